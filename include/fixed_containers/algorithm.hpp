@@ -2,6 +2,13 @@
 
 #include "fixed_containers/memory.hpp"
 
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <type_traits>
 #include <utility>
 
 namespace fixed_containers::algorithm
@@ -35,4 +42,159 @@ constexpr BidirIt2 uninitialized_relocate_backward(BidirIt1 first, BidirIt1 last
     }
     return d_last;
 }
+
+// Types whose builtin `==` is equivalent to comparing their bytes: no padding, no floating-point
+// (+0.0 == -0.0, NaN != NaN) and no user-defined comparison operators.
+template <typename T>
+concept BitwiseEqualityComparable =
+    (std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>) &&
+    std::has_unique_object_representations_v<T>;
+
+// Index of the first position where [lhs, lhs + count) and [rhs, rhs + count) differ, or `count`.
+// At run-time, bitwise comparable elements are compared a block at a time with fixed-size
+// memcmp()s, which compilers lower to vector compares.
+template <typename T>
+constexpr std::size_t mismatch_index(const T* lhs, const T* rhs, const std::size_t count)
+{
+    std::size_t i = 0;
+    if constexpr (BitwiseEqualityComparable<T>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            constexpr std::size_t BLOCK_SIZE = std::max<std::size_t>(64 / sizeof(T), 1);
+            while (i + BLOCK_SIZE <= count &&
+                   std::memcmp(lhs + i, rhs + i, BLOCK_SIZE * sizeof(T)) == 0)
+            {
+                i += BLOCK_SIZE;
+            }
+        }
+    }
+    while (i < count && lhs[i] == rhs[i])
+    {
+        ++i;
+    }
+    return i;
+}
+
+// Index of the first element of [first, first + count) that is equal to `value`, or `count`.
+// Bitwise comparable elements are first compared a block of 32 bytes at a time, without branching
+// inside the block, which compilers lower to vector compares. The block with the match is then
+// scanned element by element.
+template <typename T>
+constexpr std::size_t find_index(const T* first, const std::size_t count, const T& value)
+{
+    std::size_t i = 0;
+    if constexpr (BitwiseEqualityComparable<T>)
+    {
+        constexpr std::size_t BLOCK_SIZE = std::max<std::size_t>(32 / sizeof(T), 1);
+        const T needle = value;
+        for (; i + BLOCK_SIZE <= count; i += BLOCK_SIZE)
+        {
+            unsigned int matches = 0;
+            for (std::size_t j = 0; j < BLOCK_SIZE; j++)
+            {
+                matches |= static_cast<unsigned int>(first[i + j] == needle);
+            }
+            if (matches != 0)
+            {
+                break;
+            }
+        }
+    }
+    while (i < count && !(first[i] == value))
+    {
+        ++i;
+    }
+    return i;
+}
+
+// Similar to https://en.cppreference.com/w/cpp/algorithm/equal
+// but on contiguous ranges, with a memcmp() fast-path for bitwise comparable elements
+template <typename T>
+constexpr bool equal(const T* lhs,
+                     const std::size_t lhs_count,
+                     const T* rhs,
+                     const std::size_t rhs_count)
+{
+    if (lhs_count != rhs_count)
+    {
+        return false;
+    }
+    if constexpr (BitwiseEqualityComparable<T>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            return lhs_count == 0 || std::memcmp(lhs, rhs, lhs_count * sizeof(T)) == 0;
+        }
+    }
+    return std::equal(lhs, lhs + lhs_count, rhs);
+}
+
+// Similar to https://en.cppreference.com/w/cpp/algorithm/lexicographical_compare_three_way
+// but on contiguous ranges. The mismatch is found with mismatch_index(), then the two differing
+// elements are ordered with `<=>`, as the byte order is not the numeric order in general.
+template <typename T>
+constexpr auto lexicographical_compare_three_way(const T* lhs,
+                                                 const std::size_t lhs_count,
+                                                 const T* rhs,
+                                                 const std::size_t rhs_count)
+{
+    if constexpr (BitwiseEqualityComparable<T>)
+    {
+        const std::size_t common_count = (std::min)(lhs_count, rhs_count);
+        const std::size_t i = mismatch_index(lhs, rhs, common_count);
+        if (i != common_count)
+        {
+            return std::compare_three_way{}(lhs[i], rhs[i]);
+        }
+        return std::compare_three_way{}(lhs_count, rhs_count);
+    }
+    else
+    {
+        return std::lexicographical_compare_three_way(
+            lhs, lhs + lhs_count, rhs, rhs + rhs_count);
+    }
+}
+
+// mismatch_index() for sequences stored as several contiguous segments, such as the two halves
+// of a ring buffer. Both sequences must have at least `count` elements.
+template <typename T, std::size_t LHS_SEGMENT_COUNT, std::size_t RHS_SEGMENT_COUNT>
+constexpr std::size_t segmented_mismatch_index(
+    const std::array<std::span<const T>, LHS_SEGMENT_COUNT>& lhs,
+    const std::array<std::span<const T>, RHS_SEGMENT_COUNT>& rhs,
+    const std::size_t count)
+{
+    std::size_t lhs_segment = 0;
+    std::size_t lhs_offset = 0;
+    std::size_t rhs_segment = 0;
+    std::size_t rhs_offset = 0;
+    std::size_t i = 0;
+    while (i < count)
+    {
+        while (lhs_offset == lhs.at(lhs_segment).size())
+        {
+            ++lhs_segment;
+            lhs_offset = 0;
+        }
+        while (rhs_offset == rhs.at(rhs_segment).size())
+        {
+            ++rhs_segment;
+            rhs_offset = 0;
+        }
+        const std::size_t run = (std::min)({lhs.at(lhs_segment).size() - lhs_offset,
+                                            rhs.at(rhs_segment).size() - rhs_offset,
+                                            count - i});
+        const std::size_t mismatch = mismatch_index(lhs.at(lhs_segment).subspan(lhs_offset).data(),
+                                                    rhs.at(rhs_segment).subspan(rhs_offset).data(),
+                                                    run);
+        i += mismatch;
+        if (mismatch != run)
+        {
+            return i;
+        }
+        lhs_offset += run;
+        rhs_offset += run;
+    }
+    return count;
+}
 }  // namespace fixed_containers::algorithm
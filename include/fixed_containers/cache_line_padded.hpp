@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+
+namespace fixed_containers
+{
+// std::hardware_destructive_interference_size is not used, as it is not available everywhere and
+// gcc warns that its value may change across compiler flags (-Winterference-size).
+inline constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+// Places each instance on its own cache line(s), to avoid false sharing between adjacent
+// instances that are written by different threads.
+template <class T, std::size_t ALIGNMENT = CACHE_LINE_SIZE>
+struct alignas(ALIGNMENT) CacheLinePadded
+{
+    T value;
+};
+}  // namespace fixed_containers
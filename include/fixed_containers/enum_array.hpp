@@ -1,5 +1,6 @@
 #pragma once
 
+#include "fixed_containers/algorithm.hpp"
 #include "fixed_containers/assert_or_abort.hpp"
 #include "fixed_containers/concepts.hpp"
 #include "fixed_containers/enum_utils.hpp"
@@ -32,6 +33,9 @@ public:
     using reverse_iterator = typename ValueArrayType::reverse_iterator;
     using const_reverse_iterator = typename ValueArrayType::const_reverse_iterator;
 
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return ENUM_COUNT; }
+
 private:
     template <std::size_t M>
     struct PairOrdinalComparator
@@ -158,11 +162,19 @@ public:
 
     constexpr bool operator==(const EnumArray<L, T>& other) const
     {
-        return values() == other.values();
+        return algorithm::equal(data(), size(), other.data(), other.size());
     }
     constexpr auto operator<=>(const EnumArray<L, T>& other) const
     {
-        return values() <=> other.values();
+        if constexpr (algorithm::BitwiseEqualityComparable<T>)
+        {
+            return algorithm::lexicographical_compare_three_way(
+                data(), size(), other.data(), other.size());
+        }
+        else
+        {
+            return values() <=> other.values();
+        }
     }
 
 private:
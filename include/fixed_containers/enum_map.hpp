@@ -20,6 +20,7 @@
 #include <initializer_list>
 #include <memory>
 #include <type_traits>
+#include <utility>
 
 namespace fixed_containers::customize
 {
@@ -1062,6 +1063,55 @@ constexpr typename EnumMap<K, V, CheckingType>::size_type erase_if(EnumMap<K, V,
 
 }  // namespace fixed_containers
 
+namespace fixed_containers::enum_map_detail
+{
+template <class K, class Visitor, class Signature>
+struct EnumFunctionMapEntries;
+
+template <class K, class Visitor, class R, class... Args>
+struct EnumFunctionMapEntries<K, Visitor, R(Args...)>
+{
+    template <std::size_t ORDINAL>
+    static constexpr bool IS_INVOCABLE =
+        std::is_invocable_r_v<R, const Visitor&, rich_enums::EnumConstant<K, ORDINAL>, Args...>;
+
+    template <std::size_t ORDINAL>
+    static constexpr R invoke(Args... args)
+    {
+        return Visitor{}(rich_enums::EnumConstant<K, ORDINAL>{}, std::forward<Args>(args)...);
+    }
+};
+}  // namespace fixed_containers::enum_map_detail
+
+namespace fixed_containers
+{
+/**
+ * EnumMap from every value of `K` to a function pointer that invokes a `Visitor` with the value's
+ * EnumConstant, followed by the call's arguments. This is a dispatch table that can be stored,
+ * passed around and have individual entries replaced. `Visitor` must be stateless (e.g. a
+ * captureless lambda), as each function default-constructs it.
+ *
+ * Fails to compile unless `Visitor` handles every value.
+ */
+template <class K, class Signature, class Visitor>
+    requires(std::is_function_v<Signature> && std::is_empty_v<Visitor> &&
+             std::is_default_constructible_v<Visitor>)
+[[nodiscard]] constexpr EnumMap<K, Signature*> make_enum_function_map(const Visitor& /*visitor*/)
+{
+    using Adapter = rich_enums::EnumAdapter<K>;
+    using Entries = enum_map_detail::EnumFunctionMapEntries<K, Visitor, Signature>;
+    return [&]<std::size_t... ORDINALS>(std::index_sequence<ORDINALS...>)
+    {
+        static_assert((Entries::template IS_INVOCABLE<ORDINALS> && ...),
+                      "The visitor must handle every enum value with the given signature.");
+        EnumMap<K, Signature*> out{};
+        (out.try_emplace(Adapter::values()[ORDINALS], &Entries::template invoke<ORDINALS>), ...);
+        return out;
+    }(std::make_index_sequence<Adapter::count()>{});
+}
+
+}  // namespace fixed_containers
+
 // Specializations
 namespace std
 {
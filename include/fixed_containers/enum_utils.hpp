@@ -11,6 +11,7 @@
 #include <optional>
 #include <string_view>
 #include <type_traits>
+#include <utility>
 
 namespace fixed_containers::rich_enums_detail
 {
@@ -633,3 +634,76 @@ protected:
 };
 
 }  // namespace fixed_containers::rich_enums
+
+namespace fixed_containers::rich_enums
+{
+/**
+ * The enum value with the given ordinal, as a type. `visit()` passes these to visitors, so
+ * overloads can select on individual values by type, e.g. `[](EnumConstantOf<Color::RED>) {}`, and
+ * generic overloads can use `value()` in `if constexpr`.
+ */
+template <has_enum_adapter EnumType, std::size_t ORDINAL>
+    requires(ORDINAL < EnumAdapter<EnumType>::count())
+struct EnumConstant
+{
+    using Enum = EnumType;
+
+    [[nodiscard]] static constexpr std::size_t ordinal() { return ORDINAL; }
+    [[nodiscard]] static constexpr const EnumType& value()
+    {
+        return EnumAdapter<EnumType>::values()[ORDINAL];
+    }
+    explicit(false) constexpr operator const EnumType&() const { return value(); }
+};
+
+template <auto VALUE>
+using EnumConstantOf =
+    EnumConstant<std::remove_cvref_t<decltype(VALUE)>,
+                 EnumAdapter<std::remove_cvref_t<decltype(VALUE)>>::ordinal(VALUE)>;
+}  // namespace fixed_containers::rich_enums
+
+namespace fixed_containers::rich_enums_detail
+{
+template <class EnumType, class Visitor, class Result, std::size_t... ORDINALS>
+inline constexpr std::array<Result (*)(Visitor&&), sizeof...(ORDINALS)> VISIT_TABLE{
+    [](Visitor&& visitor) -> Result
+    {
+        return std::invoke(std::forward<Visitor>(visitor),
+                           rich_enums::EnumConstant<EnumType, ORDINALS>{});
+    }...,
+};
+}  // namespace fixed_containers::rich_enums_detail
+
+namespace fixed_containers::rich_enums
+{
+/**
+ * Invokes `visitor` with the EnumConstant of `value`, through a table of function pointers indexed
+ * by ordinal. Dispatch is a single indirect call regardless of the number of enum values, without
+ * relying on the optimizer to turn a `switch` or `if` chain into a jump table.
+ *
+ * Fails to compile unless `visitor` handles every value, with the same return type for all.
+ */
+template <has_enum_adapter EnumType, class Visitor>
+    requires(EnumAdapter<EnumType>::count() > 0)
+constexpr decltype(auto) visit(const EnumType& value, Visitor&& visitor)
+{
+    using Adapter = EnumAdapter<EnumType>;
+    return [&]<std::size_t... ORDINALS>(std::index_sequence<ORDINALS...>) -> decltype(auto)
+    {
+        static_assert((std::is_invocable_v<Visitor&&, EnumConstant<EnumType, ORDINALS>> && ...),
+                      "The visitor must handle every enum value.");
+        using Result = std::invoke_result_t<Visitor&&, EnumConstant<EnumType, 0>>;
+        static_assert(
+            (std::is_same_v<Result,
+                            std::invoke_result_t<Visitor&&, EnumConstant<EnumType, ORDINALS>>> &&
+             ...),
+            "The visitor must return the same type for every enum value.");
+
+        const std::size_t ordinal = Adapter::ordinal(value);
+        assert_or_abort(ordinal < Adapter::count());
+        return rich_enums_detail::VISIT_TABLE<EnumType, Visitor, Result, ORDINALS...>[ordinal](
+            std::forward<Visitor>(visitor));
+    }(std::make_index_sequence<Adapter::count()>{});
+}
+
+}  // namespace fixed_containers::rich_enums
@@ -0,0 +1,507 @@
+#pragma once
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/bidirectional_iterator.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_index_based_storage.hpp"
+#include "fixed_containers/fixed_red_black_tree.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/iterator_utils.hpp"
+#include "fixed_containers/string_key_arena.hpp"
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers::fixed_arena_string_map_detail
+{
+using string_key_arena_detail::ArenaSpan;
+
+// Lookups carry the arena along, so that the comparator can be stateless.
+struct LookupKey
+{
+    std::string_view text;
+    const char* arena;
+};
+
+struct KeyCompare
+{
+    using is_transparent = void;
+
+    constexpr bool operator()(const LookupKey& lhs, const ArenaSpan& rhs) const
+    {
+        return lhs.text < std::string_view{lhs.arena + rhs.offset, rhs.length};
+    }
+    constexpr bool operator()(const ArenaSpan& lhs, const LookupKey& rhs) const
+    {
+        return std::string_view{rhs.arena + lhs.offset, lhs.length} < rhs.text;
+    }
+    // Two stored keys can't be ordered without the arena. The tree only needs this to copy or move
+    // non-trivially-copyable contents, and the map does that itself (by re-inserting each entry).
+    constexpr bool operator()(const ArenaSpan& /*lhs*/, const ArenaSpan& /*rhs*/) const
+    {
+        assert_or_abort(false);
+        return false;
+    }
+};
+}  // namespace fixed_containers::fixed_arena_string_map_detail
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity ordered map from strings to V, for keys of varying length.
+ *
+ * The characters of all keys share one inline arena of MAXIMUM_KEY_BYTE_COUNT bytes, and each
+ * red-black tree node stores an (offset, length) pair instead of a FixedString sized for the
+ * longest key. Lookups take std::string_view. Iteration is in lexicographical key order.
+ *
+ * Erasing a key releases its characters; they are reclaimed by compacting the arena when an
+ * insertion would otherwise not fit (or by calling compact() directly). Compaction invalidates
+ * the string_views previously returned by iterators, but not the iterators themselves.
+ */
+template <typename V, std::size_t MAXIMUM_SIZE, std::size_t MAXIMUM_KEY_BYTE_COUNT>
+class FixedArenaStringMap
+{
+    using ArenaSpan = string_key_arena_detail::ArenaSpan;
+    using LookupKey = fixed_arena_string_map_detail::LookupKey;
+    using NodeIndex = fixed_red_black_tree_detail::NodeIndex;
+    using NodeIndexAndParentIndex = fixed_red_black_tree_detail::NodeIndexAndParentIndex;
+    static constexpr NodeIndex NULL_INDEX = fixed_red_black_tree_detail::NULL_INDEX;
+    using Tree = fixed_red_black_tree_detail::FixedRedBlackTree<
+        ArenaSpan,
+        V,
+        MAXIMUM_SIZE,
+        fixed_arena_string_map_detail::KeyCompare,
+        fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+        FixedIndexBasedPoolStorage>;
+    using Arena = string_key_arena_detail::StringKeyArena<MAXIMUM_KEY_BYTE_COUNT>;
+
+public:
+    using key_type = std::string_view;
+    using mapped_type = V;
+    using value_type = std::pair<const std::string_view, V>;
+    using reference = std::pair<std::string_view, V&>;
+    using const_reference = std::pair<std::string_view, const V&>;
+
+private:
+    template <bool IS_CONST>
+    class PairProvider
+    {
+        friend class PairProvider<!IS_CONST>;
+        friend class FixedArenaStringMap;
+        using ConstOrMutableMap =
+            std::conditional_t<IS_CONST, const FixedArenaStringMap, FixedArenaStringMap>;
+
+    private:
+        ConstOrMutableMap* map_;
+        NodeIndex current_index_;
+
+    public:
+        constexpr PairProvider() noexcept
+          : PairProvider{nullptr, MAXIMUM_SIZE}
+        {
+        }
+
+        constexpr PairProvider(ConstOrMutableMap* const map,
+                               const NodeIndex& current_index) noexcept
+          : map_{map}
+          , current_index_{current_index}
+        {
+        }
+
+        constexpr PairProvider(const PairProvider&) = default;
+        constexpr PairProvider(PairProvider&&) noexcept = default;
+        constexpr PairProvider& operator=(const PairProvider&) = default;
+        constexpr PairProvider& operator=(PairProvider&&) noexcept = default;
+
+        // https://github.com/llvm/llvm-project/issues/62555
+        template <bool IS_CONST_2>
+        constexpr PairProvider(const PairProvider<IS_CONST_2>& m) noexcept
+            requires(IS_CONST and !IS_CONST_2)
+          : PairProvider{m.map_, m.current_index_}
+        {
+        }
+
+        constexpr void advance() noexcept
+        {
+            if (current_index_ == NULL_INDEX)
+            {
+                current_index_ = map_->tree_.index_of_min_at();
+            }
+            else
+            {
+                current_index_ = map_->tree_.index_of_successor_at(current_index_);
+                current_index_ = replace_null_index_with_max_size_for_end_iterator(current_index_);
+            }
+        }
+        constexpr void recede() noexcept
+        {
+            if (current_index_ == MAXIMUM_SIZE)
+            {
+                current_index_ = map_->tree_.index_of_max_at();
+            }
+            else
+            {
+                current_index_ = map_->tree_.index_of_predecessor_at(current_index_);
+            }
+        }
+
+        constexpr std::conditional_t<IS_CONST, const_reference, reference> get() const noexcept
+        {
+            auto node = map_->tree_.node_at(current_index_);
+            return {map_->arena_.view(node.key()), node.value()};
+        }
+
+        template <bool IS_CONST2>
+        constexpr bool operator==(const PairProvider<IS_CONST2>& other) const noexcept
+        {
+            return map_ == other.map_ && current_index_ == other.current_index_;
+        }
+    };
+
+    template <IteratorConstness CONSTNESS, IteratorDirection DIRECTION>
+    using Iterator =
+        BidirectionalIterator<PairProvider<true>, PairProvider<false>, CONSTNESS, DIRECTION>;
+
+    // The tree returns NULL_INDEX when an index is not available.
+    // For the purposes of iterators, use NULL_INDEX for rend() and
+    // MAXIMUM_SIZE for end()
+    static constexpr NodeIndex replace_null_index_with_max_size_for_end_iterator(
+        const NodeIndex& i) noexcept
+    {
+        return i == NULL_INDEX ? MAXIMUM_SIZE : i;
+    }
+
+public:
+    using const_iterator =
+        Iterator<IteratorConstness::CONSTANT_ITERATOR, IteratorDirection::FORWARD>;
+    using iterator = Iterator<IteratorConstness::MUTABLE_ITERATOR, IteratorDirection::FORWARD>;
+    using const_reverse_iterator =
+        Iterator<IteratorConstness::CONSTANT_ITERATOR, IteratorDirection::REVERSE>;
+    using reverse_iterator =
+        Iterator<IteratorConstness::MUTABLE_ITERATOR, IteratorDirection::REVERSE>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+    [[nodiscard]] static constexpr std::size_t static_max_key_byte_count() noexcept
+    {
+        return MAXIMUM_KEY_BYTE_COUNT;
+    }
+
+private:
+    Tree tree_;
+    Arena arena_;
+
+public:
+    constexpr FixedArenaStringMap() noexcept
+      : tree_{}
+      , arena_{}
+    {
+    }
+
+    constexpr FixedArenaStringMap(
+        std::initializer_list<std::pair<std::string_view, V>> list) noexcept
+      : FixedArenaStringMap()
+    {
+        for (const std::pair<std::string_view, V>& entry : list)
+        {
+            try_emplace(entry.first, entry.second);
+        }
+    }
+
+    constexpr FixedArenaStringMap(const FixedArenaStringMap& other)
+        requires TriviallyCopyConstructible<V>
+    = default;
+    constexpr FixedArenaStringMap(FixedArenaStringMap&& other) noexcept
+        requires TriviallyMoveConstructible<V>
+    = default;
+    constexpr FixedArenaStringMap& operator=(const FixedArenaStringMap& other)
+        requires TriviallyCopyAssignable<V>
+    = default;
+    constexpr FixedArenaStringMap& operator=(FixedArenaStringMap&& other) noexcept
+        requires TriviallyMoveAssignable<V>
+    = default;
+
+    // The tree would copy non-trivially-copyable contents by re-inserting every node, comparing
+    // stored keys without the arena. Re-insert the entries here instead, which also compacts the
+    // keys of the copy.
+    constexpr FixedArenaStringMap(const FixedArenaStringMap& other)
+      : FixedArenaStringMap()
+    {
+        insert_all_from(other);
+    }
+    constexpr FixedArenaStringMap(FixedArenaStringMap&& other) noexcept
+      : FixedArenaStringMap()
+    {
+        insert_all_from(std::move(other));
+    }
+    constexpr FixedArenaStringMap& operator=(const FixedArenaStringMap& other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        clear();
+        insert_all_from(other);
+        return *this;
+    }
+    constexpr FixedArenaStringMap& operator=(FixedArenaStringMap&& other) noexcept
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        clear();
+        insert_all_from(std::move(other));
+        return *this;
+    }
+
+public:
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return MAXIMUM_SIZE; }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return tree_.size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return tree_.empty(); }
+
+    [[nodiscard]] constexpr std::size_t max_key_byte_count() const noexcept
+    {
+        return MAXIMUM_KEY_BYTE_COUNT;
+    }
+    // Total length of the keys currently in the map
+    [[nodiscard]] constexpr std::size_t key_byte_count() const noexcept
+    {
+        return arena_.live_byte_count();
+    }
+
+    constexpr const_iterator cbegin() const noexcept
+    {
+        return create_const_iterator(tree_.index_of_min_at());
+    }
+    constexpr const_iterator cend() const noexcept { return create_const_iterator(MAXIMUM_SIZE); }
+    constexpr const_iterator begin() const noexcept { return cbegin(); }
+    constexpr iterator begin() noexcept { return create_iterator(tree_.index_of_min_at()); }
+    constexpr const_iterator end() const noexcept { return cend(); }
+    constexpr iterator end() noexcept { return create_iterator(MAXIMUM_SIZE); }
+
+    constexpr reverse_iterator rbegin() noexcept
+    {
+        return reverse_iterator{PairProvider<false>{this, MAXIMUM_SIZE}};
+    }
+    constexpr const_reverse_iterator rbegin() const noexcept { return crbegin(); }
+    constexpr const_reverse_iterator crbegin() const noexcept
+    {
+        return const_reverse_iterator{PairProvider<true>{this, MAXIMUM_SIZE}};
+    }
+    constexpr reverse_iterator rend() noexcept
+    {
+        return reverse_iterator{PairProvider<false>{this, tree_.index_of_min_at()}};
+    }
+    constexpr const_reverse_iterator rend() const noexcept { return crend(); }
+    constexpr const_reverse_iterator crend() const noexcept
+    {
+        return const_reverse_iterator{PairProvider<true>{this, tree_.index_of_min_at()}};
+    }
+
+    [[nodiscard]] constexpr V& at(const std::string_view key) noexcept
+    {
+        const NodeIndex i = tree_.index_of_node_or_null(lookup_key_of(key));
+        assert_or_abort(tree_.contains_at(i));
+        return tree_.node_at(i).value();
+    }
+    [[nodiscard]] constexpr const V& at(const std::string_view key) const noexcept
+    {
+        const NodeIndex i = tree_.index_of_node_or_null(lookup_key_of(key));
+        assert_or_abort(tree_.contains_at(i));
+        return tree_.node_at(i).value();
+    }
+
+    constexpr V& operator[](const std::string_view key) noexcept
+    {
+        return (*try_emplace(key).first).second;
+    }
+
+    template <class... Args>
+    constexpr std::pair<iterator, bool> try_emplace(const std::string_view key,
+                                                    Args&&... args) noexcept
+    {
+        NodeIndexAndParentIndex np = tree_.index_of_node_with_parent(lookup_key_of(key));
+        if (tree_.contains_at(np.i))
+        {
+            return {create_iterator(np.i), false};
+        }
+
+        assert_or_abort(!tree_.full());
+        reserve_key_bytes(key.size());
+        // Compaction only moves characters, so `np` is still the insertion point.
+        tree_.insert_new_at(np, arena_.append(key), std::forward<Args>(args)...);
+        return {create_iterator(np.i), true};
+    }
+
+    template <class M>
+    constexpr std::pair<iterator, bool> insert_or_assign(const std::string_view key,
+                                                         M&& obj) noexcept
+        requires std::is_assignable_v<V&, M&&>
+    {
+        NodeIndexAndParentIndex np = tree_.index_of_node_with_parent(lookup_key_of(key));
+        if (tree_.contains_at(np.i))
+        {
+            tree_.node_at(np.i).value() = std::forward<M>(obj);
+            return {create_iterator(np.i), false};
+        }
+
+        assert_or_abort(!tree_.full());
+        reserve_key_bytes(key.size());
+        tree_.insert_new_at(np, arena_.append(key), std::forward<M>(obj));
+        return {create_iterator(np.i), true};
+    }
+
+    constexpr iterator erase(const_iterator pos) noexcept
+    {
+        assert_or_abort(pos != cend());
+        const NodeIndex i = pos.template private_reference_provider<PairProvider<true>>()
+                                .current_index_;
+        return create_iterator(erase_at(i));
+    }
+    constexpr iterator erase(iterator pos) noexcept { return erase(const_iterator{pos}); }
+
+    constexpr size_type erase(const std::string_view key) noexcept
+    {
+        const NodeIndex i = tree_.index_of_node_or_null(lookup_key_of(key));
+        if (!tree_.contains_at(i))
+        {
+            return 0;
+        }
+        erase_at(i);
+        return 1;
+    }
+
+    constexpr void clear() noexcept
+    {
+        for (NodeIndex i = tree_.index_of_min_at(); i != NULL_INDEX;)
+        {
+            i = tree_.delete_at_and_return_successor(i);
+        }
+        arena_.clear();
+    }
+
+    [[nodiscard]] constexpr iterator find(const std::string_view key) noexcept
+    {
+        const NodeIndex i = tree_.index_of_node_or_null(lookup_key_of(key));
+        return tree_.contains_at(i) ? create_iterator(i) : end();
+    }
+    [[nodiscard]] constexpr const_iterator find(const std::string_view key) const noexcept
+    {
+        const NodeIndex i = tree_.index_of_node_or_null(lookup_key_of(key));
+        return tree_.contains_at(i) ? create_const_iterator(i) : cend();
+    }
+
+    [[nodiscard]] constexpr bool contains(const std::string_view key) const noexcept
+    {
+        return tree_.contains_node(lookup_key_of(key));
+    }
+    [[nodiscard]] constexpr std::size_t count(const std::string_view key) const noexcept
+    {
+        return static_cast<std::size_t>(contains(key));
+    }
+
+    [[nodiscard]] constexpr iterator lower_bound(const std::string_view key) noexcept
+    {
+        const NodeIndexAndParentIndex np = tree_.index_of_node_with_parent(lookup_key_of(key));
+        return create_iterator(tree_.index_of_node_ceiling(np));
+    }
+    [[nodiscard]] constexpr const_iterator lower_bound(const std::string_view key) const noexcept
+    {
+        const NodeIndexAndParentIndex np = tree_.index_of_node_with_parent(lookup_key_of(key));
+        return create_const_iterator(tree_.index_of_node_ceiling(np));
+    }
+    [[nodiscard]] constexpr iterator upper_bound(const std::string_view key) noexcept
+    {
+        const NodeIndexAndParentIndex np = tree_.index_of_node_with_parent(lookup_key_of(key));
+        return create_iterator(tree_.index_of_node_higher(np));
+    }
+    [[nodiscard]] constexpr const_iterator upper_bound(const std::string_view key) const noexcept
+    {
+        const NodeIndexAndParentIndex np = tree_.index_of_node_with_parent(lookup_key_of(key));
+        return create_const_iterator(tree_.index_of_node_higher(np));
+    }
+
+    // Reclaims the characters of erased keys.
+    constexpr void compact() noexcept
+    {
+        FixedVector<ArenaSpan*, MAXIMUM_SIZE> live_spans{};
+        for (NodeIndex i = tree_.index_of_min_at(); i != NULL_INDEX;
+             i = tree_.index_of_successor_at(i))
+        {
+            // Compaction preserves the characters, and therefore the order, of every key.
+            live_spans.push_back(&tree_.node_at(i).key());
+        }
+        arena_.compact(live_spans);
+    }
+
+private:
+    template <typename Map>
+    constexpr void insert_all_from(Map&& other) noexcept
+    {
+        for (NodeIndex i = other.tree_.index_of_min_at(); i != NULL_INDEX;
+             i = other.tree_.index_of_successor_at(i))
+        {
+            auto node = other.tree_.node_at(i);
+            if constexpr (std::is_lvalue_reference_v<Map>)
+            {
+                try_emplace(other.arena_.view(node.key()), node.value());
+            }
+            else
+            {
+                try_emplace(other.arena_.view(node.key()), std::move(node.value()));
+            }
+        }
+    }
+
+    [[nodiscard]] constexpr LookupKey lookup_key_of(const std::string_view key) const
+    {
+        return {key, arena_.data()};
+    }
+
+    constexpr void reserve_key_bytes(const std::size_t length) noexcept
+    {
+        if (arena_.can_append(length))
+        {
+            return;
+        }
+        assert_or_abort(arena_.can_append_after_compaction(length));
+        compact();
+    }
+
+    constexpr NodeIndex erase_at(const NodeIndex& i) noexcept
+    {
+        const ArenaSpan stored_key = tree_.node_at(i).key();
+        const NodeIndex successor = tree_.delete_at_and_return_successor(i);
+        if (empty())
+        {
+            arena_.clear();
+        }
+        else
+        {
+            arena_.release(stored_key);
+        }
+        return successor;
+    }
+
+    constexpr iterator create_iterator(const NodeIndex& start_index) noexcept
+    {
+        const NodeIndex i = replace_null_index_with_max_size_for_end_iterator(start_index);
+        return iterator{PairProvider<false>{this, i}};
+    }
+    constexpr const_iterator create_const_iterator(const NodeIndex& start_index) const noexcept
+    {
+        const NodeIndex i = replace_null_index_with_max_size_for_end_iterator(start_index);
+        return const_iterator{PairProvider<true>{this, i}};
+    }
+};
+
+}  // namespace fixed_containers
@@ -0,0 +1,388 @@
+#pragma once
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/fixed_robinhood_hashtable.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/forward_iterator.hpp"
+#include "fixed_containers/iterator_utils.hpp"
+#include "fixed_containers/string_key_arena.hpp"
+#include "fixed_containers/wyhash.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers::fixed_arena_string_unordered_map_detail
+{
+using string_key_arena_detail::ArenaSpan;
+
+// The stored key. The hash is cached so neither lookups nor compaction ever rehash a stored key.
+struct HashedArenaSpan
+{
+    ArenaSpan span;
+    std::uint64_t hash;
+};
+
+// Lookups carry the arena along, so that Hash and KeyEqual can be stateless.
+struct LookupKey
+{
+    std::string_view text;
+    std::uint64_t hash;
+    const char* arena;
+};
+
+struct KeyHash
+{
+    constexpr std::uint64_t operator()(const LookupKey& key) const { return key.hash; }
+    constexpr std::uint64_t operator()(const HashedArenaSpan& key) const { return key.hash; }
+};
+
+struct KeyEqual
+{
+    constexpr bool operator()(const LookupKey& lhs, const HashedArenaSpan& rhs) const
+    {
+        return lhs.hash == rhs.hash &&
+               lhs.text == std::string_view{lhs.arena + rhs.span.offset, rhs.span.length};
+    }
+    // Stored keys are unique and each owns its characters, so they are equal only to themselves.
+    constexpr bool operator()(const HashedArenaSpan& lhs, const HashedArenaSpan& rhs) const
+    {
+        return lhs.span.offset == rhs.span.offset && lhs.span.length == rhs.span.length;
+    }
+};
+}  // namespace fixed_containers::fixed_arena_string_unordered_map_detail
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity hash map from strings to V, for keys of varying length.
+ *
+ * Keying a FixedUnorderedMap by FixedString<N> sizes every key for the longest one. Here, the
+ * characters of all keys share one inline arena of MAXIMUM_KEY_BYTE_COUNT bytes, and each entry
+ * stores an (offset, length, hash) triple instead. Lookups take std::string_view.
+ *
+ * Erasing a key releases its characters; they are reclaimed by compacting the arena when an
+ * insertion would otherwise not fit (or by calling compact() directly). Compaction invalidates
+ * the string_views previously returned by iterators, but not the iterators themselves.
+ */
+template <typename V,
+          std::size_t MAXIMUM_SIZE,
+          std::size_t MAXIMUM_KEY_BYTE_COUNT,
+          std::size_t BUCKET_COUNT =
+              fixed_robinhood_hashtable_detail::default_bucket_count(MAXIMUM_SIZE)>
+class FixedArenaStringUnorderedMap
+{
+    using HashedArenaSpan = fixed_arena_string_unordered_map_detail::HashedArenaSpan;
+    using LookupKey = fixed_arena_string_unordered_map_detail::LookupKey;
+    using Table = fixed_robinhood_hashtable_detail::FixedRobinhoodHashtable<
+        HashedArenaSpan,
+        V,
+        MAXIMUM_SIZE,
+        BUCKET_COUNT,
+        fixed_arena_string_unordered_map_detail::KeyHash,
+        fixed_arena_string_unordered_map_detail::KeyEqual>;
+    using Arena = string_key_arena_detail::StringKeyArena<MAXIMUM_KEY_BYTE_COUNT>;
+    using TableIndex = typename Table::OpaqueIndexType;
+    using TableIteratedIndex = typename Table::OpaqueIteratedType;
+
+public:
+    using key_type = std::string_view;
+    using mapped_type = V;
+    using value_type = std::pair<const std::string_view, V>;
+    using reference = std::pair<std::string_view, V&>;
+    using const_reference = std::pair<std::string_view, const V&>;
+
+private:
+    template <bool IS_CONST>
+    class PairProvider
+    {
+        friend class PairProvider<!IS_CONST>;
+        friend class FixedArenaStringUnorderedMap;
+        using ConstOrMutableMap = std::conditional_t<IS_CONST,
+                                                     const FixedArenaStringUnorderedMap,
+                                                     FixedArenaStringUnorderedMap>;
+
+    private:
+        ConstOrMutableMap* map_;
+        TableIteratedIndex current_index_;
+
+        constexpr PairProvider(ConstOrMutableMap* const map, const TableIteratedIndex& index)
+          : map_(map)
+          , current_index_(index)
+        {
+        }
+
+    public:
+        constexpr PairProvider() noexcept
+          : map_(nullptr)
+          , current_index_(Table::invalid_index())
+        {
+        }
+
+        constexpr PairProvider(const PairProvider&) = default;
+        constexpr PairProvider(PairProvider&&) noexcept = default;
+        constexpr PairProvider& operator=(const PairProvider&) = default;
+        constexpr PairProvider& operator=(PairProvider&&) noexcept = default;
+
+        // https://github.com/llvm/llvm-project/issues/62555
+        template <bool IS_CONST_2>
+        constexpr PairProvider(const PairProvider<IS_CONST_2>& m) noexcept
+            requires(IS_CONST and !IS_CONST_2)
+          : PairProvider{m.map_, m.current_index_}
+        {
+        }
+
+        constexpr void advance() noexcept
+        {
+            current_index_ = map_->table_.next_of(current_index_);
+        }
+
+        constexpr std::conditional_t<IS_CONST, const_reference, reference> get() const noexcept
+        {
+            return {map_->arena_.view(map_->table_.key_at(current_index_).span),
+                    map_->table_.value_at(current_index_)};
+        }
+
+        template <bool IS_CONST2>
+        constexpr bool operator==(const PairProvider<IS_CONST2>& other) const noexcept
+        {
+            return map_ == other.map_ && current_index_ == other.current_index_;
+        }
+    };
+
+    template <IteratorConstness CONSTNESS>
+    using Iterator = ForwardIterator<PairProvider<true>, PairProvider<false>, CONSTNESS>;
+
+public:
+    using const_iterator = Iterator<IteratorConstness::CONSTANT_ITERATOR>;
+    using iterator = Iterator<IteratorConstness::MUTABLE_ITERATOR>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+    [[nodiscard]] static constexpr std::size_t static_max_key_byte_count() noexcept
+    {
+        return MAXIMUM_KEY_BYTE_COUNT;
+    }
+
+private:
+    Table table_;
+    Arena arena_;
+
+public:
+    constexpr FixedArenaStringUnorderedMap() noexcept
+      : table_{}
+      , arena_{}
+    {
+    }
+
+    constexpr FixedArenaStringUnorderedMap(
+        std::initializer_list<std::pair<std::string_view, V>> list) noexcept
+      : FixedArenaStringUnorderedMap()
+    {
+        for (const std::pair<std::string_view, V>& entry : list)
+        {
+            try_emplace(entry.first, entry.second);
+        }
+    }
+
+public:
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return MAXIMUM_SIZE; }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return table_.size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+
+    [[nodiscard]] constexpr std::size_t max_key_byte_count() const noexcept
+    {
+        return MAXIMUM_KEY_BYTE_COUNT;
+    }
+    // Total length of the keys currently in the map
+    [[nodiscard]] constexpr std::size_t key_byte_count() const noexcept
+    {
+        return arena_.live_byte_count();
+    }
+
+    constexpr const_iterator cbegin() const noexcept
+    {
+        return const_iterator{PairProvider<true>{this, table_.begin_index()}};
+    }
+    constexpr const_iterator cend() const noexcept
+    {
+        return const_iterator{PairProvider<true>{this, table_.end_index()}};
+    }
+    constexpr const_iterator begin() const noexcept { return cbegin(); }
+    constexpr iterator begin() noexcept
+    {
+        return iterator{PairProvider<false>{this, table_.begin_index()}};
+    }
+    constexpr const_iterator end() const noexcept { return cend(); }
+    constexpr iterator end() noexcept
+    {
+        return iterator{PairProvider<false>{this, table_.end_index()}};
+    }
+
+    [[nodiscard]] constexpr V& at(const std::string_view key) noexcept
+    {
+        const TableIndex i = table_.opaque_index_of(lookup_key_of(key));
+        assert_or_abort(table_.exists(i));
+        return table_.value(i);
+    }
+    [[nodiscard]] constexpr const V& at(const std::string_view key) const noexcept
+    {
+        const TableIndex i = table_.opaque_index_of(lookup_key_of(key));
+        assert_or_abort(table_.exists(i));
+        return table_.value(i);
+    }
+
+    constexpr V& operator[](const std::string_view key) noexcept
+    {
+        return (*try_emplace(key).first).second;
+    }
+
+    template <class... Args>
+    constexpr std::pair<iterator, bool> try_emplace(const std::string_view key,
+                                                    Args&&... args) noexcept
+    {
+        const LookupKey lookup_key = lookup_key_of(key);
+        TableIndex i = table_.opaque_index_of(lookup_key);
+        if (table_.exists(i))
+        {
+            return {create_iterator(i), false};
+        }
+
+        assert_or_abort(size() < MAXIMUM_SIZE);
+        reserve_key_bytes(key.size());
+        // Compaction only moves characters, so `i` is still the insertion point.
+        i = table_.emplace(
+            i, HashedArenaSpan{arena_.append(key), lookup_key.hash}, std::forward<Args>(args)...);
+        return {create_iterator(i), true};
+    }
+
+    template <class M>
+    constexpr std::pair<iterator, bool> insert_or_assign(const std::string_view key,
+                                                         M&& obj) noexcept
+        requires std::is_assignable_v<V&, M&&>
+    {
+        const LookupKey lookup_key = lookup_key_of(key);
+        TableIndex i = table_.opaque_index_of(lookup_key);
+        if (table_.exists(i))
+        {
+            table_.value(i) = std::forward<M>(obj);
+            return {create_iterator(i), false};
+        }
+
+        assert_or_abort(size() < MAXIMUM_SIZE);
+        reserve_key_bytes(key.size());
+        i = table_.emplace(
+            i, HashedArenaSpan{arena_.append(key), lookup_key.hash}, std::forward<M>(obj));
+        return {create_iterator(i), true};
+    }
+
+    constexpr iterator erase(const_iterator pos) noexcept
+    {
+        assert_or_abort(pos != cend());
+        const TableIteratedIndex iterated_index = iterated_index_of(pos);
+        const HashedArenaSpan stored_key = table_.key_at(iterated_index);
+        const TableIteratedIndex next = table_.erase(table_.opaque_index_of(stored_key));
+        release_key_bytes(stored_key);
+        return iterator{PairProvider<false>{this, next}};
+    }
+    constexpr iterator erase(iterator pos) noexcept { return erase(const_iterator{pos}); }
+
+    constexpr size_type erase(const std::string_view key) noexcept
+    {
+        const TableIndex i = table_.opaque_index_of(lookup_key_of(key));
+        if (!table_.exists(i))
+        {
+            return 0;
+        }
+        const HashedArenaSpan stored_key = table_.key_at(table_.iterated_index_from(i));
+        table_.erase(i);
+        release_key_bytes(stored_key);
+        return 1;
+    }
+
+    constexpr void clear() noexcept
+    {
+        table_.clear();
+        arena_.clear();
+    }
+
+    [[nodiscard]] constexpr iterator find(const std::string_view key) noexcept
+    {
+        const TableIndex i = table_.opaque_index_of(lookup_key_of(key));
+        return table_.exists(i) ? create_iterator(i) : end();
+    }
+    [[nodiscard]] constexpr const_iterator find(const std::string_view key) const noexcept
+    {
+        const TableIndex i = table_.opaque_index_of(lookup_key_of(key));
+        return table_.exists(i)
+                   ? const_iterator{PairProvider<true>{this, table_.iterated_index_from(i)}}
+                   : cend();
+    }
+
+    [[nodiscard]] constexpr bool contains(const std::string_view key) const noexcept
+    {
+        return table_.exists(table_.opaque_index_of(lookup_key_of(key)));
+    }
+    [[nodiscard]] constexpr std::size_t count(const std::string_view key) const noexcept
+    {
+        return static_cast<std::size_t>(contains(key));
+    }
+
+    // Reclaims the characters of erased keys.
+    constexpr void compact() noexcept
+    {
+        FixedVector<string_key_arena_detail::ArenaSpan*, MAXIMUM_SIZE> live_spans{};
+        for (TableIteratedIndex i = table_.begin_index(); i != table_.end_index();
+             i = table_.next_of(i))
+        {
+            // Offsets are neither hashed nor compared, so they can be updated in place.
+            live_spans.push_back(
+                &table_.IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.at(i).key().span);
+        }
+        arena_.compact(live_spans);
+    }
+
+private:
+    [[nodiscard]] constexpr LookupKey lookup_key_of(const std::string_view key) const
+    {
+        return {key, wyhash::hash<std::string_view>{}(key), arena_.data()};
+    }
+
+    constexpr void reserve_key_bytes(const std::size_t length) noexcept
+    {
+        if (arena_.can_append(length))
+        {
+            return;
+        }
+        assert_or_abort(arena_.can_append_after_compaction(length));
+        compact();
+    }
+
+    constexpr void release_key_bytes(const HashedArenaSpan& stored_key) noexcept
+    {
+        if (empty())
+        {
+            arena_.clear();
+            return;
+        }
+        arena_.release(stored_key.span);
+    }
+
+    constexpr iterator create_iterator(const TableIndex& i) noexcept
+    {
+        return iterator{PairProvider<false>{this, table_.iterated_index_from(i)}};
+    }
+
+    [[nodiscard]] static constexpr TableIteratedIndex iterated_index_of(const const_iterator& it)
+    {
+        return it.template private_reference_provider<PairProvider<true>>().current_index_;
+    }
+};
+
+}  // namespace fixed_containers
@@ -0,0 +1,339 @@
+#pragma once
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/fixed_circular_queue.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+
+#include <coroutine>
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers::fixed_channel_detail
+{
+// Resumes waiters on the stack of the coroutine that unblocked them.
+struct InlineResumer
+{
+    void operator()(const std::coroutine_handle<> handle) const { handle.resume(); }
+};
+
+// FIFO of waiters, linked through a `next` pointer inside each waiter. Waiters are the awaiter
+// objects themselves, which live in the suspended coroutine's frame, so no storage is needed.
+template <class Node>
+class IntrusiveWaitQueue
+{
+    Node* head_;
+    Node* tail_;
+
+public:
+    constexpr IntrusiveWaitQueue() noexcept
+      : head_{nullptr}
+      , tail_{nullptr}
+    {
+    }
+
+    [[nodiscard]] constexpr bool empty() const noexcept { return head_ == nullptr; }
+
+    constexpr void push_back(Node& node) noexcept
+    {
+        node.next = nullptr;
+        if (tail_ == nullptr)
+        {
+            head_ = &node;
+        }
+        else
+        {
+            tail_->next = &node;
+        }
+        tail_ = &node;
+    }
+
+    constexpr Node& pop_front() noexcept
+    {
+        assert_or_abort(!empty());
+        Node& out = *head_;
+        head_ = out.next;
+        if (head_ == nullptr)
+        {
+            tail_ = nullptr;
+        }
+        return out;
+    }
+};
+}  // namespace fixed_containers::fixed_channel_detail
+
+namespace fixed_containers
+{
+/**
+ * Bounded, allocation-free channel between coroutines on the same thread.
+ *
+ * `co_await send(v)` suspends while the channel is full and `co_await receive()` suspends while
+ * it is empty. Elements are buffered in a FixedCircularQueue, and suspended senders/receivers are
+ * queued (FIFO) in intrusive lists threaded through their awaiters, so the channel never
+ * allocates. When a receiver is waiting, a sent value is handed to it directly.
+ *
+ * Unblocked waiters are resumed through `Resumer`, which by default resumes them inline. Pass a
+ * resumer that posts to an executor to avoid nesting resumptions.
+ *
+ * After `close()`, sends fail and receives drain the buffer, then return std::nullopt.
+ */
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          typename Resumer = fixed_channel_detail::InlineResumer>
+    requires(MAXIMUM_SIZE > 0)
+class FixedChannel
+{
+    struct SendWaiter
+    {
+        SendWaiter* next{};
+        std::coroutine_handle<> handle{};
+        std::optional<T> value{};
+        bool result{};
+    };
+
+    struct ReceiveWaiter
+    {
+        ReceiveWaiter* next{};
+        std::coroutine_handle<> handle{};
+        void* destination{};
+        void (*deliver)(void* destination, T&& value){};
+    };
+
+public:
+    class SendAwaiter : private SendWaiter
+    {
+        friend class FixedChannel;
+        FixedChannel* channel_;
+
+        SendAwaiter(FixedChannel& channel, T&& value)
+          : SendWaiter{}
+          , channel_{&channel}
+        {
+            this->value.emplace(std::move(value));
+        }
+
+    public:
+        bool await_ready() { return channel_->try_complete_send(*this); }
+        void await_suspend(const std::coroutine_handle<> handle)
+        {
+            this->handle = handle;
+            channel_->waiting_senders_.push_back(*this);
+        }
+        // Returns false if the channel was closed before the value could be sent.
+        [[nodiscard]] bool await_resume() const noexcept { return this->result; }
+    };
+
+    class ReceiveAwaiter : private ReceiveWaiter
+    {
+        friend class FixedChannel;
+        FixedChannel* channel_;
+        std::optional<T> out_;
+
+        explicit ReceiveAwaiter(FixedChannel& channel)
+          : ReceiveWaiter{}
+          , channel_{&channel}
+          , out_{}
+        {
+            this->destination = &out_;
+            this->deliver = [](void* destination, T&& value)
+            { static_cast<std::optional<T>*>(destination)->emplace(std::move(value)); };
+        }
+
+    public:
+        bool await_ready()
+        {
+            if (std::optional<T> value = channel_->try_receive())
+            {
+                out_ = std::move(value);
+                return true;
+            }
+            return channel_->closed();
+        }
+        void await_suspend(const std::coroutine_handle<> handle)
+        {
+            this->handle = handle;
+            channel_->waiting_receivers_.push_back(*this);
+        }
+        // Returns std::nullopt if the channel is closed and drained.
+        std::optional<T> await_resume() { return std::move(out_); }
+    };
+
+    template <std::size_t DESTINATION_SIZE>
+    class ReceiveManyAwaiter : private ReceiveWaiter
+    {
+        friend class FixedChannel;
+        using DestinationType = FixedVector<T, DESTINATION_SIZE>;
+        FixedChannel* channel_;
+        DestinationType* out_;
+        std::size_t initial_size_;
+
+        ReceiveManyAwaiter(FixedChannel& channel, DestinationType& out)
+          : ReceiveWaiter{}
+          , channel_{&channel}
+          , out_{&out}
+          , initial_size_{out.size()}
+        {
+            this->destination = out_;
+            this->deliver = [](void* destination, T&& value)
+            { static_cast<DestinationType*>(destination)->push_back(std::move(value)); };
+        }
+
+    public:
+        bool await_ready()
+        {
+            assert_or_abort(!is_full(*out_));
+            channel_->drain_into(*out_);
+            return out_->size() != initial_size_ || channel_->closed();
+        }
+        void await_suspend(const std::coroutine_handle<> handle)
+        {
+            this->handle = handle;
+            channel_->waiting_receivers_.push_back(*this);
+        }
+        // Returns the number of elements appended, 0 only if the channel is closed and drained.
+        std::size_t await_resume()
+        {
+            channel_->drain_into(*out_);
+            return out_->size() - initial_size_;
+        }
+    };
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+
+private:
+    FixedCircularQueue<T, MAXIMUM_SIZE> buffer_;
+    fixed_channel_detail::IntrusiveWaitQueue<SendWaiter> waiting_senders_;
+    fixed_channel_detail::IntrusiveWaitQueue<ReceiveWaiter> waiting_receivers_;
+    bool closed_;
+    Resumer resumer_;
+
+public:
+    FixedChannel()
+        requires std::is_default_constructible_v<Resumer>
+      : FixedChannel(Resumer{})
+    {
+    }
+
+    explicit FixedChannel(Resumer resumer)
+      : buffer_{}
+      , waiting_senders_{}
+      , waiting_receivers_{}
+      , closed_{false}
+      , resumer_{std::move(resumer)}
+    {
+    }
+
+    // Waiters hold pointers into the channel
+    FixedChannel(const FixedChannel&) = delete;
+    FixedChannel(FixedChannel&&) noexcept = delete;
+    FixedChannel& operator=(const FixedChannel&) = delete;
+    FixedChannel& operator=(FixedChannel&&) noexcept = delete;
+    ~FixedChannel() = default;
+
+public:
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return MAXIMUM_SIZE; }
+    [[nodiscard]] std::size_t size() const noexcept { return buffer_.size(); }
+    [[nodiscard]] bool empty() const noexcept { return buffer_.empty(); }
+    [[nodiscard]] bool closed() const noexcept { return closed_; }
+
+    [[nodiscard]] SendAwaiter send(T value) { return SendAwaiter{*this, std::move(value)}; }
+    [[nodiscard]] ReceiveAwaiter receive() { return ReceiveAwaiter{*this}; }
+
+    // Waits until at least one element is available, then moves as many buffered elements as fit
+    // into `out`, which must not be full.
+    template <std::size_t DESTINATION_SIZE>
+    [[nodiscard]] ReceiveManyAwaiter<DESTINATION_SIZE> receive_n(
+        FixedVector<T, DESTINATION_SIZE>& out)
+    {
+        return ReceiveManyAwaiter<DESTINATION_SIZE>{*this, out};
+    }
+
+    // Non-suspending variants
+    bool try_send(T value)
+    {
+        SendWaiter waiter{};
+        waiter.value.emplace(std::move(value));
+        return try_complete_send(waiter) && waiter.result;
+    }
+
+    std::optional<T> try_receive()
+    {
+        if (buffer_.empty())
+        {
+            return std::nullopt;
+        }
+        std::optional<T> out{std::move(buffer_.front())};
+        buffer_.pop();
+        refill_from_waiting_sender();
+        return out;
+    }
+
+    void close()
+    {
+        closed_ = true;
+        while (!waiting_senders_.empty())
+        {
+            SendWaiter& sender = waiting_senders_.pop_front();
+            sender.result = false;
+            resumer_(sender.handle);
+        }
+        while (!waiting_receivers_.empty())
+        {
+            resumer_(waiting_receivers_.pop_front().handle);
+        }
+    }
+
+private:
+    // Returns true if the send completed (successfully or not) without suspending.
+    bool try_complete_send(SendWaiter& sender)
+    {
+        if (closed_)
+        {
+            sender.result = false;
+            return true;
+        }
+        if (!waiting_receivers_.empty())
+        {
+            // The buffer is empty, otherwise the receiver would not be waiting
+            ReceiveWaiter& receiver = waiting_receivers_.pop_front();
+            receiver.deliver(receiver.destination, std::move(*sender.value));
+            sender.result = true;
+            resumer_(receiver.handle);
+            return true;
+        }
+        if (!is_full(buffer_))
+        {
+            buffer_.push(std::move(*sender.value));
+            sender.result = true;
+            return true;
+        }
+        return false;
+    }
+
+    void refill_from_waiting_sender()
+    {
+        if (waiting_senders_.empty())
+        {
+            return;
+        }
+        SendWaiter& sender = waiting_senders_.pop_front();
+        buffer_.push(std::move(*sender.value));
+        sender.result = true;
+        resumer_(sender.handle);
+    }
+
+    template <std::size_t DESTINATION_SIZE>
+    void drain_into(FixedVector<T, DESTINATION_SIZE>& out)
+    {
+        while (!buffer_.empty() && !is_full(out))
+        {
+            out.push_back(std::move(buffer_.front()));
+            buffer_.pop();
+            refill_from_waiting_sender();
+        }
+    }
+};
+
+}  // namespace fixed_containers
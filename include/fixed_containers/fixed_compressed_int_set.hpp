@@ -0,0 +1,728 @@
+#pragma once
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/bidirectional_iterator.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/iterator_utils.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/set_checking.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <utility>
+
+namespace fixed_containers::fixed_compressed_int_set_detail
+{
+// Values are split into blocks of consecutive values. A block stores each of its values as the
+// offset from its first value ("frame of reference"), packed into `bits` bits, starting at word
+// `word_offset` of the payload. The headers double as the skip index for lookups.
+struct BlockHeader
+{
+    std::uint64_t first;
+    std::uint32_t word_offset;
+    std::uint16_t count;
+    std::uint16_t bits;
+};
+
+inline constexpr std::size_t BLOCK_SIZE = 64;
+// Adjacent blocks holding this many values or fewer between them are merged
+inline constexpr std::size_t MERGE_THRESHOLD = BLOCK_SIZE / 2;
+
+// Every two adjacent blocks hold more than MERGE_THRESHOLD values
+constexpr std::size_t max_block_count(const std::size_t maximum_size)
+{
+    return std::min(maximum_size, (2 * (maximum_size / (MERGE_THRESHOLD + 1))) + 1);
+}
+
+constexpr std::size_t word_count_for(const std::size_t count, const std::size_t bits)
+{
+    return ((count * bits) + 63) / 64;
+}
+
+// Precondition: 1 <= bits <= 64
+constexpr std::uint64_t mask_for(const std::size_t bits)
+{
+    return ~std::uint64_t{0} >> (64 - bits);
+}
+
+// The payload has a trailing word, so reading the word after the one holding the low bits is
+// always in bounds. Shifting in two steps keeps every shift amount below 64.
+template <typename Words>
+constexpr std::uint64_t load(const Words& words,
+                             const BlockHeader& header,
+                             const std::uint64_t mask,
+                             const std::size_t j) noexcept
+{
+    const std::size_t bit = j * header.bits;
+    const std::size_t w = header.word_offset + (bit / 64);
+    const std::size_t offset = bit % 64;
+    const std::uint64_t low = words[w] >> offset;
+    const std::uint64_t high = (words[w + 1] << 1U) << (63 - offset);
+    return (low | high) & mask;
+}
+}  // namespace fixed_containers::fixed_compressed_int_set_detail
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity sorted set of 64-bit unsigned integers, compressed in blocks of up to 64 values.
+ * Each block keeps its first value and the bit width needed for the distance to its last value;
+ * every value is stored as its offset from the first one, at that width. Dense ids thus take
+ * a few bits each instead of a red-black tree node.
+ *
+ * The packed values share a budget of WORD_CAPACITY 64-bit words. The default budget can hold
+ * MAXIMUM_SIZE values of any spread; a smaller budget shrinks the footprint further when the
+ * values are known to be dense. Running out of words is a `length_error`. Since merging blocks
+ * can widen them, `erase()` may need words too.
+ *
+ * Lookups are O(log n): a binary search over the block headers, then within one block.
+ * `insert()` and `erase()` re-encode one or two blocks and shift the payload after them, so they
+ * are O(log n + payload size after the block); appending in increasing order is O(log n).
+ * `set_intersection()` skips non-overlapping blocks by their headers.
+ *
+ * Properties:
+ *  - constexpr
+ *  - trivially copyable
+ *  - standard layout
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ */
+template <std::size_t MAXIMUM_SIZE,
+          std::size_t WORD_CAPACITY = MAXIMUM_SIZE,
+          customize::SetChecking<std::uint64_t> CheckingType =
+              customize::SetAbortChecking<std::uint64_t, MAXIMUM_SIZE>>
+class FixedCompressedIntSet
+{
+    static_assert(WORD_CAPACITY <= UINT32_MAX);
+
+    template <std::size_t, std::size_t, customize::SetChecking<std::uint64_t>>
+    friend class FixedCompressedIntSet;
+
+    using BlockHeader = fixed_compressed_int_set_detail::BlockHeader;
+    static constexpr std::size_t BLOCK_SIZE = fixed_compressed_int_set_detail::BLOCK_SIZE;
+    static constexpr std::size_t MERGE_THRESHOLD = fixed_compressed_int_set_detail::MERGE_THRESHOLD;
+    static constexpr std::size_t MAXIMUM_BLOCK_COUNT =
+        fixed_compressed_int_set_detail::max_block_count(MAXIMUM_SIZE);
+
+    using Headers = FixedVector<BlockHeader, MAXIMUM_BLOCK_COUNT>;
+    using Words = std::array<std::uint64_t, WORD_CAPACITY + 1>;
+    // One decoded block, plus the value being inserted
+    using DecodedBlock = std::array<std::uint64_t, BLOCK_SIZE + 1>;
+
+public:
+    using key_type = std::uint64_t;
+    using value_type = std::uint64_t;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using const_reference = value_type;
+    using reference = const_reference;
+
+private:
+    // Positions are (block, index in block), with end() at (block count, 0). rend() is at
+    // (0, SIZE_MAX): receding from (0, 0) wraps the index, and advancing wraps it back.
+    class ReferenceProvider
+    {
+        const FixedCompressedIntSet* set_;
+        std::size_t block_;
+        std::size_t index_;
+
+    public:
+        constexpr ReferenceProvider() noexcept
+          : ReferenceProvider{nullptr, 0, 0}
+        {
+        }
+
+        constexpr ReferenceProvider(const FixedCompressedIntSet* const set,
+                                    const std::size_t block,
+                                    const std::size_t index) noexcept
+          : set_{set}
+          , block_{block}
+          , index_{index}
+        {
+        }
+
+        constexpr void advance() noexcept
+        {
+            ++index_;
+            if (index_ == set_->headers()[block_].count)
+            {
+                ++block_;
+                index_ = 0;
+            }
+        }
+        constexpr void recede() noexcept
+        {
+            if (index_ == 0 && block_ > 0)
+            {
+                --block_;
+                index_ = set_->headers()[block_].count - 1U;
+            }
+            else
+            {
+                --index_;
+            }
+        }
+
+        constexpr const_reference get() const noexcept { return set_->value_at(block_, index_); }
+
+        constexpr bool operator==(const ReferenceProvider& other) const noexcept = default;
+    };
+
+    template <IteratorDirection DIRECTION>
+    using Iterator = BidirectionalIterator<ReferenceProvider,
+                                           ReferenceProvider,
+                                           IteratorConstness::CONSTANT_ITERATOR,
+                                           DIRECTION>;
+
+public:
+    using const_iterator = Iterator<IteratorDirection::FORWARD>;
+    using iterator = const_iterator;
+    using const_reverse_iterator = Iterator<IteratorDirection::REVERSE>;
+    using reverse_iterator = const_reverse_iterator;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+    [[nodiscard]] static constexpr std::size_t word_capacity() noexcept { return WORD_CAPACITY; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    Headers IMPLEMENTATION_DETAIL_DO_NOT_USE_headers_;
+    Words IMPLEMENTATION_DETAIL_DO_NOT_USE_words_;
+    std::size_t IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+
+public:
+    constexpr FixedCompressedIntSet() noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_headers_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_words_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_size_{0}
+    {
+    }
+
+    template <InputIterator InputIt>
+    constexpr FixedCompressedIntSet(InputIt first,
+                                    InputIt last,
+                                    const std_transition::source_location& loc =
+                                        std_transition::source_location::current()) noexcept
+      : FixedCompressedIntSet{}
+    {
+        insert(first, last, loc);
+    }
+
+    constexpr FixedCompressedIntSet(std::initializer_list<value_type> list,
+                                    const std_transition::source_location& loc =
+                                        std_transition::source_location::current()) noexcept
+      : FixedCompressedIntSet{}
+    {
+        insert(list, loc);
+    }
+
+public:
+    constexpr const_iterator cbegin() const noexcept { return create_const_iterator(0, 0); }
+    constexpr const_iterator cend() const noexcept
+    {
+        return create_const_iterator(headers().size(), 0);
+    }
+    constexpr const_iterator begin() const noexcept { return cbegin(); }
+    constexpr const_iterator end() const noexcept { return cend(); }
+
+    constexpr const_reverse_iterator crbegin() const noexcept
+    {
+        return const_reverse_iterator{ReferenceProvider{this, headers().size(), 0}};
+    }
+    constexpr const_reverse_iterator crend() const noexcept
+    {
+        return const_reverse_iterator{ReferenceProvider{this, 0, 0}};
+    }
+    constexpr const_reverse_iterator rbegin() const noexcept { return crbegin(); }
+    constexpr const_reverse_iterator rend() const noexcept { return crend(); }
+
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+    [[nodiscard]] constexpr std::size_t size() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+    }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+
+    // Payload words currently taken, out of `word_capacity()`
+    [[nodiscard]] constexpr std::size_t used_words() const noexcept
+    {
+        if (headers().empty())
+        {
+            return 0;
+        }
+        const BlockHeader& last = headers().back();
+        return last.word_offset +
+               fixed_compressed_int_set_detail::word_count_for(last.count, last.bits);
+    }
+
+    constexpr void clear() noexcept
+    {
+        std::fill(words().begin(), words().begin() + used_words(), 0);
+        headers().clear();
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = 0;
+    }
+
+    constexpr std::pair<const_iterator, bool> insert(
+        const value_type& value,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        if (empty())
+        {
+            check_not_full(loc);
+            const std::array<std::uint64_t, 1> values{value};
+            replace_blocks(0, 0, values, 1, loc);
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = 1;
+            return {cbegin(), true};
+        }
+
+        const std::size_t block = index_of_block_for(value);
+        const std::size_t count = headers()[block].count;
+        DecodedBlock values{};
+        decode_block(block, values);
+        const auto it = std::lower_bound(values.begin(), values.begin() + count, value);
+        const auto j = static_cast<std::size_t>(std::distance(values.begin(), it));
+        if (j < count && values[j] == value)
+        {
+            return {create_const_iterator(block, j), false};
+        }
+
+        check_not_full(loc);
+        std::copy_backward(it, values.begin() + count, values.begin() + count + 1);
+        *it = value;
+        // A full block is split in half, except when appending past the last value, where it is
+        // kept full so that ids arriving in increasing order are packed into full blocks
+        const std::size_t new_count = count + 1;
+        std::size_t split_at = new_count;
+        if (new_count > BLOCK_SIZE)
+        {
+            const bool appends = block + 1 == headers().size() && j == count;
+            split_at = appends ? BLOCK_SIZE : new_count / 2;
+        }
+        replace_blocks(block, 1, std::span{values.data(), new_count}, split_at, loc);
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_++;
+
+        if (j >= split_at)
+        {
+            return {create_const_iterator(block + 1, j - split_at), true};
+        }
+        return {create_const_iterator(block, j), true};
+    }
+
+    template <InputIterator InputIt>
+    constexpr void insert(InputIt first,
+                          InputIt last,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        for (; first != last; ++first)
+        {
+            this->insert(*first, loc);
+        }
+    }
+    constexpr void insert(std::initializer_list<value_type> ilist,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        this->insert(ilist.begin(), ilist.end(), loc);
+    }
+
+    constexpr size_type erase(const key_type& key,
+                              const std_transition::source_location& loc =
+                                  std_transition::source_location::current()) noexcept
+    {
+        if (empty())
+        {
+            return 0;
+        }
+
+        const std::size_t block = index_of_block_for(key);
+        const std::size_t j = index_of_lower_bound_in_block(block, key);
+        if (j == headers()[block].count || value_at(block, j) != key)
+        {
+            return 0;
+        }
+
+        // Merge with the neighbours that would otherwise leave too few values in two blocks
+        std::size_t total = headers()[block].count - 1U;
+        std::size_t first_block = block;
+        if (block > 0 && headers()[block - 1].count + total <= MERGE_THRESHOLD)
+        {
+            first_block = block - 1;
+            total += headers()[first_block].count;
+        }
+        std::size_t last_block = block;
+        if (block + 1 < headers().size() && headers()[block + 1].count + total <= MERGE_THRESHOLD)
+        {
+            last_block = block + 1;
+            total += headers()[last_block].count;
+        }
+
+        DecodedBlock values{};
+        std::size_t decoded = 0;
+        std::size_t erased_position = 0;
+        for (std::size_t b = first_block; b <= last_block; b++)
+        {
+            if (b == block)
+            {
+                erased_position = decoded + j;
+            }
+            decode_block(b, std::span{values}.subspan(decoded));
+            decoded += headers()[b].count;
+        }
+        std::copy(values.begin() + erased_position + 1,
+                  values.begin() + decoded,
+                  values.begin() + erased_position);
+
+        replace_blocks(
+            first_block, last_block - first_block + 1, std::span{values.data(), total}, total, loc);
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_--;
+        return 1;
+    }
+
+    constexpr const_iterator erase(const_iterator pos,
+                                   const std_transition::source_location& loc =
+                                       std_transition::source_location::current()) noexcept
+    {
+        assert_or_abort(pos != cend());
+        const value_type value = *pos;
+        erase(value, loc);
+        return upper_bound(value);
+    }
+
+    [[nodiscard]] constexpr const_iterator find(const key_type& key) const noexcept
+    {
+        const const_iterator it = lower_bound(key);
+        if (it == cend() || *it != key)
+        {
+            return cend();
+        }
+        return it;
+    }
+
+    [[nodiscard]] constexpr bool contains(const key_type& key) const noexcept
+    {
+        if (empty())
+        {
+            return false;
+        }
+        const std::size_t block = index_of_block_for(key);
+        const std::size_t j = index_of_lower_bound_in_block(block, key);
+        return j < headers()[block].count && value_at(block, j) == key;
+    }
+
+    [[nodiscard]] constexpr size_type count(const key_type& key) const noexcept
+    {
+        return static_cast<size_type>(contains(key));
+    }
+
+    [[nodiscard]] constexpr const_iterator lower_bound(const key_type& key) const noexcept
+    {
+        if (empty())
+        {
+            return cend();
+        }
+        const std::size_t block = index_of_block_for(key);
+        return create_const_iterator(block, index_of_lower_bound_in_block(block, key));
+    }
+    [[nodiscard]] constexpr const_iterator upper_bound(const key_type& key) const noexcept
+    {
+        if (empty())
+        {
+            return cend();
+        }
+        const std::size_t block = index_of_block_for(key);
+        const std::size_t j = index_of_lower_bound_in_block(block, key);
+        const bool found = j < headers()[block].count && value_at(block, j) == key;
+        return create_const_iterator(block, found ? j + 1 : j);
+    }
+
+    /**
+     * Writes the values present in both sets to `d_first`, in increasing order. Blocks whose
+     * ranges do not overlap a block of the other set are skipped without being decoded.
+     */
+    template <std::size_t MAXIMUM_SIZE_2,
+              std::size_t WORD_CAPACITY_2,
+              customize::SetChecking<std::uint64_t> CheckingType2,
+              class OutputIt>
+    constexpr OutputIt set_intersection(
+        const FixedCompressedIntSet<MAXIMUM_SIZE_2, WORD_CAPACITY_2, CheckingType2>& other,
+        OutputIt d_first) const
+    {
+        DecodedBlock values{};
+        DecodedBlock other_values{};
+        std::size_t decoded = headers().size();
+        std::size_t other_decoded = other.headers().size();
+
+        std::size_t i = 0;
+        std::size_t k = 0;
+        while (i < headers().size() && k < other.headers().size())
+        {
+            const BlockHeader& header = headers()[i];
+            const BlockHeader& other_header = other.headers()[k];
+            const std::uint64_t last = value_at(i, header.count - 1U);
+            const std::uint64_t other_last = other.value_at(k, other_header.count - 1U);
+            if (last < other_header.first)
+            {
+                i = std::max(i + 1, index_of_block_for(other_header.first));
+                continue;
+            }
+            if (other_last < header.first)
+            {
+                k = std::max(k + 1, other.index_of_block_for(header.first));
+                continue;
+            }
+
+            if (decoded != i)
+            {
+                decode_block(i, values);
+                decoded = i;
+            }
+            if (other_decoded != k)
+            {
+                other.decode_block(k, other_values);
+                other_decoded = k;
+            }
+            std::size_t x = index_of_lower_bound_in_block(i, other_header.first);
+            std::size_t y = other.index_of_lower_bound_in_block(k, header.first);
+            while (x < header.count && y < other_header.count)
+            {
+                if (values[x] < other_values[y])
+                {
+                    ++x;
+                }
+                else if (other_values[y] < values[x])
+                {
+                    ++y;
+                }
+                else
+                {
+                    *d_first = values[x];
+                    ++d_first;
+                    ++x;
+                    ++y;
+                }
+            }
+
+            // The block that ends first cannot overlap anything further in the other set
+            if (last <= other_last)
+            {
+                ++i;
+            }
+            if (other_last <= last)
+            {
+                ++k;
+            }
+        }
+        return d_first;
+    }
+
+    template <std::size_t MAXIMUM_SIZE_2,
+              std::size_t WORD_CAPACITY_2,
+              customize::SetChecking<std::uint64_t> CheckingType2>
+    [[nodiscard]] constexpr bool operator==(
+        const FixedCompressedIntSet<MAXIMUM_SIZE_2, WORD_CAPACITY_2, CheckingType2>& other) const
+    {
+        return size() == other.size() && std::ranges::equal(*this, other);
+    }
+
+private:
+    constexpr Headers& headers() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_headers_; }
+    constexpr const Headers& headers() const { return IMPLEMENTATION_DETAIL_DO_NOT_USE_headers_; }
+    constexpr Words& words() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_words_; }
+    constexpr const Words& words() const { return IMPLEMENTATION_DETAIL_DO_NOT_USE_words_; }
+
+    constexpr const_iterator create_const_iterator(const std::size_t block,
+                                                   const std::size_t index) const noexcept
+    {
+        // One past the last value of a block is the first value of the next one
+        if (block < headers().size() && index == headers()[block].count)
+        {
+            return const_iterator{ReferenceProvider{this, block + 1, 0}};
+        }
+        return const_iterator{ReferenceProvider{this, block, index}};
+    }
+
+    constexpr void check_not_full(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(size() < MAXIMUM_SIZE))
+        {
+            CheckingType::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+    }
+
+    [[nodiscard]] constexpr std::uint64_t value_at(const std::size_t block,
+                                                   const std::size_t j) const noexcept
+    {
+        const BlockHeader& header = headers()[block];
+        const std::uint64_t mask = fixed_compressed_int_set_detail::mask_for(header.bits);
+        return header.first + fixed_compressed_int_set_detail::load(words(), header, mask, j);
+    }
+
+    // The block whose range would contain `key`, which is the first block for keys below all of
+    // them. Precondition: not empty
+    [[nodiscard]] constexpr std::size_t index_of_block_for(const key_type& key) const noexcept
+    {
+        const auto it = std::upper_bound(headers().begin(),
+                                         headers().end(),
+                                         key,
+                                         [](const key_type& k, const BlockHeader& header)
+                                         { return k < header.first; });
+        const auto following = static_cast<std::size_t>(std::distance(headers().begin(), it));
+        return following == 0 ? 0 : following - 1;
+    }
+
+    [[nodiscard]] constexpr std::size_t index_of_lower_bound_in_block(
+        const std::size_t block, const key_type& key) const noexcept
+    {
+        std::size_t low = 0;
+        std::size_t high = headers()[block].count;
+        while (low < high)
+        {
+            const std::size_t middle = low + ((high - low) / 2);
+            if (value_at(block, middle) < key)
+            {
+                low = middle + 1;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+        return low;
+    }
+
+    // Branch-free, so that compilers can vectorize it. Precondition: out.size() >= block count
+    constexpr void decode_block(const std::size_t block,
+                                const std::span<std::uint64_t> out) const noexcept
+    {
+        const BlockHeader& header = headers()[block];
+        const std::uint64_t mask = fixed_compressed_int_set_detail::mask_for(header.bits);
+        for (std::size_t j = 0; j < header.count; j++)
+        {
+            out[j] = header.first + fixed_compressed_int_set_detail::load(words(), header, mask, j);
+        }
+    }
+
+    // Precondition: the words of the block are zero
+    constexpr void encode_block(const BlockHeader& header,
+                                const std::span<const std::uint64_t> values) noexcept
+    {
+        for (std::size_t j = 0; j < header.count; j++)
+        {
+            const std::uint64_t offset_value = values[j] - header.first;
+            const std::size_t bit = j * header.bits;
+            const std::size_t w = header.word_offset + (bit / 64);
+            const std::size_t offset = bit % 64;
+            words()[w] |= offset_value << offset;
+            // Zero when the value fits in word `w`
+            words()[w + 1] |= (offset_value >> 1U) >> (63 - offset);
+        }
+    }
+
+    // Replaces blocks [first_block, first_block + old_block_count) with new blocks holding
+    // `values` (sorted, distinct): [0, split_at) in one, and the rest, if any, in another.
+    constexpr void replace_blocks(const std::size_t first_block,
+                                  const std::size_t old_block_count,
+                                  const std::span<const std::uint64_t> values,
+                                  const std::size_t split_at,
+                                  const std_transition::source_location& loc) noexcept
+    {
+        const std::array<std::size_t, 3> bounds{0, split_at, values.size()};
+        std::size_t new_block_count = 0;
+        if (!values.empty())
+        {
+            new_block_count = split_at < values.size() ? 2 : 1;
+        }
+
+        const std::size_t used = used_words();
+        const std::size_t begin_word =
+            first_block < headers().size() ? headers()[first_block].word_offset : used;
+        const std::size_t old_end_block = first_block + old_block_count;
+        const std::size_t old_end_word =
+            old_end_block < headers().size() ? headers()[old_end_block].word_offset : used;
+
+        std::array<BlockHeader, 2> new_headers{};
+        std::size_t new_end_word = begin_word;
+        for (std::size_t n = 0; n < new_block_count; n++)
+        {
+            const std::size_t start = bounds.at(n);
+            const std::size_t end = bounds.at(n + 1);
+            const std::size_t bits =
+                std::max<std::size_t>(1, std::bit_width(values[end - 1] - values[start]));
+            new_headers.at(n) = BlockHeader{values[start],
+                                            static_cast<std::uint32_t>(new_end_word),
+                                            static_cast<std::uint16_t>(end - start),
+                                            static_cast<std::uint16_t>(bits)};
+            new_end_word += fixed_compressed_int_set_detail::word_count_for(end - start, bits);
+        }
+
+        const std::size_t new_used = (used - old_end_word) + new_end_word;
+        if (preconditions::test(new_used <= WORD_CAPACITY))
+        {
+            CheckingType::length_error(size() + 1, loc);
+        }
+
+        // Move the payload of the following blocks, and clear the words of the new blocks
+        auto words_at = [this](const std::size_t w) { return words().begin() + w; };
+        if (new_end_word > old_end_word)
+        {
+            std::copy_backward(words_at(old_end_word), words_at(used), words_at(new_used));
+        }
+        else if (new_end_word < old_end_word)
+        {
+            std::copy(words_at(old_end_word), words_at(used), words_at(new_end_word));
+            std::fill(words_at(new_used), words_at(used), 0);
+        }
+        std::fill(words_at(begin_word), words_at(new_end_word), 0);
+        for (std::size_t b = old_end_block; b < headers().size(); b++)
+        {
+            headers()[b].word_offset = static_cast<std::uint32_t>(
+                (headers()[b].word_offset - old_end_word) + new_end_word);
+        }
+
+        headers().erase(headers().begin() + static_cast<std::ptrdiff_t>(first_block),
+                        headers().begin() + static_cast<std::ptrdiff_t>(old_end_block));
+        headers().insert(headers().begin() + static_cast<std::ptrdiff_t>(first_block),
+                         new_headers.begin(),
+                         new_headers.begin() + static_cast<std::ptrdiff_t>(new_block_count));
+
+        for (std::size_t n = 0; n < new_block_count; n++)
+        {
+            encode_block(new_headers.at(n), values.subspan(bounds.at(n)));
+        }
+    }
+};
+
+template <std::size_t MAXIMUM_SIZE,
+          std::size_t WORD_CAPACITY,
+          customize::SetChecking<std::uint64_t> CheckingType>
+[[nodiscard]] constexpr bool is_full(
+    const FixedCompressedIntSet<MAXIMUM_SIZE, WORD_CAPACITY, CheckingType>& c)
+{
+    return c.size() >= c.max_size();
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <std::size_t MAXIMUM_SIZE,
+          std::size_t WORD_CAPACITY,
+          fixed_containers::customize::SetChecking<std::uint64_t> CheckingType>
+struct tuple_size<
+    fixed_containers::FixedCompressedIntSet<MAXIMUM_SIZE, WORD_CAPACITY, CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
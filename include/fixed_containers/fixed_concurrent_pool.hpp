@@ -0,0 +1,309 @@
+#pragma once
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/cache_line_padded.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/memory.hpp"
+#include "fixed_containers/optional_storage.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <utility>
+
+namespace fixed_containers::fixed_concurrent_pool_detail
+{
+inline constexpr std::uint32_t NULL_INDEX = (std::numeric_limits<std::uint32_t>::max)();
+
+// The head of the free list is a single 64-bit word: the index of the first free slot in the low
+// half and a tag in the high half. The tag is bumped on every successful CAS, which prevents the
+// ABA problem (a slot popped and pushed back between a load and the CAS of another thread).
+class TaggedIndex
+{
+    std::uint64_t word_;
+
+public:
+    static constexpr TaggedIndex create(const std::uint32_t index, const std::uint32_t tag) noexcept
+    {
+        return TaggedIndex{(static_cast<std::uint64_t>(tag) << 32U) | index};
+    }
+
+    constexpr explicit TaggedIndex(const std::uint64_t word) noexcept
+      : word_{word}
+    {
+    }
+
+    [[nodiscard]] constexpr std::uint64_t word() const noexcept { return word_; }
+    [[nodiscard]] constexpr std::uint32_t index() const noexcept
+    {
+        return static_cast<std::uint32_t>(word_);
+    }
+    [[nodiscard]] constexpr std::uint32_t tag() const noexcept
+    {
+        return static_cast<std::uint32_t>(word_ >> 32U);
+    }
+    [[nodiscard]] constexpr TaggedIndex with_next_tag(const std::uint32_t index) const noexcept
+    {
+        return create(index, tag() + 1);
+    }
+};
+}  // namespace fixed_containers::fixed_concurrent_pool_detail
+
+namespace fixed_containers
+{
+/**
+ * Thread-safe counterpart of `FixedIndexBasedPoolStorage`: slots are allocated on one thread and
+ * may be freed on any other. Free slots form an index-based Treiber stack whose head is tagged
+ * against ABA. Indices are stable for the lifetime of the element, and the
+ * `emplace_and_return_index()`/`delete_at_and_return_repositioned_index()` interface matches the
+ * other index-based storages.
+ *
+ * To reduce contention on the head, threads can allocate and free through a `Magazine`, a small
+ * thread-local cache of free indices that is refilled from, and flushed to, the shared free list
+ * in batches. Flushing a batch is a single CAS.
+ *
+ * As with `FixedIndexBasedPoolStorage`, elements still alive when the pool is destroyed are not
+ * destroyed.
+ */
+template <class T, std::size_t MAXIMUM_SIZE, std::size_t MAGAZINE_SIZE = 32>
+    requires(MAXIMUM_SIZE < fixed_concurrent_pool_detail::NULL_INDEX && MAGAZINE_SIZE >= 2)
+class FixedConcurrentPool
+{
+    static constexpr std::uint32_t NULL_INDEX = fixed_concurrent_pool_detail::NULL_INDEX;
+    using TaggedIndex = fixed_concurrent_pool_detail::TaggedIndex;
+    using OptionalT = optional_storage_detail::OptionalStorage<T>;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    // Not thread-safe itself; intended to be owned by a single thread.
+    class Magazine
+    {
+        friend class FixedConcurrentPool;
+
+        FixedConcurrentPool* pool_;
+        FixedVector<std::uint32_t, MAGAZINE_SIZE> indices_;
+
+    public:
+        explicit Magazine(FixedConcurrentPool& pool) noexcept
+          : pool_{&pool}
+          , indices_{}
+        {
+        }
+
+        Magazine(const Magazine&) = delete;
+        Magazine(Magazine&&) noexcept = delete;
+        Magazine& operator=(const Magazine&) = delete;
+        Magazine& operator=(Magazine&&) noexcept = delete;
+        ~Magazine() noexcept { flush(); }
+
+        [[nodiscard]] std::size_t cached_count() const noexcept { return indices_.size(); }
+
+        template <class... Args>
+        std::optional<std::size_t> try_emplace_and_return_index(Args&&... args)
+        {
+            if (indices_.empty())
+            {
+                refill();
+                if (indices_.empty())
+                {
+                    return std::nullopt;
+                }
+            }
+            const std::uint32_t i = indices_.back();
+            indices_.pop_back();
+            pool_->emplace_at(i, std::forward<Args>(args)...);
+            return i;
+        }
+
+        template <class... Args>
+        std::size_t emplace_and_return_index(Args&&... args)
+        {
+            const std::optional<std::size_t> i =
+                try_emplace_and_return_index(std::forward<Args>(args)...);
+            assert_or_abort(i.has_value());
+            return *i;
+        }
+
+        std::size_t delete_at_and_return_repositioned_index(const std::size_t i) noexcept
+        {
+            pool_->destroy_at(i);
+            if (is_full(indices_))
+            {
+                flush_count(MAGAZINE_SIZE / 2);
+            }
+            indices_.push_back(static_cast<std::uint32_t>(i));
+            return i;
+        }
+
+        // Returns all cached indices to the shared free list.
+        void flush() noexcept { flush_count(indices_.size()); }
+
+    private:
+        void refill() noexcept
+        {
+            for (std::size_t n = 0; n < MAGAZINE_SIZE / 2; n++)
+            {
+                const std::uint32_t i = pool_->pop_free_index();
+                if (i == NULL_INDEX)
+                {
+                    return;
+                }
+                indices_.push_back(i);
+            }
+        }
+
+        void flush_count(const std::size_t count) noexcept
+        {
+            if (count == 0)
+            {
+                return;
+            }
+            // Link the batch locally, then publish it with a single CAS
+            const std::size_t first_position = indices_.size() - count;
+            for (std::size_t n = first_position; n + 1 < indices_.size(); n++)
+            {
+                pool_->set_next_free_index(indices_[n], indices_[n + 1]);
+            }
+            pool_->push_free_chain(indices_[first_position], indices_.back());
+            indices_.erase(indices_.begin() + static_cast<difference_type>(first_position),
+                           indices_.end());
+        }
+    };
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+
+private:
+    alignas(CACHE_LINE_SIZE) std::atomic<std::uint64_t> head_;
+    // Kept apart from the values, because a thread losing the race for the head may still read
+    // the link of a slot that another thread is constructing a value into.
+    alignas(CACHE_LINE_SIZE) std::array<std::atomic<std::uint32_t>, MAXIMUM_SIZE> next_free_;
+    std::array<OptionalT, MAXIMUM_SIZE> values_;
+
+public:
+    FixedConcurrentPool() noexcept
+      : head_{TaggedIndex::create(MAXIMUM_SIZE > 0 ? 0 : NULL_INDEX, 0).word()}
+      , next_free_{}
+      , values_{}
+    {
+        for (std::size_t i = 0; i < MAXIMUM_SIZE; i++)
+        {
+            next_free_[i].store(i + 1 < MAXIMUM_SIZE ? static_cast<std::uint32_t>(i + 1)
+                                                     : NULL_INDEX,
+                                std::memory_order_relaxed);
+        }
+    }
+
+    FixedConcurrentPool(const FixedConcurrentPool&) = delete;
+    FixedConcurrentPool(FixedConcurrentPool&&) noexcept = delete;
+    FixedConcurrentPool& operator=(const FixedConcurrentPool&) = delete;
+    FixedConcurrentPool& operator=(FixedConcurrentPool&&) noexcept = delete;
+    ~FixedConcurrentPool() = default;
+
+public:
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return MAXIMUM_SIZE; }
+
+    // Only a snapshot when other threads are allocating. Indices cached in magazines count as used.
+    [[nodiscard]] bool full() const noexcept
+    {
+        return TaggedIndex{head_.load(std::memory_order_acquire)}.index() == NULL_INDEX;
+    }
+
+    T& at(const std::size_t i) noexcept { return values_[i].value; }
+    const T& at(const std::size_t i) const noexcept { return values_[i].value; }
+
+    template <class... Args>
+    std::optional<std::size_t> try_emplace_and_return_index(Args&&... args)
+    {
+        const std::uint32_t i = pop_free_index();
+        if (i == NULL_INDEX)
+        {
+            return std::nullopt;
+        }
+        emplace_at(i, std::forward<Args>(args)...);
+        return i;
+    }
+
+    template <class... Args>
+    std::size_t emplace_and_return_index(Args&&... args)
+    {
+        const std::optional<std::size_t> i =
+            try_emplace_and_return_index(std::forward<Args>(args)...);
+        assert_or_abort(i.has_value());
+        return *i;
+    }
+
+    std::size_t delete_at_and_return_repositioned_index(const std::size_t i) noexcept
+    {
+        destroy_at(i);
+        const auto index = static_cast<std::uint32_t>(i);
+        push_free_chain(index, index);
+        return i;
+    }
+
+private:
+    std::uint32_t pop_free_index() noexcept
+    {
+        TaggedIndex head{head_.load(std::memory_order_acquire)};
+        while (true)
+        {
+            if (head.index() == NULL_INDEX)
+            {
+                return NULL_INDEX;
+            }
+            const TaggedIndex new_head =
+                head.with_next_tag(next_free_[head.index()].load(std::memory_order_relaxed));
+            std::uint64_t expected = head.word();
+            if (head_.compare_exchange_weak(expected,
+                                            new_head.word(),
+                                            std::memory_order_acquire,
+                                            std::memory_order_acquire))
+            {
+                return head.index();
+            }
+            head = TaggedIndex{expected};
+        }
+    }
+
+    // `first` to `last` must already be linked through `next_free_`
+    void push_free_chain(const std::uint32_t first, const std::uint32_t last) noexcept
+    {
+        std::uint64_t expected = head_.load(std::memory_order_relaxed);
+        while (true)
+        {
+            const TaggedIndex head{expected};
+            next_free_[last].store(head.index(), std::memory_order_relaxed);
+            if (head_.compare_exchange_weak(expected,
+                                            head.with_next_tag(first).word(),
+                                            std::memory_order_release,
+                                            std::memory_order_relaxed))
+            {
+                return;
+            }
+        }
+    }
+
+    void set_next_free_index(const std::uint32_t i, const std::uint32_t next) noexcept
+    {
+        next_free_[i].store(next, std::memory_order_relaxed);
+    }
+
+    template <class... Args>
+    void emplace_at(const std::size_t i, Args&&... args)
+    {
+        memory::construct_at_address_of(values_[i], std::in_place, std::forward<Args>(args)...);
+    }
+
+    void destroy_at(const std::size_t i) noexcept
+    {
+        memory::destroy_at_address_of(values_[i].value);
+    }
+};
+
+}  // namespace fixed_containers
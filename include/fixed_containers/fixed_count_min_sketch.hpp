@@ -0,0 +1,150 @@
+#pragma once
+
+#include "fixed_containers/wyhash.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace fixed_containers::fixed_count_min_sketch_detail
+{
+// Rows mix the hash of the key with their seed, so one call to the user-provided hash serves all
+constexpr std::uint64_t row_seed(const std::size_t row)
+{
+    return wyhash_detail::hash(static_cast<std::uint64_t>(row) + 1);
+}
+}  // namespace fixed_containers::fixed_count_min_sketch_detail
+
+namespace fixed_containers
+{
+/**
+ * Count-Min sketch: frequency estimates for a stream of keys, in DEPTH rows of WIDTH counters
+ * stored inline. A key is counted once in each row, at a column given by its hash with that
+ * row's seed, and its estimate is the smallest of those counters.
+ *
+ * Estimates never undercount. With probability 1 - e^-DEPTH, they overcount by at most
+ * e / WIDTH of `total_count()`, whatever the number of distinct keys.
+ *
+ * Sketches with the same dimensions and hash can be merged, e.g. one per thread, by adding their
+ * counters: the result is the sketch of both streams.
+ * Properties:
+ *  - constexpr
+ *  - trivially copyable (if Hash is)
+ *  - standard layout
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ */
+template <typename K, std::size_t WIDTH, std::size_t DEPTH = 4, class Hash = wyhash::hash<K>>
+class FixedCountMinSketch
+{
+    static_assert(std::has_single_bit(WIDTH), "WIDTH must be a power of two");
+    static_assert(DEPTH > 0);
+
+    static constexpr std::array<std::uint64_t, DEPTH> ROW_SEEDS = []()
+    {
+        std::array<std::uint64_t, DEPTH> out{};
+        for (std::size_t row = 0; row < DEPTH; row++)
+        {
+            out[row] = fixed_count_min_sketch_detail::row_seed(row);
+        }
+        return out;
+    }();
+
+public:
+    using key_type = K;
+    using hasher = Hash;
+
+    [[nodiscard]] static constexpr std::size_t width() noexcept { return WIDTH; }
+    [[nodiscard]] static constexpr std::size_t depth() noexcept { return DEPTH; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    // Row-major, so that merging is a single flat loop
+    std::array<std::uint64_t, WIDTH * DEPTH> IMPLEMENTATION_DETAIL_DO_NOT_USE_counters_;
+    std::uint64_t IMPLEMENTATION_DETAIL_DO_NOT_USE_total_count_;
+    Hash IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_;
+
+public:
+    constexpr FixedCountMinSketch(const Hash& hash = Hash()) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_counters_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_total_count_{0}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_(hash)
+    {
+    }
+
+public:
+    // Returns the estimate for `key`, including this addition
+    constexpr std::uint64_t add(const K& key, const std::uint64_t count = 1)
+    {
+        const std::uint64_t key_hash = IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_(key);
+        std::uint64_t estimate = std::numeric_limits<std::uint64_t>::max();
+        for (std::size_t row = 0; row < DEPTH; row++)
+        {
+            std::uint64_t& counter = counters()[counter_index(key_hash, row)];
+            counter += count;
+            estimate = std::min(estimate, counter);
+        }
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_total_count_ += count;
+        return estimate;
+    }
+
+    [[nodiscard]] constexpr std::uint64_t estimate(const K& key) const
+    {
+        const std::uint64_t key_hash = IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_(key);
+        std::uint64_t estimate = std::numeric_limits<std::uint64_t>::max();
+        for (std::size_t row = 0; row < DEPTH; row++)
+        {
+            estimate = std::min(estimate, counters()[counter_index(key_hash, row)]);
+        }
+        return estimate;
+    }
+
+    // Precondition: `other` hashes the same way
+    constexpr void merge(const FixedCountMinSketch& other) noexcept
+    {
+        for (std::size_t i = 0; i < WIDTH * DEPTH; i++)
+        {
+            counters()[i] += other.counters()[i];
+        }
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_total_count_ += other.total_count();
+    }
+
+    constexpr void clear() noexcept
+    {
+        counters().fill(0);
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_total_count_ = 0;
+    }
+
+    // Sum of the counts of all additions
+    [[nodiscard]] constexpr std::uint64_t total_count() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_total_count_;
+    }
+    [[nodiscard]] constexpr bool empty() const noexcept { return total_count() == 0; }
+
+    [[nodiscard]] constexpr bool operator==(const FixedCountMinSketch& other) const
+    {
+        return total_count() == other.total_count() && counters() == other.counters();
+    }
+
+private:
+    constexpr std::array<std::uint64_t, WIDTH * DEPTH>& counters()
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_counters_;
+    }
+    constexpr const std::array<std::uint64_t, WIDTH * DEPTH>& counters() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_counters_;
+    }
+
+    [[nodiscard]] static constexpr std::size_t counter_index(const std::uint64_t key_hash,
+                                                             const std::size_t row)
+    {
+        const std::uint64_t hash = wyhash_detail::hash_with_seed(key_hash, ROW_SEEDS[row]);
+        return (row * WIDTH) + static_cast<std::size_t>(hash & (WIDTH - 1));
+    }
+};
+
+}  // namespace fixed_containers
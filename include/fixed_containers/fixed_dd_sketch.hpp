@@ -0,0 +1,333 @@
+#pragma once
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace fixed_containers::fixed_dd_sketch_detail
+{
+struct Bucket
+{
+    std::int32_t index;
+    std::uint64_t count;
+
+    constexpr bool operator==(const Bucket& other) const = default;
+};
+
+inline constexpr std::uint64_t EXPONENT_MASK = 0x7FF0000000000000ULL;
+inline constexpr std::uint64_t SIGNIFICAND_MASK = 0x000FFFFFFFFFFFFFULL;
+inline constexpr std::uint64_t ONE_BITS = 0x3FF0000000000000ULL;
+
+// f(s) = A s^3 + B s^2 + C s goes from 0 to 1 on [0, 1]; 2^e (1 + s) is mapped to e + f(s).
+// The coefficients minimize the spread of the slope of the resulting approximation of log2.
+inline constexpr double A = 6.0 / 35.0;
+inline constexpr double B = -3.0 / 5.0;
+inline constexpr double C = 10.0 / 7.0;
+// Smallest slope of the approximation, relative to the natural logarithm (at s = 0 and s = 2/3)
+inline constexpr double MIN_SLOPE = 10.0 / 7.0;
+
+// Precondition: `value` is positive and normal
+constexpr double approximate_log2(const double value)
+{
+    const auto bits = std::bit_cast<std::uint64_t>(value);
+    const auto exponent = static_cast<std::int64_t>((bits & EXPONENT_MASK) >> 52U) - 1023;
+    const double s = std::bit_cast<double>((bits & SIGNIFICAND_MASK) | ONE_BITS) - 1.0;
+    return (((((A * s) + B) * s) + C) * s) + static_cast<double>(exponent);
+}
+
+// Inverse of approximate_log2(), by Newton's method. f'(s) = 3A s^2 + 2B s + C decreases on [0, 1]
+// (its vertex is at s = 7/6), so it is at least f'(1) = 3A + 2B + C = 26/35.
+constexpr double approximate_exp2(const double y)
+{
+    auto exponent = static_cast<std::int64_t>(y);
+    if (static_cast<double>(exponent) > y)
+    {
+        exponent--;
+    }
+    exponent = std::clamp<std::int64_t>(exponent, -1022, 1023);
+    const double target = y - static_cast<double>(exponent);
+    double s = target;
+    for (std::size_t i = 0; i < 6; i++)
+    {
+        const double f = (((((A * s) + B) * s) + C) * s) - target;
+        const double derivative = (((3.0 * A * s) + (2.0 * B)) * s) + C;
+        s -= f / derivative;
+    }
+    const auto power_of_two = std::bit_cast<double>(static_cast<std::uint64_t>(exponent + 1023)
+                                                    << 52U);
+    return power_of_two * (1.0 + s);
+}
+
+// ln((1 + a) / (1 - a)) = 2 atanh(a), as a series
+constexpr double log_gamma(const double relative_accuracy)
+{
+    const double a2 = relative_accuracy * relative_accuracy;
+    double term = relative_accuracy;
+    double sum = 0.0;
+    for (double k = 1.0; term / k > 1e-17; k += 2.0)
+    {
+        sum += term / k;
+        term *= a2;
+    }
+    return 2.0 * sum;
+}
+
+constexpr std::int32_t ceil_to_int(const double value)
+{
+    const auto truncated = static_cast<std::int32_t>(value);
+    return static_cast<double>(truncated) < value ? truncated + 1 : truncated;
+}
+}  // namespace fixed_containers::fixed_dd_sketch_detail
+
+namespace fixed_containers
+{
+/**
+ * Quantile sketch (DDSketch) of non-negative values, with at most MAXIMUM_BUCKET_COUNT buckets in
+ * a FixedVector. Quantiles are reported with a relative error of at most `relative_accuracy()`
+ * (1% by default), for any distribution, as long as the buckets do not run out. Sketches with the
+ * same accuracy can be merged, with the same guarantee.
+ *
+ * Each bucket covers a range of values whose bounds are at most (1 + a) / (1 - a) apart, so
+ * latencies from 1us to 1s take about 700 buckets at 1%. When a new bucket is needed and there is
+ * no room, the two lowest buckets are merged: accuracy is given up on the lowest quantiles, and
+ * the high ones, which matter for latency, keep it.
+ *
+ * Bucket indices come from a cubic approximation of log2 on the bits of the value, rather than
+ * `std::log()`, so that everything is constexpr. `record()` is O(log buckets) plus, when a new
+ * bucket is made, O(buckets).
+ * Properties:
+ *  - constexpr
+ *  - trivially copyable
+ *  - standard layout
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ */
+template <std::size_t MAXIMUM_BUCKET_COUNT>
+class FixedDdSketch
+{
+    static_assert(MAXIMUM_BUCKET_COUNT >= 2);
+
+    template <std::size_t>
+    friend class FixedDdSketch;
+
+    using Bucket = fixed_dd_sketch_detail::Bucket;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_bucket_count() noexcept
+    {
+        return MAXIMUM_BUCKET_COUNT;
+    }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    FixedVector<Bucket, MAXIMUM_BUCKET_COUNT> IMPLEMENTATION_DETAIL_DO_NOT_USE_buckets_;
+    std::uint64_t IMPLEMENTATION_DETAIL_DO_NOT_USE_zero_count_;
+    std::uint64_t IMPLEMENTATION_DETAIL_DO_NOT_USE_count_;
+    double IMPLEMENTATION_DETAIL_DO_NOT_USE_sum_;
+    double IMPLEMENTATION_DETAIL_DO_NOT_USE_min_;
+    double IMPLEMENTATION_DETAIL_DO_NOT_USE_max_;
+    double IMPLEMENTATION_DETAIL_DO_NOT_USE_relative_accuracy_;
+    double IMPLEMENTATION_DETAIL_DO_NOT_USE_multiplier_;
+
+public:
+    constexpr FixedDdSketch() noexcept
+      : FixedDdSketch{0.01}
+    {
+    }
+
+    explicit constexpr FixedDdSketch(const double relative_accuracy) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_buckets_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_zero_count_{0}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_count_{0}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_sum_{0.0}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_min_{std::numeric_limits<double>::max()}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_max_{0.0}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_relative_accuracy_{relative_accuracy}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_multiplier_{}
+    {
+        assert_or_abort(relative_accuracy > 0.0 && relative_accuracy < 1.0);
+        // A bucket spans 1 / multiplier of the approximate log2, which is at most
+        // 1 / (multiplier * MIN_SLOPE) of the natural log. That has to fit in ln(gamma).
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_multiplier_ =
+            1.0 / (fixed_dd_sketch_detail::MIN_SLOPE *
+                   fixed_dd_sketch_detail::log_gamma(relative_accuracy));
+    }
+
+public:
+    // Precondition: value >= 0. A `count` of 0 records nothing, not even the value as a min or max.
+    constexpr void record(const double value, const std::uint64_t count = 1) noexcept
+    {
+        assert_or_abort(value >= 0.0);
+        if (count == 0)
+        {
+            return;
+        }
+        if (value < std::numeric_limits<double>::min())
+        {
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_zero_count_ += count;
+        }
+        else
+        {
+            add_to_bucket(index_of(value), count);
+        }
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_count_ += count;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_sum_ += value * static_cast<double>(count);
+        update_min_and_max(value, value);
+    }
+
+    // Precondition: both sketches have the same relative accuracy
+    template <std::size_t MAXIMUM_BUCKET_COUNT_2>
+    constexpr void merge(const FixedDdSketch<MAXIMUM_BUCKET_COUNT_2>& other) noexcept
+    {
+        assert_or_abort(relative_accuracy() == other.relative_accuracy());
+        for (const Bucket& bucket : other.buckets())
+        {
+            add_to_bucket(bucket.index, bucket.count);
+        }
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_zero_count_ +=
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_zero_count_;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_count_ += other.count();
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_sum_ += other.sum();
+        if (!other.empty())
+        {
+            update_min_and_max(other.min(), other.max());
+        }
+    }
+
+    constexpr void clear() noexcept { *this = FixedDdSketch{relative_accuracy()}; }
+
+    [[nodiscard]] constexpr double relative_accuracy() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_relative_accuracy_;
+    }
+    [[nodiscard]] constexpr std::size_t bucket_count() const noexcept { return buckets().size(); }
+
+    [[nodiscard]] constexpr std::uint64_t count() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_count_;
+    }
+    [[nodiscard]] constexpr bool empty() const noexcept { return count() == 0; }
+    [[nodiscard]] constexpr double sum() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_sum_;
+    }
+    [[nodiscard]] constexpr double mean() const noexcept
+    {
+        return empty() ? 0.0 : sum() / static_cast<double>(count());
+    }
+
+    // Exact smallest and largest recorded values, 0 when empty
+    [[nodiscard]] constexpr double min() const noexcept
+    {
+        return empty() ? 0.0 : IMPLEMENTATION_DETAIL_DO_NOT_USE_min_;
+    }
+    [[nodiscard]] constexpr double max() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_max_;
+    }
+
+    // The value of rank `quantile * (count() - 1)`, for `quantile` in [0, 1]. 0 when empty.
+    // Quantiles 0 and 1 are the exact `min()` and `max()`.
+    [[nodiscard]] constexpr double value_at_quantile(const double quantile) const noexcept
+    {
+        if (empty() || quantile <= 0.0)
+        {
+            return min();
+        }
+        if (quantile >= 1.0)
+        {
+            return max();
+        }
+        const double rank = quantile * static_cast<double>(count() - 1);
+
+        double cumulative_count = static_cast<double>(IMPLEMENTATION_DETAIL_DO_NOT_USE_zero_count_);
+        if (cumulative_count > rank)
+        {
+            return min();
+        }
+        for (const Bucket& bucket : buckets())
+        {
+            cumulative_count += static_cast<double>(bucket.count);
+            if (cumulative_count > rank)
+            {
+                return std::clamp(value_of(bucket.index), min(), max());
+            }
+        }
+        return max();
+    }
+
+    [[nodiscard]] constexpr bool operator==(const FixedDdSketch& other) const = default;
+
+private:
+    constexpr FixedVector<Bucket, MAXIMUM_BUCKET_COUNT>& buckets()
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_buckets_;
+    }
+    constexpr const FixedVector<Bucket, MAXIMUM_BUCKET_COUNT>& buckets() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_buckets_;
+    }
+
+    [[nodiscard]] constexpr std::int32_t index_of(const double value) const
+    {
+        return fixed_dd_sketch_detail::ceil_to_int(
+            fixed_dd_sketch_detail::approximate_log2(value) *
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_multiplier_);
+    }
+
+    // Bucket `index` holds the values in (lower, upper], with upper <= lower * gamma. Reporting
+    // lower * (1 + a) is then off by at most a, relative to any value of the bucket.
+    [[nodiscard]] constexpr double value_of(const std::int32_t index) const
+    {
+        const double lower = fixed_dd_sketch_detail::approximate_exp2(
+            static_cast<double>(index - 1) / IMPLEMENTATION_DETAIL_DO_NOT_USE_multiplier_);
+        return lower * (1.0 + relative_accuracy());
+    }
+
+    constexpr void add_to_bucket(const std::int32_t index, const std::uint64_t count)
+    {
+        auto it = std::lower_bound(buckets().begin(),
+                                   buckets().end(),
+                                   index,
+                                   [](const Bucket& bucket, const std::int32_t i)
+                                   { return bucket.index < i; });
+        if (it != buckets().end() && it->index == index)
+        {
+            it->count += count;
+            return;
+        }
+
+        if (buckets().size() == MAXIMUM_BUCKET_COUNT)
+        {
+            // Fold the lowest bucket into the next one, which then also stands for anything lower
+            const std::uint64_t lowest_count = buckets().front().count;
+            buckets().erase(buckets().begin());
+            buckets().front().count += lowest_count;
+            if (index <= buckets().front().index)
+            {
+                buckets().front().count += count;
+                return;
+            }
+            it = std::lower_bound(buckets().begin(),
+                                  buckets().end(),
+                                  index,
+                                  [](const Bucket& bucket, const std::int32_t i)
+                                  { return bucket.index < i; });
+        }
+        buckets().insert(it, Bucket{index, count});
+    }
+
+    constexpr void update_min_and_max(const double min_value, const double max_value)
+    {
+        double& current_min = IMPLEMENTATION_DETAIL_DO_NOT_USE_min_;
+        double& current_max = IMPLEMENTATION_DETAIL_DO_NOT_USE_max_;
+        current_min = std::min(current_min, min_value);
+        current_max = std::max(current_max, max_value);
+    }
+};
+
+}  // namespace fixed_containers
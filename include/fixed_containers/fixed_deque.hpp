@@ -15,11 +15,13 @@
 
 #include <algorithm>
 #include <array>
+#include <compare>
 #include <cstddef>
 #include <initializer_list>
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <span>
 #include <type_traits>
 
 namespace fixed_containers::fixed_deque_detail
@@ -33,6 +35,9 @@ namespace fixed_containers::fixed_deque_detail
 template <typename T, std::size_t MAXIMUM_SIZE, customize::SequenceContainerChecking CheckingType>
 class FixedDequeBase
 {
+    template <typename, std::size_t, customize::SequenceContainerChecking>
+    friend class FixedDequeBase;
+
     using OptionalT = optional_storage_detail::OptionalStorage<T>;
     // std::deque has the following restrictions too
     static_assert(IsNotReference<T>, "References are not allowed");
@@ -496,12 +501,37 @@ public:
             }
         }
 
+        if constexpr (algorithm::BitwiseEqualityComparable<T>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return size() == other.size() &&
+                       algorithm::segmented_mismatch_index(
+                           contiguous_segments(), other.contiguous_segments(), size()) == size();
+            }
+        }
+
         return std::ranges::equal(*this, other);
     }
 
     template <std::size_t MAXIMUM_SIZE_2, customize::SequenceContainerChecking CheckingType2>
     constexpr auto operator<=>(const FixedDequeBase<T, MAXIMUM_SIZE_2, CheckingType2>& other) const
     {
+        if constexpr (algorithm::BitwiseEqualityComparable<T>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const std::size_t common_size = (std::min)(size(), other.size());
+                const std::size_t i = algorithm::segmented_mismatch_index(
+                    contiguous_segments(), other.contiguous_segments(), common_size);
+                if (i != common_size)
+                {
+                    return std::compare_three_way{}(at(i), other.at(i));
+                }
+                return std::compare_three_way{}(size(), other.size());
+            }
+        }
+
         return std::lexicographical_compare_three_way(
             cbegin(), cend(), other.cbegin(), other.cend());
     }
@@ -692,6 +722,24 @@ private:
         return increment_index_with_wraparound(front_index(), size());
     }
 
+    // The elements as (at most) two contiguous runs: from the front up to the end of the storage,
+    // then wrapped around from the start of the storage. Only usable at run-time, as it does
+    // pointer arithmetic across the OptionalT wrappers.
+    [[nodiscard]] std::array<std::span<const T>, 2> contiguous_segments() const
+    {
+        static_assert(sizeof(OptionalT) == sizeof(T));
+        if (empty())
+        {
+            return {};
+        }
+        const std::size_t front = front_index();
+        const std::size_t first_size = (std::min)(size(), MAXIMUM_SIZE - front);
+        const T* storage = std::addressof(optional_storage_detail::get(*array().data()));
+        return {std::span<const T>{std::next(storage, static_cast<std::ptrdiff_t>(front)),
+                                   first_size},
+                std::span<const T>{storage, size() - first_size}};
+    }
+
     constexpr const Array& array() const { return IMPLEMENTATION_DETAIL_DO_NOT_USE_array_; }
     constexpr Array& array() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_array_; }
     constexpr const StartingIntegerAndDistance& starting_index_and_size() const
@@ -3,7 +3,10 @@
 #include "fixed_containers/fixed_index_based_storage.hpp"
 
 #include <array>
+#include <cstddef>
 #include <limits>
+#include <span>
+#include <utility>
 
 namespace fixed_containers::fixed_doubly_linked_list_detail
 {
@@ -14,6 +17,157 @@ struct LinkedListIndices
     IndexType next{};
 };
 
+// Relinking algorithms. They only touch the chain of indices and never move payloads. A chain may
+// hold several lists, each anchored at its own sentinel entry, so that nodes can be moved between
+// them in O(1).
+
+template <typename IndexType>
+constexpr void chain_unlink(const std::span<LinkedListIndices<IndexType>> chain, const IndexType i)
+{
+    chain[chain[i].prev].next = chain[i].next;
+    chain[chain[i].next].prev = chain[i].prev;
+}
+
+// Moves [first, last) right before `position`, which must not be inside (first, last). The range
+// and `position` may belong to different lists of the same chain.
+template <typename IndexType>
+constexpr void chain_splice_before(const std::span<LinkedListIndices<IndexType>> chain,
+                                   const IndexType position,
+                                   const IndexType first,
+                                   const IndexType last)
+{
+    if (first == last || position == first || position == last)
+    {
+        return;
+    }
+
+    const IndexType range_back = chain[last].prev;
+    const IndexType range_prev = chain[first].prev;
+    chain[range_prev].next = last;
+    chain[last].prev = range_prev;
+
+    const IndexType position_prev = chain[position].prev;
+    chain[position_prev].next = first;
+    chain[first].prev = position_prev;
+    chain[range_back].next = position;
+    chain[position].prev = range_back;
+}
+
+template <typename IndexType>
+constexpr void chain_reverse(const std::span<LinkedListIndices<IndexType>> chain,
+                             const IndexType sentinel)
+{
+    IndexType i = sentinel;
+    do
+    {
+        std::swap(chain[i].prev, chain[i].next);
+        i = chain[i].prev;  // Formerly next
+    } while (i != sentinel);
+}
+
+// Stable, in-place, bottom-up merge sort of the list anchored at `sentinel`. `less` compares two
+// indices. The list is treated as singly-linked (terminated by the sentinel) while merging runs of
+// doubling length, and the prev links are restored in a final pass. O(n log n) comparisons and
+// O(1) extra space.
+template <typename IndexType, typename Less>
+constexpr void chain_sort(const std::span<LinkedListIndices<IndexType>> chain,
+                          const IndexType sentinel,
+                          Less less)
+{
+    IndexType head = chain[sentinel].next;
+    if (head == sentinel || chain[head].next == sentinel)
+    {
+        return;
+    }
+
+    for (std::size_t run_length = 1;; run_length *= 2)
+    {
+        IndexType p = head;
+        IndexType tail = sentinel;  // The sentinel means "no tail yet"
+        std::size_t merge_count = 0;
+        while (p != sentinel)
+        {
+            merge_count++;
+            IndexType q = p;
+            std::size_t p_size = 0;
+            for (; p_size < run_length && q != sentinel; p_size++)
+            {
+                q = chain[q].next;
+            }
+
+            std::size_t q_size = run_length;
+            while (p_size > 0 || (q_size > 0 && q != sentinel))
+            {
+                IndexType e{};
+                // Taking from `p` on ties keeps the sort stable
+                if (p_size != 0 && (q_size == 0 || q == sentinel || !less(q, p)))
+                {
+                    e = p;
+                    p = chain[p].next;
+                    p_size--;
+                }
+                else
+                {
+                    e = q;
+                    q = chain[q].next;
+                    q_size--;
+                }
+
+                if (tail == sentinel)
+                {
+                    head = e;
+                }
+                else
+                {
+                    chain[tail].next = e;
+                }
+                tail = e;
+            }
+            p = q;
+        }
+        chain[tail].next = sentinel;
+
+        if (merge_count <= 1)
+        {
+            break;
+        }
+    }
+
+    IndexType prev = sentinel;
+    for (IndexType i = head; i != sentinel; i = chain[i].next)
+    {
+        chain[i].prev = prev;
+        prev = i;
+    }
+    chain[sentinel].next = head;
+    chain[sentinel].prev = prev;
+}
+
+// Moves every node of the sorted list at `source_sentinel` into the sorted list at
+// `destination_sentinel`, keeping it sorted. Equivalent nodes of the destination stay first.
+template <typename IndexType, typename Less>
+constexpr void chain_merge(const std::span<LinkedListIndices<IndexType>> chain,
+                           const IndexType destination_sentinel,
+                           const IndexType source_sentinel,
+                           Less less)
+{
+    IndexType i = chain[destination_sentinel].next;
+    IndexType j = chain[source_sentinel].next;
+    while (j != source_sentinel)
+    {
+        if (i == destination_sentinel || less(j, i))
+        {
+            const IndexType next_j = chain[j].next;
+            chain_splice_before(chain, i, j, next_j);
+            j = next_j;
+        }
+        else
+        {
+            i = chain[i].next;
+        }
+    }
+}
+
 template <typename T, std::size_t MAXIMUM_SIZE, typename IndexType = std::size_t>
 class FixedDoublyLinkedListBase
 {
@@ -113,6 +267,25 @@ public:
         return i;
     }
 
+    // Moves [first, last) of this list right before `position`, without touching the payloads
+    constexpr void splice_before_index(const IndexType position,
+                                       const IndexType first,
+                                       const IndexType last)
+    {
+        chain_splice_before(chain_span(), position, first, last);
+    }
+
+    constexpr void reverse() { chain_reverse(chain_span(), NULL_INDEX); }
+
+    template <typename Compare>
+    constexpr void sort(Compare comp)
+    {
+        chain_sort(chain_span(),
+                   NULL_INDEX,
+                   [this, &comp](const IndexType a, const IndexType b)
+                   { return static_cast<bool>(comp(at(a), at(b))); });
+    }
+
 public:
     [[nodiscard]] constexpr const IndexType& next_of(IndexType i) const
     {
@@ -135,6 +308,7 @@ private:
 
     constexpr const ChainType& chain() const { return IMPLEMENTATION_DETAIL_DO_NOT_USE_chain_; }
     constexpr ChainType& chain() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_chain_; }
+    constexpr std::span<ChainEntryType> chain_span() { return chain(); }
 
     constexpr void increment_size(const IndexType n = 1)
     {
@@ -0,0 +1,325 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace fixed_containers::fixed_hdr_histogram_detail
+{
+constexpr std::uint64_t pow10(const std::size_t exponent)
+{
+    std::uint64_t out = 1;
+    for (std::size_t i = 0; i < exponent; i++)
+    {
+        out *= 10;
+    }
+    return out;
+}
+
+// The bucket layout of HdrHistogram. Values are grouped into buckets that each cover twice the
+// range of the previous one, and each bucket is split into sub-buckets of equal width, enough of
+// them to tell apart values that differ in the SIGNIFICANT_DIGITS-th decimal digit. The lower
+// half of every bucket but the first overlaps the previous bucket, so only upper halves are kept.
+template <std::uint64_t LOWEST_DISCERNIBLE_VALUE,
+          std::uint64_t HIGHEST_TRACKABLE_VALUE,
+          std::size_t SIGNIFICANT_DIGITS>
+struct HdrLayout
+{
+    static_assert(SIGNIFICANT_DIGITS >= 1 && SIGNIFICANT_DIGITS <= 5);
+    static_assert(LOWEST_DISCERNIBLE_VALUE >= 1);
+    static_assert(HIGHEST_TRACKABLE_VALUE >= 2 * LOWEST_DISCERNIBLE_VALUE);
+    static_assert(HIGHEST_TRACKABLE_VALUE <= static_cast<std::uint64_t>(INT64_MAX));
+
+    static constexpr std::uint64_t LARGEST_VALUE_WITH_SINGLE_UNIT_RESOLUTION =
+        2 * pow10(SIGNIFICANT_DIGITS);
+    static constexpr std::size_t SUB_BUCKET_COUNT_MAGNITUDE =
+        std::bit_width(LARGEST_VALUE_WITH_SINGLE_UNIT_RESOLUTION - 1);
+    static constexpr std::size_t SUB_BUCKET_HALF_COUNT_MAGNITUDE = SUB_BUCKET_COUNT_MAGNITUDE - 1;
+    static constexpr std::uint64_t SUB_BUCKET_COUNT = std::uint64_t{1}
+                                                      << SUB_BUCKET_COUNT_MAGNITUDE;
+    static constexpr std::uint64_t SUB_BUCKET_HALF_COUNT = SUB_BUCKET_COUNT / 2;
+    static constexpr std::size_t UNIT_MAGNITUDE = std::bit_width(LOWEST_DISCERNIBLE_VALUE) - 1;
+    static constexpr std::uint64_t SUB_BUCKET_MASK = (SUB_BUCKET_COUNT - 1) << UNIT_MAGNITUDE;
+    static constexpr std::size_t LEADING_ZERO_COUNT_BASE =
+        64 - UNIT_MAGNITUDE - SUB_BUCKET_COUNT_MAGNITUDE;
+
+    static constexpr std::size_t bucket_count()
+    {
+        std::uint64_t smallest_untrackable_value = SUB_BUCKET_COUNT << UNIT_MAGNITUDE;
+        std::size_t out = 1;
+        while (smallest_untrackable_value <= HIGHEST_TRACKABLE_VALUE)
+        {
+            if (smallest_untrackable_value > static_cast<std::uint64_t>(INT64_MAX) / 2)
+            {
+                return out + 1;
+            }
+            smallest_untrackable_value <<= 1U;
+            out++;
+        }
+        return out;
+    }
+
+    static constexpr std::size_t BUCKET_COUNT = bucket_count();
+    static constexpr std::size_t COUNTS_LENGTH = (BUCKET_COUNT + 1) * SUB_BUCKET_HALF_COUNT;
+
+    static constexpr std::size_t bucket_index(const std::uint64_t value)
+    {
+        return LEADING_ZERO_COUNT_BASE -
+               static_cast<std::size_t>(std::countl_zero(value | SUB_BUCKET_MASK));
+    }
+    static constexpr std::uint64_t sub_bucket_index(const std::uint64_t value,
+                                                    const std::size_t bucket)
+    {
+        return value >> (bucket + UNIT_MAGNITUDE);
+    }
+    static constexpr std::size_t counts_index(const std::size_t bucket,
+                                              const std::uint64_t sub_bucket)
+    {
+        return static_cast<std::size_t>(((bucket + 1) << SUB_BUCKET_HALF_COUNT_MAGNITUDE) +
+                                        sub_bucket - SUB_BUCKET_HALF_COUNT);
+    }
+    static constexpr std::size_t counts_index_for(const std::uint64_t value)
+    {
+        const std::size_t bucket = bucket_index(value);
+        return counts_index(bucket, sub_bucket_index(value, bucket));
+    }
+
+    static constexpr std::uint64_t value_from_index(const std::size_t bucket,
+                                                    const std::uint64_t sub_bucket)
+    {
+        return sub_bucket << (bucket + UNIT_MAGNITUDE);
+    }
+    static constexpr std::uint64_t value_at_counts_index(const std::size_t index)
+    {
+        std::uint64_t sub_bucket = (index & (SUB_BUCKET_HALF_COUNT - 1)) + SUB_BUCKET_HALF_COUNT;
+        std::size_t bucket = index >> SUB_BUCKET_HALF_COUNT_MAGNITUDE;
+        if (bucket == 0)
+        {
+            sub_bucket -= SUB_BUCKET_HALF_COUNT;
+        }
+        else
+        {
+            bucket--;
+        }
+        return value_from_index(bucket, sub_bucket);
+    }
+
+    static constexpr std::uint64_t size_of_equivalent_value_range(const std::uint64_t value)
+    {
+        const std::size_t bucket = bucket_index(value);
+        const std::uint64_t sub_bucket = sub_bucket_index(value, bucket);
+        const std::size_t adjusted_bucket = sub_bucket >= SUB_BUCKET_COUNT ? bucket + 1 : bucket;
+        return std::uint64_t{1} << (UNIT_MAGNITUDE + adjusted_bucket);
+    }
+    static constexpr std::uint64_t lowest_equivalent_value(const std::uint64_t value)
+    {
+        const std::size_t bucket = bucket_index(value);
+        return value_from_index(bucket, sub_bucket_index(value, bucket));
+    }
+};
+}  // namespace fixed_containers::fixed_hdr_histogram_detail
+
+namespace fixed_containers
+{
+/**
+ * Fixed-size histogram of integer values in [0, HIGHEST_TRACKABLE_VALUE], with the bucket layout
+ * of HdrHistogram: any recorded value is reported to within SIGNIFICANT_DIGITS decimal digits
+ * (and never finer than LOWEST_DISCERNIBLE_VALUE). For example, with 3 digits, 1'234'567 is
+ * reported as a value in [1'233'920, 1'234'943]. All counts are in an inline `std::array`.
+ *
+ * `record()` is O(1): a count-leading-zeros, two shifts and an increment. Percentile queries and
+ * `merge()` are O(counts length), which is fixed at compile time by the three parameters.
+ * Properties:
+ *  - constexpr
+ *  - trivially copyable
+ *  - standard layout
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ */
+template <std::uint64_t LOWEST_DISCERNIBLE_VALUE,
+          std::uint64_t HIGHEST_TRACKABLE_VALUE,
+          std::size_t SIGNIFICANT_DIGITS>
+class FixedHdrHistogram
+{
+    using Layout = fixed_hdr_histogram_detail::
+        HdrLayout<LOWEST_DISCERNIBLE_VALUE, HIGHEST_TRACKABLE_VALUE, SIGNIFICANT_DIGITS>;
+
+public:
+    using value_type = std::uint64_t;
+    using count_type = std::uint64_t;
+
+    [[nodiscard]] static constexpr std::size_t counts_length() noexcept
+    {
+        return Layout::COUNTS_LENGTH;
+    }
+    [[nodiscard]] static constexpr value_type lowest_discernible_value() noexcept
+    {
+        return LOWEST_DISCERNIBLE_VALUE;
+    }
+    [[nodiscard]] static constexpr value_type highest_trackable_value() noexcept
+    {
+        return HIGHEST_TRACKABLE_VALUE;
+    }
+
+    // Values that are reported as the same value
+    [[nodiscard]] static constexpr value_type lowest_equivalent_value(const value_type value)
+    {
+        return Layout::lowest_equivalent_value(value);
+    }
+    [[nodiscard]] static constexpr value_type highest_equivalent_value(const value_type value)
+    {
+        return Layout::lowest_equivalent_value(value) +
+               Layout::size_of_equivalent_value_range(value) - 1;
+    }
+    [[nodiscard]] static constexpr bool values_are_equivalent(const value_type lhs,
+                                                              const value_type rhs)
+    {
+        return lowest_equivalent_value(lhs) == lowest_equivalent_value(rhs);
+    }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    std::array<count_type, Layout::COUNTS_LENGTH> IMPLEMENTATION_DETAIL_DO_NOT_USE_counts_;
+    count_type IMPLEMENTATION_DETAIL_DO_NOT_USE_total_count_;
+    value_type IMPLEMENTATION_DETAIL_DO_NOT_USE_min_;
+    value_type IMPLEMENTATION_DETAIL_DO_NOT_USE_max_;
+
+public:
+    constexpr FixedHdrHistogram() noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_counts_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_total_count_{0}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_min_{std::numeric_limits<value_type>::max()}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_max_{0}
+    {
+    }
+
+public:
+    /**
+     * Records `count` occurrences of `value`. Values above `highest_trackable_value()` are not
+     * recorded and return false. A `count` of 0 records nothing, not even `value` as the min or
+     * max.
+     */
+    constexpr bool record(const value_type value, const count_type count = 1) noexcept
+    {
+        if (value > HIGHEST_TRACKABLE_VALUE)
+        {
+            return false;
+        }
+        if (count == 0)
+        {
+            return true;
+        }
+        counts()[Layout::counts_index_for(value)] += count;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_total_count_ += count;
+        update_min_and_max(value, value);
+        return true;
+    }
+
+    // Adds the counts of `other`, e.g. to aggregate the histograms of several threads
+    constexpr void merge(const FixedHdrHistogram& other) noexcept
+    {
+        for (std::size_t i = 0; i < Layout::COUNTS_LENGTH; i++)
+        {
+            counts()[i] += other.counts()[i];
+        }
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_total_count_ += other.total_count();
+        update_min_and_max(other.IMPLEMENTATION_DETAIL_DO_NOT_USE_min_,
+                           other.IMPLEMENTATION_DETAIL_DO_NOT_USE_max_);
+    }
+
+    constexpr void clear() noexcept { *this = FixedHdrHistogram{}; }
+
+    [[nodiscard]] constexpr count_type total_count() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_total_count_;
+    }
+    [[nodiscard]] constexpr bool empty() const noexcept { return total_count() == 0; }
+
+    // Exact smallest and largest recorded values, 0 when empty
+    [[nodiscard]] constexpr value_type min() const noexcept
+    {
+        return empty() ? 0 : IMPLEMENTATION_DETAIL_DO_NOT_USE_min_;
+    }
+    [[nodiscard]] constexpr value_type max() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_max_;
+    }
+
+    [[nodiscard]] constexpr count_type count_at_value(const value_type value) const noexcept
+    {
+        if (value > HIGHEST_TRACKABLE_VALUE)
+        {
+            return 0;
+        }
+        return counts()[Layout::counts_index_for(value)];
+    }
+
+    /**
+     * The smallest value that at least `percentile` percent of the recorded values are less than
+     * or equivalent to, reported as the highest equivalent value. 0 when empty.
+     */
+    [[nodiscard]] constexpr value_type value_at_percentile(const double percentile) const noexcept
+    {
+        const double clamped_percentile = std::clamp(percentile, 0.0, 100.0);
+        const auto count_at_percentile = std::max<count_type>(
+            1,
+            static_cast<count_type>(
+                ((clamped_percentile / 100.0) * static_cast<double>(total_count())) + 0.5));
+
+        count_type cumulative_count = 0;
+        for (std::size_t i = 0; i < Layout::COUNTS_LENGTH; i++)
+        {
+            cumulative_count += counts()[i];
+            if (cumulative_count >= count_at_percentile)
+            {
+                return std::min(highest_equivalent_value(Layout::value_at_counts_index(i)), max());
+            }
+        }
+        return 0;
+    }
+
+    // Mean of the recorded values, each taken as the middle of its equivalent range
+    [[nodiscard]] constexpr double mean() const noexcept
+    {
+        if (empty())
+        {
+            return 0.0;
+        }
+        double total = 0.0;
+        for (std::size_t i = 0; i < Layout::COUNTS_LENGTH; i++)
+        {
+            if (counts()[i] != 0)
+            {
+                const value_type value = Layout::value_at_counts_index(i);
+                const value_type middle =
+                    value + (Layout::size_of_equivalent_value_range(value) / 2);
+                total += static_cast<double>(counts()[i]) * static_cast<double>(middle);
+            }
+        }
+        return total / static_cast<double>(total_count());
+    }
+
+    [[nodiscard]] constexpr bool operator==(const FixedHdrHistogram& other) const = default;
+
+private:
+    constexpr std::array<count_type, Layout::COUNTS_LENGTH>& counts()
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_counts_;
+    }
+    constexpr const std::array<count_type, Layout::COUNTS_LENGTH>& counts() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_counts_;
+    }
+
+    constexpr void update_min_and_max(const value_type min_value, const value_type max_value)
+    {
+        value_type& current_min = IMPLEMENTATION_DETAIL_DO_NOT_USE_min_;
+        value_type& current_max = IMPLEMENTATION_DETAIL_DO_NOT_USE_max_;
+        current_min = std::min(current_min, min_value);
+        current_max = std::max(current_max, max_value);
+    }
+};
+
+}  // namespace fixed_containers
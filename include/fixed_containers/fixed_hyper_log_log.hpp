@@ -0,0 +1,163 @@
+#pragma once
+
+#include "fixed_containers/wyhash.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace fixed_containers::fixed_hyper_log_log_detail
+{
+inline constexpr std::uint64_t SEED = 0x8ebc6af09c88c6e3ULL;
+inline constexpr double LN_2 = 0.693147180559945309417;
+inline constexpr double SQRT_2 = 1.414213562373095048802;
+
+// Natural logarithm, as `std::log()` is not constexpr. Precondition: `value` is positive and normal
+constexpr double log(const double value)
+{
+    const auto bits = std::bit_cast<std::uint64_t>(value);
+    auto exponent = static_cast<std::int64_t>((bits >> 52U) & 0x7FFU) - 1023;
+    double significand =
+        std::bit_cast<double>((bits & 0x000FFFFFFFFFFFFFULL) | 0x3FF0000000000000ULL);
+    if (significand > SQRT_2)
+    {
+        significand /= 2.0;
+        exponent++;
+    }
+    // ln(s) = 2 atanh((s - 1) / (s + 1)), with |t| < 0.18 here
+    const double t = (significand - 1.0) / (significand + 1.0);
+    const double t2 = t * t;
+    double term = t;
+    double sum = 0.0;
+    for (double k = 1.0; k < 30.0; k += 2.0)
+    {
+        sum += term / k;
+        term *= t2;
+    }
+    return (static_cast<double>(exponent) * LN_2) + (2.0 * sum);
+}
+
+constexpr double alpha(const std::size_t register_count)
+{
+    switch (register_count)
+    {
+    case 16:
+        return 0.673;
+    case 32:
+        return 0.697;
+    case 64:
+        return 0.709;
+    default:
+        return 0.7213 / (1.0 + (1.079 / static_cast<double>(register_count)));
+    }
+}
+}  // namespace fixed_containers::fixed_hyper_log_log_detail
+
+namespace fixed_containers
+{
+/**
+ * HyperLogLog: estimates the number of distinct keys in a stream, in 2^PRECISION one-byte
+ * registers stored inline. The standard error is about 1.04 / sqrt(2^PRECISION), e.g. 1.6% in
+ * 4 KiB at PRECISION 12, regardless of the count. Small counts use linear counting, which is
+ * close to exact. Hashes are 64-bit, so there is no large range correction.
+ *
+ * Sketches with the same precision and hash can be merged, e.g. one per thread, by taking the
+ * maximum of each register: the result is the sketch of the union of both streams.
+ * Properties:
+ *  - constexpr
+ *  - trivially copyable (if Hash is)
+ *  - standard layout
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ */
+template <typename K, std::size_t PRECISION = 12, class Hash = wyhash::hash<K>>
+class FixedHyperLogLog
+{
+    static_assert(PRECISION >= 4 && PRECISION <= 18);
+
+    static constexpr std::size_t REGISTER_COUNT = std::size_t{1} << PRECISION;
+
+public:
+    using key_type = K;
+    using hasher = Hash;
+
+    [[nodiscard]] static constexpr std::size_t register_count() noexcept { return REGISTER_COUNT; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    std::array<std::uint8_t, REGISTER_COUNT> IMPLEMENTATION_DETAIL_DO_NOT_USE_registers_;
+    Hash IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_;
+
+public:
+    constexpr FixedHyperLogLog(const Hash& hash = Hash()) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_registers_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_(hash)
+    {
+    }
+
+public:
+    constexpr void add(const K& key)
+    {
+        // Ranks read up to all bits of the hash, which a single multiplication does not randomize
+        const std::uint64_t hash = wyhash_detail::hash_with_seed(
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_(key), fixed_hyper_log_log_detail::SEED);
+        const auto index = static_cast<std::size_t>(hash >> (64U - PRECISION));
+        // The sentinel bit caps the rank when all remaining bits are 0
+        const std::uint64_t rest = (hash << PRECISION) | (std::uint64_t{1} << (PRECISION - 1));
+        const auto rank = static_cast<std::uint8_t>(std::countl_zero(rest) + 1);
+        std::uint8_t& reg = registers()[index];
+        reg = std::max(reg, rank);
+    }
+
+    [[nodiscard]] constexpr double estimate() const noexcept
+    {
+        double inverse_sum = 0.0;
+        std::size_t zero_count = 0;
+        for (const std::uint8_t reg : registers())
+        {
+            inverse_sum += 1.0 / static_cast<double>(std::uint64_t{1} << reg);
+            zero_count += reg == 0 ? 1 : 0;
+        }
+        constexpr auto M = static_cast<double>(REGISTER_COUNT);
+        const double raw = fixed_hyper_log_log_detail::alpha(REGISTER_COUNT) * M * M / inverse_sum;
+        if (raw <= 2.5 * M && zero_count != 0)
+        {
+            return M * fixed_hyper_log_log_detail::log(M / static_cast<double>(zero_count));
+        }
+        return raw;
+    }
+
+    // Precondition: `other` hashes the same way
+    constexpr void merge(const FixedHyperLogLog& other) noexcept
+    {
+        for (std::size_t i = 0; i < REGISTER_COUNT; i++)
+        {
+            registers()[i] = std::max(registers()[i], other.registers()[i]);
+        }
+    }
+
+    constexpr void clear() noexcept { registers().fill(0); }
+
+    [[nodiscard]] constexpr bool empty() const noexcept
+    {
+        return std::ranges::all_of(registers(), [](const std::uint8_t reg) { return reg == 0; });
+    }
+
+    [[nodiscard]] constexpr bool operator==(const FixedHyperLogLog& other) const
+    {
+        return registers() == other.registers();
+    }
+
+private:
+    constexpr std::array<std::uint8_t, REGISTER_COUNT>& registers()
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_registers_;
+    }
+    constexpr const std::array<std::uint8_t, REGISTER_COUNT>& registers() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_registers_;
+    }
+};
+
+}  // namespace fixed_containers
@@ -32,6 +32,8 @@ class FixedIndexBasedPoolStorage
 public:
     using size_type = typename IndexOrValueArray::size_type;
     using difference_type = typename IndexOrValueArray::difference_type;
+    // Distance in bytes between the elements at two consecutive indices
+    static constexpr std::size_t ELEMENT_STRIDE = sizeof(IndexOrValueT);
 
 public:  // Public so this type is a structural type and can thus be used in template parameters
     IndexOrValueArray IMPLEMENTATION_DETAIL_DO_NOT_USE_array_;
@@ -116,6 +118,8 @@ class FixedIndexBasedContiguousStorage
 public:
     using size_type = typename FixedVector<T, MAXIMUM_SIZE>::size_type;
     using difference_type = typename FixedVector<T, MAXIMUM_SIZE>::difference_type;
+    // Distance in bytes between the elements at two consecutive indices
+    static constexpr std::size_t ELEMENT_STRIDE = sizeof(T);
 
 public:  // Public so this type is a structural type and can thus be used in template parameters
     FixedVector<T, MAXIMUM_SIZE> IMPLEMENTATION_DETAIL_DO_NOT_USE_nodes_{};
@@ -0,0 +1,508 @@
+#pragma once
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/bidirectional_iterator.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_red_black_tree.hpp"
+#include "fixed_containers/map_checking.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <ranges>
+
+namespace fixed_containers::fixed_interval_map_detail
+{
+// What the tree stores for each interval, keyed by its lower bound
+template <class K, class V>
+struct UpperBoundAndValue
+{
+    K upper;
+    V value;
+};
+}  // namespace fixed_containers::fixed_interval_map_detail
+
+namespace fixed_containers
+{
+// The half-open interval [lower, upper) and the value it maps to
+template <class K, class V>
+struct IntervalMapEntryView
+{
+    const K& lower;
+    const K& upper;
+    const V& value;
+
+    constexpr bool operator==(const IntervalMapEntryView& other) const
+    {
+        return lower == other.lower && upper == other.upper && value == other.value;
+    }
+};
+
+/**
+ * Fixed-capacity map from non-overlapping half-open intervals [lower, upper) to values, with
+ * maximum number of intervals that is declared at compile-time via template parameter. Adjacent
+ * intervals mapping to equal values are coalesced, so each stored interval is maximal. For
+ * intervals that may overlap, see FixedIntervalTree.
+ * Point lookup, `assign()` and `erase()` of a range are O(log n + number of intervals replaced).
+ * Properties:
+ *  - constexpr
+ *  - retains the copy/move/destruction properties of K, V
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ *  - no recursion
+ */
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          class Compare = std::less<K>,
+          fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS =
+              fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+          template <class /*Would be IsFixedIndexBasedStorage but gcc doesn't like the constraints
+                             here. clang accepts it */
+                    ,
+                    std::size_t>
+          typename StorageTemplate = FixedIndexBasedPoolStorage,
+          customize::MapChecking<K> CheckingType = customize::MapAbortChecking<K, V, MAXIMUM_SIZE>>
+class FixedIntervalMap
+{
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using const_reference = IntervalMapEntryView<K, V>;
+    using reference = const_reference;
+
+private:
+    using NodeIndex = fixed_red_black_tree_detail::NodeIndex;
+    using NodeIndexAndParentIndex = fixed_red_black_tree_detail::NodeIndexAndParentIndex;
+    static constexpr NodeIndex NULL_INDEX = fixed_red_black_tree_detail::NULL_INDEX;
+    using Mapped = fixed_interval_map_detail::UpperBoundAndValue<K, V>;
+    using Tree = fixed_red_black_tree_detail::
+        FixedRedBlackTree<K, Mapped, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate>;
+
+    class ReferenceProvider
+    {
+        const Tree* tree_;
+        NodeIndex current_index_;
+
+    public:
+        constexpr ReferenceProvider() noexcept
+          : ReferenceProvider{nullptr, MAXIMUM_SIZE}
+        {
+        }
+
+        constexpr ReferenceProvider(const Tree* const tree, const NodeIndex& current_index) noexcept
+          : tree_{tree}
+          , current_index_{current_index}
+        {
+        }
+
+        constexpr void advance() noexcept
+        {
+            if (current_index_ == NULL_INDEX)
+            {
+                current_index_ = tree_->index_of_min_at();
+            }
+            else
+            {
+                current_index_ = tree_->index_of_successor_at(current_index_);
+                current_index_ = replace_null_index_with_max_size_for_end_iterator(current_index_);
+            }
+        }
+        constexpr void recede() noexcept
+        {
+            if (current_index_ == MAXIMUM_SIZE)
+            {
+                current_index_ = tree_->index_of_max_at();
+            }
+            else
+            {
+                current_index_ = tree_->index_of_predecessor_at(current_index_);
+            }
+        }
+
+        constexpr const_reference get() const noexcept
+        {
+            const auto node = tree_->node_at(current_index_);
+            return {node.key(), node.value().upper, node.value().value};
+        }
+
+        constexpr bool operator==(const ReferenceProvider& other) const noexcept = default;
+
+        [[nodiscard]] constexpr NodeIndex current_index() const { return current_index_; }
+    };
+
+    template <IteratorDirection DIRECTION>
+    using Iterator = BidirectionalIterator<ReferenceProvider,
+                                           ReferenceProvider,
+                                           IteratorConstness::CONSTANT_ITERATOR,
+                                           DIRECTION>;
+
+    // The tree returns NULL_INDEX when an index is not available.
+    // For the purposes of iterators, use NULL_INDEX for rend() and
+    // MAXIMUM_SIZE for end()
+    static constexpr NodeIndex replace_null_index_with_max_size_for_end_iterator(
+        const NodeIndex& i) noexcept
+    {
+        return i == NULL_INDEX ? MAXIMUM_SIZE : i;
+    }
+
+public:
+    // Values are only changed through `assign()`, which keeps the intervals coalesced
+    using const_iterator = Iterator<IteratorDirection::FORWARD>;
+    using iterator = const_iterator;
+    using const_reverse_iterator = Iterator<IteratorDirection::REVERSE>;
+    using reverse_iterator = const_reverse_iterator;
+    using size_type = typename Tree::size_type;
+    using difference_type = typename Tree::difference_type;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    Tree IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_;
+
+public:
+    constexpr FixedIntervalMap() noexcept
+      : FixedIntervalMap{Compare{}}
+    {
+    }
+
+    explicit constexpr FixedIntervalMap(const Compare& comparator) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_{comparator}
+    {
+    }
+
+public:
+    [[nodiscard]] constexpr const V& at(
+        const K& point,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const noexcept
+    {
+        const NodeIndex i = index_of_interval_containing(point);
+        if (preconditions::test(tree().contains_at(i)))
+        {
+            CheckingType::out_of_range(point, size(), loc);
+        }
+        return tree().node_at(i).value().value;
+    }
+
+    constexpr const_iterator cbegin() const noexcept
+    {
+        return create_const_iterator(tree().index_of_min_at());
+    }
+    constexpr const_iterator cend() const noexcept { return create_const_iterator(MAXIMUM_SIZE); }
+    constexpr const_iterator begin() const noexcept { return cbegin(); }
+    constexpr const_iterator end() const noexcept { return cend(); }
+
+    constexpr const_reverse_iterator crbegin() const noexcept
+    {
+        return create_const_reverse_iterator(MAXIMUM_SIZE);
+    }
+    constexpr const_reverse_iterator crend() const noexcept
+    {
+        return create_const_reverse_iterator(tree().index_of_min_at());
+    }
+    constexpr const_reverse_iterator rbegin() const noexcept { return crbegin(); }
+    constexpr const_reverse_iterator rend() const noexcept { return crend(); }
+
+    // Number of (coalesced) intervals
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return tree().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return tree().empty(); }
+
+    [[nodiscard]] constexpr const Compare& key_comp() const noexcept { return tree().key_comp(); }
+
+    constexpr void clear() noexcept { tree().clear(); }
+
+    /**
+     * Maps every point of [lower, upper) to `value`, replacing whatever it was mapped to before.
+     * The result is merged with neighbours that map to an equal value. Empty ranges are a no-op.
+     * Needs up to two free slots, when [lower, upper) falls strictly inside a single interval.
+     */
+    constexpr void assign(const K& lower,
+                          const K& upper,
+                          const V& value,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        if (!less(lower, upper))
+        {
+            return;
+        }
+
+        // Already mapped to `value`; also avoids needing capacity for a split that would be undone
+        const NodeIndex container = index_of_interval_containing(lower);
+        if (tree().contains_at(container) && !less(upper_at(container), upper) &&
+            value_at(container) == value)
+        {
+            return;
+        }
+
+        erase_range(lower, upper, loc);
+
+        const NodeIndex previous = tree().index_of_node_lower(lower);
+        const NodeIndex next = tree().index_of_node_or_null(upper);
+        const bool merges_with_previous = tree().contains_at(previous) &&
+                                          equivalent(upper_at(previous), lower) &&
+                                          value_at(previous) == value;
+        const bool merges_with_next = tree().contains_at(next) && value_at(next) == value;
+
+        if (merges_with_previous && merges_with_next)
+        {
+            upper_at(previous) = upper_at(next);
+            tree().delete_at_and_return_successor(next);
+        }
+        else if (merges_with_previous)
+        {
+            upper_at(previous) = upper;
+        }
+        else if (merges_with_next)
+        {
+            // [lower, upper) is free and `previous` ends at or before `lower`, so the order of the
+            // lower bounds is unchanged
+            tree().node_at(next).key() = lower;
+        }
+        else
+        {
+            insert_new_interval(lower, upper, value, loc);
+        }
+    }
+
+    /**
+     * Unmaps every point of [lower, upper). Intervals straddling the ends are trimmed.
+     * Needs a free slot when [lower, upper) falls strictly inside a single interval.
+     */
+    constexpr void erase(const K& lower,
+                         const K& upper,
+                         const std_transition::source_location& loc =
+                             std_transition::source_location::current()) noexcept
+    {
+        if (!less(lower, upper))
+        {
+            return;
+        }
+        erase_range(lower, upper, loc);
+    }
+
+    constexpr const_iterator erase(const_iterator pos) noexcept
+    {
+        assert_or_abort(pos != cend());
+        const NodeIndex i = get_node_index_from_iterator(pos);
+        assert_or_abort(tree().contains_at(i));
+        const NodeIndex successor_index = tree().delete_at_and_return_successor(i);
+        return create_const_iterator(successor_index);
+    }
+
+    // Returns the interval containing `point`
+    [[nodiscard]] constexpr const_iterator find(const K& point) const noexcept
+    {
+        const NodeIndex i = index_of_interval_containing(point);
+        if (!tree().contains_at(i))
+        {
+            return this->cend();
+        }
+
+        return create_const_iterator(i);
+    }
+
+    [[nodiscard]] constexpr bool contains(const K& point) const noexcept
+    {
+        return tree().contains_at(index_of_interval_containing(point));
+    }
+
+    // The intervals that intersect [lower, upper), in order
+    [[nodiscard]] constexpr std::ranges::subrange<const_iterator> overlapping(
+        const K& lower, const K& upper) const noexcept
+    {
+        if (!less(lower, upper))
+        {
+            return {cend(), cend()};
+        }
+
+        NodeIndex first = tree().index_of_node_floor(lower);
+        if (!tree().contains_at(first) || !less(lower, upper_at(first)))
+        {
+            first = tree().index_of_node_higher(lower);
+        }
+        const NodeIndex last = tree().index_of_node_ceiling(upper);
+        return {create_const_iterator(first), create_const_iterator(last)};
+    }
+
+    template <std::size_t MAXIMUM_SIZE_2,
+              class Compare2,
+              fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS_2,
+              template <class /*Would be IsFixedIndexBasedStorage but gcc doesn't like the
+                                 constraints here. clang accepts it */
+                        ,
+                        std::size_t>
+              typename StorageTemplate2,
+              customize::MapChecking<K> CheckingType2>
+    [[nodiscard]] constexpr bool operator==(const FixedIntervalMap<K,
+                                                                   V,
+                                                                   MAXIMUM_SIZE_2,
+                                                                   Compare2,
+                                                                   COMPACTNESS_2,
+                                                                   StorageTemplate2,
+                                                                   CheckingType2>& other) const
+    {
+        if constexpr (MAXIMUM_SIZE == MAXIMUM_SIZE_2)
+        {
+            if (this == &other)
+            {
+                return true;
+            }
+        }
+
+        return std::ranges::equal(*this, other);
+    }
+
+private:
+    constexpr Tree& tree() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_; }
+    constexpr const Tree& tree() const { return IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_; }
+
+    constexpr const_iterator create_const_iterator(const NodeIndex& start_index) const noexcept
+    {
+        const NodeIndex i = replace_null_index_with_max_size_for_end_iterator(start_index);
+        return const_iterator{ReferenceProvider{std::addressof(tree()), i}};
+    }
+    constexpr const_reverse_iterator create_const_reverse_iterator(
+        const NodeIndex& start_index) const noexcept
+    {
+        return const_reverse_iterator{ReferenceProvider{std::addressof(tree()), start_index}};
+    }
+
+    constexpr void check_not_full(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(!tree().full()))
+        {
+            CheckingType::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+    }
+
+    [[nodiscard]] constexpr bool less(const K& left, const K& right) const
+    {
+        return key_comp()(left, right);
+    }
+    [[nodiscard]] constexpr bool equivalent(const K& left, const K& right) const
+    {
+        return !less(left, right) && !less(right, left);
+    }
+
+    constexpr K& upper_at(const NodeIndex& i) { return tree().node_at(i).value().upper; }
+    [[nodiscard]] constexpr const K& upper_at(const NodeIndex& i) const
+    {
+        return tree().node_at(i).value().upper;
+    }
+    [[nodiscard]] constexpr const V& value_at(const NodeIndex& i) const
+    {
+        return tree().node_at(i).value().value;
+    }
+
+    [[nodiscard]] constexpr NodeIndex index_of_interval_containing(const K& point) const noexcept
+    {
+        const NodeIndex i = tree().index_of_node_floor(point);
+        if (tree().contains_at(i) && less(point, upper_at(i)))
+        {
+            return i;
+        }
+        return NULL_INDEX;
+    }
+
+    constexpr void insert_new_interval(const K& lower,
+                                       const K& upper,
+                                       const V& value,
+                                       const std_transition::source_location& loc)
+    {
+        check_not_full(loc);
+        NodeIndexAndParentIndex np = tree().index_of_node_with_parent(lower);
+        tree().insert_new_at(np, lower, Mapped{upper, value});
+    }
+
+    // Precondition: lower < upper
+    constexpr void erase_range(const K& lower,
+                               const K& upper,
+                               const std_transition::source_location& loc)
+    {
+        // The interval starting before `lower` keeps its head and, if it extends past `upper`,
+        // gives its tail to a new interval
+        const NodeIndex previous = tree().index_of_node_lower(lower);
+        if (tree().contains_at(previous) && less(lower, upper_at(previous)))
+        {
+            if (less(upper, upper_at(previous)))
+            {
+                const K tail_upper = upper_at(previous);
+                upper_at(previous) = lower;
+                insert_new_interval(upper, tail_upper, value_at(previous), loc);
+                return;
+            }
+            upper_at(previous) = lower;
+        }
+
+        // Intervals starting inside [lower, upper) are dropped, except a last one extending past
+        // `upper`, which keeps its tail
+        NodeIndex i = tree().index_of_node_ceiling(lower);
+        while (tree().contains_at(i) && less(tree().node_at(i).key(), upper))
+        {
+            if (less(upper, upper_at(i)))
+            {
+                // Every other interval overlapping [lower, upper) is gone by now, so the order of
+                // the lower bounds is unchanged
+                tree().node_at(i).key() = upper;
+                return;
+            }
+            i = tree().delete_at_and_return_successor(i);
+        }
+    }
+
+    [[nodiscard]] constexpr NodeIndex get_node_index_from_iterator(const_iterator it)
+    {
+        return it.template private_reference_provider<ReferenceProvider>().current_index();
+    }
+};
+
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS,
+          template <class /*Would be IsFixedIndexBasedStorage but gcc doesn't like the constraints
+here. clang accepts it */
+                    ,
+                    std::size_t>
+          typename StorageTemplate,
+          customize::MapChecking<K> CheckingType>
+[[nodiscard]] constexpr bool is_full(
+    const FixedIntervalMap<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, CheckingType>&
+        c)
+{
+    return c.size() >= c.max_size();
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <
+    typename K,
+    typename V,
+    std::size_t MAXIMUM_SIZE,
+    typename Compare,
+    fixed_containers::fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS,
+    template <class /*Would be IsFixedIndexBasedStorage but gcc doesn't like the constraints
+here. clang accepts it */
+              ,
+              std::size_t>
+    typename StorageTemplate,
+    fixed_containers::customize::MapChecking<K> CheckingType>
+struct tuple_size<
+    fixed_containers::
+        FixedIntervalMap<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
@@ -0,0 +1,767 @@
+#pragma once
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/bidirectional_iterator.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_index_based_storage.hpp"
+#include "fixed_containers/fixed_red_black_tree_rebalancing.hpp"
+#include "fixed_containers/fixed_red_black_tree_types.hpp"
+#include "fixed_containers/map_checking.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers::fixed_interval_tree_detail
+{
+using NodeIndex = fixed_red_black_tree_detail::NodeIndex;
+using NodeColor = fixed_red_black_tree_detail::NodeColor;
+using fixed_red_black_tree_detail::COLOR_BLACK;
+using fixed_red_black_tree_detail::NULL_INDEX;
+
+// One interval, its links, and the largest upper bound in the subtree rooted at it
+template <class K, class V>
+struct IntervalTreeNode
+{
+    K lower;
+    K upper;
+    K max_end;
+    V value;
+    NodeIndex parent_index;
+    NodeIndex left_index;
+    NodeIndex right_index;
+    NodeColor color;
+
+    template <class... Args>
+    constexpr IntervalTreeNode(const K& lower_bound, const K& upper_bound, Args&&... args)
+      : lower{lower_bound}
+      , upper{upper_bound}
+      , max_end{upper_bound}
+      , value(std::forward<Args>(args)...)
+      , parent_index{NULL_INDEX}
+      , left_index{NULL_INDEX}
+      , right_index{NULL_INDEX}
+      , color{COLOR_BLACK}
+    {
+    }
+};
+
+// Links accessor for FixedRedBlackTreeRebalancing. Rotations and erasures refresh `max_end` through
+// update_augmentation().
+template <class K, class V, std::size_t MAXIMUM_SIZE, class Compare>
+class IntervalTreeLinks
+{
+    using Nodes = FixedIndexBasedPoolStorage<IntervalTreeNode<K, V>, MAXIMUM_SIZE>;
+
+    Nodes* nodes_;
+    NodeIndex* root_index_;
+    const Compare* compare_;
+
+public:
+    constexpr IntervalTreeLinks(Nodes& nodes, NodeIndex& root_index, const Compare& compare)
+      : nodes_{std::addressof(nodes)}
+      , root_index_{std::addressof(root_index)}
+      , compare_{std::addressof(compare)}
+    {
+    }
+
+    [[nodiscard]] constexpr NodeIndex root_index() const { return *root_index_; }
+    constexpr void set_root_index(const NodeIndex& r) { *root_index_ = r; }
+
+    [[nodiscard]] constexpr NodeIndex parent_index(const NodeIndex& i) const
+    {
+        return nodes_->at(i).parent_index;
+    }
+    constexpr void set_parent_index(const NodeIndex& i, const NodeIndex& s)
+    {
+        nodes_->at(i).parent_index = s;
+    }
+    [[nodiscard]] constexpr NodeIndex left_index(const NodeIndex& i) const
+    {
+        return nodes_->at(i).left_index;
+    }
+    constexpr void set_left_index(const NodeIndex& i, const NodeIndex& s)
+    {
+        nodes_->at(i).left_index = s;
+    }
+    [[nodiscard]] constexpr NodeIndex right_index(const NodeIndex& i) const
+    {
+        return nodes_->at(i).right_index;
+    }
+    constexpr void set_right_index(const NodeIndex& i, const NodeIndex& s)
+    {
+        nodes_->at(i).right_index = s;
+    }
+    [[nodiscard]] constexpr NodeColor color(const NodeIndex& i) const
+    {
+        return nodes_->at(i).color;
+    }
+    constexpr void set_color(const NodeIndex& i, const NodeColor& c) { nodes_->at(i).color = c; }
+
+    constexpr void update_augmentation(const NodeIndex& i)
+    {
+        IntervalTreeNode<K, V>& node = nodes_->at(i);
+        const K* max_end = std::addressof(node.upper);
+        for (const NodeIndex child : {node.left_index, node.right_index})
+        {
+            if (child != NULL_INDEX &&
+                static_cast<bool>((*compare_)(*max_end, nodes_->at(child).max_end)))
+            {
+                max_end = std::addressof(nodes_->at(child).max_end);
+            }
+        }
+        node.max_end = *max_end;
+    }
+};
+}  // namespace fixed_containers::fixed_interval_tree_detail
+
+namespace fixed_containers
+{
+// The half-open interval [lower, upper) and the value attached to it
+template <class K, class V>
+struct IntervalTreeEntryView
+{
+    const K& lower;
+    const K& upper;
+    const V& value;
+
+    constexpr bool operator==(const IntervalTreeEntryView& other) const
+    {
+        return lower == other.lower && upper == other.upper && value == other.value;
+    }
+};
+}  // namespace fixed_containers
+
+namespace fixed_containers::fixed_interval_tree_detail
+{
+// [WORKAROUND-1] due to destructors: manually do the split with template specialization.
+// See FixedVector which uses the same workaround for more details.
+template <class K, class V, std::size_t MAXIMUM_SIZE, class Compare, class CheckingType>
+class FixedIntervalTreeBase
+{
+    using Node = IntervalTreeNode<K, V>;
+    using Nodes = FixedIndexBasedPoolStorage<Node, MAXIMUM_SIZE>;
+    using Links = IntervalTreeLinks<K, V, MAXIMUM_SIZE, Compare>;
+    using Rebalancing = fixed_red_black_tree_detail::FixedRedBlackTreeRebalancing<Links>;
+
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using const_reference = IntervalTreeEntryView<K, V>;
+    using reference = const_reference;
+
+private:
+    class ReferenceProvider
+    {
+        const FixedIntervalTreeBase* tree_;
+        NodeIndex current_index_;
+
+    public:
+        constexpr ReferenceProvider() noexcept
+          : ReferenceProvider{nullptr, MAXIMUM_SIZE}
+        {
+        }
+
+        constexpr ReferenceProvider(const FixedIntervalTreeBase* const tree,
+                                    const NodeIndex& current_index) noexcept
+          : tree_{tree}
+          , current_index_{current_index}
+        {
+        }
+
+        constexpr void advance() noexcept
+        {
+            current_index_ = current_index_ == NULL_INDEX
+                                 ? tree_->index_of_min()
+                                 : tree_->index_of_successor(current_index_);
+        }
+        constexpr void recede() noexcept
+        {
+            current_index_ = tree_->index_of_predecessor(current_index_);
+        }
+
+        constexpr const_reference get() const noexcept { return tree_->entry_at(current_index_); }
+
+        constexpr bool operator==(const ReferenceProvider& other) const noexcept = default;
+
+        [[nodiscard]] constexpr NodeIndex current_index() const { return current_index_; }
+    };
+
+    template <IteratorDirection DIRECTION>
+    using Iterator = BidirectionalIterator<ReferenceProvider,
+                                           ReferenceProvider,
+                                           IteratorConstness::CONSTANT_ITERATOR,
+                                           DIRECTION>;
+
+public:
+    // Entries are ordered by lower bound, then by insertion order. Bounds cannot be changed in
+    // place since they determine both the order and `max_end`.
+    using const_iterator = Iterator<IteratorDirection::FORWARD>;
+    using iterator = const_iterator;
+    using const_reverse_iterator = Iterator<IteratorDirection::REVERSE>;
+    using reverse_iterator = const_reverse_iterator;
+    using size_type = typename Nodes::size_type;
+    using difference_type = typename Nodes::difference_type;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    Nodes IMPLEMENTATION_DETAIL_DO_NOT_USE_nodes_;
+    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_;
+    std::size_t IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+    Compare IMPLEMENTATION_DETAIL_DO_NOT_USE_compare_;
+
+public:
+    constexpr FixedIntervalTreeBase() noexcept
+      : FixedIntervalTreeBase{Compare{}}
+    {
+    }
+
+    explicit constexpr FixedIntervalTreeBase(const Compare& comparator) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_nodes_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_{NULL_INDEX}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_size_{0}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_compare_{comparator}
+    {
+    }
+
+public:
+    constexpr const_iterator cbegin() const noexcept
+    {
+        return create_const_iterator(index_of_min());
+    }
+    constexpr const_iterator cend() const noexcept { return create_const_iterator(MAXIMUM_SIZE); }
+    constexpr const_iterator begin() const noexcept { return cbegin(); }
+    constexpr const_iterator end() const noexcept { return cend(); }
+
+    constexpr const_reverse_iterator crbegin() const noexcept
+    {
+        return create_const_reverse_iterator(MAXIMUM_SIZE);
+    }
+    constexpr const_reverse_iterator crend() const noexcept
+    {
+        return create_const_reverse_iterator(index_of_min());
+    }
+    constexpr const_reverse_iterator rbegin() const noexcept { return crbegin(); }
+    constexpr const_reverse_iterator rend() const noexcept { return crend(); }
+
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+    [[nodiscard]] constexpr std::size_t size() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+    }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+
+    [[nodiscard]] constexpr const Compare& key_comp() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_compare_;
+    }
+
+    // Destroys the nodes leaves first, so that no recursion or successor lookup is needed
+    constexpr void clear() noexcept
+    {
+        NodeIndex i = root_index();
+        while (i != NULL_INDEX)
+        {
+            Node& n = node(i);
+            if (n.left_index != NULL_INDEX)
+            {
+                i = n.left_index;
+            }
+            else if (n.right_index != NULL_INDEX)
+            {
+                i = n.right_index;
+            }
+            else
+            {
+                const NodeIndex parent = n.parent_index;
+                if (parent != NULL_INDEX && node(parent).left_index == i)
+                {
+                    node(parent).left_index = NULL_INDEX;
+                }
+                else if (parent != NULL_INDEX)
+                {
+                    node(parent).right_index = NULL_INDEX;
+                }
+                nodes().delete_at_and_return_repositioned_index(i);
+                i = parent;
+            }
+        }
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_ = NULL_INDEX;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = 0;
+    }
+
+    /**
+     * Adds the interval [lower, upper), which may overlap or equal intervals already present.
+     * Precondition: lower < upper
+     */
+    constexpr const_iterator insert(const K& lower,
+                                    const K& upper,
+                                    const V& value,
+                                    const std_transition::source_location& loc =
+                                        std_transition::source_location::current()) noexcept
+    {
+        return create_const_iterator(emplace_impl(loc, lower, upper, value));
+    }
+    constexpr const_iterator insert(const K& lower,
+                                    const K& upper,
+                                    V&& value,
+                                    const std_transition::source_location& loc =
+                                        std_transition::source_location::current()) noexcept
+    {
+        return create_const_iterator(emplace_impl(loc, lower, upper, std::move(value)));
+    }
+
+    constexpr const_iterator erase(const_iterator pos) noexcept
+    {
+        assert_or_abort(pos != cend());
+        const NodeIndex i = get_node_index_from_iterator(pos);
+        // Nodes do not move in the pool, so the successor is still valid after the rebalancing
+        const NodeIndex successor_index = index_of_successor(i);
+        Links links = this->links();
+        Rebalancing::erase(links, i);
+        nodes().delete_at_and_return_repositioned_index(i);
+        --IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+        return create_const_iterator(successor_index);
+    }
+
+    // Returns the earliest inserted interval that is exactly [lower, upper)
+    [[nodiscard]] constexpr const_iterator find(const K& lower, const K& upper) const noexcept
+    {
+        for (NodeIndex i = index_of_lower_bound(lower);
+             i != MAXIMUM_SIZE && !less(lower, node(i).lower);
+             i = index_of_successor(i))
+        {
+            if (!less(node(i).upper, upper) && !less(upper, node(i).upper))
+            {
+                return create_const_iterator(i);
+            }
+        }
+        return cend();
+    }
+
+    /**
+     * Stabbing query: calls `visitor(const_reference)` for every interval containing `point`, in
+     * order. Subtrees whose `max_end` is not past `point` are skipped, so this is
+     * O(log n + k log n) for k intervals reported, however many intervals are stored.
+     */
+    template <class Visitor>
+    constexpr void for_each_containing(const K& point, Visitor&& visitor) const
+    {
+        visit_intersecting(
+            point, [this, &point](const K& lower) { return !less(point, lower); }, visitor);
+    }
+
+    // Calls `visitor(const_reference)` for every interval intersecting [lower, upper), in order
+    template <class Visitor>
+    constexpr void for_each_overlapping(const K& lower, const K& upper, Visitor&& visitor) const
+    {
+        if (!less(lower, upper))
+        {
+            return;
+        }
+        visit_intersecting(
+            lower,
+            [this, &upper](const K& other_lower) { return less(other_lower, upper); },
+            visitor);
+    }
+
+private:
+    [[nodiscard]] constexpr NodeIndex root_index() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_;
+    }
+    constexpr Nodes& nodes() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_nodes_; }
+    [[nodiscard]] constexpr const Node& node(const NodeIndex i) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_nodes_.at(i);
+    }
+    constexpr Node& node(const NodeIndex i) { return nodes().at(i); }
+
+    [[nodiscard]] constexpr const_reference entry_at(const NodeIndex i) const
+    {
+        const Node& n = node(i);
+        return {n.lower, n.upper, n.value};
+    }
+
+    [[nodiscard]] constexpr bool less(const K& left, const K& right) const
+    {
+        return static_cast<bool>(IMPLEMENTATION_DETAIL_DO_NOT_USE_compare_(left, right));
+    }
+
+    constexpr Links links()
+    {
+        return Links{IMPLEMENTATION_DETAIL_DO_NOT_USE_nodes_,
+                     IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_,
+                     IMPLEMENTATION_DETAIL_DO_NOT_USE_compare_};
+    }
+
+    constexpr void check_not_full(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(size() < MAXIMUM_SIZE))
+        {
+            CheckingType::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+    }
+
+    template <class... Args>
+    constexpr NodeIndex emplace_impl(const std_transition::source_location& loc,
+                                     const K& lower,
+                                     const K& upper,
+                                     Args&&... args)
+    {
+        assert_or_abort(less(lower, upper));
+        check_not_full(loc);
+
+        NodeIndex parent = NULL_INDEX;
+        bool is_left_child = false;
+        for (NodeIndex j = root_index(); j != NULL_INDEX;)
+        {
+            parent = j;
+            // Equal lower bounds go to the right, so they are visited in insertion order
+            is_left_child = less(lower, node(j).lower);
+            j = is_left_child ? node(j).left_index : node(j).right_index;
+        }
+
+        const NodeIndex i =
+            nodes().emplace_and_return_index(lower, upper, std::forward<Args>(args)...);
+        node(i).parent_index = parent;
+        if (parent == NULL_INDEX)
+        {
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_ = i;
+        }
+        else if (is_left_child)
+        {
+            node(parent).left_index = i;
+        }
+        else
+        {
+            node(parent).right_index = i;
+        }
+        ++IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+
+        Links links = this->links();
+        Rebalancing::fix_after_insertion(links, i);
+        return i;
+    }
+
+    // In-order walk over the parent links that skips every subtree whose intervals all end at or
+    // before `lower`, and every right subtree whose intervals all start too late
+    template <class StartsBeforeEnd, class Visitor>
+    constexpr void visit_intersecting(const K& lower,
+                                      const StartsBeforeEnd& starts_before_end,
+                                      Visitor& visitor) const
+    {
+        // Reports the node, then goes right unless nothing there can start early enough
+        const auto visit_and_go_right = [&](const NodeIndex i)
+        {
+            const Node& n = node(i);
+            if (!starts_before_end(n.lower))
+            {
+                return n.parent_index;
+            }
+            if (less(lower, n.upper))
+            {
+                visitor(entry_at(i));
+            }
+            return n.right_index != NULL_INDEX ? n.right_index : n.parent_index;
+        };
+
+        NodeIndex previous = NULL_INDEX;
+        NodeIndex i = root_index();
+        while (i != NULL_INDEX)
+        {
+            const Node& n = node(i);
+            NodeIndex next = NULL_INDEX;
+            if (previous == n.parent_index)
+            {
+                // First time here, coming from the parent
+                if (!less(lower, n.max_end))
+                {
+                    next = n.parent_index;
+                }
+                else if (n.left_index != NULL_INDEX)
+                {
+                    next = n.left_index;
+                }
+                else
+                {
+                    next = visit_and_go_right(i);
+                }
+            }
+            else if (previous == n.left_index)
+            {
+                next = visit_and_go_right(i);
+            }
+            else
+            {
+                next = n.parent_index;
+            }
+            previous = i;
+            i = next;
+        }
+    }
+
+    [[nodiscard]] constexpr NodeIndex index_of_lower_bound(const K& lower) const
+    {
+        NodeIndex result = MAXIMUM_SIZE;
+        for (NodeIndex j = root_index(); j != NULL_INDEX;)
+        {
+            if (!less(node(j).lower, lower))
+            {
+                result = j;
+                j = node(j).left_index;
+            }
+            else
+            {
+                j = node(j).right_index;
+            }
+        }
+        return result;
+    }
+
+    // MAXIMUM_SIZE is used for end() and NULL_INDEX for rend()
+    [[nodiscard]] constexpr NodeIndex index_of_min() const
+    {
+        const NodeIndex root = root_index();
+        return root == NULL_INDEX ? MAXIMUM_SIZE : leftmost_of(root);
+    }
+
+    [[nodiscard]] constexpr NodeIndex index_of_successor(const NodeIndex i) const
+    {
+        if (node(i).right_index != NULL_INDEX)
+        {
+            return leftmost_of(node(i).right_index);
+        }
+        NodeIndex child = i;
+        NodeIndex parent = node(i).parent_index;
+        while (parent != NULL_INDEX && child == node(parent).right_index)
+        {
+            child = parent;
+            parent = node(parent).parent_index;
+        }
+        return parent == NULL_INDEX ? MAXIMUM_SIZE : parent;
+    }
+
+    [[nodiscard]] constexpr NodeIndex index_of_predecessor(const NodeIndex i) const
+    {
+        if (i == MAXIMUM_SIZE)
+        {
+            const NodeIndex root = root_index();
+            return root == NULL_INDEX ? NULL_INDEX : rightmost_of(root);
+        }
+        if (node(i).left_index != NULL_INDEX)
+        {
+            return rightmost_of(node(i).left_index);
+        }
+        NodeIndex child = i;
+        NodeIndex parent = node(i).parent_index;
+        while (parent != NULL_INDEX && child == node(parent).left_index)
+        {
+            child = parent;
+            parent = node(parent).parent_index;
+        }
+        return parent;
+    }
+
+    [[nodiscard]] constexpr NodeIndex leftmost_of(NodeIndex i) const
+    {
+        while (node(i).left_index != NULL_INDEX)
+        {
+            i = node(i).left_index;
+        }
+        return i;
+    }
+    [[nodiscard]] constexpr NodeIndex rightmost_of(NodeIndex i) const
+    {
+        while (node(i).right_index != NULL_INDEX)
+        {
+            i = node(i).right_index;
+        }
+        return i;
+    }
+
+    constexpr const_iterator create_const_iterator(const NodeIndex& start_index) const noexcept
+    {
+        return const_iterator{ReferenceProvider{this, start_index}};
+    }
+    constexpr const_reverse_iterator create_const_reverse_iterator(
+        const NodeIndex& start_index) const noexcept
+    {
+        return const_reverse_iterator{ReferenceProvider{this, start_index}};
+    }
+
+    [[nodiscard]] constexpr NodeIndex get_node_index_from_iterator(const_iterator it)
+    {
+        return it.template private_reference_provider<ReferenceProvider>().current_index();
+    }
+
+protected:
+    template <class Other>
+    constexpr void insert_all_from(Other&& other)
+    {
+        for (NodeIndex i = other.index_of_min(); i != MAXIMUM_SIZE;
+             i = other.index_of_successor(i))
+        {
+            auto& n = other.node(i);
+            if constexpr (std::is_rvalue_reference_v<Other&&>)
+            {
+                emplace_impl(std_transition::source_location::current(),
+                             n.lower,
+                             n.upper,
+                             std::move(n.value));
+            }
+            else
+            {
+                emplace_impl(std_transition::source_location::current(), n.lower, n.upper, n.value);
+            }
+        }
+    }
+};
+}  // namespace fixed_containers::fixed_interval_tree_detail
+
+namespace fixed_containers::fixed_interval_tree_detail::specializations
+{
+template <class K, class V, std::size_t MAXIMUM_SIZE, class Compare, class CheckingType>
+class FixedIntervalTree
+  : public fixed_interval_tree_detail::
+        FixedIntervalTreeBase<K, V, MAXIMUM_SIZE, Compare, CheckingType>
+{
+    using Base = fixed_interval_tree_detail::
+        FixedIntervalTreeBase<K, V, MAXIMUM_SIZE, Compare, CheckingType>;
+
+public:
+    // clang-format off
+    constexpr FixedIntervalTree() noexcept : Base() { }
+    explicit constexpr FixedIntervalTree(const Compare& comparator) noexcept : Base(comparator) { }
+    // clang-format on
+
+    constexpr FixedIntervalTree(const FixedIntervalTree& other)
+      : FixedIntervalTree(other.key_comp())
+    {
+        this->insert_all_from(other);
+    }
+    constexpr FixedIntervalTree(FixedIntervalTree&& other) noexcept
+      : FixedIntervalTree(other.key_comp())
+    {
+        this->insert_all_from(std::move(other));
+        // Clear the moved-out-of-container, like FixedMap
+        other.clear();
+    }
+    constexpr FixedIntervalTree& operator=(const FixedIntervalTree& other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        this->clear();
+        this->insert_all_from(other);
+        return *this;
+    }
+    constexpr FixedIntervalTree& operator=(FixedIntervalTree&& other) noexcept
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        this->clear();
+        this->insert_all_from(std::move(other));
+        return *this;
+    }
+
+    constexpr ~FixedIntervalTree() noexcept { this->clear(); }
+};
+
+template <TriviallyCopyable K,
+          TriviallyCopyable V,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          class CheckingType>
+class FixedIntervalTree<K, V, MAXIMUM_SIZE, Compare, CheckingType>
+  : public fixed_interval_tree_detail::
+        FixedIntervalTreeBase<K, V, MAXIMUM_SIZE, Compare, CheckingType>
+{
+    using Base = fixed_interval_tree_detail::
+        FixedIntervalTreeBase<K, V, MAXIMUM_SIZE, Compare, CheckingType>;
+
+public:
+    // clang-format off
+    constexpr FixedIntervalTree() noexcept : Base() { }
+    explicit constexpr FixedIntervalTree(const Compare& comparator) noexcept : Base(comparator) { }
+    // clang-format on
+};
+}  // namespace fixed_containers::fixed_interval_tree_detail::specializations
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity interval tree: a multiset of half-open intervals [lower, upper), each with a
+ * value, with maximum number of intervals that is declared at compile-time via template
+ * parameter. Unlike FixedIntervalMap, intervals may overlap and are never coalesced.
+ * It is a red-black tree ordered by lower bound, where each node also keeps the largest upper
+ * bound of its subtree (`max_end`), so that stabbing and overlap queries skip the subtrees that
+ * cannot intersect the query. Properties:
+ *  - constexpr
+ *  - retains the copy/move/destruction properties of K, V
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ *  - no recursion
+ */
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          class Compare = std::less<K>,
+          customize::MapChecking<K> CheckingType = customize::MapAbortChecking<K, V, MAXIMUM_SIZE>>
+class FixedIntervalTree
+  : public fixed_interval_tree_detail::specializations::
+        FixedIntervalTree<K, V, MAXIMUM_SIZE, Compare, CheckingType>
+{
+    using Base = fixed_interval_tree_detail::specializations::
+        FixedIntervalTree<K, V, MAXIMUM_SIZE, Compare, CheckingType>;
+
+public:
+    constexpr FixedIntervalTree() noexcept
+      : Base()
+    {
+    }
+    explicit constexpr FixedIntervalTree(const Compare& comparator) noexcept
+      : Base(comparator)
+    {
+    }
+};
+
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          customize::MapChecking<K> CheckingType>
+[[nodiscard]] constexpr bool is_full(
+    const FixedIntervalTree<K, V, MAXIMUM_SIZE, Compare, CheckingType>& c)
+{
+    return c.size() >= c.max_size();
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <typename K,
+          typename V,
+          std::size_t MAXIMUM_SIZE,
+          typename Compare,
+          fixed_containers::customize::MapChecking<K> CheckingType>
+struct tuple_size<fixed_containers::FixedIntervalTree<K, V, MAXIMUM_SIZE, Compare, CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
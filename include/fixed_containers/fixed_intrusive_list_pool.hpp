@@ -0,0 +1,700 @@
+#pragma once
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/bidirectional_iterator.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_doubly_linked_list.hpp"
+#include "fixed_containers/fixed_index_based_storage.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/sequence_container_checking.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers::fixed_intrusive_list_pool_detail
+{
+template <typename ListCounts>
+struct ListCountsTraits;
+
+template <std::size_t... LIST_COUNTS>
+struct ListCountsTraits<std::index_sequence<LIST_COUNTS...>>
+{
+    static constexpr std::size_t MEMBERSHIP_COUNT = sizeof...(LIST_COUNTS);
+    static constexpr std::array<std::size_t, MEMBERSHIP_COUNT> COUNTS{LIST_COUNTS...};
+    static constexpr std::size_t TOTAL_LIST_COUNT = (LIST_COUNTS + ... + 0);
+};
+
+// [WORKAROUND-1] due to destructors: manually do the split with template specialization.
+// See FixedVector which uses the same workaround for more details.
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          typename ListCounts,
+          customize::SequenceContainerChecking CheckingType>
+class FixedIntrusiveListPoolBase
+{
+    static_assert(IsNotReference<T>, "References are not allowed");
+    static_assert(std::same_as<std::remove_cv_t<T>, T>,
+                  "FixedIntrusiveListPool must have a non-const, non-volatile value_type");
+
+    using Checking = CheckingType;
+    using Traits = ListCountsTraits<ListCounts>;
+    static constexpr std::size_t MEMBERSHIP_COUNT = Traits::MEMBERSHIP_COUNT;
+    static_assert(MEMBERSHIP_COUNT > 0, "FixedIntrusiveListPool must have at least one membership");
+
+    // Every membership has its own chain: entries [0, MAXIMUM_SIZE) are the links of the objects
+    // and entry MAXIMUM_SIZE + k is the sentinel of list k. All chains live in one array.
+    static constexpr std::array<std::size_t, MEMBERSHIP_COUNT + 1> CHAIN_OFFSETS = []()
+    {
+        std::array<std::size_t, MEMBERSHIP_COUNT + 1> out{};
+        for (std::size_t m = 0; m < MEMBERSHIP_COUNT; m++)
+        {
+            out[m + 1] = out[m] + MAXIMUM_SIZE + Traits::COUNTS[m];
+        }
+        return out;
+    }();
+    static constexpr std::array<std::size_t, MEMBERSHIP_COUNT + 1> LIST_OFFSETS = []()
+    {
+        std::array<std::size_t, MEMBERSHIP_COUNT + 1> out{};
+        for (std::size_t m = 0; m < MEMBERSHIP_COUNT; m++)
+        {
+            out[m + 1] = out[m] + Traits::COUNTS[m];
+        }
+        return out;
+    }();
+
+    using StorageType = FixedIndexBasedPoolStorage<T, MAXIMUM_SIZE>;
+    using ChainEntryType = fixed_doubly_linked_list_detail::LinkedListIndices<std::size_t>;
+    using ChainType = std::array<ChainEntryType, CHAIN_OFFSETS.back()>;
+    using ListIdsType = std::array<std::size_t, MEMBERSHIP_COUNT * MAXIMUM_SIZE>;
+    using ListSizesType = std::array<std::size_t, Traits::TOTAL_LIST_COUNT>;
+    using LiveType = std::array<bool, MAXIMUM_SIZE>;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using reference = T&;
+    using const_reference = const T&;
+
+    // Returned by list_of() for objects that are not linked into any list of a membership
+    static constexpr std::size_t NOT_LINKED = (std::numeric_limits<std::size_t>::max)();
+
+private:
+    template <bool IS_CONST>
+    class ReferenceProvider
+    {
+        friend class ReferenceProvider<!IS_CONST>;
+        using ConstOrMutablePool = std::
+            conditional_t<IS_CONST, const FixedIntrusiveListPoolBase, FixedIntrusiveListPoolBase>;
+
+    private:
+        ConstOrMutablePool* pool_;
+        std::size_t membership_;
+        std::size_t current_index_;
+
+    public:
+        constexpr ReferenceProvider() noexcept
+          : ReferenceProvider{nullptr, 0, 0}
+        {
+        }
+
+        constexpr ReferenceProvider(ConstOrMutablePool* const pool,
+                                    const std::size_t membership,
+                                    const std::size_t current_index) noexcept
+          : pool_{pool}
+          , membership_{membership}
+          , current_index_{current_index}
+        {
+        }
+
+        // https://github.com/llvm/llvm-project/issues/62555
+        template <bool IS_CONST_2>
+        constexpr ReferenceProvider(const ReferenceProvider<IS_CONST_2>& m) noexcept
+            requires(IS_CONST and !IS_CONST_2)
+          : ReferenceProvider{m.pool_, m.membership_, m.current_index_}
+        {
+        }
+
+        constexpr void advance() noexcept
+        {
+            current_index_ = pool_->link(membership_, current_index_).next;
+        }
+        constexpr void recede() noexcept
+        {
+            current_index_ = pool_->link(membership_, current_index_).prev;
+        }
+
+        constexpr std::conditional_t<IS_CONST, const_reference, reference> get() const noexcept
+        {
+            assert_or_abort(current_index_ < MAXIMUM_SIZE);
+            return pool_->storage().at(current_index_);
+        }
+
+        template <bool IS_CONST2>
+        constexpr bool operator==(const ReferenceProvider<IS_CONST2>& other) const noexcept
+        {
+            assert_or_abort(pool_ == other.pool_ && membership_ == other.membership_);
+            return current_index_ == other.current_index_;
+        }
+
+        [[nodiscard]] constexpr std::size_t current_index() const { return current_index_; }
+    };
+
+    template <IteratorConstness CONSTNESS, IteratorDirection DIRECTION>
+    using Iterator = BidirectionalIterator<ReferenceProvider<true>,
+                                           ReferenceProvider<false>,
+                                           CONSTNESS,
+                                           DIRECTION>;
+
+    // A lightweight handle to list `k` of a membership. Handles are cheap to copy and remain valid
+    // for the lifetime of the pool.
+    template <bool IS_CONST>
+    class BasicListRef
+    {
+        friend class FixedIntrusiveListPoolBase;
+        friend class BasicListRef<!IS_CONST>;
+        using ConstOrMutablePool = std::
+            conditional_t<IS_CONST, const FixedIntrusiveListPoolBase, FixedIntrusiveListPoolBase>;
+        static constexpr IteratorConstness CONSTNESS =
+            IS_CONST ? IteratorConstness::CONSTANT_ITERATOR : IteratorConstness::MUTABLE_ITERATOR;
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<IS_CONST, const T&, T&>;
+        using const_reference = const T&;
+
+        using const_iterator =
+            Iterator<IteratorConstness::CONSTANT_ITERATOR, IteratorDirection::FORWARD>;
+        using iterator = Iterator<CONSTNESS, IteratorDirection::FORWARD>;
+        using const_reverse_iterator =
+            Iterator<IteratorConstness::CONSTANT_ITERATOR, IteratorDirection::REVERSE>;
+        using reverse_iterator = Iterator<CONSTNESS, IteratorDirection::REVERSE>;
+
+    private:
+        ConstOrMutablePool* pool_;
+        std::size_t membership_;
+        std::size_t list_;
+
+        constexpr BasicListRef(ConstOrMutablePool* const pool,
+                               const std::size_t membership,
+                               const std::size_t list)
+          : pool_{pool}
+          , membership_{membership}
+          , list_{list}
+        {
+        }
+
+    public:
+        template <bool IS_CONST_2>
+        constexpr BasicListRef(const BasicListRef<IS_CONST_2>& other) noexcept
+            requires(IS_CONST and !IS_CONST_2)
+          : BasicListRef{other.pool_, other.membership_, other.list_}
+        {
+        }
+
+        [[nodiscard]] constexpr std::size_t size() const noexcept
+        {
+            return pool_->list_size(membership_, list_);
+        }
+        [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+
+        constexpr iterator begin() const noexcept { return create_iterator(front_index()); }
+        constexpr const_iterator cbegin() const noexcept { return begin(); }
+        constexpr iterator end() const noexcept { return create_iterator(sentinel()); }
+        constexpr const_iterator cend() const noexcept { return end(); }
+
+        constexpr reverse_iterator rbegin() const noexcept
+        {
+            return reverse_iterator{ReferenceProvider<IS_CONST>{pool_, membership_, sentinel()}};
+        }
+        constexpr const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+        constexpr reverse_iterator rend() const noexcept
+        {
+            return reverse_iterator{
+                ReferenceProvider<IS_CONST>{pool_, membership_, front_index()}};
+        }
+        constexpr const_reverse_iterator crend() const noexcept { return rend(); }
+
+        constexpr reference front(const std_transition::source_location& loc =
+                                      std_transition::source_location::current()) const
+        {
+            check_not_empty(loc);
+            return pool_->storage().at(front_index());
+        }
+        constexpr reference back(const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) const
+        {
+            check_not_empty(loc);
+            return pool_->storage().at(back_index());
+        }
+
+        // Indexes of the objects, as returned by FixedIntrusiveListPool::emplace()
+        [[nodiscard]] constexpr std::size_t front_index() const
+        {
+            return pool_->link(membership_, sentinel()).next;
+        }
+        [[nodiscard]] constexpr std::size_t back_index() const
+        {
+            return pool_->link(membership_, sentinel()).prev;
+        }
+        static constexpr std::size_t index_of(const const_iterator& it)
+        {
+            const auto& ref = it.template private_reference_provider<ReferenceProvider<true>>();
+            return ref.current_index();
+        }
+
+        // The object at index `i` must not be in any list of this membership
+        constexpr void link_back(const std::size_t i,
+                                 const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) const
+            requires(!IS_CONST)
+        {
+            pool_->link_before(membership_, list_, sentinel(), i, loc);
+        }
+        constexpr void link_front(const std::size_t i,
+                                  const std_transition::source_location& loc =
+                                      std_transition::source_location::current()) const
+            requires(!IS_CONST)
+        {
+            pool_->link_before(membership_, list_, front_index(), i, loc);
+        }
+        constexpr iterator link_before(const_iterator pos,
+                                       const std::size_t i,
+                                       const std_transition::source_location& loc =
+                                           std_transition::source_location::current()) const
+            requires(!IS_CONST)
+        {
+            pool_->link_before(membership_, list_, index_of(pos), i, loc);
+            return create_iterator(i);
+        }
+
+        // Removes the object from this list only; it stays alive in the pool and in its other lists
+        constexpr iterator unlink(const_iterator it,
+                                  const std_transition::source_location& loc =
+                                      std_transition::source_location::current()) const
+            requires(!IS_CONST)
+        {
+            if (preconditions::test(it != cend()))
+            {
+                Checking::invalid_argument("it != cend(), invalid parameter", loc);
+            }
+            const std::size_t i = index_of(it);
+            const std::size_t next = pool_->link(membership_, i).next;
+            pool_->unlink_internal(membership_, i);
+            return create_iterator(next);
+        }
+
+    private:
+        [[nodiscard]] constexpr std::size_t sentinel() const { return MAXIMUM_SIZE + list_; }
+
+        constexpr iterator create_iterator(const std::size_t i) const noexcept
+        {
+            return iterator{ReferenceProvider<IS_CONST>{pool_, membership_, i}};
+        }
+
+        constexpr void check_not_empty(const std_transition::source_location& loc) const
+        {
+            if (preconditions::test(!empty()))
+            {
+                Checking::empty_container_access(loc);
+            }
+        }
+    };
+
+public:
+    using list_reference = BasicListRef<false>;
+    using const_list_reference = BasicListRef<true>;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+    [[nodiscard]] static constexpr std::size_t membership_count() noexcept
+    {
+        return MEMBERSHIP_COUNT;
+    }
+    [[nodiscard]] static constexpr std::size_t list_count(const std::size_t membership)
+    {
+        return Traits::COUNTS.at(membership);
+    }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    StorageType IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_;
+    ChainType IMPLEMENTATION_DETAIL_DO_NOT_USE_chain_;
+    ListIdsType IMPLEMENTATION_DETAIL_DO_NOT_USE_list_ids_;
+    ListSizesType IMPLEMENTATION_DETAIL_DO_NOT_USE_list_sizes_;
+    LiveType IMPLEMENTATION_DETAIL_DO_NOT_USE_live_;
+    std::size_t IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+
+public:
+    constexpr FixedIntrusiveListPoolBase() noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_chain_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_list_ids_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_list_sizes_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_live_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_size_{}
+    {
+        for (std::size_t m = 0; m < MEMBERSHIP_COUNT; m++)
+        {
+            for (std::size_t k = 0; k < Traits::COUNTS[m]; k++)
+            {
+                link(m, MAXIMUM_SIZE + k) = {MAXIMUM_SIZE + k, MAXIMUM_SIZE + k};
+            }
+        }
+        for (std::size_t& list_id : IMPLEMENTATION_DETAIL_DO_NOT_USE_list_ids_)
+        {
+            list_id = NOT_LINKED;
+        }
+    }
+
+public:
+    [[nodiscard]] constexpr std::size_t size() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+    }
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+    [[nodiscard]] constexpr bool full() const noexcept { return storage().full(); }
+
+    // Constructs an object that is not linked into any list and returns its index. The index is
+    // stable until the object is erased.
+    template <typename... Args>
+    constexpr std::size_t emplace(Args&&... args)
+    {
+        check_not_full(std_transition::source_location::current());
+        const std::size_t i = storage().emplace_and_return_index(std::forward<Args>(args)...);
+        live(i) = true;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_++;
+        return i;
+    }
+
+    // Unlinks the object from all of its lists, then destroys it
+    constexpr void erase(
+        const std::size_t i,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_contains(i, loc);
+        for (std::size_t m = 0; m < MEMBERSHIP_COUNT; m++)
+        {
+            unlink_internal(m, i);
+        }
+        destroy_at(i);
+    }
+
+    constexpr void clear() noexcept
+    {
+        for (std::size_t i = 0; i < MAXIMUM_SIZE && !empty(); i++)
+        {
+            if (live(i))
+            {
+                erase(i);
+            }
+        }
+    }
+
+    [[nodiscard]] constexpr bool contains(const std::size_t i) const noexcept
+    {
+        return i < MAXIMUM_SIZE && live(i);
+    }
+
+    constexpr reference at(
+        const std::size_t i,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_contains(i, loc);
+        return storage().at(i);
+    }
+    constexpr const_reference at(const std::size_t i,
+                                 const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) const
+    {
+        check_contains(i, loc);
+        return storage().at(i);
+    }
+    constexpr reference operator[](const std::size_t i) noexcept
+    {
+        // Cannot capture real source_location for operator[]
+        return at(i, std_transition::source_location::current());
+    }
+    constexpr const_reference operator[](const std::size_t i) const noexcept
+    {
+        // Cannot capture real source_location for operator[]
+        return at(i, std_transition::source_location::current());
+    }
+
+    constexpr list_reference list(
+        const std::size_t membership,
+        const std::size_t k,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_list(membership, k, loc);
+        return list_reference{this, membership, k};
+    }
+    constexpr const_list_reference list(
+        const std::size_t membership,
+        const std::size_t k,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        check_list(membership, k, loc);
+        return const_list_reference{this, membership, k};
+    }
+
+    // The list of `membership` that the object at `i` is linked into, or NOT_LINKED
+    [[nodiscard]] constexpr std::size_t list_of(
+        const std::size_t membership,
+        const std::size_t i,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        check_membership(membership, loc);
+        check_contains(i, loc);
+        return list_id(membership, i);
+    }
+    [[nodiscard]] constexpr bool is_linked(const std::size_t membership,
+                                           const std::size_t i,
+                                           const std_transition::source_location& loc =
+                                               std_transition::source_location::current()) const
+    {
+        return list_of(membership, i, loc) != NOT_LINKED;
+    }
+
+    // Removes the object from its list of `membership`, if any. O(1).
+    constexpr void unlink(
+        const std::size_t membership,
+        const std::size_t i,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_membership(membership, loc);
+        check_contains(i, loc);
+        unlink_internal(membership, i);
+    }
+
+private:
+    [[nodiscard]] constexpr const ChainEntryType& link(const std::size_t membership,
+                                                       const std::size_t i) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_chain_[CHAIN_OFFSETS[membership] + i];
+    }
+    [[nodiscard]] constexpr ChainEntryType& link(const std::size_t membership, const std::size_t i)
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_chain_[CHAIN_OFFSETS[membership] + i];
+    }
+    constexpr std::span<ChainEntryType> chain_span(const std::size_t membership)
+    {
+        return std::span<ChainEntryType>{IMPLEMENTATION_DETAIL_DO_NOT_USE_chain_}.subspan(
+            CHAIN_OFFSETS[membership], MAXIMUM_SIZE + Traits::COUNTS[membership]);
+    }
+
+    [[nodiscard]] constexpr const std::size_t& list_id(const std::size_t membership,
+                                                       const std::size_t i) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_list_ids_[(membership * MAXIMUM_SIZE) + i];
+    }
+    [[nodiscard]] constexpr std::size_t& list_id(const std::size_t membership, const std::size_t i)
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_list_ids_[(membership * MAXIMUM_SIZE) + i];
+    }
+
+    [[nodiscard]] constexpr const std::size_t& list_size(const std::size_t membership,
+                                                         const std::size_t k) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_list_sizes_[LIST_OFFSETS[membership] + k];
+    }
+    [[nodiscard]] constexpr std::size_t& list_size(const std::size_t membership,
+                                                   const std::size_t k)
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_list_sizes_[LIST_OFFSETS[membership] + k];
+    }
+
+    [[nodiscard]] constexpr const bool& live(const std::size_t i) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_live_[i];
+    }
+    [[nodiscard]] constexpr bool& live(const std::size_t i)
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_live_[i];
+    }
+
+    constexpr void link_before(const std::size_t membership,
+                               const std::size_t k,
+                               const std::size_t position,
+                               const std::size_t i,
+                               const std_transition::source_location& loc)
+    {
+        check_contains(i, loc);
+        if (preconditions::test(list_id(membership, i) == NOT_LINKED))
+        {
+            Checking::invalid_argument("object is already linked into a list of this membership",
+                                       loc);
+        }
+
+        const std::size_t position_prev = link(membership, position).prev;
+        link(membership, i) = {position_prev, position};
+        link(membership, position_prev).next = i;
+        link(membership, position).prev = i;
+        list_id(membership, i) = k;
+        list_size(membership, k)++;
+    }
+
+    constexpr void unlink_internal(const std::size_t membership, const std::size_t i)
+    {
+        std::size_t& k = list_id(membership, i);
+        if (k == NOT_LINKED)
+        {
+            return;
+        }
+        fixed_doubly_linked_list_detail::chain_unlink(chain_span(membership), i);
+        list_size(membership, k)--;
+        k = NOT_LINKED;
+    }
+
+    constexpr void destroy_at(const std::size_t i)
+    {
+        storage().delete_at_and_return_repositioned_index(i);
+        live(i) = false;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_--;
+    }
+
+    constexpr void check_not_full(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(!full()))
+        {
+            Checking::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+    }
+    constexpr void check_contains(const std::size_t i,
+                                  const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(contains(i)))
+        {
+            Checking::out_of_range(i, MAXIMUM_SIZE, loc);
+        }
+    }
+    static constexpr void check_membership(const std::size_t membership,
+                                           const std_transition::source_location& loc)
+    {
+        if (preconditions::test(membership < MEMBERSHIP_COUNT))
+        {
+            Checking::out_of_range(membership, MEMBERSHIP_COUNT, loc);
+        }
+    }
+    static constexpr void check_list(const std::size_t membership,
+                                     const std::size_t k,
+                                     const std_transition::source_location& loc)
+    {
+        check_membership(membership, loc);
+        if (preconditions::test(k < Traits::COUNTS[membership]))
+        {
+            Checking::out_of_range(k, Traits::COUNTS[membership], loc);
+        }
+    }
+
+    constexpr const StorageType& storage() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_;
+    }
+    constexpr StorageType& storage() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_; }
+};
+
+}  // namespace fixed_containers::fixed_intrusive_list_pool_detail
+
+namespace fixed_containers::fixed_intrusive_list_pool_detail::specializations
+{
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          typename ListCounts,
+          customize::SequenceContainerChecking CheckingType>
+class FixedIntrusiveListPool
+  : public fixed_intrusive_list_pool_detail::
+        FixedIntrusiveListPoolBase<T, MAXIMUM_SIZE, ListCounts, CheckingType>
+{
+    using Base = fixed_intrusive_list_pool_detail::
+        FixedIntrusiveListPoolBase<T, MAXIMUM_SIZE, ListCounts, CheckingType>;
+
+public:
+    // clang-format off
+    constexpr FixedIntrusiveListPool() noexcept : Base() { }
+    // clang-format on
+
+    // Objects are addressed by index, so a copy would have to reproduce the exact slot of every
+    // object, which the pool storage cannot do for non-trivially-copyable types.
+    FixedIntrusiveListPool(const FixedIntrusiveListPool& other) = delete;
+    FixedIntrusiveListPool(FixedIntrusiveListPool&& other) noexcept = delete;
+    FixedIntrusiveListPool& operator=(const FixedIntrusiveListPool& other) = delete;
+    FixedIntrusiveListPool& operator=(FixedIntrusiveListPool&& other) noexcept = delete;
+
+    constexpr ~FixedIntrusiveListPool() noexcept { this->clear(); }
+};
+
+template <TriviallyCopyable T,
+          std::size_t MAXIMUM_SIZE,
+          typename ListCounts,
+          customize::SequenceContainerChecking CheckingType>
+class FixedIntrusiveListPool<T, MAXIMUM_SIZE, ListCounts, CheckingType>
+  : public fixed_intrusive_list_pool_detail::
+        FixedIntrusiveListPoolBase<T, MAXIMUM_SIZE, ListCounts, CheckingType>
+{
+    using Base = fixed_intrusive_list_pool_detail::
+        FixedIntrusiveListPoolBase<T, MAXIMUM_SIZE, ListCounts, CheckingType>;
+
+public:
+    // clang-format off
+    constexpr FixedIntrusiveListPool() noexcept : Base() { }
+    // clang-format on
+};
+
+}  // namespace fixed_containers::fixed_intrusive_list_pool_detail::specializations
+
+namespace fixed_containers
+{
+/**
+ * Pool of objects that can each be linked into several independent lists at once, e.g. an order
+ * that is simultaneously in a price-level FIFO, an account list and an expiry list. Objects are
+ * stored once and addressed by a stable index; every "membership" has its own set of lists and
+ * its own prev/next links per object, so linking, unlinking and iterating are O(1) per membership
+ * without copies or side tables.
+ *
+ * `ListCounts` is a std::index_sequence with the number of lists of every membership, e.g.
+ * `FixedIntrusiveListPool<Order, 4096, std::index_sequence<256, 1024, 1>>`.
+ *
+ * Properties:
+ *  - constexpr
+ *  - trivially copyable if T is; otherwise neither copyable nor movable (indices are identity)
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ */
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          typename ListCounts,
+          customize::SequenceContainerChecking CheckingType =
+              customize::SequenceContainerAbortChecking<T, MAXIMUM_SIZE>>
+class FixedIntrusiveListPool : public fixed_intrusive_list_pool_detail::specializations::
+                                   FixedIntrusiveListPool<T, MAXIMUM_SIZE, ListCounts, CheckingType>
+{
+    using Base = fixed_intrusive_list_pool_detail::specializations::
+        FixedIntrusiveListPool<T, MAXIMUM_SIZE, ListCounts, CheckingType>;
+
+public:
+    constexpr FixedIntrusiveListPool() noexcept
+      : Base()
+    {
+    }
+};
+
+template <typename T, std::size_t MAXIMUM_SIZE, typename ListCounts, typename CheckingType>
+[[nodiscard]] constexpr bool is_full(
+    const FixedIntrusiveListPool<T, MAXIMUM_SIZE, ListCounts, CheckingType>& c)
+{
+    return c.full();
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,624 @@
+#pragma once
+
+#include "fixed_containers/algorithm.hpp"
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/emplace.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/iterator_utils.hpp"
+#include "fixed_containers/map_checking.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/random_access_iterator.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers::fixed_linear_map_detail
+{
+template <typename K, typename KeyEqual>
+inline constexpr bool IS_DEFAULT_KEY_EQUAL =
+    std::same_as<KeyEqual, std::equal_to<K>> || std::same_as<KeyEqual, std::equal_to<>>;
+
+// Index of `key` in `keys`, or `keys.size()`. `data()` is only used for bitwise comparable keys,
+// as it is only usable at compile-time for simple types.
+template <typename Keys, typename K, typename KeyEqual>
+constexpr std::size_t find_index(const Keys& keys, const K& key, const KeyEqual& key_equal)
+{
+    if constexpr (IS_DEFAULT_KEY_EQUAL<K, KeyEqual> && algorithm::BitwiseEqualityComparable<K>)
+    {
+        return algorithm::find_index(keys.data(), keys.size(), key);
+    }
+    else
+    {
+        std::size_t i = 0;
+        while (i < keys.size() && !key_equal(keys[i], key))
+        {
+            ++i;
+        }
+        return i;
+    }
+}
+}  // namespace fixed_containers::fixed_linear_map_detail
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity map for a handful of entries, with maximum size that is declared at compile-time
+ * via template parameter. Keys and values are kept in two dense FixedVectors, in no particular
+ * order, and lookups scan the keys linearly. Below a few dozen entries, lookups are on par with
+ * FixedMap while the footprint is just the keys and values: there is no hashing, no pointer
+ * chasing and no per-entry metadata, and integral keys are compared a block at a time (see
+ * `algorithm::find_index()`). Keys without a cheap hash benefit the most.
+ *
+ * Iterators are random access and visit the entries in insertion order, until the first erase:
+ * erasing moves the last entry into the hole, so it is O(1) but reorders. Like in FixedVector,
+ * erasing invalidates the iterators to the erased entry and to the last one.
+ * Properties:
+ *  - constexpr
+ *  - retains the copy/move/destruction properties of K, V
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ */
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          class KeyEqual = std::equal_to<K>,
+          customize::MapChecking<K> CheckingType = customize::MapAbortChecking<K, V, MAXIMUM_SIZE>>
+class FixedLinearMap
+{
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<const K, V>;
+    using reference = std::pair<const K&, V&>;
+    using const_reference = std::pair<const K&, const V&>;
+    using pointer = std::add_pointer_t<reference>;
+    using const_pointer = std::add_pointer_t<const_reference>;
+    using key_equal = KeyEqual;
+
+private:
+    using Self = FixedLinearMap<K, V, MAXIMUM_SIZE, KeyEqual, CheckingType>;
+    using Keys = FixedVector<K, MAXIMUM_SIZE>;
+    using Values = FixedVector<V, MAXIMUM_SIZE>;
+
+    template <bool IS_CONST>
+    class PairProvider
+    {
+        friend class PairProvider<!IS_CONST>;
+        using ConstOrMutableSelf = std::conditional_t<IS_CONST, const Self, Self>;
+
+        ConstOrMutableSelf* map_;
+        std::size_t current_index_;
+
+    public:
+        constexpr PairProvider() noexcept
+          : PairProvider{nullptr, 0}
+        {
+        }
+
+        constexpr PairProvider(ConstOrMutableSelf* const map,
+                               const std::size_t current_index) noexcept
+          : map_{map}
+          , current_index_{current_index}
+        {
+        }
+
+        constexpr PairProvider(const PairProvider&) = default;
+        constexpr PairProvider(PairProvider&&) noexcept = default;
+        constexpr PairProvider& operator=(const PairProvider&) = default;
+        constexpr PairProvider& operator=(PairProvider&&) noexcept = default;
+
+        // https://github.com/llvm/llvm-project/issues/62555
+        template <bool IS_CONST_2>
+        constexpr PairProvider(const PairProvider<IS_CONST_2>& m) noexcept
+            requires(IS_CONST and !IS_CONST_2)
+          : PairProvider{m.map_, m.current_index_}
+        {
+        }
+
+        constexpr void advance(const std::size_t n) noexcept { current_index_ += n; }
+        constexpr void recede(const std::size_t n) noexcept { current_index_ -= n; }
+
+        constexpr std::conditional_t<IS_CONST, const_reference, reference> get() const noexcept
+        {
+            return {map_->keys()[current_index_], map_->values()[current_index_]};
+        }
+
+        template <bool IS_CONST2>
+        constexpr bool operator==(const PairProvider<IS_CONST2>& other) const noexcept
+        {
+            assert_or_abort(map_ == other.map_);
+            return current_index_ == other.current_index_;
+        }
+        template <bool IS_CONST2>
+        constexpr auto operator<=>(const PairProvider<IS_CONST2>& other) const noexcept
+        {
+            assert_or_abort(map_ == other.map_);
+            return current_index_ <=> other.current_index_;
+        }
+
+        template <bool IS_CONST2>
+        constexpr std::ptrdiff_t operator-(const PairProvider<IS_CONST2>& other) const
+        {
+            assert_or_abort(map_ == other.map_);
+            return static_cast<std::ptrdiff_t>(current_index_ - other.current_index_);
+        }
+    };
+
+    template <IteratorConstness CONSTNESS, IteratorDirection DIRECTION>
+    using Iterator =
+        RandomAccessIterator<PairProvider<true>, PairProvider<false>, CONSTNESS, DIRECTION>;
+
+public:
+    using const_iterator =
+        Iterator<IteratorConstness::CONSTANT_ITERATOR, IteratorDirection::FORWARD>;
+    using iterator = Iterator<IteratorConstness::MUTABLE_ITERATOR, IteratorDirection::FORWARD>;
+    using const_reverse_iterator =
+        Iterator<IteratorConstness::CONSTANT_ITERATOR, IteratorDirection::REVERSE>;
+    using reverse_iterator =
+        Iterator<IteratorConstness::MUTABLE_ITERATOR, IteratorDirection::REVERSE>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    Keys IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_;
+    Values IMPLEMENTATION_DETAIL_DO_NOT_USE_values_;
+    KeyEqual IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_;
+
+public:
+    constexpr FixedLinearMap() noexcept
+      : FixedLinearMap{KeyEqual{}}
+    {
+    }
+
+    explicit constexpr FixedLinearMap(const KeyEqual& equal) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_values_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_(equal)
+    {
+    }
+
+    template <InputIterator InputIt>
+    constexpr FixedLinearMap(InputIt first,
+                             InputIt last,
+                             const KeyEqual& equal = KeyEqual{},
+                             const std_transition::source_location& loc =
+                                 std_transition::source_location::current()) noexcept
+      : FixedLinearMap{equal}
+    {
+        insert(first, last, loc);
+    }
+
+    constexpr FixedLinearMap(std::initializer_list<value_type> list,
+                             const KeyEqual& equal = KeyEqual{},
+                             const std_transition::source_location& loc =
+                                 std_transition::source_location::current()) noexcept
+      : FixedLinearMap{equal}
+    {
+        this->insert(list, loc);
+    }
+
+public:
+    [[nodiscard]] constexpr V& at(const K& key,
+                                  const std_transition::source_location& loc =
+                                      std_transition::source_location::current()) noexcept
+    {
+        const std::size_t i = index_of(key);
+        if (preconditions::test(i != size()))
+        {
+            CheckingType::out_of_range(key, size(), loc);
+        }
+        return values()[i];
+    }
+    [[nodiscard]] constexpr const V& at(
+        const K& key,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const noexcept
+    {
+        const std::size_t i = index_of(key);
+        if (preconditions::test(i != size()))
+        {
+            CheckingType::out_of_range(key, size(), loc);
+        }
+        return values()[i];
+    }
+
+    constexpr V& operator[](const K& key) noexcept
+    {
+        // Cannot capture real source_location for operator[]
+        return values()[try_emplace_at(std_transition::source_location::current(), key).first];
+    }
+    constexpr V& operator[](K&& key) noexcept
+    {
+        // Cannot capture real source_location for operator[]
+        const std::size_t i =
+            try_emplace_at(std_transition::source_location::current(), std::move(key)).first;
+        return values()[i];
+    }
+
+    constexpr const_iterator cbegin() const noexcept { return create_const_iterator(0); }
+    constexpr const_iterator cend() const noexcept { return create_const_iterator(size()); }
+    constexpr const_iterator begin() const noexcept { return cbegin(); }
+    constexpr iterator begin() noexcept { return create_iterator(0); }
+    constexpr const_iterator end() const noexcept { return cend(); }
+    constexpr iterator end() noexcept { return create_iterator(size()); }
+
+    constexpr reverse_iterator rbegin() noexcept
+    {
+        return reverse_iterator{PairProvider<false>{this, size()}};
+    }
+    constexpr const_reverse_iterator rbegin() const noexcept { return crbegin(); }
+    constexpr const_reverse_iterator crbegin() const noexcept
+    {
+        return const_reverse_iterator{PairProvider<true>{this, size()}};
+    }
+    constexpr reverse_iterator rend() noexcept
+    {
+        return reverse_iterator{PairProvider<false>{this, 0}};
+    }
+    constexpr const_reverse_iterator rend() const noexcept { return crend(); }
+    constexpr const_reverse_iterator crend() const noexcept
+    {
+        return const_reverse_iterator{PairProvider<true>{this, 0}};
+    }
+
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return keys().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return keys().empty(); }
+
+    constexpr void clear() noexcept
+    {
+        keys().clear();
+        values().clear();
+    }
+
+    constexpr std::pair<iterator, bool> insert(
+        const value_type& value,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return as_iterator_and_bool(try_emplace_at(loc, value.first, value.second));
+    }
+    constexpr std::pair<iterator, bool> insert(
+        value_type&& value,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return as_iterator_and_bool(try_emplace_at(loc, value.first, std::move(value.second)));
+    }
+
+    template <InputIterator InputIt>
+    constexpr void insert(InputIt first,
+                          InputIt last,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        for (; first != last; std::advance(first, 1))
+        {
+            this->insert(*first, loc);
+        }
+    }
+    constexpr void insert(std::initializer_list<value_type> list,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        this->insert(list.begin(), list.end(), loc);
+    }
+
+    template <class M>
+    constexpr std::pair<iterator, bool> insert_or_assign(
+        const K& key,
+        M&& obj,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+        requires std::is_assignable_v<mapped_type&, M&&>
+    {
+        return insert_or_assign_impl(loc, key, std::forward<M>(obj));
+    }
+    template <class M>
+    constexpr std::pair<iterator, bool> insert_or_assign(
+        K&& key,
+        M&& obj,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+        requires std::is_assignable_v<mapped_type&, M&&>
+    {
+        return insert_or_assign_impl(loc, std::move(key), std::forward<M>(obj));
+    }
+    template <class M>
+    constexpr iterator insert_or_assign(const_iterator /*hint*/,
+                                        const K& key,
+                                        M&& obj,
+                                        const std_transition::source_location& loc =
+                                            std_transition::source_location::current()) noexcept
+        requires std::is_assignable_v<mapped_type&, M&&>
+    {
+        return insert_or_assign(key, std::forward<M>(obj), loc).first;
+    }
+    template <class M>
+    constexpr iterator insert_or_assign(const_iterator /*hint*/,
+                                        K&& key,
+                                        M&& obj,
+                                        const std_transition::source_location& loc =
+                                            std_transition::source_location::current()) noexcept
+        requires std::is_assignable_v<mapped_type&, M&&>
+    {
+        return insert_or_assign(std::move(key), std::forward<M>(obj), loc).first;
+    }
+
+    template <class... Args>
+    constexpr std::pair<iterator, bool> try_emplace(const K& key, Args&&... args) noexcept
+    {
+        return as_iterator_and_bool(try_emplace_at(
+            std_transition::source_location::current(), key, std::forward<Args>(args)...));
+    }
+    template <class... Args>
+    constexpr std::pair<iterator, bool> try_emplace(K&& key, Args&&... args) noexcept
+    {
+        return as_iterator_and_bool(try_emplace_at(std_transition::source_location::current(),
+                                                   std::move(key),
+                                                   std::forward<Args>(args)...));
+    }
+    template <class... Args>
+    constexpr std::pair<iterator, bool> try_emplace(const_iterator /*hint*/,
+                                                    const K& key,
+                                                    Args&&... args) noexcept
+    {
+        return try_emplace(key, std::forward<Args>(args)...);
+    }
+    template <class... Args>
+    constexpr std::pair<iterator, bool> try_emplace(const_iterator /*hint*/,
+                                                    K&& key,
+                                                    Args&&... args) noexcept
+    {
+        return try_emplace(std::move(key), std::forward<Args>(args)...);
+    }
+
+    template <class... Args>
+        requires(sizeof...(Args) >= 1 and sizeof...(Args) <= 3)
+    constexpr std::pair<iterator, bool> emplace(Args&&... args) noexcept
+    {
+        return emplace_detail::emplace_in_terms_of_try_emplace_impl(*this,
+                                                                    std::forward<Args>(args)...);
+    }
+    template <class... Args>
+    constexpr std::pair<iterator, bool> emplace_hint(const_iterator /*hint*/,
+                                                     Args&&... args) noexcept
+    {
+        return emplace(std::forward<Args>(args)...);
+    }
+
+    // The last entry takes the place of the erased one, so the returned iterator is at the same
+    // position as `pos`
+    constexpr iterator erase(const_iterator pos) noexcept
+    {
+        assert_or_abort(pos != cend());
+        const std::size_t i = index_of_iterator(pos);
+        erase_at(i);
+        return create_iterator(i);
+    }
+    constexpr iterator erase(iterator pos) noexcept { return erase(const_iterator{pos}); }
+
+    constexpr iterator erase(const_iterator first, const_iterator last) noexcept
+    {
+        const std::size_t from = index_of_iterator(first);
+        const std::size_t to = index_of_iterator(last);
+        assert_or_abort(from <= to && to <= size());
+        // Fill the hole from the end, moving no more entries than it has
+        const std::size_t count = to - from;
+        const std::size_t moved_count = (std::min)(count, size() - to);
+        for (std::size_t i = 0; i < moved_count; i++)
+        {
+            const std::size_t source = size() - moved_count + i;
+            keys()[from + i] = std::move(keys()[source]);
+            values()[from + i] = std::move(values()[source]);
+        }
+        keys().erase(keys().end() - static_cast<difference_type>(count), keys().end());
+        values().erase(values().end() - static_cast<difference_type>(count), values().end());
+        return create_iterator(from);
+    }
+
+    constexpr size_type erase(const K& key) noexcept
+    {
+        const std::size_t i = index_of(key);
+        if (i == size())
+        {
+            return 0;
+        }
+        erase_at(i);
+        return 1;
+    }
+
+    [[nodiscard]] constexpr iterator find(const K& key) noexcept
+    {
+        return create_iterator(index_of(key));
+    }
+    [[nodiscard]] constexpr const_iterator find(const K& key) const noexcept
+    {
+        return create_const_iterator(index_of(key));
+    }
+
+    [[nodiscard]] constexpr bool contains(const K& key) const noexcept
+    {
+        return index_of(key) != size();
+    }
+
+    [[nodiscard]] constexpr std::size_t count(const K& key) const noexcept
+    {
+        return static_cast<std::size_t>(contains(key));
+    }
+
+    [[nodiscard]] constexpr key_equal key_eq() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_;
+    }
+
+    // Equal if they have the same entries, in any order
+    template <std::size_t MAXIMUM_SIZE_2, customize::MapChecking<K> CheckingType2>
+    [[nodiscard]] constexpr bool operator==(
+        const FixedLinearMap<K, V, MAXIMUM_SIZE_2, KeyEqual, CheckingType2>& other) const
+    {
+        if (size() != other.size())
+        {
+            return false;
+        }
+        for (std::size_t i = 0; i < size(); i++)
+        {
+            const auto it = other.find(keys()[i]);
+            if (it == other.cend() || !(it->second == values()[i]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    constexpr Keys& keys() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_; }
+    constexpr const Keys& keys() const { return IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_; }
+    constexpr Values& values() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_values_; }
+    constexpr const Values& values() const { return IMPLEMENTATION_DETAIL_DO_NOT_USE_values_; }
+
+    [[nodiscard]] constexpr std::size_t index_of(const K& key) const
+    {
+        return fixed_linear_map_detail::find_index(
+            keys(), key, IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_);
+    }
+
+    [[nodiscard]] constexpr std::size_t index_of_iterator(const const_iterator& it) const
+    {
+        return static_cast<std::size_t>(it - cbegin());
+    }
+
+    constexpr iterator create_iterator(const std::size_t i) noexcept
+    {
+        return iterator{PairProvider<false>{this, i}};
+    }
+    constexpr const_iterator create_const_iterator(const std::size_t i) const noexcept
+    {
+        return const_iterator{PairProvider<true>{this, i}};
+    }
+
+    constexpr std::pair<iterator, bool> as_iterator_and_bool(
+        const std::pair<std::size_t, bool>& index_and_inserted) noexcept
+    {
+        return {create_iterator(index_and_inserted.first), index_and_inserted.second};
+    }
+
+    // Returns the index of `key` and whether it was inserted
+    template <class Key, class... Args>
+    constexpr std::pair<std::size_t, bool> try_emplace_at(
+        const std_transition::source_location& loc, Key&& key, Args&&... args)
+    {
+        const std::size_t i = index_of(key);
+        if (i != size())
+        {
+            return {i, false};
+        }
+
+        check_not_full(loc);
+        keys().emplace_back(std::forward<Key>(key));
+        values().emplace_back(std::forward<Args>(args)...);
+        return {i, true};
+    }
+
+    template <class Key, class M>
+    constexpr std::pair<iterator, bool> insert_or_assign_impl(
+        const std_transition::source_location& loc, Key&& key, M&& obj)
+    {
+        const std::size_t i = index_of(key);
+        if (i != size())
+        {
+            values()[i] = std::forward<M>(obj);
+            return {create_iterator(i), false};
+        }
+
+        check_not_full(loc);
+        keys().emplace_back(std::forward<Key>(key));
+        values().emplace_back(std::forward<M>(obj));
+        return {create_iterator(i), true};
+    }
+
+    constexpr void erase_at(const std::size_t i)
+    {
+        if (i + 1 != size())
+        {
+            keys()[i] = std::move(keys().back());
+            values()[i] = std::move(values().back());
+        }
+        keys().pop_back();
+        values().pop_back();
+    }
+
+    constexpr void check_not_full(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(size() < MAXIMUM_SIZE))
+        {
+            CheckingType::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+    }
+};
+
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          class KeyEqual,
+          customize::MapChecking<K> CheckingType>
+[[nodiscard]] constexpr bool is_full(
+    const FixedLinearMap<K, V, MAXIMUM_SIZE, KeyEqual, CheckingType>& c)
+{
+    return c.size() >= c.max_size();
+}
+
+// erase() moves the last entry into the hole, so entries are visited by index and the end is
+// re-read after every erase
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          class KeyEqual,
+          customize::MapChecking<K> CheckingType,
+          class Predicate>
+constexpr typename FixedLinearMap<K, V, MAXIMUM_SIZE, KeyEqual, CheckingType>::size_type erase_if(
+    FixedLinearMap<K, V, MAXIMUM_SIZE, KeyEqual, CheckingType>& c, Predicate predicate)
+{
+    const auto original_size = c.size();
+    for (auto it = c.begin(); it != c.end();)
+    {
+        if (predicate(*it))
+        {
+            it = c.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    return original_size - c.size();
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <typename K,
+          typename V,
+          std::size_t MAXIMUM_SIZE,
+          typename KeyEqual,
+          fixed_containers::customize::MapChecking<K> CheckingType>
+struct tuple_size<fixed_containers::FixedLinearMap<K, V, MAXIMUM_SIZE, KeyEqual, CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
@@ -0,0 +1,326 @@
+#pragma once
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_linear_map.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/set_checking.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity set for a handful of elements, with maximum size that is declared at
+ * compile-time via template parameter. The set counterpart of FixedLinearMap: elements are kept in
+ * a dense FixedVector, in no particular order, and lookups scan them linearly. Erasing moves the
+ * last element into the hole.
+ * Properties:
+ *  - constexpr
+ *  - retains the copy/move/destruction properties of K
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ */
+template <class K,
+          std::size_t MAXIMUM_SIZE,
+          class KeyEqual = std::equal_to<K>,
+          customize::SetChecking<K> CheckingType = customize::SetAbortChecking<K, MAXIMUM_SIZE>>
+class FixedLinearSet
+{
+    using Keys = FixedVector<K, MAXIMUM_SIZE>;
+
+public:
+    using key_type = K;
+    using value_type = K;
+    using const_reference = const K&;
+    using reference = const_reference;
+    using const_pointer = std::add_pointer_t<const_reference>;
+    using pointer = const_pointer;
+    using key_equal = KeyEqual;
+
+    using const_iterator = typename Keys::const_iterator;
+    using iterator = const_iterator;
+    using const_reverse_iterator = typename Keys::const_reverse_iterator;
+    using reverse_iterator = const_reverse_iterator;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    Keys IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_;
+    KeyEqual IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_;
+
+public:
+    constexpr FixedLinearSet() noexcept
+      : FixedLinearSet{KeyEqual{}}
+    {
+    }
+
+    explicit constexpr FixedLinearSet(const KeyEqual& equal) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_(equal)
+    {
+    }
+
+    template <InputIterator InputIt>
+    constexpr FixedLinearSet(InputIt first,
+                             InputIt last,
+                             const KeyEqual& equal = KeyEqual{},
+                             const std_transition::source_location& loc =
+                                 std_transition::source_location::current()) noexcept
+      : FixedLinearSet{equal}
+    {
+        insert(first, last, loc);
+    }
+
+    constexpr FixedLinearSet(std::initializer_list<K> list,
+                             const KeyEqual& equal = KeyEqual{},
+                             const std_transition::source_location& loc =
+                                 std_transition::source_location::current()) noexcept
+      : FixedLinearSet{equal}
+    {
+        this->insert(list, loc);
+    }
+
+public:
+    constexpr const_iterator cbegin() const noexcept { return keys().cbegin(); }
+    constexpr const_iterator cend() const noexcept { return keys().cend(); }
+    constexpr const_iterator begin() const noexcept { return cbegin(); }
+    constexpr const_iterator end() const noexcept { return cend(); }
+
+    constexpr const_reverse_iterator crbegin() const noexcept { return keys().crbegin(); }
+    constexpr const_reverse_iterator crend() const noexcept { return keys().crend(); }
+    constexpr const_reverse_iterator rbegin() const noexcept { return crbegin(); }
+    constexpr const_reverse_iterator rend() const noexcept { return crend(); }
+
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return keys().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return keys().empty(); }
+
+    constexpr void clear() noexcept { keys().clear(); }
+
+    constexpr std::pair<const_iterator, bool> insert(
+        const K& value,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return insert_impl(loc, value);
+    }
+    constexpr std::pair<const_iterator, bool> insert(
+        K&& value,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return insert_impl(loc, std::move(value));
+    }
+    constexpr const_iterator insert(const_iterator /*hint*/,
+                                    const K& value,
+                                    const std_transition::source_location& loc =
+                                        std_transition::source_location::current()) noexcept
+    {
+        return insert(value, loc).first;
+    }
+    constexpr const_iterator insert(const_iterator /*hint*/,
+                                    K&& value,
+                                    const std_transition::source_location& loc =
+                                        std_transition::source_location::current()) noexcept
+    {
+        return insert(std::move(value), loc).first;
+    }
+
+    template <InputIterator InputIt>
+    constexpr void insert(InputIt first,
+                          InputIt last,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        for (; first != last; std::advance(first, 1))
+        {
+            this->insert(*first, loc);
+        }
+    }
+    constexpr void insert(std::initializer_list<K> list,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        this->insert(list.begin(), list.end(), loc);
+    }
+
+    template <class... Args>
+    constexpr std::pair<const_iterator, bool> emplace(Args&&... args)
+    {
+        return insert(K{std::forward<Args>(args)...});
+    }
+    template <class... Args>
+    constexpr const_iterator emplace_hint(const_iterator /*hint*/, Args&&... args)
+    {
+        return emplace(std::forward<Args>(args)...).first;
+    }
+
+    // The last element takes the place of the erased one, so the returned iterator is at the same
+    // position as `pos`
+    constexpr const_iterator erase(const_iterator pos) noexcept
+    {
+        assert_or_abort(pos != cend());
+        const auto i = static_cast<std::size_t>(pos - cbegin());
+        erase_at(i);
+        return create_const_iterator(i);
+    }
+
+    constexpr const_iterator erase(const_iterator first, const_iterator last) noexcept
+    {
+        const auto from = static_cast<std::size_t>(first - cbegin());
+        const auto to = static_cast<std::size_t>(last - cbegin());
+        assert_or_abort(from <= to && to <= size());
+        // Fill the hole from the end, moving no more elements than it has
+        const std::size_t count = to - from;
+        const std::size_t moved_count = (std::min)(count, size() - to);
+        for (std::size_t i = 0; i < moved_count; i++)
+        {
+            keys()[from + i] = std::move(keys()[size() - moved_count + i]);
+        }
+        keys().erase(keys().end() - static_cast<difference_type>(count), keys().end());
+        return create_const_iterator(from);
+    }
+
+    constexpr size_type erase(const K& key) noexcept
+    {
+        const std::size_t i = index_of(key);
+        if (i == size())
+        {
+            return 0;
+        }
+        erase_at(i);
+        return 1;
+    }
+
+    [[nodiscard]] constexpr const_iterator find(const K& key) const noexcept
+    {
+        return create_const_iterator(index_of(key));
+    }
+
+    [[nodiscard]] constexpr bool contains(const K& key) const noexcept
+    {
+        return index_of(key) != size();
+    }
+
+    [[nodiscard]] constexpr std::size_t count(const K& key) const noexcept
+    {
+        return static_cast<std::size_t>(contains(key));
+    }
+
+    [[nodiscard]] constexpr key_equal key_eq() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_;
+    }
+
+    // Equal if they have the same elements, in any order
+    template <std::size_t MAXIMUM_SIZE_2, customize::SetChecking<K> CheckingType2>
+    [[nodiscard]] constexpr bool operator==(
+        const FixedLinearSet<K, MAXIMUM_SIZE_2, KeyEqual, CheckingType2>& other) const
+    {
+        return size() == other.size() &&
+               std::all_of(
+                   cbegin(), cend(), [&other](const K& key) { return other.contains(key); });
+    }
+
+private:
+    constexpr Keys& keys() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_; }
+    constexpr const Keys& keys() const { return IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_; }
+
+    [[nodiscard]] constexpr std::size_t index_of(const K& key) const
+    {
+        return fixed_linear_map_detail::find_index(
+            keys(), key, IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_);
+    }
+
+    constexpr const_iterator create_const_iterator(const std::size_t i) const noexcept
+    {
+        return std::next(cbegin(), static_cast<difference_type>(i));
+    }
+
+    template <class Key>
+    constexpr std::pair<const_iterator, bool> insert_impl(
+        const std_transition::source_location& loc, Key&& value)
+    {
+        const std::size_t i = index_of(value);
+        if (i != size())
+        {
+            return {create_const_iterator(i), false};
+        }
+
+        if (preconditions::test(size() < MAXIMUM_SIZE))
+        {
+            CheckingType::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+        keys().emplace_back(std::forward<Key>(value));
+        return {create_const_iterator(i), true};
+    }
+
+    constexpr void erase_at(const std::size_t i)
+    {
+        if (i + 1 != size())
+        {
+            keys()[i] = std::move(keys().back());
+        }
+        keys().pop_back();
+    }
+};
+
+template <class K, std::size_t MAXIMUM_SIZE, class KeyEqual, customize::SetChecking<K> CheckingType>
+[[nodiscard]] constexpr bool is_full(
+    const FixedLinearSet<K, MAXIMUM_SIZE, KeyEqual, CheckingType>& c)
+{
+    return c.size() >= c.max_size();
+}
+
+// erase() moves the last element into the hole, so elements are visited by index and the end is
+// re-read after every erase
+template <class K,
+          std::size_t MAXIMUM_SIZE,
+          class KeyEqual,
+          customize::SetChecking<K> CheckingType,
+          class Predicate>
+constexpr typename FixedLinearSet<K, MAXIMUM_SIZE, KeyEqual, CheckingType>::size_type erase_if(
+    FixedLinearSet<K, MAXIMUM_SIZE, KeyEqual, CheckingType>& c, Predicate predicate)
+{
+    const auto original_size = c.size();
+    for (auto it = c.begin(); it != c.end();)
+    {
+        if (predicate(*it))
+        {
+            it = c.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    return original_size - c.size();
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <typename K,
+          std::size_t MAXIMUM_SIZE,
+          typename KeyEqual,
+          fixed_containers::customize::SetChecking<K> CheckingType>
+struct tuple_size<fixed_containers::FixedLinearSet<K, MAXIMUM_SIZE, KeyEqual, CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
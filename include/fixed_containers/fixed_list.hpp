@@ -12,6 +12,7 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <functional>
 #include <initializer_list>
 #include <iterator>
 #include <type_traits>
@@ -373,6 +374,125 @@ public:
         return remove_if([&value](const T& v) { return v == value; });
     }
 
+    // Splicing within the same list only relinks nodes and is O(1). Each FixedList owns its node
+    // pool, so splicing from another list has to move the payloads (O(n)) and may exceed the
+    // capacity of this list; use FixedListGroup for O(1) transfers between lists.
+    constexpr void splice(
+        const_iterator pos,
+        FixedList& other,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        if (preconditions::test(this != &other))
+        {
+            Checking::invalid_argument("this != &other, cannot splice a list into itself", loc);
+        }
+        splice(pos, other, other.cbegin(), other.cend(), loc);
+    }
+    constexpr void splice(
+        const_iterator pos,
+        FixedList& other,
+        const_iterator it,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        if (preconditions::test(it != other.cend()))
+        {
+            Checking::invalid_argument("it != other.cend(), invalid parameter", loc);
+        }
+        splice(pos, other, it, std::next(it), loc);
+    }
+    constexpr void splice(
+        const_iterator pos,
+        FixedList& other,
+        const_iterator first,
+        const_iterator last,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        if (this == &other)
+        {
+            list().splice_before_index(index_of(pos), index_of(first), index_of(last));
+            return;
+        }
+
+        const auto moved_count = static_cast<std::size_t>(std::distance(first, last));
+        check_target_size(size() + moved_count, loc);
+        const std::size_t insertion_point = index_of(pos);
+        const std::size_t last_index = other.index_of(last);
+        for (std::size_t i = other.index_of(first); i != last_index;)
+        {
+            list().emplace_before_index_and_return_index(insertion_point,
+                                                         std::move(other.list().at(i)));
+            i = other.list().delete_at_and_return_next_index(i);
+        }
+    }
+
+    // Both lists must be sorted with respect to `comp`. Elements of `other` are moved into this
+    // list (see splice()) and `other` is left empty.
+    template <typename Compare = std::less<>>
+    constexpr void merge(
+        FixedList& other,
+        Compare comp = Compare{},
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        if (this == &other)
+        {
+            return;
+        }
+
+        check_target_size(size() + other.size(), loc);
+        std::size_t i = front_index();
+        for (std::size_t j = other.front_index(); j != other.end_index();)
+        {
+            if (i == end_index() || comp(other.list().at(j), list().at(i)))
+            {
+                list().emplace_before_index_and_return_index(i, std::move(other.list().at(j)));
+                j = other.list().delete_at_and_return_next_index(j);
+            }
+            else
+            {
+                i = list().next_of(i);
+            }
+        }
+    }
+
+    // Removes all but the first element of every group of consecutive equivalent elements
+    template <typename BinaryPredicate = std::equal_to<>>
+    constexpr size_type unique(BinaryPredicate predicate = BinaryPredicate{})
+    {
+        size_type removed_counter = 0;
+        if (empty())
+        {
+            return removed_counter;
+        }
+
+        std::size_t kept = front_index();
+        for (std::size_t i = list().next_of(kept); i != end_index();)
+        {
+            if (predicate(list().at(kept), list().at(i)))
+            {
+                i = list().delete_at_and_return_next_index(i);
+                ++removed_counter;
+            }
+            else
+            {
+                kept = i;
+                i = list().next_of(i);
+            }
+        }
+
+        return removed_counter;
+    }
+
+    // Relinks the nodes; elements are not moved and iterators remain valid
+    constexpr void reverse() noexcept { list().reverse(); }
+
+    // Stable, in-place, O(n log n) merge sort that relinks the nodes; elements are not moved and
+    // iterators remain valid
+    template <typename Compare = std::less<>>
+    constexpr void sort(Compare comp = Compare{})
+    {
+        list().sort(comp);
+    }
+
     constexpr iterator erase(const_iterator first,
                              const_iterator last,
                              const std_transition::source_location& /*loc*/ =
@@ -0,0 +1,811 @@
+#pragma once
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/bidirectional_iterator.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_doubly_linked_list.hpp"
+#include "fixed_containers/fixed_index_based_storage.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/sequence_container_checking.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers::fixed_list_group_detail
+{
+// [WORKAROUND-1] due to destructors: manually do the split with template specialization.
+// See FixedVector which uses the same workaround for more details.
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          std::size_t LIST_COUNT,
+          customize::SequenceContainerChecking CheckingType>
+class FixedListGroupBase
+{
+    static_assert(IsNotReference<T>, "References are not allowed");
+    static_assert(std::same_as<std::remove_cv_t<T>, T>,
+                  "FixedListGroup must have a non-const, non-volatile value_type");
+    static_assert(LIST_COUNT > 0, "FixedListGroup must have at least one list");
+
+    using Checking = CheckingType;
+    using StorageType = FixedIndexBasedPoolStorage<T, MAXIMUM_SIZE>;
+    using ChainEntryType = fixed_doubly_linked_list_detail::LinkedListIndices<std::size_t>;
+    // Entries [0, MAXIMUM_SIZE) are the nodes, entry MAXIMUM_SIZE + k is the sentinel of list k
+    using ChainType = std::array<ChainEntryType, MAXIMUM_SIZE + LIST_COUNT>;
+    using SizesType = std::array<std::size_t, LIST_COUNT>;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using reference = T&;
+    using const_reference = const T&;
+
+private:
+    template <bool IS_CONST>
+    class ReferenceProvider
+    {
+        friend class ReferenceProvider<!IS_CONST>;
+        using ConstOrMutableGroup =
+            std::conditional_t<IS_CONST, const FixedListGroupBase, FixedListGroupBase>;
+
+    private:
+        ConstOrMutableGroup* group_;
+        std::size_t current_index_;
+
+    public:
+        constexpr ReferenceProvider() noexcept
+          : ReferenceProvider{nullptr, 0}
+        {
+        }
+
+        constexpr ReferenceProvider(ConstOrMutableGroup* const group,
+                                    const std::size_t& current_index) noexcept
+          : group_{group}
+          , current_index_{current_index}
+        {
+        }
+
+        // https://github.com/llvm/llvm-project/issues/62555
+        template <bool IS_CONST_2>
+        constexpr ReferenceProvider(const ReferenceProvider<IS_CONST_2>& m) noexcept
+            requires(IS_CONST and !IS_CONST_2)
+          : ReferenceProvider{m.group_, m.current_index_}
+        {
+        }
+
+        constexpr void advance() noexcept { current_index_ = group_->next_of(current_index_); }
+        constexpr void recede() noexcept { current_index_ = group_->prev_of(current_index_); }
+
+        constexpr std::conditional_t<IS_CONST, const_reference, reference> get() const noexcept
+        {
+            assert_or_abort(current_index_ < MAXIMUM_SIZE);
+            return group_->storage().at(current_index_);
+        }
+
+        template <bool IS_CONST2>
+        constexpr bool operator==(const ReferenceProvider<IS_CONST2>& other) const noexcept
+        {
+            assert_or_abort(group_ == other.group_);
+            return current_index_ == other.current_index_;
+        }
+
+        [[nodiscard]] constexpr std::size_t current_index() const { return current_index_; }
+    };
+
+    template <IteratorConstness CONSTNESS, IteratorDirection DIRECTION>
+    using Iterator = BidirectionalIterator<ReferenceProvider<true>,
+                                           ReferenceProvider<false>,
+                                           CONSTNESS,
+                                           DIRECTION>;
+
+    // A lightweight handle to one of the lists of the group. Handles are cheap to copy and remain
+    // valid for the lifetime of the group.
+    template <bool IS_CONST>
+    class BasicListRef
+    {
+        friend class FixedListGroupBase;
+        friend class BasicListRef<!IS_CONST>;
+        using ConstOrMutableGroup =
+            std::conditional_t<IS_CONST, const FixedListGroupBase, FixedListGroupBase>;
+        static constexpr IteratorConstness CONSTNESS =
+            IS_CONST ? IteratorConstness::CONSTANT_ITERATOR : IteratorConstness::MUTABLE_ITERATOR;
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<IS_CONST, const T&, T&>;
+        using const_reference = const T&;
+
+        using const_iterator =
+            Iterator<IteratorConstness::CONSTANT_ITERATOR, IteratorDirection::FORWARD>;
+        using iterator = Iterator<CONSTNESS, IteratorDirection::FORWARD>;
+        using const_reverse_iterator =
+            Iterator<IteratorConstness::CONSTANT_ITERATOR, IteratorDirection::REVERSE>;
+        using reverse_iterator = Iterator<CONSTNESS, IteratorDirection::REVERSE>;
+
+    private:
+        ConstOrMutableGroup* group_;
+        std::size_t sentinel_;
+
+        constexpr BasicListRef(ConstOrMutableGroup* const group, const std::size_t sentinel)
+          : group_{group}
+          , sentinel_{sentinel}
+        {
+        }
+
+    public:
+        template <bool IS_CONST_2>
+        constexpr BasicListRef(const BasicListRef<IS_CONST_2>& other) noexcept
+            requires(IS_CONST and !IS_CONST_2)
+          : BasicListRef{other.group_, other.sentinel_}
+        {
+        }
+
+        [[nodiscard]] constexpr std::size_t size() const noexcept
+        {
+            return group_->list_size(sentinel_);
+        }
+        [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+        // The capacity is shared by all the lists of the group
+        [[nodiscard]] constexpr std::size_t max_size() const noexcept { return MAXIMUM_SIZE; }
+
+        constexpr iterator begin() const noexcept { return create_iterator(front_index()); }
+        constexpr const_iterator cbegin() const noexcept { return begin(); }
+        constexpr iterator end() const noexcept { return create_iterator(sentinel_); }
+        constexpr const_iterator cend() const noexcept { return end(); }
+
+        constexpr reverse_iterator rbegin() const noexcept
+        {
+            return reverse_iterator{ReferenceProvider<IS_CONST>{group_, sentinel_}};
+        }
+        constexpr const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+        constexpr reverse_iterator rend() const noexcept
+        {
+            return reverse_iterator{ReferenceProvider<IS_CONST>{group_, front_index()}};
+        }
+        constexpr const_reverse_iterator crend() const noexcept { return rend(); }
+
+        constexpr reference front(const std_transition::source_location& loc =
+                                      std_transition::source_location::current()) const
+        {
+            check_not_empty(loc);
+            return group_->storage().at(front_index());
+        }
+        constexpr reference back(const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) const
+        {
+            check_not_empty(loc);
+            return group_->storage().at(group_->prev_of(sentinel_));
+        }
+
+        template <typename... Args>
+        constexpr reference emplace_back(Args&&... args) const
+            requires(!IS_CONST)
+        {
+            group_->check_not_full(std_transition::source_location::current());
+            const std::size_t i = group_->emplace_before_index_and_return_index(
+                sentinel_, sentinel_, std::forward<Args>(args)...);
+            return group_->storage().at(i);
+        }
+        constexpr void push_back(
+            const value_type& v,
+            const std_transition::source_location& loc =
+                std_transition::source_location::current()) const
+            requires(!IS_CONST)
+        {
+            group_->check_not_full(loc);
+            group_->emplace_before_index_and_return_index(sentinel_, sentinel_, v);
+        }
+        constexpr void push_back(
+            value_type&& v,
+            const std_transition::source_location& loc =
+                std_transition::source_location::current()) const
+            requires(!IS_CONST)
+        {
+            group_->check_not_full(loc);
+            group_->emplace_before_index_and_return_index(sentinel_, sentinel_, std::move(v));
+        }
+
+        template <typename... Args>
+        constexpr reference emplace_front(Args&&... args) const
+            requires(!IS_CONST)
+        {
+            group_->check_not_full(std_transition::source_location::current());
+            const std::size_t i = group_->emplace_before_index_and_return_index(
+                sentinel_, front_index(), std::forward<Args>(args)...);
+            return group_->storage().at(i);
+        }
+        constexpr void push_front(
+            const value_type& v,
+            const std_transition::source_location& loc =
+                std_transition::source_location::current()) const
+            requires(!IS_CONST)
+        {
+            group_->check_not_full(loc);
+            group_->emplace_before_index_and_return_index(sentinel_, front_index(), v);
+        }
+        constexpr void push_front(
+            value_type&& v,
+            const std_transition::source_location& loc =
+                std_transition::source_location::current()) const
+            requires(!IS_CONST)
+        {
+            group_->check_not_full(loc);
+            group_->emplace_before_index_and_return_index(sentinel_, front_index(), std::move(v));
+        }
+
+        constexpr void pop_back(const std_transition::source_location& loc =
+                                    std_transition::source_location::current()) const
+            requires(!IS_CONST)
+        {
+            check_not_empty(loc);
+            group_->delete_at_and_return_next_index(sentinel_, group_->prev_of(sentinel_));
+        }
+        constexpr void pop_front(const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) const
+            requires(!IS_CONST)
+        {
+            check_not_empty(loc);
+            group_->delete_at_and_return_next_index(sentinel_, front_index());
+        }
+
+        template <typename... Args>
+        constexpr iterator emplace(const_iterator pos, Args&&... args) const
+            requires(!IS_CONST)
+        {
+            group_->check_not_full(std_transition::source_location::current());
+            return create_iterator(group_->emplace_before_index_and_return_index(
+                sentinel_, index_of(pos), std::forward<Args>(args)...));
+        }
+        constexpr iterator insert(
+            const_iterator pos,
+            const value_type& v,
+            const std_transition::source_location& loc =
+                std_transition::source_location::current()) const
+            requires(!IS_CONST)
+        {
+            group_->check_not_full(loc);
+            return create_iterator(
+                group_->emplace_before_index_and_return_index(sentinel_, index_of(pos), v));
+        }
+        constexpr iterator insert(
+            const_iterator pos,
+            value_type&& v,
+            const std_transition::source_location& loc =
+                std_transition::source_location::current()) const
+            requires(!IS_CONST)
+        {
+            group_->check_not_full(loc);
+            return create_iterator(group_->emplace_before_index_and_return_index(
+                sentinel_, index_of(pos), std::move(v)));
+        }
+
+        constexpr iterator erase(const_iterator first, const_iterator last) const noexcept
+            requires(!IS_CONST)
+        {
+            const std::size_t last_index = index_of(last);
+            for (std::size_t i = index_of(first); i != last_index;)
+            {
+                i = group_->delete_at_and_return_next_index(sentinel_, i);
+            }
+            return create_iterator(last_index);
+        }
+        constexpr iterator erase(
+            const_iterator it,
+            const std_transition::source_location& loc =
+                std_transition::source_location::current()) const noexcept
+            requires(!IS_CONST)
+        {
+            if (preconditions::test(it != cend()))
+            {
+                Checking::invalid_argument("it != cend(), invalid parameter", loc);
+            }
+            return erase(it, std::next(it));
+        }
+
+        constexpr void clear() const noexcept
+            requires(!IS_CONST)
+        {
+            erase(cbegin(), cend());
+        }
+
+        template <typename Predicate>
+        constexpr size_type remove_if(Predicate predicate) const
+            requires(!IS_CONST)
+        {
+            size_type removed_counter = 0;
+            for (std::size_t i = front_index(); i != sentinel_;)
+            {
+                if (predicate(group_->storage().at(i)))
+                {
+                    i = group_->delete_at_and_return_next_index(sentinel_, i);
+                    ++removed_counter;
+                }
+                else
+                {
+                    i = group_->next_of(i);
+                }
+            }
+            return removed_counter;
+        }
+        constexpr size_type remove(const T& value) const
+            requires(!IS_CONST)
+        {
+            return remove_if([&value](const T& v) { return v == value; });
+        }
+
+        // Moves all the nodes of `other` right before `pos`. O(1), elements are not moved.
+        constexpr void splice(
+            const_iterator pos,
+            const BasicListRef<false>& other,
+            const std_transition::source_location& loc =
+                std_transition::source_location::current()) const
+            requires(!IS_CONST)
+        {
+            check_same_group(other, loc);
+            if (preconditions::test(sentinel_ != other.sentinel_))
+            {
+                Checking::invalid_argument("cannot splice a list into itself", loc);
+            }
+            const std::size_t moved_count = other.size();
+            group_->splice_before_index(
+                index_of(pos), other.front_index(), other.sentinel_, moved_count, other.sentinel_);
+            group_->list_size(sentinel_) += moved_count;
+        }
+        // Moves the node at `it` of `other` right before `pos`. O(1), the element is not moved.
+        constexpr void splice(
+            const_iterator pos,
+            const BasicListRef<false>& other,
+            const_iterator it,
+            const std_transition::source_location& loc =
+                std_transition::source_location::current()) const
+            requires(!IS_CONST)
+        {
+            check_same_group(other, loc);
+            if (preconditions::test(it != other.cend()))
+            {
+                Checking::invalid_argument("it != other.cend(), invalid parameter", loc);
+            }
+            const std::size_t i = index_of(it);
+            group_->splice_before_index(
+                index_of(pos), i, group_->next_of(i), 1, other.sentinel_);
+            group_->list_size(sentinel_) += 1;
+        }
+        // O(1) within the same list, O(std::distance(first, last)) across lists as the moved
+        // nodes need to be counted. Elements are not moved.
+        constexpr void splice(
+            const_iterator pos,
+            const BasicListRef<false>& other,
+            const_iterator first,
+            const_iterator last,
+            const std_transition::source_location& loc =
+                std_transition::source_location::current()) const
+            requires(!IS_CONST)
+        {
+            check_same_group(other, loc);
+            const std::size_t moved_count =
+                sentinel_ == other.sentinel_
+                    ? 0
+                    : static_cast<std::size_t>(std::distance(first, last));
+            group_->splice_before_index(
+                index_of(pos), index_of(first), index_of(last), moved_count, other.sentinel_);
+            group_->list_size(sentinel_) += moved_count;
+        }
+
+        // Both lists must be sorted with respect to `comp`. All the nodes of `other` are relinked
+        // into this list and `other` is left empty. Elements are not moved.
+        template <typename Compare = std::less<>>
+        constexpr void merge(
+            const BasicListRef<false>& other,
+            Compare comp = Compare{},
+            const std_transition::source_location& loc =
+                std_transition::source_location::current()) const
+            requires(!IS_CONST)
+        {
+            check_same_group(other, loc);
+            if (sentinel_ == other.sentinel_)
+            {
+                return;
+            }
+            fixed_doubly_linked_list_detail::chain_merge(
+                group_->chain_span(), sentinel_, other.sentinel_, group_->index_less(comp));
+            group_->list_size(sentinel_) += other.size();
+            group_->list_size(other.sentinel_) = 0;
+        }
+
+        // Removes all but the first element of every group of consecutive equivalent elements
+        template <typename BinaryPredicate = std::equal_to<>>
+        constexpr size_type unique(BinaryPredicate predicate = BinaryPredicate{}) const
+            requires(!IS_CONST)
+        {
+            size_type removed_counter = 0;
+            if (empty())
+            {
+                return removed_counter;
+            }
+
+            std::size_t kept = front_index();
+            for (std::size_t i = group_->next_of(kept); i != sentinel_;)
+            {
+                if (predicate(group_->storage().at(kept), group_->storage().at(i)))
+                {
+                    i = group_->delete_at_and_return_next_index(sentinel_, i);
+                    ++removed_counter;
+                }
+                else
+                {
+                    kept = i;
+                    i = group_->next_of(i);
+                }
+            }
+            return removed_counter;
+        }
+
+        constexpr void reverse() const noexcept
+            requires(!IS_CONST)
+        {
+            fixed_doubly_linked_list_detail::chain_reverse(group_->chain_span(), sentinel_);
+        }
+
+        // Stable, in-place, O(n log n) merge sort that relinks the nodes; elements are not moved
+        template <typename Compare = std::less<>>
+        constexpr void sort(Compare comp = Compare{}) const
+            requires(!IS_CONST)
+        {
+            fixed_doubly_linked_list_detail::chain_sort(
+                group_->chain_span(), sentinel_, group_->index_less(comp));
+        }
+
+    private:
+        [[nodiscard]] constexpr std::size_t front_index() const
+        {
+            return group_->next_of(sentinel_);
+        }
+
+        constexpr iterator create_iterator(const std::size_t i) const noexcept
+        {
+            return iterator{ReferenceProvider<IS_CONST>{group_, i}};
+        }
+
+        static constexpr std::size_t index_of(const const_iterator& it)
+        {
+            const auto& ref = it.template private_reference_provider<ReferenceProvider<true>>();
+            return ref.current_index();
+        }
+
+        constexpr void check_not_empty(const std_transition::source_location& loc) const
+        {
+            if (preconditions::test(!empty()))
+            {
+                Checking::empty_container_access(loc);
+            }
+        }
+        constexpr void check_same_group(const BasicListRef<false>& other,
+                                        const std_transition::source_location& loc) const
+        {
+            if (preconditions::test(group_ == other.group_))
+            {
+                Checking::invalid_argument("lists must belong to the same FixedListGroup", loc);
+            }
+        }
+    };
+
+public:
+    using list_reference = BasicListRef<false>;
+    using const_list_reference = BasicListRef<true>;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+    [[nodiscard]] static constexpr std::size_t list_count() noexcept { return LIST_COUNT; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    StorageType IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_;
+    ChainType IMPLEMENTATION_DETAIL_DO_NOT_USE_chain_;
+    SizesType IMPLEMENTATION_DETAIL_DO_NOT_USE_sizes_;
+
+public:
+    constexpr FixedListGroupBase() noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_chain_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_sizes_{}
+    {
+        // Every sentinel starts by pointing to itself. This works because
+        // FixedIndexBasedPoolStorage will only return indexes in [0, MAXIMUM_SIZE - 1]
+        for (std::size_t k = 0; k < LIST_COUNT; k++)
+        {
+            next_of(MAXIMUM_SIZE + k) = MAXIMUM_SIZE + k;
+            prev_of(MAXIMUM_SIZE + k) = MAXIMUM_SIZE + k;
+        }
+    }
+
+public:
+    constexpr list_reference list(
+        const std::size_t k,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_list_index(k, loc);
+        return list_reference{this, MAXIMUM_SIZE + k};
+    }
+    constexpr const_list_reference list(
+        const std::size_t k,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        check_list_index(k, loc);
+        return const_list_reference{this, MAXIMUM_SIZE + k};
+    }
+
+    // Total element count across all the lists
+    [[nodiscard]] constexpr std::size_t size() const noexcept
+    {
+        std::size_t total = 0;
+        for (const std::size_t list_size : IMPLEMENTATION_DETAIL_DO_NOT_USE_sizes_)
+        {
+            total += list_size;
+        }
+        return total;
+    }
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+    [[nodiscard]] constexpr bool full() const noexcept { return storage().full(); }
+
+    constexpr void clear() noexcept
+    {
+        for (std::size_t k = 0; k < LIST_COUNT; k++)
+        {
+            list(k).clear();
+        }
+    }
+
+private:
+    [[nodiscard]] constexpr const std::size_t& next_of(const std::size_t i) const
+    {
+        return chain().at(i).next;
+    }
+    [[nodiscard]] constexpr std::size_t& next_of(const std::size_t i) { return chain().at(i).next; }
+    [[nodiscard]] constexpr const std::size_t& prev_of(const std::size_t i) const
+    {
+        return chain().at(i).prev;
+    }
+    [[nodiscard]] constexpr std::size_t& prev_of(const std::size_t i) { return chain().at(i).prev; }
+
+    [[nodiscard]] constexpr const std::size_t& list_size(const std::size_t sentinel) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_sizes_.at(sentinel - MAXIMUM_SIZE);
+    }
+    [[nodiscard]] constexpr std::size_t& list_size(const std::size_t sentinel)
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_sizes_.at(sentinel - MAXIMUM_SIZE);
+    }
+
+    template <typename... Args>
+    constexpr std::size_t emplace_before_index_and_return_index(const std::size_t sentinel,
+                                                                const std::size_t idx,
+                                                                Args&&... args)
+    {
+        list_size(sentinel)++;
+        const std::size_t new_idx = storage().emplace_and_return_index(std::forward<Args>(args)...);
+        const std::size_t prev_idx = prev_of(idx);
+        prev_of(new_idx) = prev_idx;
+        next_of(new_idx) = idx;
+        next_of(prev_idx) = new_idx;
+        prev_of(idx) = new_idx;
+        return new_idx;
+    }
+
+    constexpr std::size_t delete_at_and_return_next_index(const std::size_t sentinel,
+                                                          const std::size_t idx)
+    {
+        list_size(sentinel)--;
+        storage().delete_at_and_return_repositioned_index(idx);
+        fixed_doubly_linked_list_detail::chain_unlink(chain_span(), idx);
+        return next_of(idx);
+    }
+
+    // The caller accounts for the destination list; `moved_count` nodes leave `source_sentinel`
+    constexpr void splice_before_index(const std::size_t position,
+                                       const std::size_t first,
+                                       const std::size_t last,
+                                       const std::size_t moved_count,
+                                       const std::size_t source_sentinel)
+    {
+        fixed_doubly_linked_list_detail::chain_splice_before(chain_span(), position, first, last);
+        list_size(source_sentinel) -= moved_count;
+    }
+
+    template <typename Compare>
+    constexpr auto index_less(Compare& comp) const
+    {
+        return [this, &comp](const std::size_t a, const std::size_t b)
+        { return static_cast<bool>(comp(storage().at(a), storage().at(b))); };
+    }
+
+    constexpr void check_not_full(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(!full()))
+        {
+            Checking::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+    }
+    static constexpr void check_list_index(const std::size_t k,
+                                           const std_transition::source_location& loc)
+    {
+        if (preconditions::test(k < LIST_COUNT))
+        {
+            Checking::out_of_range(k, LIST_COUNT, loc);
+        }
+    }
+
+    constexpr const StorageType& storage() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_;
+    }
+    constexpr StorageType& storage() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_; }
+
+    constexpr const ChainType& chain() const { return IMPLEMENTATION_DETAIL_DO_NOT_USE_chain_; }
+    constexpr ChainType& chain() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_chain_; }
+    constexpr std::span<ChainEntryType> chain_span() { return chain(); }
+
+protected:
+    // [WORKAROUND-1] - Needed by the non-trivially-copyable flavor of FixedListGroup
+    constexpr void append_all_from(const FixedListGroupBase& other)
+    {
+        for (std::size_t k = 0; k < LIST_COUNT; k++)
+        {
+            const std::size_t sentinel = MAXIMUM_SIZE + k;
+            for (std::size_t i = other.next_of(sentinel); i != sentinel; i = other.next_of(i))
+            {
+                emplace_before_index_and_return_index(sentinel, sentinel, other.storage().at(i));
+            }
+        }
+    }
+    constexpr void append_all_from(FixedListGroupBase&& other)
+    {
+        for (std::size_t k = 0; k < LIST_COUNT; k++)
+        {
+            const std::size_t sentinel = MAXIMUM_SIZE + k;
+            for (std::size_t i = other.next_of(sentinel); i != sentinel; i = other.next_of(i))
+            {
+                emplace_before_index_and_return_index(
+                    sentinel, sentinel, std::move(other.storage().at(i)));
+            }
+        }
+    }
+};
+
+}  // namespace fixed_containers::fixed_list_group_detail
+
+namespace fixed_containers::fixed_list_group_detail::specializations
+{
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          std::size_t LIST_COUNT,
+          customize::SequenceContainerChecking CheckingType>
+class FixedListGroup
+  : public fixed_list_group_detail::FixedListGroupBase<T, MAXIMUM_SIZE, LIST_COUNT, CheckingType>
+{
+    using Base =
+        fixed_list_group_detail::FixedListGroupBase<T, MAXIMUM_SIZE, LIST_COUNT, CheckingType>;
+
+public:
+    // clang-format off
+    constexpr FixedListGroup() noexcept : Base() { }
+    // clang-format on
+
+    constexpr FixedListGroup(const FixedListGroup& other)
+        requires TriviallyCopyConstructible<T>
+    = default;
+    constexpr FixedListGroup(FixedListGroup&& other) noexcept
+        requires TriviallyMoveConstructible<T>
+    = default;
+    constexpr FixedListGroup& operator=(const FixedListGroup& other)
+        requires TriviallyCopyAssignable<T>
+    = default;
+    constexpr FixedListGroup& operator=(FixedListGroup&& other) noexcept
+        requires TriviallyMoveAssignable<T>
+    = default;
+
+    constexpr FixedListGroup(const FixedListGroup& other)
+      : FixedListGroup()
+    {
+        this->append_all_from(other);
+    }
+    constexpr FixedListGroup(FixedListGroup&& other) noexcept
+      : FixedListGroup()
+    {
+        this->append_all_from(std::move(other));
+        // Clear the moved-out-of-group. This is consistent with the trivial move constructor of
+        // this class.
+        other.clear();
+    }
+    constexpr FixedListGroup& operator=(const FixedListGroup& other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        this->clear();
+        this->append_all_from(other);
+        return *this;
+    }
+    constexpr FixedListGroup& operator=(FixedListGroup&& other) noexcept
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        this->clear();
+        this->append_all_from(std::move(other));
+        return *this;
+    }
+
+    constexpr ~FixedListGroup() noexcept { this->clear(); }
+};
+
+template <TriviallyCopyable T,
+          std::size_t MAXIMUM_SIZE,
+          std::size_t LIST_COUNT,
+          customize::SequenceContainerChecking CheckingType>
+class FixedListGroup<T, MAXIMUM_SIZE, LIST_COUNT, CheckingType>
+  : public fixed_list_group_detail::FixedListGroupBase<T, MAXIMUM_SIZE, LIST_COUNT, CheckingType>
+{
+    using Base =
+        fixed_list_group_detail::FixedListGroupBase<T, MAXIMUM_SIZE, LIST_COUNT, CheckingType>;
+
+public:
+    // clang-format off
+    constexpr FixedListGroup() noexcept : Base() { }
+    // clang-format on
+};
+
+}  // namespace fixed_containers::fixed_list_group_detail::specializations
+
+namespace fixed_containers
+{
+/**
+ * A fixed number of lists that share a single node pool of MAXIMUM_SIZE elements. Moving nodes
+ * between the lists of a group (splice(), merge()) only relinks indices and is O(1) per call or
+ * per node, which suits e.g. per-price-level order queues. Properties:
+ *  - constexpr
+ *  - retains the properties of T (e.g. if T is trivially copyable, then so is FixedListGroup<T>)
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ */
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          std::size_t LIST_COUNT,
+          customize::SequenceContainerChecking CheckingType =
+              customize::SequenceContainerAbortChecking<T, MAXIMUM_SIZE>>
+class FixedListGroup : public fixed_list_group_detail::specializations::
+                           FixedListGroup<T, MAXIMUM_SIZE, LIST_COUNT, CheckingType>
+{
+    using Base = fixed_list_group_detail::specializations::
+        FixedListGroup<T, MAXIMUM_SIZE, LIST_COUNT, CheckingType>;
+
+public:
+    constexpr FixedListGroup() noexcept
+      : Base()
+    {
+    }
+};
+
+template <typename T, std::size_t MAXIMUM_SIZE, std::size_t LIST_COUNT, typename CheckingType>
+[[nodiscard]] constexpr bool is_full(
+    const FixedListGroup<T, MAXIMUM_SIZE, LIST_COUNT, CheckingType>& c)
+{
+    return c.full();
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,1306 @@
+#pragma once
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/bidirectional_iterator.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_doubly_linked_list.hpp"
+#include "fixed_containers/fixed_red_black_tree_rebalancing.hpp"
+#include "fixed_containers/fixed_red_black_tree_types.hpp"
+#include "fixed_containers/fixed_robinhood_hashtable.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/sequence_container_checking.hpp"
+#include "fixed_containers/source_location.hpp"
+#include "fixed_containers/wyhash.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers::multi_index
+{
+// Key extractor returning a data member of the element, e.g. `Member<&Order::id>`
+template <auto MEMBER_POINTER>
+struct Member
+{
+    template <typename T>
+    constexpr const auto& operator()(const T& value) const
+    {
+        return value.*MEMBER_POINTER;
+    }
+};
+
+// Index specifications. `Hash = void` selects `wyhash::hash<Key>` and `BUCKET_COUNT = 0` selects
+// the same oversizing as FixedUnorderedMap.
+template <typename KeyExtractor,
+          typename Hash = void,
+          typename KeyEqual = std::equal_to<>,
+          std::size_t BUCKET_COUNT = 0>
+struct HashedUnique
+{
+};
+template <typename KeyExtractor, typename Compare = std::less<>>
+struct OrderedUnique
+{
+};
+// Equivalent keys are kept in insertion order
+template <typename KeyExtractor, typename Compare = std::less<>>
+struct OrderedNonUnique
+{
+};
+
+template <typename... IndexSpecs>
+struct IndexedBy
+{
+};
+}  // namespace fixed_containers::multi_index
+
+namespace fixed_containers::fixed_multi_index_detail
+{
+using NodeIndex = fixed_red_black_tree_detail::NodeIndex;
+using NodeColor = fixed_red_black_tree_detail::NodeColor;
+using fixed_red_black_tree_detail::COLOR_BLACK;
+using fixed_red_black_tree_detail::NULL_INDEX;
+
+template <typename T, typename KeyExtractor>
+using KeyOf = std::remove_cvref_t<std::invoke_result_t<const KeyExtractor&, const T&>>;
+
+// The links of one element in one ordered index. The element payloads live in the shared pool.
+struct OrderedIndexNode
+{
+    NodeIndex parent_index;
+    NodeIndex left_index;
+    NodeIndex right_index;
+    NodeColor color;
+};
+
+// Links accessor for FixedRedBlackTreeRebalancing. It only depends on a span, so the rebalancing
+// code is shared by the ordered indices of every FixedMultiIndex.
+class OrderedIndexLinks
+{
+    std::span<OrderedIndexNode> nodes_;
+    NodeIndex* root_index_;
+
+public:
+    constexpr OrderedIndexLinks(const std::span<OrderedIndexNode> nodes, NodeIndex& root_index)
+      : nodes_{nodes}
+      , root_index_{&root_index}
+    {
+    }
+
+    [[nodiscard]] constexpr NodeIndex root_index() const { return *root_index_; }
+    constexpr void set_root_index(const NodeIndex& r) { *root_index_ = r; }
+
+    [[nodiscard]] constexpr NodeIndex parent_index(const NodeIndex& i) const
+    {
+        return nodes_[i].parent_index;
+    }
+    constexpr void set_parent_index(const NodeIndex& i, const NodeIndex& s)
+    {
+        nodes_[i].parent_index = s;
+    }
+    [[nodiscard]] constexpr NodeIndex left_index(const NodeIndex& i) const
+    {
+        return nodes_[i].left_index;
+    }
+    constexpr void set_left_index(const NodeIndex& i, const NodeIndex& s)
+    {
+        nodes_[i].left_index = s;
+    }
+    [[nodiscard]] constexpr NodeIndex right_index(const NodeIndex& i) const
+    {
+        return nodes_[i].right_index;
+    }
+    constexpr void set_right_index(const NodeIndex& i, const NodeIndex& s)
+    {
+        nodes_[i].right_index = s;
+    }
+    [[nodiscard]] constexpr NodeColor color(const NodeIndex& i) const { return nodes_[i].color; }
+    constexpr void set_color(const NodeIndex& i, const NodeColor& c) { nodes_[i].color = c; }
+};
+
+// A red-black tree over the element indices of the pool. In-order iteration uses MAXIMUM_SIZE as
+// the end index and NULL_INDEX as the reverse end index, like FixedSet.
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          typename KeyExtractor,
+          typename Compare,
+          bool UNIQUE>
+class OrderedIndex
+{
+    using Rebalancing =
+        fixed_red_black_tree_detail::FixedRedBlackTreeRebalancing<OrderedIndexLinks>;
+
+public:
+    using key_type = KeyOf<T, KeyExtractor>;
+    static constexpr bool IS_ORDERED = true;
+    static constexpr bool IS_UNIQUE = UNIQUE;
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    std::array<OrderedIndexNode, MAXIMUM_SIZE> IMPLEMENTATION_DETAIL_DO_NOT_USE_nodes_;
+    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_;
+    KeyExtractor IMPLEMENTATION_DETAIL_DO_NOT_USE_key_extractor_;
+    Compare IMPLEMENTATION_DETAIL_DO_NOT_USE_compare_;
+
+public:
+    constexpr OrderedIndex() noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_nodes_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_{NULL_INDEX}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_key_extractor_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_compare_{}
+    {
+    }
+
+    // NULL_INDEX if the unlinked element `i` can be linked, otherwise the conflicting element
+    template <typename Elements>
+    [[nodiscard]] constexpr NodeIndex index_of_conflict(const Elements& elements,
+                                                        const NodeIndex i) const
+    {
+        if constexpr (UNIQUE)
+        {
+            return index_of(elements, key_at(elements, i));
+        }
+        else
+        {
+            return NULL_INDEX;
+        }
+    }
+
+    template <typename Elements>
+    constexpr void link(const Elements& elements, const NodeIndex i)
+    {
+        const auto& key = key_at(elements, i);
+        NodeIndex parent = NULL_INDEX;
+        bool is_left_child = false;
+        for (NodeIndex j = root_index(); j != NULL_INDEX;)
+        {
+            parent = j;
+            // Equivalent keys go to the right, so they are visited in insertion order
+            is_left_child = compare(key, key_at(elements, j));
+            j = is_left_child ? node(j).left_index : node(j).right_index;
+        }
+
+        node(i) = {parent, NULL_INDEX, NULL_INDEX, COLOR_BLACK};
+        if (parent == NULL_INDEX)
+        {
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_ = i;
+        }
+        else if (is_left_child)
+        {
+            node(parent).left_index = i;
+        }
+        else
+        {
+            node(parent).right_index = i;
+        }
+
+        OrderedIndexLinks links = this->links();
+        Rebalancing::fix_after_insertion(links, i);
+    }
+
+    template <typename Elements>
+    constexpr void unlink(const Elements& /*elements*/, const NodeIndex i)
+    {
+        OrderedIndexLinks links = this->links();
+        Rebalancing::erase(links, i);
+    }
+
+    // Called before and after an element is modified in place
+    template <typename Elements>
+    [[nodiscard]] constexpr NodeIndex position_of(const Elements& /*elements*/,
+                                                  const NodeIndex i) const
+    {
+        return i;
+    }
+    // Keeps the element where it is if its new key still sits between its neighbours, so that
+    // modifying the non-key parts of an element does not change its position among equals
+    template <typename Elements>
+    constexpr bool unlink_if_misplaced(const Elements& elements,
+                                       const NodeIndex i,
+                                       const NodeIndex /*position*/)
+    {
+        const auto& key = key_at(elements, i);
+        const NodeIndex previous = index_of_predecessor(i);
+        const NodeIndex next = index_of_successor(i);
+        if ((previous == NULL_INDEX || in_order(key_at(elements, previous), key)) &&
+            (next == MAXIMUM_SIZE || in_order(key, key_at(elements, next))))
+        {
+            return false;
+        }
+        unlink(elements, i);
+        return true;
+    }
+
+    constexpr void reset() { IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_ = NULL_INDEX; }
+
+    template <typename Elements, typename K>
+    [[nodiscard]] constexpr NodeIndex index_of(const Elements& elements, const K& key) const
+    {
+        const NodeIndex i = index_of_lower_bound(elements, key);
+        if (i == MAXIMUM_SIZE || compare(key, key_at(elements, i)))
+        {
+            return NULL_INDEX;
+        }
+        return i;
+    }
+
+    template <typename Elements, typename K>
+    [[nodiscard]] constexpr NodeIndex index_of_lower_bound(const Elements& elements,
+                                                           const K& key) const
+    {
+        NodeIndex result = MAXIMUM_SIZE;
+        for (NodeIndex j = root_index(); j != NULL_INDEX;)
+        {
+            if (!compare(key_at(elements, j), key))
+            {
+                result = j;
+                j = node(j).left_index;
+            }
+            else
+            {
+                j = node(j).right_index;
+            }
+        }
+        return result;
+    }
+
+    template <typename Elements, typename K>
+    [[nodiscard]] constexpr NodeIndex index_of_upper_bound(const Elements& elements,
+                                                           const K& key) const
+    {
+        NodeIndex result = MAXIMUM_SIZE;
+        for (NodeIndex j = root_index(); j != NULL_INDEX;)
+        {
+            if (compare(key, key_at(elements, j)))
+            {
+                result = j;
+                j = node(j).left_index;
+            }
+            else
+            {
+                j = node(j).right_index;
+            }
+        }
+        return result;
+    }
+
+    [[nodiscard]] constexpr NodeIndex index_of_min() const
+    {
+        const NodeIndex root = root_index();
+        return root == NULL_INDEX ? MAXIMUM_SIZE : leftmost_of(root);
+    }
+
+    [[nodiscard]] constexpr NodeIndex index_of_successor(const NodeIndex i) const
+    {
+        if (node(i).right_index != NULL_INDEX)
+        {
+            return leftmost_of(node(i).right_index);
+        }
+        NodeIndex child = i;
+        NodeIndex parent = node(i).parent_index;
+        while (parent != NULL_INDEX && child == node(parent).right_index)
+        {
+            child = parent;
+            parent = node(parent).parent_index;
+        }
+        return parent == NULL_INDEX ? MAXIMUM_SIZE : parent;
+    }
+
+    [[nodiscard]] constexpr NodeIndex index_of_predecessor(const NodeIndex i) const
+    {
+        if (i == MAXIMUM_SIZE)
+        {
+            const NodeIndex root = root_index();
+            return root == NULL_INDEX ? NULL_INDEX : rightmost_of(root);
+        }
+        if (node(i).left_index != NULL_INDEX)
+        {
+            return rightmost_of(node(i).left_index);
+        }
+        NodeIndex child = i;
+        NodeIndex parent = node(i).parent_index;
+        while (parent != NULL_INDEX && child == node(parent).left_index)
+        {
+            child = parent;
+            parent = node(parent).parent_index;
+        }
+        return parent;
+    }
+
+private:
+    template <typename Elements>
+    [[nodiscard]] constexpr decltype(auto) key_at(const Elements& elements, const NodeIndex i) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_key_extractor_(elements.at(i));
+    }
+
+    template <typename K1, typename K2>
+    [[nodiscard]] constexpr bool compare(const K1& lhs, const K2& rhs) const
+    {
+        return static_cast<bool>(IMPLEMENTATION_DETAIL_DO_NOT_USE_compare_(lhs, rhs));
+    }
+
+    // Unique indices need strictly increasing neighbours
+    template <typename K1, typename K2>
+    [[nodiscard]] constexpr bool in_order(const K1& lhs, const K2& rhs) const
+    {
+        if constexpr (UNIQUE)
+        {
+            return compare(lhs, rhs);
+        }
+        else
+        {
+            return !compare(rhs, lhs);
+        }
+    }
+
+    [[nodiscard]] constexpr NodeIndex root_index() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_;
+    }
+    [[nodiscard]] constexpr const OrderedIndexNode& node(const NodeIndex i) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_nodes_[i];
+    }
+    [[nodiscard]] constexpr OrderedIndexNode& node(const NodeIndex i)
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_nodes_[i];
+    }
+
+    [[nodiscard]] constexpr NodeIndex leftmost_of(NodeIndex i) const
+    {
+        while (node(i).left_index != NULL_INDEX)
+        {
+            i = node(i).left_index;
+        }
+        return i;
+    }
+    [[nodiscard]] constexpr NodeIndex rightmost_of(NodeIndex i) const
+    {
+        while (node(i).right_index != NULL_INDEX)
+        {
+            i = node(i).right_index;
+        }
+        return i;
+    }
+
+    constexpr OrderedIndexLinks links()
+    {
+        return OrderedIndexLinks{IMPLEMENTATION_DETAIL_DO_NOT_USE_nodes_,
+                                 IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_};
+    }
+};
+
+// A robinhood bucket array whose buckets refer to element indices of the pool. Probing and bucket
+// shifting are the span-based code shared with FixedRobinhoodHashtable.
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          typename KeyExtractor,
+          typename Hash,
+          typename KeyEqual,
+          std::size_t BUCKET_COUNT>
+class HashedIndex
+{
+    using Bucket = fixed_robinhood_hashtable_detail::Bucket;
+
+    static_assert(BUCKET_COUNT >= MAXIMUM_SIZE, "Need at least one bucket per element");
+    static_assert(BUCKET_COUNT <= Bucket::MAX_NUM_BUCKETS,
+                  "Cannot guarantee correct behavior with this many buckets");
+
+    using Location = fixed_robinhood_hashtable_detail::BucketLocation;
+
+public:
+    using key_type = KeyOf<T, KeyExtractor>;
+    static constexpr bool IS_ORDERED = false;
+    static constexpr bool IS_UNIQUE = true;
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    std::array<Bucket, BUCKET_COUNT> IMPLEMENTATION_DETAIL_DO_NOT_USE_buckets_;
+    KeyExtractor IMPLEMENTATION_DETAIL_DO_NOT_USE_key_extractor_;
+    Hash IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_;
+    KeyEqual IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_;
+
+public:
+    constexpr HashedIndex() noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_buckets_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_key_extractor_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_{}
+    {
+    }
+
+    template <typename Elements>
+    [[nodiscard]] constexpr NodeIndex index_of_conflict(const Elements& elements,
+                                                        const NodeIndex i) const
+    {
+        return index_of(elements, key_at(elements, i));
+    }
+
+    template <typename Elements>
+    constexpr void link(const Elements& elements, const NodeIndex i)
+    {
+        const Location location = locate(elements, key_at(elements, i));
+        assert_or_abort(location.dist_and_fingerprint != 0);
+        fixed_robinhood_hashtable_detail::place_and_shift_up_in(
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_buckets_,
+            Bucket{location.dist_and_fingerprint, static_cast<Bucket::ValueIndexType>(i)},
+            location.bucket_index);
+    }
+
+    template <typename Elements>
+    constexpr void unlink(const Elements& elements, const NodeIndex i)
+    {
+        const Location location = locate(elements, key_at(elements, i));
+        assert_or_abort(location.dist_and_fingerprint == 0);
+        fixed_robinhood_hashtable_detail::erase_bucket_in(IMPLEMENTATION_DETAIL_DO_NOT_USE_buckets_,
+                                                          location.bucket_index);
+    }
+
+    // Called before and after an element is modified in place. The bucket of the element has to
+    // be found with the old key; the buckets do not define an order, so it is always relinked.
+    template <typename Elements>
+    [[nodiscard]] constexpr NodeIndex position_of(const Elements& elements,
+                                                  const NodeIndex i) const
+    {
+        const Location location = locate(elements, key_at(elements, i));
+        assert_or_abort(location.dist_and_fingerprint == 0);
+        return location.bucket_index;
+    }
+    template <typename Elements>
+    constexpr bool unlink_if_misplaced(const Elements& /*elements*/,
+                                       const NodeIndex /*i*/,
+                                       const NodeIndex position)
+    {
+        fixed_robinhood_hashtable_detail::erase_bucket_in(
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_buckets_,
+            static_cast<Bucket::ValueIndexType>(position));
+        return true;
+    }
+
+    constexpr void reset() { IMPLEMENTATION_DETAIL_DO_NOT_USE_buckets_.fill({}); }
+
+    template <typename Elements, typename K>
+    [[nodiscard]] constexpr NodeIndex index_of(const Elements& elements, const K& key) const
+    {
+        const Location location = locate(elements, key);
+        if (location.dist_and_fingerprint != 0)
+        {
+            return NULL_INDEX;
+        }
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_buckets_[location.bucket_index].value_index_;
+    }
+
+private:
+    template <typename Elements, typename K>
+    [[nodiscard]] constexpr Location locate(const Elements& elements, const K& key) const
+    {
+        const std::uint64_t hash = IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_(key);
+        return fixed_robinhood_hashtable_detail::find_bucket_in(
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_buckets_,
+            static_cast<Bucket::ValueIndexType>((hash >> Bucket::FINGERPRINT_BITS) % BUCKET_COUNT),
+            Bucket::dist_and_fingerprint_from_hash(hash),
+            [this, &elements, &key](const Bucket::ValueIndexType value_index)
+            {
+                return IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_(key,
+                                                                   key_at(elements, value_index));
+            });
+    }
+
+    template <typename Elements>
+    [[nodiscard]] constexpr decltype(auto) key_at(const Elements& elements, const NodeIndex i) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_key_extractor_(elements.at(i));
+    }
+};
+
+template <typename T, std::size_t MAXIMUM_SIZE, typename IndexSpec>
+struct IndexImplOf;
+
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          typename KeyExtractor,
+          typename Hash,
+          typename KeyEqual,
+          std::size_t BUCKET_COUNT>
+struct IndexImplOf<T,
+                   MAXIMUM_SIZE,
+                   multi_index::HashedUnique<KeyExtractor, Hash, KeyEqual, BUCKET_COUNT>>
+{
+    using type = HashedIndex<
+        T,
+        MAXIMUM_SIZE,
+        KeyExtractor,
+        std::conditional_t<std::is_void_v<Hash>, wyhash::hash<KeyOf<T, KeyExtractor>>, Hash>,
+        KeyEqual,
+        BUCKET_COUNT == 0 ? fixed_robinhood_hashtable_detail::default_bucket_count(MAXIMUM_SIZE)
+                          : BUCKET_COUNT>;
+};
+template <typename T, std::size_t MAXIMUM_SIZE, typename KeyExtractor, typename Compare>
+struct IndexImplOf<T, MAXIMUM_SIZE, multi_index::OrderedUnique<KeyExtractor, Compare>>
+{
+    using type = OrderedIndex<T, MAXIMUM_SIZE, KeyExtractor, Compare, true>;
+};
+template <typename T, std::size_t MAXIMUM_SIZE, typename KeyExtractor, typename Compare>
+struct IndexImplOf<T, MAXIMUM_SIZE, multi_index::OrderedNonUnique<KeyExtractor, Compare>>
+{
+    using type = OrderedIndex<T, MAXIMUM_SIZE, KeyExtractor, Compare, false>;
+};
+
+// A minimal aggregate tuple. std::tuple is neither guaranteed to be trivially copyable nor a
+// structural type.
+template <typename... Indices>
+struct IndexTuple;
+template <>
+struct IndexTuple<>
+{
+};
+template <typename Head, typename... Tail>
+struct IndexTuple<Head, Tail...>
+{
+    Head IMPLEMENTATION_DETAIL_DO_NOT_USE_head_;
+    IndexTuple<Tail...> IMPLEMENTATION_DETAIL_DO_NOT_USE_tail_;
+};
+
+template <std::size_t I, typename Tuple>
+constexpr auto& index_at(Tuple& tuple)
+{
+    if constexpr (I == 0)
+    {
+        return tuple.IMPLEMENTATION_DETAIL_DO_NOT_USE_head_;
+    }
+    else
+    {
+        return index_at<I - 1>(tuple.IMPLEMENTATION_DETAIL_DO_NOT_USE_tail_);
+    }
+}
+
+template <typename T, std::size_t MAXIMUM_SIZE, typename IndexedByType>
+struct IndicesOf;
+template <typename T, std::size_t MAXIMUM_SIZE, typename... IndexSpecs>
+struct IndicesOf<T, MAXIMUM_SIZE, multi_index::IndexedBy<IndexSpecs...>>
+{
+    static constexpr std::size_t COUNT = sizeof...(IndexSpecs);
+    using type = IndexTuple<typename IndexImplOf<T, MAXIMUM_SIZE, IndexSpecs>::type...>;
+};
+
+// [WORKAROUND-1] due to destructors: manually do the split with template specialization.
+// See FixedVector which uses the same workaround for more details.
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          typename IndexedByType,
+          customize::SequenceContainerChecking CheckingType>
+class FixedMultiIndexBase
+{
+    static_assert(IsNotReference<T>, "References are not allowed");
+    static_assert(std::same_as<std::remove_cv_t<T>, T>,
+                  "FixedMultiIndex must have a non-const, non-volatile value_type");
+    static_assert(IndicesOf<T, MAXIMUM_SIZE, IndexedByType>::COUNT > 0,
+                  "FixedMultiIndex must have at least one index");
+    // Hashed indices store element indices in 32-bit buckets
+    static_assert(MAXIMUM_SIZE < (std::numeric_limits<std::uint32_t>::max)());
+
+    using Checking = CheckingType;
+    using ElementsType = fixed_doubly_linked_list_detail::FixedDoublyLinkedList<T, MAXIMUM_SIZE>;
+    using IndicesType = typename IndicesOf<T, MAXIMUM_SIZE, IndexedByType>::type;
+    static constexpr std::size_t INDEX_COUNT = IndicesOf<T, MAXIMUM_SIZE, IndexedByType>::COUNT;
+    // Pseudo-index for iterating over the elements in insertion order
+    static constexpr std::size_t INSERTION_ORDER = INDEX_COUNT;
+    // End index of every traversal. It is also the sentinel of the insertion-order list.
+    static constexpr NodeIndex END_INDEX = MAXIMUM_SIZE;
+
+    template <std::size_t INDEX>
+    using IndexImplAt =
+        std::remove_cvref_t<decltype(index_at<INDEX>(std::declval<IndicesType&>()))>;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using const_pointer = const T*;
+    using reference = const T&;
+    using const_reference = const T&;
+
+private:
+    // Elements are only exposed as const, as mutating a key in place would corrupt the indices.
+    // Use modify() instead.
+    template <std::size_t ORDER>
+    class ReferenceProvider
+    {
+        const FixedMultiIndexBase* container_;
+        NodeIndex current_index_;
+
+    public:
+        constexpr ReferenceProvider() noexcept
+          : ReferenceProvider{nullptr, END_INDEX}
+        {
+        }
+
+        constexpr ReferenceProvider(const FixedMultiIndexBase* const container,
+                                    const NodeIndex current_index) noexcept
+          : container_{container}
+          , current_index_{current_index}
+        {
+        }
+
+        constexpr void advance() noexcept
+        {
+            current_index_ = container_->template next_index<ORDER>(current_index_);
+        }
+        constexpr void recede() noexcept
+        {
+            current_index_ = container_->template prev_index<ORDER>(current_index_);
+        }
+
+        [[nodiscard]] constexpr const_reference get() const noexcept
+        {
+            return container_->elements().at(current_index_);
+        }
+
+        constexpr bool operator==(const ReferenceProvider& other) const noexcept
+        {
+            assert_or_abort(container_ == other.container_);
+            return current_index_ == other.current_index_;
+        }
+
+        [[nodiscard]] constexpr NodeIndex current_index() const { return current_index_; }
+    };
+
+    template <std::size_t ORDER, IteratorDirection DIRECTION>
+    using Iterator = BidirectionalIterator<ReferenceProvider<ORDER>,
+                                           ReferenceProvider<ORDER>,
+                                           IteratorConstness::CONSTANT_ITERATOR,
+                                           DIRECTION>;
+
+    // Hashed indices iterate in insertion order, so they share the iterators of the container
+    template <std::size_t INDEX>
+    static constexpr std::size_t ORDER_OF =
+        IndexImplAt<INDEX>::IS_ORDERED ? INDEX : INSERTION_ORDER;
+
+public:
+    using const_iterator = Iterator<INSERTION_ORDER, IteratorDirection::FORWARD>;
+    using iterator = const_iterator;
+    using const_reverse_iterator = Iterator<INSERTION_ORDER, IteratorDirection::REVERSE>;
+    using reverse_iterator = const_reverse_iterator;
+
+private:
+    // A lightweight handle to one of the indices, obtained with get<INDEX>(). Handles are cheap to
+    // copy and remain valid for the lifetime of the container.
+    template <std::size_t INDEX, bool IS_CONST>
+    class BasicIndexView
+    {
+        friend class FixedMultiIndexBase;
+        using ConstOrMutableContainer =
+            std::conditional_t<IS_CONST, const FixedMultiIndexBase, FixedMultiIndexBase>;
+        using IndexImpl = IndexImplAt<INDEX>;
+        static constexpr std::size_t ORDER = ORDER_OF<INDEX>;
+
+    public:
+        using key_type = typename IndexImpl::key_type;
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = const T&;
+        using const_reference = const T&;
+
+        using const_iterator = Iterator<ORDER, IteratorDirection::FORWARD>;
+        using iterator = const_iterator;
+        using const_reverse_iterator = Iterator<ORDER, IteratorDirection::REVERSE>;
+        using reverse_iterator = const_reverse_iterator;
+
+    private:
+        ConstOrMutableContainer* container_;
+
+        explicit constexpr BasicIndexView(ConstOrMutableContainer* const container)
+          : container_{container}
+        {
+        }
+
+    public:
+        template <bool IS_CONST_2>
+        constexpr BasicIndexView(const BasicIndexView<INDEX, IS_CONST_2>& other) noexcept
+            requires(IS_CONST and !IS_CONST_2)
+          : BasicIndexView{other.container_}
+        {
+        }
+
+        [[nodiscard]] constexpr size_type size() const noexcept { return container_->size(); }
+        [[nodiscard]] constexpr bool empty() const noexcept { return container_->empty(); }
+
+        constexpr const_iterator begin() const noexcept
+        {
+            return create_iterator(container_->template first_index<ORDER>());
+        }
+        constexpr const_iterator cbegin() const noexcept { return begin(); }
+        constexpr const_iterator end() const noexcept { return create_iterator(END_INDEX); }
+        constexpr const_iterator cend() const noexcept { return end(); }
+
+        constexpr const_reverse_iterator rbegin() const noexcept
+        {
+            return const_reverse_iterator{ReferenceProvider<ORDER>{container_, END_INDEX}};
+        }
+        constexpr const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+        constexpr const_reverse_iterator rend() const noexcept
+        {
+            return const_reverse_iterator{ReferenceProvider<ORDER>{
+                container_, container_->template first_index<ORDER>()}};
+        }
+        constexpr const_reverse_iterator crend() const noexcept { return rend(); }
+
+        template <typename K>
+        [[nodiscard]] constexpr const_iterator find(const K& key) const
+        {
+            const NodeIndex i = impl().index_of(container_->elements(), key);
+            return create_iterator(i == NULL_INDEX ? END_INDEX : i);
+        }
+
+        template <typename K>
+        [[nodiscard]] constexpr bool contains(const K& key) const
+        {
+            return impl().index_of(container_->elements(), key) != NULL_INDEX;
+        }
+
+        // O(log n + count) for non-unique ordered indices
+        template <typename K>
+        [[nodiscard]] constexpr size_type count(const K& key) const
+        {
+            if constexpr (IndexImpl::IS_UNIQUE)
+            {
+                return contains(key) ? 1 : 0;
+            }
+            else
+            {
+                const auto [first, last] = equal_range(key);
+                return static_cast<size_type>(std::distance(first, last));
+            }
+        }
+
+        template <typename K>
+        [[nodiscard]] constexpr const_iterator lower_bound(const K& key) const
+            requires(IndexImpl::IS_ORDERED)
+        {
+            return create_iterator(impl().index_of_lower_bound(container_->elements(), key));
+        }
+        template <typename K>
+        [[nodiscard]] constexpr const_iterator upper_bound(const K& key) const
+            requires(IndexImpl::IS_ORDERED)
+        {
+            return create_iterator(impl().index_of_upper_bound(container_->elements(), key));
+        }
+        template <typename K>
+        [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range(
+            const K& key) const
+            requires(IndexImpl::IS_ORDERED)
+        {
+            return {lower_bound(key), upper_bound(key)};
+        }
+
+        // Returns the iterator following `pos` in this index
+        constexpr const_iterator erase(
+            const_iterator pos,
+            const std_transition::source_location& loc =
+                std_transition::source_location::current()) const
+            requires(!IS_CONST)
+        {
+            const NodeIndex i = index_of(pos);
+            container_->check_valid_element(i, loc);
+            const NodeIndex next = container_->template next_index<ORDER>(i);
+            container_->erase_at(i);
+            return create_iterator(next);
+        }
+
+        template <typename K>
+        constexpr size_type erase(const K& key) const
+            requires(!IS_CONST)
+        {
+            if constexpr (IndexImpl::IS_UNIQUE)
+            {
+                const NodeIndex i = impl().index_of(container_->elements(), key);
+                if (i == NULL_INDEX)
+                {
+                    return 0;
+                }
+                container_->erase_at(i);
+                return 1;
+            }
+            else
+            {
+                auto [first, last] = equal_range(key);
+                size_type removed_count = 0;
+                while (first != last)
+                {
+                    first = erase(first);
+                    ++removed_count;
+                }
+                return removed_count;
+            }
+        }
+
+        // See FixedMultiIndex::modify()
+        template <typename Modifier>
+        constexpr bool modify(const_iterator pos,
+                              Modifier modifier,
+                              const std_transition::source_location& loc =
+                                  std_transition::source_location::current()) const
+            requires(!IS_CONST)
+        {
+            return container_->modify_at(index_of(pos), modifier, loc);
+        }
+
+    private:
+        [[nodiscard]] constexpr const IndexImpl& impl() const
+        {
+            return index_at<INDEX>(container_->indices());
+        }
+
+        constexpr const_iterator create_iterator(const NodeIndex i) const noexcept
+        {
+            return const_iterator{ReferenceProvider<ORDER>{container_, i}};
+        }
+
+        static constexpr NodeIndex index_of(const const_iterator& it)
+        {
+            return it.template private_reference_provider<ReferenceProvider<ORDER>>()
+                .current_index();
+        }
+    };
+
+public:
+    template <std::size_t INDEX>
+    using index_view = BasicIndexView<INDEX, false>;
+    template <std::size_t INDEX>
+    using const_index_view = BasicIndexView<INDEX, true>;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+    [[nodiscard]] static constexpr std::size_t index_count() noexcept { return INDEX_COUNT; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    ElementsType IMPLEMENTATION_DETAIL_DO_NOT_USE_elements_;
+    IndicesType IMPLEMENTATION_DETAIL_DO_NOT_USE_indices_;
+
+public:
+    constexpr FixedMultiIndexBase() noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_elements_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_indices_{}
+    {
+    }
+
+public:
+    template <std::size_t INDEX>
+    [[nodiscard]] constexpr index_view<INDEX> get() noexcept
+    {
+        static_assert(INDEX < INDEX_COUNT, "Index out of range");
+        return index_view<INDEX>{this};
+    }
+    template <std::size_t INDEX>
+    [[nodiscard]] constexpr const_index_view<INDEX> get() const noexcept
+    {
+        static_assert(INDEX < INDEX_COUNT, "Index out of range");
+        return const_index_view<INDEX>{this};
+    }
+
+    constexpr const_iterator begin() const noexcept
+    {
+        return create_iterator(first_index<INSERTION_ORDER>());
+    }
+    constexpr const_iterator cbegin() const noexcept { return begin(); }
+    constexpr const_iterator end() const noexcept { return create_iterator(END_INDEX); }
+    constexpr const_iterator cend() const noexcept { return end(); }
+
+    constexpr const_reverse_iterator rbegin() const noexcept
+    {
+        return const_reverse_iterator{ReferenceProvider<INSERTION_ORDER>{this, END_INDEX}};
+    }
+    constexpr const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+    constexpr const_reverse_iterator rend() const noexcept
+    {
+        return const_reverse_iterator{
+            ReferenceProvider<INSERTION_ORDER>{this, first_index<INSERTION_ORDER>()}};
+    }
+    constexpr const_reverse_iterator crend() const noexcept { return rend(); }
+
+    [[nodiscard]] constexpr size_type size() const noexcept { return elements().size(); }
+    [[nodiscard]] constexpr size_type max_size() const noexcept { return static_max_size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+    [[nodiscard]] constexpr bool full() const noexcept { return elements().full(); }
+
+    constexpr void clear() noexcept
+    {
+        for_each_index([](auto& index) { index.reset(); });
+        elements().clear();
+    }
+
+    // Inserts the element in every index, or nothing at all if any unique index already has an
+    // equivalent key. Returns the inserted element, or the element that prevented the insertion.
+    constexpr std::pair<const_iterator, bool> insert(
+        const value_type& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        return emplace_impl(loc, value);
+    }
+    constexpr std::pair<const_iterator, bool> insert(
+        value_type&& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        return emplace_impl(loc, std::move(value));
+    }
+
+    template <typename... Args>
+    constexpr std::pair<const_iterator, bool> emplace(Args&&... args)
+    {
+        return emplace_impl(std_transition::source_location::current(),
+                            std::forward<Args>(args)...);
+    }
+
+    constexpr const_iterator erase(
+        const_iterator pos,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        const NodeIndex i = index_of(pos);
+        check_valid_element(i, loc);
+        const NodeIndex next = next_index<INSERTION_ORDER>(i);
+        erase_at(i);
+        return create_iterator(next);
+    }
+
+    // Applies `modifier` to the element and updates every index. An element whose new key still
+    // sorts between its neighbours keeps its position. If the new keys conflict with another
+    // element in a unique index, the modified element is erased and false is returned.
+    template <typename Modifier>
+    constexpr bool modify(
+        const_iterator pos,
+        Modifier modifier,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        return modify_at(index_of(pos), modifier, loc);
+    }
+
+private:
+    template <typename... Args>
+    constexpr std::pair<const_iterator, bool> emplace_impl(
+        const std_transition::source_location& loc, Args&&... args)
+    {
+        check_not_full(loc);
+        const NodeIndex i = elements().emplace_back_and_return_index(std::forward<Args>(args)...);
+        const NodeIndex conflict = index_of_first_conflict(i);
+        if (conflict != NULL_INDEX)
+        {
+            elements().delete_at_and_return_next_index(i);
+            return {create_iterator(conflict), false};
+        }
+        for_each_index([this, i](auto& index) { index.link(elements(), i); });
+        return {create_iterator(i), true};
+    }
+
+    template <typename Modifier>
+    constexpr bool modify_at(const NodeIndex i,
+                             Modifier& modifier,
+                             const std_transition::source_location& loc)
+    {
+        check_valid_element(i, loc);
+        std::array<NodeIndex, INDEX_COUNT> positions{};
+        for_each_index_with_ordinal([this, i, &positions](const std::size_t k, auto& index)
+                                    { positions[k] = index.position_of(elements(), i); });
+
+        modifier(elements().at(i));
+
+        std::array<bool, INDEX_COUNT> unlinked{};
+        bool has_conflict = false;
+        for_each_index_with_ordinal(
+            [this, i, &positions, &unlinked, &has_conflict](const std::size_t k, auto& index)
+            {
+                unlinked[k] = index.unlink_if_misplaced(elements(), i, positions[k]);
+                if (unlinked[k] && index.index_of_conflict(elements(), i) != NULL_INDEX)
+                {
+                    has_conflict = true;
+                }
+            });
+
+        for_each_index_with_ordinal(
+            [this, i, &unlinked, has_conflict](const std::size_t k, auto& index)
+            {
+                if (has_conflict && !unlinked[k])
+                {
+                    index.unlink(elements(), i);
+                }
+                else if (!has_conflict && unlinked[k])
+                {
+                    index.link(elements(), i);
+                }
+            });
+        if (has_conflict)
+        {
+            elements().delete_at_and_return_next_index(i);
+        }
+        return !has_conflict;
+    }
+
+    constexpr void erase_at(const NodeIndex i)
+    {
+        for_each_index([this, i](auto& index) { index.unlink(elements(), i); });
+        elements().delete_at_and_return_next_index(i);
+    }
+
+    // The unlinked element `i` conflicts with another element in a unique index
+    [[nodiscard]] constexpr NodeIndex index_of_first_conflict(const NodeIndex i) const
+    {
+        NodeIndex conflict = NULL_INDEX;
+        for_each_index(
+            [this, i, &conflict](const auto& index)
+            {
+                if (conflict == NULL_INDEX)
+                {
+                    conflict = index.index_of_conflict(elements(), i);
+                }
+            });
+        return conflict;
+    }
+
+    template <std::size_t ORDER>
+    [[nodiscard]] constexpr NodeIndex first_index() const
+    {
+        if constexpr (ORDER == INSERTION_ORDER)
+        {
+            return elements().front_index();
+        }
+        else
+        {
+            return index_at<ORDER>(indices()).index_of_min();
+        }
+    }
+
+    template <std::size_t ORDER>
+    [[nodiscard]] constexpr NodeIndex next_index(const NodeIndex i) const
+    {
+        if constexpr (ORDER == INSERTION_ORDER)
+        {
+            return elements().next_of(i);
+        }
+        else
+        {
+            return index_at<ORDER>(indices()).index_of_successor(i);
+        }
+    }
+
+    template <std::size_t ORDER>
+    [[nodiscard]] constexpr NodeIndex prev_index(const NodeIndex i) const
+    {
+        if constexpr (ORDER == INSERTION_ORDER)
+        {
+            return elements().prev_of(i);
+        }
+        else
+        {
+            return index_at<ORDER>(indices()).index_of_predecessor(i);
+        }
+    }
+
+    template <typename Function>
+    constexpr void for_each_index(Function function)
+    {
+        [this, &function]<std::size_t... INDICES>(std::index_sequence<INDICES...>)
+        { (function(index_at<INDICES>(indices())), ...); }(std::make_index_sequence<INDEX_COUNT>{});
+    }
+    template <typename Function>
+    constexpr void for_each_index_with_ordinal(Function function)
+    {
+        [this, &function]<std::size_t... INDICES>(std::index_sequence<INDICES...>)
+        {
+            (function(INDICES, index_at<INDICES>(indices())), ...);
+        }(std::make_index_sequence<INDEX_COUNT>{});
+    }
+    template <typename Function>
+    constexpr void for_each_index(Function function) const
+    {
+        [this, &function]<std::size_t... INDICES>(std::index_sequence<INDICES...>)
+        { (function(index_at<INDICES>(indices())), ...); }(std::make_index_sequence<INDEX_COUNT>{});
+    }
+
+    constexpr const_iterator create_iterator(const NodeIndex i) const noexcept
+    {
+        return const_iterator{ReferenceProvider<INSERTION_ORDER>{this, i}};
+    }
+
+    static constexpr NodeIndex index_of(const const_iterator& it)
+    {
+        return it.template private_reference_provider<ReferenceProvider<INSERTION_ORDER>>()
+            .current_index();
+    }
+
+    constexpr void check_not_full(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(!full()))
+        {
+            Checking::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+    }
+    constexpr void check_valid_element(const NodeIndex i,
+                                       const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(i < MAXIMUM_SIZE))
+        {
+            Checking::out_of_range(i, size(), loc);
+        }
+    }
+
+    constexpr const ElementsType& elements() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_elements_;
+    }
+    constexpr ElementsType& elements() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_elements_; }
+
+    constexpr const IndicesType& indices() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_indices_;
+    }
+    constexpr IndicesType& indices() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_indices_; }
+
+protected:
+    // [WORKAROUND-1] - Needed by the non-trivially-copyable flavor of FixedMultiIndex. The slots
+    // of the copy differ from the ones of the source, so the indices are rebuilt.
+    constexpr void insert_all_from(const FixedMultiIndexBase& other)
+    {
+        for (const T& value : other)
+        {
+            insert(value);
+        }
+    }
+    constexpr void insert_all_from(FixedMultiIndexBase&& other)
+    {
+        for (NodeIndex i = other.elements().front_index(); i != END_INDEX;
+             i = other.elements().next_of(i))
+        {
+            insert(std::move(other.elements().at(i)));
+        }
+    }
+};
+
+}  // namespace fixed_containers::fixed_multi_index_detail
+
+namespace fixed_containers::fixed_multi_index_detail::specializations
+{
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          typename IndexedByType,
+          customize::SequenceContainerChecking CheckingType>
+class FixedMultiIndex
+  : public fixed_multi_index_detail::
+        FixedMultiIndexBase<T, MAXIMUM_SIZE, IndexedByType, CheckingType>
+{
+    using Base = fixed_multi_index_detail::
+        FixedMultiIndexBase<T, MAXIMUM_SIZE, IndexedByType, CheckingType>;
+
+public:
+    // clang-format off
+    constexpr FixedMultiIndex() noexcept : Base() { }
+    // clang-format on
+
+    constexpr FixedMultiIndex(const FixedMultiIndex& other)
+      : FixedMultiIndex()
+    {
+        this->insert_all_from(other);
+    }
+    constexpr FixedMultiIndex(FixedMultiIndex&& other) noexcept
+      : FixedMultiIndex()
+    {
+        this->insert_all_from(std::move(other));
+        // Clear the moved-out-of-container, like FixedList
+        other.clear();
+    }
+    constexpr FixedMultiIndex& operator=(const FixedMultiIndex& other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        this->clear();
+        this->insert_all_from(other);
+        return *this;
+    }
+    constexpr FixedMultiIndex& operator=(FixedMultiIndex&& other) noexcept
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        this->clear();
+        this->insert_all_from(std::move(other));
+        return *this;
+    }
+
+    constexpr ~FixedMultiIndex() noexcept { this->clear(); }
+};
+
+template <TriviallyCopyable T,
+          std::size_t MAXIMUM_SIZE,
+          typename IndexedByType,
+          customize::SequenceContainerChecking CheckingType>
+class FixedMultiIndex<T, MAXIMUM_SIZE, IndexedByType, CheckingType>
+  : public fixed_multi_index_detail::
+        FixedMultiIndexBase<T, MAXIMUM_SIZE, IndexedByType, CheckingType>
+{
+    using Base = fixed_multi_index_detail::
+        FixedMultiIndexBase<T, MAXIMUM_SIZE, IndexedByType, CheckingType>;
+
+public:
+    // clang-format off
+    constexpr FixedMultiIndex() noexcept : Base() { }
+    // clang-format on
+};
+
+}  // namespace fixed_containers::fixed_multi_index_detail::specializations
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity container with several indices over the same elements, in the spirit of
+ * boost::multi_index_container. Properties:
+ *  - constexpr
+ *  - retains the properties of T (e.g. if T is trivially copyable, then so is FixedMultiIndex<T>)
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ *
+ * The elements live in one shared pool, in insertion order. Every index only stores links:
+ *  - multi_index::HashedUnique: a robinhood bucket array, as in FixedUnorderedMap.
+ *  - multi_index::OrderedUnique and OrderedNonUnique: a red-black tree, as in FixedMap.
+ * insert() and erase() update every index at once. Elements are const; use modify() to change
+ * the keys of an element in place.
+ */
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          typename IndexedByType,
+          customize::SequenceContainerChecking CheckingType =
+              customize::SequenceContainerAbortChecking<T, MAXIMUM_SIZE>>
+class FixedMultiIndex
+  : public fixed_multi_index_detail::specializations::
+        FixedMultiIndex<T, MAXIMUM_SIZE, IndexedByType, CheckingType>
+{
+    using Base = fixed_multi_index_detail::specializations::
+        FixedMultiIndex<T, MAXIMUM_SIZE, IndexedByType, CheckingType>;
+
+public:
+    constexpr FixedMultiIndex() noexcept
+      : Base()
+    {
+    }
+};
+
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          typename IndexedByType,
+          customize::SequenceContainerChecking CheckingType>
+[[nodiscard]] constexpr bool is_full(
+    const FixedMultiIndex<T, MAXIMUM_SIZE, IndexedByType, CheckingType>& c)
+{
+    return c.size() >= c.max_size();
+}
+
+}  // namespace fixed_containers
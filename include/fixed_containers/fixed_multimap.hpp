@@ -0,0 +1,594 @@
+#pragma once
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/bidirectional_iterator.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/erase_if.hpp"
+#include "fixed_containers/fixed_red_black_tree.hpp"
+#include "fixed_containers/map_checking.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity red-black tree multimap with maximum size that is declared at compile-time via
+ * template parameter. Entries with equivalent keys are kept in insertion order. Properties:
+ *  - constexpr
+ *  - retains the copy/move/destruction properties of K, V
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ *  - no recursion
+ */
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          class Compare = std::less<K>,
+          fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS =
+              fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+          template <class /*Would be IsFixedIndexBasedStorage but gcc doesn't like the constraints
+                             here. clang accepts it */
+                    ,
+                    std::size_t>
+          typename StorageTemplate = FixedIndexBasedPoolStorage,
+          customize::MapChecking<K> CheckingType = customize::MapAbortChecking<K, V, MAXIMUM_SIZE>>
+class FixedMultiMap
+{
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<const K, V>;
+    using reference = std::pair<const K&, V&>;
+    using const_reference = std::pair<const K&, const V&>;
+    using pointer = std::add_pointer_t<reference>;
+    using const_pointer = std::add_pointer_t<const_reference>;
+
+private:
+    using NodeIndex = fixed_red_black_tree_detail::NodeIndex;
+    using NodeIndexAndParentIndex = fixed_red_black_tree_detail::NodeIndexAndParentIndex;
+    static constexpr NodeIndex NULL_INDEX = fixed_red_black_tree_detail::NULL_INDEX;
+    using Tree = fixed_red_black_tree_detail::
+        FixedRedBlackTree<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate>;
+
+    template <bool IS_CONST>
+    class PairProvider
+    {
+        friend class PairProvider<!IS_CONST>;
+        using ConstOrMutableTree = std::conditional_t<IS_CONST, const Tree, Tree>;
+
+    private:
+        ConstOrMutableTree* tree_;
+        NodeIndex current_index_;
+
+    public:
+        constexpr PairProvider() noexcept
+          : PairProvider{nullptr, MAXIMUM_SIZE}
+        {
+        }
+
+        constexpr PairProvider(ConstOrMutableTree* const tree,
+                               const NodeIndex& current_index) noexcept
+          : tree_{tree}
+          , current_index_{current_index}
+        {
+        }
+
+        constexpr PairProvider(const PairProvider&) = default;
+        constexpr PairProvider(PairProvider&&) noexcept = default;
+        constexpr PairProvider& operator=(const PairProvider&) = default;
+        constexpr PairProvider& operator=(PairProvider&&) noexcept = default;
+
+        // https://github.com/llvm/llvm-project/issues/62555
+        template <bool IS_CONST_2>
+        constexpr PairProvider(const PairProvider<IS_CONST_2>& m) noexcept
+            requires(IS_CONST and !IS_CONST_2)
+          : PairProvider{m.tree_, m.current_index_}
+        {
+        }
+
+        constexpr void advance() noexcept
+        {
+            if (current_index_ == NULL_INDEX)
+            {
+                current_index_ = tree_->index_of_min_at();
+            }
+            else
+            {
+                current_index_ = tree_->index_of_successor_at(current_index_);
+                current_index_ = replace_null_index_with_max_size_for_end_iterator(current_index_);
+            }
+        }
+        constexpr void recede() noexcept
+        {
+            if (current_index_ == MAXIMUM_SIZE)
+            {
+                current_index_ = tree_->index_of_max_at();
+            }
+            else
+            {
+                current_index_ = tree_->index_of_predecessor_at(current_index_);
+            }
+        }
+
+        constexpr std::conditional_t<IS_CONST, const_reference, reference> get() const noexcept
+        {
+            fixed_red_black_tree_detail::RedBlackTreeNodeView node = tree_->node_at(current_index_);
+            return {node.key(), node.value()};
+        }
+
+        template <bool IS_CONST2>
+        constexpr bool operator==(const PairProvider<IS_CONST2>& other) const noexcept
+        {
+            return tree_ == other.tree_ && current_index_ == other.current_index_;
+        }
+
+        [[nodiscard]] constexpr NodeIndex current_index() const { return current_index_; }
+    };
+
+    template <IteratorConstness CONSTNESS, IteratorDirection DIRECTION>
+    using Iterator =
+        BidirectionalIterator<PairProvider<true>, PairProvider<false>, CONSTNESS, DIRECTION>;
+
+    // The tree returns NULL_INDEX when an index is not available.
+    // For the purposes of iterators, use NULL_INDEX for rend() and
+    // MAXIMUM_SIZE for end()
+    static constexpr NodeIndex replace_null_index_with_max_size_for_end_iterator(
+        const NodeIndex& i) noexcept
+    {
+        return i == NULL_INDEX ? MAXIMUM_SIZE : i;
+    }
+
+public:
+    using const_iterator =
+        Iterator<IteratorConstness::CONSTANT_ITERATOR, IteratorDirection::FORWARD>;
+    using iterator = Iterator<IteratorConstness::MUTABLE_ITERATOR, IteratorDirection::FORWARD>;
+    using const_reverse_iterator =
+        Iterator<IteratorConstness::CONSTANT_ITERATOR, IteratorDirection::REVERSE>;
+    using reverse_iterator =
+        Iterator<IteratorConstness::MUTABLE_ITERATOR, IteratorDirection::REVERSE>;
+    using size_type = typename Tree::size_type;
+    using difference_type = typename Tree::difference_type;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    Tree IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_;
+
+public:
+    constexpr FixedMultiMap() noexcept
+      : FixedMultiMap{Compare{}}
+    {
+    }
+
+    explicit constexpr FixedMultiMap(const Compare& comparator) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_{comparator}
+    {
+    }
+
+    template <InputIterator InputIt>
+    constexpr FixedMultiMap(
+        InputIt first,
+        InputIt last,
+        const Compare& comparator = {},
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedMultiMap{comparator}
+    {
+        insert(first, last, loc);
+    }
+
+    constexpr FixedMultiMap(std::initializer_list<value_type> list,
+                            const Compare& comparator = {},
+                            const std_transition::source_location& loc =
+                                std_transition::source_location::current()) noexcept
+      : FixedMultiMap{comparator}
+    {
+        this->insert(list, loc);
+    }
+
+public:
+    constexpr const_iterator cbegin() const noexcept
+    {
+        return create_const_iterator(tree().index_of_min_at());
+    }
+    constexpr const_iterator cend() const noexcept { return create_const_iterator(MAXIMUM_SIZE); }
+    constexpr const_iterator begin() const noexcept { return cbegin(); }
+    constexpr iterator begin() noexcept { return create_iterator(tree().index_of_min_at()); }
+    constexpr const_iterator end() const noexcept { return cend(); }
+    constexpr iterator end() noexcept { return create_iterator(MAXIMUM_SIZE); }
+
+    constexpr reverse_iterator rbegin() noexcept { return create_reverse_iterator(MAXIMUM_SIZE); }
+    constexpr const_reverse_iterator rbegin() const noexcept { return crbegin(); }
+    constexpr const_reverse_iterator crbegin() const noexcept
+    {
+        return create_const_reverse_iterator(MAXIMUM_SIZE);
+    }
+    constexpr reverse_iterator rend() noexcept
+    {
+        return create_reverse_iterator(tree().index_of_min_at());
+    }
+    constexpr const_reverse_iterator rend() const noexcept { return crend(); }
+    constexpr const_reverse_iterator crend() const noexcept
+    {
+        return create_const_reverse_iterator(tree().index_of_min_at());
+    }
+
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return tree().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return tree().empty(); }
+
+    constexpr void clear() noexcept { tree().clear(); }
+
+    // Always inserts; the new entry goes after the entries with keys equivalent to its own
+    constexpr iterator insert(const value_type& value,
+                              const std_transition::source_location& loc =
+                                  std_transition::source_location::current()) noexcept
+    {
+        check_not_full(loc);
+        NodeIndexAndParentIndex np = tree().index_of_insertion_point_after_equivalents(value.first);
+        tree().insert_new_at(np, value.first, value.second);
+        return create_iterator(np.i);
+    }
+    constexpr iterator insert(value_type&& value,
+                              const std_transition::source_location& loc =
+                                  std_transition::source_location::current()) noexcept
+    {
+        check_not_full(loc);
+        NodeIndexAndParentIndex np = tree().index_of_insertion_point_after_equivalents(value.first);
+        tree().insert_new_at(np, value.first, std::move(value.second));
+        return create_iterator(np.i);
+    }
+    constexpr iterator insert(const_iterator /*hint*/,
+                              const value_type& value,
+                              const std_transition::source_location& loc =
+                                  std_transition::source_location::current()) noexcept
+    {
+        return insert(value, loc);
+    }
+    constexpr iterator insert(const_iterator /*hint*/,
+                              value_type&& value,
+                              const std_transition::source_location& loc =
+                                  std_transition::source_location::current()) noexcept
+    {
+        return insert(std::move(value), loc);
+    }
+
+    template <InputIterator InputIt>
+    constexpr void insert(InputIt first,
+                          InputIt last,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        for (; first != last; std::advance(first, 1))
+        {
+            this->insert(*first, loc);
+        }
+    }
+    constexpr void insert(std::initializer_list<value_type> list,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        this->insert(list.begin(), list.end(), loc);
+    }
+
+    template <class... Args>
+    constexpr iterator emplace(Args&&... args) noexcept
+    {
+        std::pair<K, V> value(std::forward<Args>(args)...);
+        check_not_full(std_transition::source_location::current());
+        NodeIndexAndParentIndex np = tree().index_of_insertion_point_after_equivalents(value.first);
+        tree().insert_new_at(np, std::move(value.first), std::move(value.second));
+        return create_iterator(np.i);
+    }
+    template <class... Args>
+    constexpr iterator emplace_hint(const_iterator /*hint*/, Args&&... args) noexcept
+    {
+        return emplace(std::forward<Args>(args)...);
+    }
+
+    constexpr iterator erase(const_iterator pos) noexcept
+    {
+        assert_or_abort(pos != cend());
+        const NodeIndex i = get_node_index_from_iterator(pos);
+        assert_or_abort(tree().contains_at(i));
+        const NodeIndex successor_index = tree().delete_at_and_return_successor(i);
+        return create_iterator(successor_index);
+    }
+    constexpr iterator erase(iterator pos) noexcept { return erase(const_iterator{pos}); }
+
+    constexpr iterator erase(const_iterator first, const_iterator last) noexcept
+    {
+        // iterators might be invalidated after every deletion, so we can't just loop through
+        const NodeIndex from = first == cend() ? NULL_INDEX : get_node_index_from_iterator(first);
+        const NodeIndex to = last == cend() ? NULL_INDEX : get_node_index_from_iterator(last);
+
+        const NodeIndex successor_index = tree().delete_range_and_return_successor(from, to);
+        return create_iterator(successor_index);
+    }
+
+    // Erases all the entries with keys equivalent to `key` in O(log n + count)
+    constexpr size_type erase(const K& key) noexcept
+    {
+        const NodeIndex from = tree().index_of_first_node_ceiling(key);
+        const NodeIndex to = tree().index_of_first_node_higher(key);
+        const size_type removed_count = count_range(from, to);
+        tree().delete_range_and_return_successor(from, to);
+        return removed_count;
+    }
+
+    // Returns the first of the entries with equivalent keys
+    [[nodiscard]] constexpr iterator find(const K& key) noexcept
+    {
+        return create_iterator(index_of_first_node_or_end(key));
+    }
+    [[nodiscard]] constexpr const_iterator find(const K& key) const noexcept
+    {
+        return create_const_iterator(index_of_first_node_or_end(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr iterator find(const K0& key) noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_iterator(index_of_first_node_or_end(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator find(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_const_iterator(index_of_first_node_or_end(key));
+    }
+
+    [[nodiscard]] constexpr bool contains(const K& key) const noexcept
+    {
+        return tree().contains_node(key);
+    }
+
+    template <class K0>
+    [[nodiscard]] constexpr bool contains(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return tree().contains_node(key);
+    }
+
+    // O(log n + count)
+    [[nodiscard]] constexpr std::size_t count(const K& key) const noexcept
+    {
+        return count_range(tree().index_of_first_node_ceiling(key),
+                           tree().index_of_first_node_higher(key));
+    }
+
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t count(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return count_range(tree().index_of_first_node_ceiling(key),
+                           tree().index_of_first_node_higher(key));
+    }
+
+    [[nodiscard]] constexpr iterator lower_bound(const K& key) noexcept
+    {
+        return create_iterator(tree().index_of_first_node_ceiling(key));
+    }
+    [[nodiscard]] constexpr const_iterator lower_bound(const K& key) const noexcept
+    {
+        return create_const_iterator(tree().index_of_first_node_ceiling(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr iterator lower_bound(const K0& key) noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_iterator(tree().index_of_first_node_ceiling(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator lower_bound(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_const_iterator(tree().index_of_first_node_ceiling(key));
+    }
+
+    [[nodiscard]] constexpr iterator upper_bound(const K& key) noexcept
+    {
+        return create_iterator(tree().index_of_first_node_higher(key));
+    }
+    [[nodiscard]] constexpr const_iterator upper_bound(const K& key) const noexcept
+    {
+        return create_const_iterator(tree().index_of_first_node_higher(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr iterator upper_bound(const K0& key) noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_iterator(tree().index_of_first_node_higher(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator upper_bound(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_const_iterator(tree().index_of_first_node_higher(key));
+    }
+
+    [[nodiscard]] constexpr std::pair<iterator, iterator> equal_range(const K& key) noexcept
+    {
+        return {lower_bound(key), upper_bound(key)};
+    }
+    [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range(
+        const K& key) const noexcept
+    {
+        return {lower_bound(key), upper_bound(key)};
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::pair<iterator, iterator> equal_range(const K0& key) noexcept
+        requires IsTransparent<Compare>
+    {
+        return {lower_bound(key), upper_bound(key)};
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range(
+        const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    template <std::size_t MAXIMUM_SIZE_2,
+              class Compare2,
+              fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS_2,
+              template <class /*Would be IsFixedIndexBasedStorage but gcc doesn't like the
+                                 constraints here. clang accepts it */
+                        ,
+                        std::size_t>
+              typename StorageTemplate2,
+              customize::MapChecking<K> CheckingType2>
+    [[nodiscard]] constexpr bool operator==(const FixedMultiMap<K,
+                                                                V,
+                                                                MAXIMUM_SIZE_2,
+                                                                Compare2,
+                                                                COMPACTNESS_2,
+                                                                StorageTemplate2,
+                                                                CheckingType2>& other) const
+    {
+        if constexpr (MAXIMUM_SIZE == MAXIMUM_SIZE_2)
+        {
+            if (this == &other)
+            {
+                return true;
+            }
+        }
+
+        return std::ranges::equal(*this, other);
+    }
+
+private:
+    constexpr Tree& tree() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_; }
+    constexpr const Tree& tree() const { return IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_; }
+
+    constexpr iterator create_iterator(const NodeIndex& start_index) noexcept
+    {
+        const NodeIndex i = replace_null_index_with_max_size_for_end_iterator(start_index);
+        return iterator{PairProvider<false>{std::addressof(tree()), i}};
+    }
+
+    constexpr const_iterator create_const_iterator(const NodeIndex& start_index) const noexcept
+    {
+        const NodeIndex i = replace_null_index_with_max_size_for_end_iterator(start_index);
+        return const_iterator{PairProvider<true>{std::addressof(tree()), i}};
+    }
+
+    constexpr reverse_iterator create_reverse_iterator(const NodeIndex& start_index) noexcept
+    {
+        return reverse_iterator{PairProvider<false>{std::addressof(tree()), start_index}};
+    }
+
+    constexpr const_reverse_iterator create_const_reverse_iterator(
+        const NodeIndex& start_index) const noexcept
+    {
+        return const_reverse_iterator{PairProvider<true>{std::addressof(tree()), start_index}};
+    }
+
+    constexpr void check_not_full(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(!tree().full()))
+        {
+            CheckingType::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+    }
+
+    template <class K0>
+    [[nodiscard]] constexpr NodeIndex index_of_first_node_or_end(const K0& key) const noexcept
+    {
+        const NodeIndex i = tree().index_of_first_node_or_null(key);
+        return tree().contains_at(i) ? i : MAXIMUM_SIZE;
+    }
+
+    [[nodiscard]] constexpr size_type count_range(NodeIndex from, const NodeIndex to) const noexcept
+    {
+        size_type count = 0;
+        for (; from != to; from = tree().index_of_successor_at(from))
+        {
+            ++count;
+        }
+        return count;
+    }
+
+    [[nodiscard]] constexpr NodeIndex get_node_index_from_iterator(const_iterator it)
+    {
+        return it.template private_reference_provider<PairProvider<true>>().current_index();
+    }
+};
+
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS,
+          template <class /*Would be IsFixedIndexBasedStorage but gcc doesn't like the constraints
+here. clang accepts it */
+                    ,
+                    std::size_t>
+          typename StorageTemplate,
+          customize::MapChecking<K> CheckingType>
+[[nodiscard]] constexpr bool is_full(
+    const FixedMultiMap<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, CheckingType>&
+        c)
+{
+    return c.size() >= c.max_size();
+}
+
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS,
+          template <class /*Would be IsFixedIndexBasedStorage but gcc doesn't like the constraints
+here. clang accepts it */
+                    ,
+                    std::size_t>
+          typename StorageTemplate,
+          customize::MapChecking<K> CheckingType,
+          class Predicate>
+constexpr typename FixedMultiMap<K,
+                                 V,
+                                 MAXIMUM_SIZE,
+                                 Compare,
+                                 COMPACTNESS,
+                                 StorageTemplate,
+                                 CheckingType>::size_type
+erase_if(
+    FixedMultiMap<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, CheckingType>& c,
+    Predicate predicate)
+{
+    return erase_if_detail::erase_if_impl(c, predicate);
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <
+    typename K,
+    typename V,
+    std::size_t MAXIMUM_SIZE,
+    typename Compare,
+    fixed_containers::fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS,
+    template <class /*Would be IsFixedIndexBasedStorage but gcc doesn't like the constraints
+here. clang accepts it */
+              ,
+              std::size_t>
+    typename StorageTemplate,
+    fixed_containers::customize::MapChecking<K> CheckingType>
+struct tuple_size<
+    fixed_containers::
+        FixedMultiMap<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
@@ -0,0 +1,587 @@
+#pragma once
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/iterator_utils.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/random_access_iterator.hpp"
+#include "fixed_containers/sequence_container_checking.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers::fixed_packed_vector_detail
+{
+template <std::size_t BITS>
+using SmallestUnsignedFor = std::conditional_t<
+    (BITS <= 8),
+    std::uint8_t,
+    std::conditional_t<(BITS <= 16),
+                       std::uint16_t,
+                       std::conditional_t<(BITS <= 32), std::uint32_t, std::uint64_t>>>;
+
+// Values are laid out back to back, least significant bit first, and may straddle two words.
+// WORD_COUNT includes one trailing word so that reading or writing "the next word" is always in
+// bounds; this keeps `load()`/`store()` free of branches, which lets bulk loops vectorize.
+template <std::size_t BITS, std::size_t MAXIMUM_SIZE>
+struct PackedWordsLayout
+{
+    static_assert(BITS >= 1 && BITS <= 64);
+
+    static constexpr std::size_t WORD_BITS = 64;
+    static constexpr std::size_t WORD_COUNT =
+        (((BITS * MAXIMUM_SIZE) + WORD_BITS - 1) / WORD_BITS) + 1;
+    static constexpr std::uint64_t MASK =
+        BITS == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << BITS) - 1;
+
+    using Words = std::array<std::uint64_t, WORD_COUNT>;
+
+    // The high part comes from the next word. Shifting in two steps keeps every shift amount
+    // below 64, so the offset-0 case needs no special handling.
+    static constexpr std::uint64_t load(const Words& words, const std::size_t i) noexcept
+    {
+        const std::size_t bit = i * BITS;
+        const std::size_t w = bit / WORD_BITS;
+        const std::size_t offset = bit % WORD_BITS;
+        const std::uint64_t low = words[w] >> offset;
+        const std::uint64_t high = (words[w + 1] << 1U) << (WORD_BITS - 1 - offset);
+        return (low | high) & MASK;
+    }
+
+    static constexpr void store(Words& words,
+                                const std::size_t i,
+                                const std::uint64_t value) noexcept
+    {
+        const std::size_t bit = i * BITS;
+        const std::size_t w = bit / WORD_BITS;
+        const std::size_t offset = bit % WORD_BITS;
+        words[w] = (words[w] & ~(MASK << offset)) | (value << offset);
+        const std::size_t high_shift = WORD_BITS - 1 - offset;
+        words[w + 1] =
+            (words[w + 1] & ~((MASK >> 1U) >> high_shift)) | ((value >> 1U) >> high_shift);
+    }
+
+    // Any 64 consecutive values starting at a multiple of 64 occupy exactly BITS whole words, so
+    // within such a block every shift amount is a compile-time constant.
+    static constexpr std::size_t BLOCK_SIZE = WORD_BITS;
+
+    template <typename T, std::size_t... J>
+    static constexpr void decode_block(const Words& words,
+                                       const std::size_t block,
+                                       T* out,
+                                       std::index_sequence<J...> /*unused*/) noexcept
+    {
+        const std::size_t base = block * BITS;
+        ((out[J] = static_cast<T>(
+              ((words[base + (J * BITS / WORD_BITS)] >> (J * BITS % WORD_BITS)) |
+               ((words[base + (J * BITS / WORD_BITS) + 1] << 1U)
+                << (WORD_BITS - 1 - (J * BITS % WORD_BITS)))) &
+              MASK)),
+         ...);
+    }
+};
+
+}  // namespace fixed_containers::fixed_packed_vector_detail
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity vector of unsigned integers that are BITS wide, stored back to back in inline
+ * 64-bit words. Uses BITS * MAXIMUM_SIZE bits rounded up to whole words, plus one word. Elements
+ * are read as `value_type` and written through a proxy reference, like std::vector<bool>.
+ * `decode()`/`encode()` convert whole ranges at a time. Properties:
+ *  - constexpr
+ *  - trivially copyable
+ *  - standard layout
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ */
+template <std::size_t BITS,
+          std::size_t MAXIMUM_SIZE,
+          customize::SequenceContainerChecking CheckingType =
+              customize::SequenceContainerAbortChecking<
+                  fixed_packed_vector_detail::SmallestUnsignedFor<BITS>,
+                  MAXIMUM_SIZE>>
+class FixedPackedVector
+{
+    using Layout = fixed_packed_vector_detail::PackedWordsLayout<BITS, MAXIMUM_SIZE>;
+    using Words = typename Layout::Words;
+    using Checking = CheckingType;
+
+public:
+    using value_type = fixed_packed_vector_detail::SmallestUnsignedFor<BITS>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using const_reference = value_type;
+
+    // Proxy for one element. Assigning through a const proxy writes the element, as required of
+    // the references of writable iterators.
+    class reference
+    {
+        friend class FixedPackedVector;
+
+        Words* words_;
+        std::size_t i_;
+
+        constexpr reference(Words* words, const std::size_t i) noexcept
+          : words_{words}
+          , i_{i}
+        {
+        }
+
+    public:
+        constexpr reference(const reference&) noexcept = default;
+
+        explicit(false) constexpr operator value_type() const noexcept
+        {
+            return static_cast<value_type>(Layout::load(*words_, i_));
+        }
+
+        constexpr const reference& operator=(const value_type value) const noexcept
+        {
+            check_fits(value);
+            Layout::store(*words_, i_, value);
+            return *this;
+        }
+        constexpr const reference& operator=(const reference& other) const noexcept
+        {
+            return *this = static_cast<value_type>(other);
+        }
+
+        friend constexpr void swap(const reference& lhs, const reference& rhs) noexcept
+        {
+            const value_type tmp = lhs;
+            lhs = static_cast<value_type>(rhs);
+            rhs = tmp;
+        }
+    };
+
+private:
+    template <bool IS_CONST>
+    class ReferenceProvider
+    {
+        friend class ReferenceProvider<!IS_CONST>;
+        using ConstOrMutableWords = std::conditional_t<IS_CONST, const Words, Words>;
+
+        ConstOrMutableWords* words_;
+        std::size_t current_index_;
+
+    public:
+        constexpr ReferenceProvider() noexcept
+          : ReferenceProvider{nullptr, 0}
+        {
+        }
+
+        constexpr ReferenceProvider(ConstOrMutableWords* const words,
+                                    const std::size_t current_index) noexcept
+          : words_{words}
+          , current_index_{current_index}
+        {
+        }
+
+        constexpr ReferenceProvider(const ReferenceProvider&) = default;
+        constexpr ReferenceProvider(ReferenceProvider&&) noexcept = default;
+        constexpr ReferenceProvider& operator=(const ReferenceProvider&) = default;
+        constexpr ReferenceProvider& operator=(ReferenceProvider&&) noexcept = default;
+
+        // https://github.com/llvm/llvm-project/issues/62555
+        template <bool IS_CONST_2>
+        constexpr ReferenceProvider(const ReferenceProvider<IS_CONST_2>& m) noexcept
+            requires(IS_CONST and !IS_CONST_2)
+          : ReferenceProvider{m.words_, m.current_index_}
+        {
+        }
+
+        constexpr void advance(const std::size_t n) noexcept { current_index_ += n; }
+        constexpr void recede(const std::size_t n) noexcept { current_index_ -= n; }
+
+        constexpr std::conditional_t<IS_CONST, const_reference, reference> get() const noexcept
+        {
+            if constexpr (IS_CONST)
+            {
+                return static_cast<value_type>(Layout::load(*words_, current_index_));
+            }
+            else
+            {
+                return reference{words_, current_index_};
+            }
+        }
+
+        template <bool IS_CONST2>
+        constexpr bool operator==(const ReferenceProvider<IS_CONST2>& other) const noexcept
+        {
+            assert_or_abort(words_ == other.words_);
+            return current_index_ == other.current_index_;
+        }
+        template <bool IS_CONST2>
+        constexpr auto operator<=>(const ReferenceProvider<IS_CONST2>& other) const noexcept
+        {
+            assert_or_abort(words_ == other.words_);
+            return current_index_ <=> other.current_index_;
+        }
+
+        template <bool IS_CONST2>
+        constexpr std::ptrdiff_t operator-(const ReferenceProvider<IS_CONST2>& other) const
+        {
+            assert_or_abort(words_ == other.words_);
+            return static_cast<std::ptrdiff_t>(current_index_ - other.current_index_);
+        }
+
+        [[nodiscard]] constexpr std::size_t current_index() const { return current_index_; }
+    };
+
+    template <IteratorConstness CONSTNESS, IteratorDirection DIRECTION>
+    using Iterator = RandomAccessIterator<ReferenceProvider<true>,
+                                          ReferenceProvider<false>,
+                                          CONSTNESS,
+                                          DIRECTION>;
+
+public:
+    using const_iterator =
+        Iterator<IteratorConstness::CONSTANT_ITERATOR, IteratorDirection::FORWARD>;
+    using iterator = Iterator<IteratorConstness::MUTABLE_ITERATOR, IteratorDirection::FORWARD>;
+    using const_reverse_iterator =
+        Iterator<IteratorConstness::CONSTANT_ITERATOR, IteratorDirection::REVERSE>;
+    using reverse_iterator =
+        Iterator<IteratorConstness::MUTABLE_ITERATOR, IteratorDirection::REVERSE>;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+    [[nodiscard]] static constexpr std::size_t bits_per_element() noexcept { return BITS; }
+    [[nodiscard]] static constexpr value_type max_value() noexcept
+    {
+        return static_cast<value_type>(Layout::MASK);
+    }
+
+private:
+    static constexpr void check_target_size(size_type target_size,
+                                            const std_transition::source_location& loc)
+    {
+        if (preconditions::test(target_size <= MAXIMUM_SIZE))
+        {
+            Checking::length_error(target_size, loc);
+        }
+    }
+    static constexpr void check_fits(
+        const value_type value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        if (preconditions::test(value <= max_value()))
+        {
+            Checking::invalid_argument("value does not fit in BITS", loc);
+        }
+    }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    std::size_t IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+    Words IMPLEMENTATION_DETAIL_DO_NOT_USE_words_;
+
+public:
+    constexpr FixedPackedVector() noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_size_{0}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_words_{}
+    {
+    }
+
+    constexpr FixedPackedVector(std::size_t count,
+                                const value_type value,
+                                const std_transition::source_location& loc =
+                                    std_transition::source_location::current()) noexcept
+      : FixedPackedVector()
+    {
+        resize(count, value, loc);
+    }
+
+    template <InputIterator InputIt>
+    constexpr FixedPackedVector(InputIt first,
+                                InputIt last,
+                                const std_transition::source_location& loc =
+                                    std_transition::source_location::current()) noexcept
+      : FixedPackedVector()
+    {
+        for (; first != last; ++first)
+        {
+            push_back(static_cast<value_type>(*first), loc);
+        }
+    }
+
+    constexpr FixedPackedVector(std::initializer_list<value_type> list,
+                                const std_transition::source_location& loc =
+                                    std_transition::source_location::current()) noexcept
+      : FixedPackedVector(list.begin(), list.end(), loc)
+    {
+    }
+
+    /**
+     * Resizes the container to contain `count` elements. New elements are set to `value`.
+     */
+    constexpr void resize(
+        size_type count,
+        const value_type value = 0,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_target_size(count, loc);
+        check_fits(value, loc);
+        for (std::size_t i = size(); i < count; i++)
+        {
+            Layout::store(words(), i, value);
+        }
+        set_size(count);
+    }
+
+    constexpr void push_back(
+        const value_type value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_full(loc);
+        check_fits(value, loc);
+        Layout::store(words(), size(), value);
+        set_size(size() + 1);
+    }
+
+    constexpr void pop_back(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_empty(loc);
+        set_size(size() - 1);
+    }
+
+    constexpr void clear() noexcept { set_size(0); }
+
+    /**
+     * Regular accessors.
+     */
+    constexpr reference operator[](size_type i) noexcept
+    {
+        // Cannot capture real source_location for operator[]
+        return at(i, std_transition::source_location::current());
+    }
+    constexpr const_reference operator[](size_type i) const noexcept
+    {
+        // Cannot capture real source_location for operator[]
+        return at(i, std_transition::source_location::current());
+    }
+
+    constexpr reference at(size_type i,
+                           const std_transition::source_location& loc =
+                               std_transition::source_location::current()) noexcept
+    {
+        check_index(i, loc);
+        return reference{std::addressof(words()), i};
+    }
+    [[nodiscard]] constexpr const_reference at(
+        size_type i,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const noexcept
+    {
+        check_index(i, loc);
+        return static_cast<value_type>(Layout::load(words(), i));
+    }
+
+    constexpr reference front(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_empty(loc);
+        return reference{std::addressof(words()), 0};
+    }
+    [[nodiscard]] constexpr const_reference front(
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        check_not_empty(loc);
+        return static_cast<value_type>(Layout::load(words(), 0));
+    }
+    constexpr reference back(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_empty(loc);
+        return reference{std::addressof(words()), size() - 1};
+    }
+    [[nodiscard]] constexpr const_reference back(
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        check_not_empty(loc);
+        return static_cast<value_type>(Layout::load(words(), size() - 1));
+    }
+
+    /**
+     * Bulk accessors. `decode()` unpacks the elements starting at `first` into all of `out`;
+     * `encode()` overwrites the elements starting at `first` with all of `in`. Both are a
+     * branch-free loop over the elements, which is much faster than going through iterators.
+     */
+    constexpr void decode(const size_type first,
+                          std::span<value_type> out,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) const noexcept
+    {
+        check_range(first, out.size(), loc);
+        std::size_t k = 0;
+        for (; k < out.size() && (first + k) % Layout::BLOCK_SIZE != 0; k++)
+        {
+            out[k] = static_cast<value_type>(Layout::load(words(), first + k));
+        }
+        for (; k + Layout::BLOCK_SIZE <= out.size(); k += Layout::BLOCK_SIZE)
+        {
+            Layout::decode_block(words(),
+                                 (first + k) / Layout::BLOCK_SIZE,
+                                 out.data() + k,
+                                 std::make_index_sequence<Layout::BLOCK_SIZE>{});
+        }
+        for (; k < out.size(); k++)
+        {
+            out[k] = static_cast<value_type>(Layout::load(words(), first + k));
+        }
+    }
+    constexpr void encode(const size_type first,
+                          std::span<const value_type> in,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        check_range(first, in.size(), loc);
+        value_type all_bits = 0;
+        for (const value_type value : in)
+        {
+            all_bits |= value;
+        }
+        check_fits(all_bits, loc);
+        for (std::size_t k = 0; k < in.size(); k++)
+        {
+            Layout::store(words(), first + k, in[k]);
+        }
+    }
+
+    /**
+     * Iterators
+     */
+    constexpr iterator begin() noexcept { return create_iterator(0); }
+    constexpr const_iterator begin() const noexcept { return cbegin(); }
+    constexpr const_iterator cbegin() const noexcept { return create_const_iterator(0); }
+    constexpr iterator end() noexcept { return create_iterator(size()); }
+    constexpr const_iterator end() const noexcept { return cend(); }
+    constexpr const_iterator cend() const noexcept { return create_const_iterator(size()); }
+
+    constexpr reverse_iterator rbegin() noexcept { return create_reverse_iterator(size()); }
+    constexpr const_reverse_iterator rbegin() const noexcept { return crbegin(); }
+    constexpr const_reverse_iterator crbegin() const noexcept
+    {
+        return create_const_reverse_iterator(size());
+    }
+    constexpr reverse_iterator rend() noexcept { return create_reverse_iterator(0); }
+    constexpr const_reverse_iterator rend() const noexcept { return crend(); }
+    constexpr const_reverse_iterator crend() const noexcept
+    {
+        return create_const_reverse_iterator(0);
+    }
+
+    /**
+     * Size
+     */
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+    [[nodiscard]] constexpr std::size_t capacity() const noexcept { return max_size(); }
+    [[nodiscard]] constexpr std::size_t size() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+    }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+
+    template <std::size_t MAXIMUM_SIZE_2, customize::SequenceContainerChecking CheckingType2>
+    constexpr bool operator==(
+        const FixedPackedVector<BITS, MAXIMUM_SIZE_2, CheckingType2>& other) const
+    {
+        return std::ranges::equal(*this, other);
+    }
+
+private:
+    constexpr Words& words() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_words_; }
+    [[nodiscard]] constexpr const Words& words() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_words_;
+    }
+    constexpr void set_size(const std::size_t size)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = size;
+    }
+
+    constexpr iterator create_iterator(const std::size_t start_index) noexcept
+    {
+        return iterator{ReferenceProvider<false>{std::addressof(words()), start_index}};
+    }
+    constexpr const_iterator create_const_iterator(const std::size_t start_index) const noexcept
+    {
+        return const_iterator{ReferenceProvider<true>{std::addressof(words()), start_index}};
+    }
+    constexpr reverse_iterator create_reverse_iterator(const std::size_t start_index) noexcept
+    {
+        return reverse_iterator{ReferenceProvider<false>{std::addressof(words()), start_index}};
+    }
+    constexpr const_reverse_iterator create_const_reverse_iterator(
+        const std::size_t start_index) const noexcept
+    {
+        return const_reverse_iterator{
+            ReferenceProvider<true>{std::addressof(words()), start_index}};
+    }
+
+    constexpr void check_index(const std::size_t i,
+                               const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(i < size()))
+        {
+            Checking::out_of_range(i, size(), loc);
+        }
+    }
+    constexpr void check_range(const std::size_t first,
+                               const std::size_t count,
+                               const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(first <= size() && count <= size() - first))
+        {
+            Checking::out_of_range(first + count, size(), loc);
+        }
+    }
+    constexpr void check_not_full(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(size() < MAXIMUM_SIZE))
+        {
+            Checking::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+    }
+    constexpr void check_not_empty(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(!empty()))
+        {
+            Checking::empty_container_access(loc);
+        }
+    }
+};
+
+template <std::size_t BITS,
+          std::size_t MAXIMUM_SIZE,
+          customize::SequenceContainerChecking CheckingType>
+[[nodiscard]] constexpr bool is_full(const FixedPackedVector<BITS, MAXIMUM_SIZE, CheckingType>& c)
+{
+    return c.size() >= c.max_size();
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <std::size_t BITS,
+          std::size_t MAXIMUM_SIZE,
+          fixed_containers::customize::SequenceContainerChecking CheckingType>
+struct tuple_size<fixed_containers::FixedPackedVector<BITS, MAXIMUM_SIZE, CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
@@ -0,0 +1,288 @@
+#pragma once
+
+#include "fixed_containers/cache_line_padded.hpp"
+#include "fixed_containers/fixed_stack.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+#if defined(__linux__)
+#include <sched.h>
+#if __has_include(<sys/rseq.h>) && defined(__has_builtin)
+#if __has_builtin(__builtin_thread_pointer)
+#include <sys/rseq.h>
+#define FIXED_CONTAINERS_PER_CPU_USE_RSEQ 1
+#endif
+#endif
+#endif
+
+namespace fixed_containers::fixed_per_cpu_detail
+{
+inline std::size_t fallback_thread_hint() noexcept
+{
+    static std::atomic<std::size_t> NEXT_HINT{0};
+    thread_local const std::size_t HINT = NEXT_HINT.fetch_add(1, std::memory_order_relaxed);
+    return HINT;
+}
+
+// The CPU the calling thread is running on. The thread may be migrated right after this returns,
+// so the result is a hint for locality and must not be relied upon for mutual exclusion.
+//
+// Order of preference:
+// 1) The `cpu_id` the kernel maintains in the thread's rseq area, registered by glibc 2.35+.
+//    This is a plain load, with no syscall or vDSO call.
+// 2) sched_getcpu()
+// 3) A per-thread round-robin hint, on platforms without either.
+inline std::size_t current_cpu() noexcept
+{
+#if defined(FIXED_CONTAINERS_PER_CPU_USE_RSEQ)
+    if (__rseq_size > 0)
+    {
+        const auto address =
+            reinterpret_cast<std::uintptr_t>(__builtin_thread_pointer()) + __rseq_offset;
+        const std::uint32_t cpu_id = reinterpret_cast<const volatile struct rseq*>(address)->cpu_id;
+        // Negative values (as signed) flag an uninitialized or failed registration
+        if (static_cast<std::int32_t>(cpu_id) >= 0)
+        {
+            return cpu_id;
+        }
+    }
+#endif
+#if defined(__linux__)
+    const int cpu = sched_getcpu();
+    if (cpu >= 0)
+    {
+        return static_cast<std::size_t>(cpu);
+    }
+#endif
+    return fallback_thread_hint();
+}
+}  // namespace fixed_containers::fixed_per_cpu_detail
+
+namespace fixed_containers
+{
+// One inline instance of T per CPU, each on its own cache line(s).
+//
+// `local()` returns the instance of the CPU the thread is currently running on. As the thread may
+// be preempted and migrated at any point, concurrent access to the same instance is still
+// possible and T must be safe for it (e.g. atomics, which are then almost never contended).
+// CPUs beyond MAXIMUM_CPUS share instances.
+template <class T, std::size_t MAXIMUM_CPUS>
+    requires(MAXIMUM_CPUS > 0)
+class FixedPerCpu
+{
+    using PaddedT = CacheLinePadded<T>;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_CPUS; }
+
+    [[nodiscard]] static std::size_t current_cpu_index() noexcept
+    {
+        return fixed_per_cpu_detail::current_cpu() % MAXIMUM_CPUS;
+    }
+
+private:
+    std::array<PaddedT, MAXIMUM_CPUS> instances_;
+
+public:
+    FixedPerCpu() noexcept
+      : instances_{}
+    {
+    }
+
+    FixedPerCpu(const FixedPerCpu&) = delete;
+    FixedPerCpu(FixedPerCpu&&) noexcept = delete;
+    FixedPerCpu& operator=(const FixedPerCpu&) = delete;
+    FixedPerCpu& operator=(FixedPerCpu&&) noexcept = delete;
+    ~FixedPerCpu() = default;
+
+public:
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return MAXIMUM_CPUS; }
+
+    T& local() noexcept { return at(current_cpu_index()); }
+    const T& local() const noexcept { return at(current_cpu_index()); }
+
+    T& at(const std::size_t cpu_index) noexcept { return instances_.at(cpu_index).value; }
+    const T& at(const std::size_t cpu_index) const noexcept
+    {
+        return instances_.at(cpu_index).value;
+    }
+
+    template <class Func>
+    void for_each(Func&& func)
+    {
+        for (PaddedT& padded : instances_)
+        {
+            func(padded.value);
+        }
+    }
+    template <class Func>
+    void for_each(Func&& func) const
+    {
+        for (const PaddedT& padded : instances_)
+        {
+            func(padded.value);
+        }
+    }
+
+    // Folds all instances, e.g. to aggregate per-CPU counters.
+    template <class R, class BinaryOp>
+    [[nodiscard]] R accumulate(R init, BinaryOp&& op) const
+    {
+        for (const PaddedT& padded : instances_)
+        {
+            init = op(std::move(init), padded.value);
+        }
+        return init;
+    }
+};
+
+// Counter whose increments go to the current CPU's slot. Increments are relaxed atomic RMWs on a
+// cache line that is, barring migration, only touched by one CPU.
+template <std::size_t MAXIMUM_CPUS, class CounterType = std::uint64_t>
+class FixedPerCpuCounter
+{
+    FixedPerCpu<std::atomic<CounterType>, MAXIMUM_CPUS> counters_;
+
+public:
+    FixedPerCpuCounter() noexcept
+      : counters_{}
+    {
+    }
+
+    void add(const CounterType n = 1) noexcept
+    {
+        counters_.local().fetch_add(n, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] CounterType load() const noexcept
+    {
+        return counters_.accumulate(
+            CounterType{},
+            [](const CounterType sum, const std::atomic<CounterType>& counter)
+            { return sum + counter.load(std::memory_order_relaxed); });
+    }
+
+    void reset() noexcept
+    {
+        counters_.for_each([](std::atomic<CounterType>& counter)
+                           { counter.store(0, std::memory_order_relaxed); });
+    }
+};
+
+// Per-CPU free lists of indices (e.g. into a FixedIndexBasedPoolStorage), each a FixedStack
+// guarded by a per-CPU spin lock that is, barring migration, uncontended. `pop()` falls back to
+// the other CPUs' lists when the local one is empty, and `push()` spills to them when it is full.
+template <std::size_t MAXIMUM_CPUS,
+          std::size_t MAXIMUM_SIZE_PER_CPU,
+          class IndexType = std::uint32_t>
+class FixedPerCpuFreeList
+{
+    struct LockedStack
+    {
+        std::atomic_flag lock{};
+        FixedStack<IndexType, MAXIMUM_SIZE_PER_CPU> stack{};
+    };
+
+    FixedPerCpu<LockedStack, MAXIMUM_CPUS> lists_;
+
+public:
+    FixedPerCpuFreeList() noexcept
+      : lists_{}
+    {
+    }
+
+    // Returns false if every per-CPU list is full.
+    bool push(const IndexType index) noexcept
+    {
+        const std::size_t local = FixedPerCpu<LockedStack, MAXIMUM_CPUS>::current_cpu_index();
+        for (std::size_t n = 0; n < MAXIMUM_CPUS; n++)
+        {
+            if (try_push_at((local + n) % MAXIMUM_CPUS, index))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Returns std::nullopt if every per-CPU list is empty.
+    std::optional<IndexType> pop() noexcept
+    {
+        const std::size_t local = FixedPerCpu<LockedStack, MAXIMUM_CPUS>::current_cpu_index();
+        for (std::size_t n = 0; n < MAXIMUM_CPUS; n++)
+        {
+            if (const std::optional<IndexType> out = try_pop_at((local + n) % MAXIMUM_CPUS))
+            {
+                return out;
+            }
+        }
+        return std::nullopt;
+    }
+
+    // Not a consistent snapshot while other threads are pushing or popping.
+    [[nodiscard]] std::size_t size() noexcept
+    {
+        std::size_t out = 0;
+        lists_.for_each(
+            [&out](LockedStack& locked)
+            {
+                lock(locked);
+                out += locked.stack.size();
+                unlock(locked);
+            });
+        return out;
+    }
+
+private:
+    static void lock(LockedStack& locked) noexcept
+    {
+        while (locked.lock.test_and_set(std::memory_order_acquire))
+        {
+            while (locked.lock.test(std::memory_order_relaxed))
+            {
+            }
+        }
+    }
+    static void unlock(LockedStack& locked) noexcept
+    {
+        locked.lock.clear(std::memory_order_release);
+    }
+
+    bool try_push_at(const std::size_t cpu_index, const IndexType index) noexcept
+    {
+        LockedStack& locked = lists_.at(cpu_index);
+        lock(locked);
+        const bool has_space = !is_full(locked.stack);
+        if (has_space)
+        {
+            locked.stack.push(index);
+        }
+        unlock(locked);
+        return has_space;
+    }
+
+    std::optional<IndexType> try_pop_at(const std::size_t cpu_index) noexcept
+    {
+        LockedStack& locked = lists_.at(cpu_index);
+        lock(locked);
+        std::optional<IndexType> out{};
+        if (!locked.stack.empty())
+        {
+            out = locked.stack.top();
+            locked.stack.pop();
+        }
+        unlock(locked);
+        return out;
+    }
+};
+
+}  // namespace fixed_containers
@@ -4,12 +4,14 @@
 #include "fixed_containers/concepts.hpp"
 #include "fixed_containers/fixed_index_based_storage.hpp"
 #include "fixed_containers/fixed_red_black_tree_ops.hpp"
+#include "fixed_containers/fixed_red_black_tree_rebalancing.hpp"
 #include "fixed_containers/fixed_red_black_tree_storage.hpp"
 #include "fixed_containers/fixed_red_black_tree_types.hpp"
 
 #include <algorithm>
 #include <cstddef>
 #include <functional>
+#include <type_traits>
 
 namespace fixed_containers::fixed_red_black_tree_detail
 {
@@ -50,6 +52,8 @@ protected:  // [WORKAROUND-1]
     using NodeType = typename TreeStorage::NodeType;
     using Ops = FixedRedBlackTreeOps<FixedRedBlackTreeBase>;
     friend Ops;
+    using StorageLinks = RedBlackTreeStorageLinks<TreeStorage>;
+    using LayoutLinks = RedBlackTreeLinkLayout<COMPACTNESS>;
 
 public:
     using size_type = std::size_t;
@@ -83,6 +87,11 @@ public:
     [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
     [[nodiscard]] constexpr bool full() const noexcept { return size() == MAXIMUM_SIZE; }
 
+    [[nodiscard]] constexpr const Compare& key_comp() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+    }
+
     constexpr void clear() noexcept
     {
         delete_range_and_return_successor(index_of_min_at(), NULL_INDEX);
@@ -250,6 +259,74 @@ public:
         return index_of_node_with_parent(key).i;
     }
 
+    // Where a node with `key` goes when equivalent keys are allowed: after all of them, so that
+    // they are kept in insertion order. `i` is always NULL_INDEX.
+    template <class K0>
+    constexpr NodeIndexAndParentIndex index_of_insertion_point_after_equivalents(
+        const K0& key) const noexcept
+    {
+        NodeIndexAndParentIndex np{.i = NULL_INDEX, .parent = NULL_INDEX, .is_left_child = true};
+        for (NodeIndex j = root_index(); j != NULL_INDEX;)
+        {
+            const RedBlackTreeNodeView current_node = tree_storage_at(j);
+            np.parent = j;
+            np.is_left_child = compare(key, current_node.key()) < 0;
+            j = np.is_left_child ? current_node.left_index() : current_node.right_index();
+        }
+        return np;
+    }
+
+    // Ceiling and higher that are also correct in the presence of equivalent keys: they return the
+    // first such node in iteration order, whereas index_of_node_with_parent() stops at any match.
+    template <class K0>
+    [[nodiscard]] constexpr NodeIndex index_of_first_node_ceiling(const K0& key) const noexcept
+    {
+        NodeIndex result = NULL_INDEX;
+        for (NodeIndex j = root_index(); j != NULL_INDEX;)
+        {
+            const RedBlackTreeNodeView current_node = tree_storage_at(j);
+            if (compare(current_node.key(), key) >= 0)
+            {
+                result = j;
+                j = current_node.left_index();
+            }
+            else
+            {
+                j = current_node.right_index();
+            }
+        }
+        return result;
+    }
+    template <class K0>
+    [[nodiscard]] constexpr NodeIndex index_of_first_node_or_null(const K0& key) const noexcept
+    {
+        const NodeIndex i = index_of_first_node_ceiling(key);
+        if (i == NULL_INDEX || compare(key, tree_storage().key(i)) != 0)
+        {
+            return NULL_INDEX;
+        }
+        return i;
+    }
+    template <class K0>
+    [[nodiscard]] constexpr NodeIndex index_of_first_node_higher(const K0& key) const noexcept
+    {
+        NodeIndex result = NULL_INDEX;
+        for (NodeIndex j = root_index(); j != NULL_INDEX;)
+        {
+            const RedBlackTreeNodeView current_node = tree_storage_at(j);
+            if (compare(key, current_node.key()) < 0)
+            {
+                result = j;
+                j = current_node.left_index();
+            }
+            else
+            {
+                j = current_node.right_index();
+            }
+        }
+        return result;
+    }
+
     [[nodiscard]] constexpr NodeIndex index_of_node_lower(
         const NodeIndexAndParentIndex& np) const noexcept
     {
@@ -460,156 +537,42 @@ private:
         return node.left_index() != NULL_INDEX && node.right_index() != NULL_INDEX;
     }
 
-    // Accessors that automatically handle NULL_INDEX
-    [[nodiscard]] constexpr NodeIndex parent_index_of(const NodeIndex& i) const
-    {
-        return i == NULL_INDEX ? NULL_INDEX : tree_storage().parent_index(i);
-    }
-    [[nodiscard]] constexpr NodeIndex left_index_of(const NodeIndex& i) const
-    {
-        return i == NULL_INDEX ? NULL_INDEX : tree_storage().left_index(i);
-    }
-    [[nodiscard]] constexpr NodeIndex right_index_of(const NodeIndex& i) const
-    {
-        return i == NULL_INDEX ? NULL_INDEX : tree_storage().right_index(i);
-    }
-    [[nodiscard]] constexpr NodeColor color_of(const NodeIndex& i) const
-    {
-        // null nodes are treated as COLOR_BLACK
-        if (i == NULL_INDEX) return COLOR_BLACK;
-        return tree_storage().color(i);
-    }
-    constexpr void set_color(const NodeIndex& i, const NodeColor& color)
-    {
-        if (i == NULL_INDEX) return;
-        tree_storage().set_color(i, color);
-    }
-
-    constexpr void rotate_left(const NodeIndex& i)
+    // Rebalancing only touches node links. At run time it goes through a layout descriptor, so
+    // its code is shared by all trees with the same COMPACTNESS instead of being instantiated for
+    // every (K, V, MAXIMUM_SIZE, Compare, StorageTemplate). Constant evaluation can't reinterpret
+    // node bytes, so it goes through the storage instead.
+    constexpr void fix_after_insertion(const NodeIndex& index_of_newly_added)
     {
-        if (i == NULL_INDEX)
+        if (std::is_constant_evaluated())
         {
+            StorageLinks links = storage_links();
+            FixedRedBlackTreeRebalancing<StorageLinks>::fix_after_insertion(
+                links, index_of_newly_added);
             return;
         }
-
-        RedBlackTreeNodeView node = tree_storage_at(i);
-        const NodeIndex r = node.right_index();
-        RedBlackTreeNodeView right = tree_storage_at(r);
-        node.set_right_index(right.left_index());
-        if (right.left_index() != NULL_INDEX)
-        {
-            tree_storage_at(right.left_index()).set_parent_index(i);
-        }
-        right.set_parent_index(node.parent_index());
-
-        if (node.parent_index() == NULL_INDEX)
-        {
-            set_root_index(r);
-        }
-        else if (RedBlackTreeNodeView parent = tree_storage_at(node.parent_index());
-                 parent.left_index() == i)
-        {
-            parent.set_left_index(r);
-        }
-        else
-        {
-            parent.set_right_index(r);
-        }
-
-        right.set_left_index(i);
-        node.set_parent_index(r);
+        LayoutLinks links = layout_links(index_of_newly_added);
+        FixedRedBlackTreeRebalancing<LayoutLinks>::fix_after_insertion(links, index_of_newly_added);
     }
 
-    constexpr void rotate_right(const NodeIndex& i)
+    constexpr void unlink(const NodeIndex& index_to_delete)
     {
-        if (i == NULL_INDEX)
+        if (std::is_constant_evaluated())
         {
+            StorageLinks links = storage_links();
+            FixedRedBlackTreeRebalancing<StorageLinks>::unlink(links, index_to_delete);
             return;
         }
-
-        RedBlackTreeNodeView node = tree_storage_at(i);
-        const NodeIndex l = node.left_index();
-        RedBlackTreeNodeView left = tree_storage_at(l);
-        node.set_left_index(left.right_index());
-        if (left.right_index() != NULL_INDEX)
-        {
-            tree_storage_at(left.right_index()).set_parent_index(i);
-        }
-        left.set_parent_index(node.parent_index());
-
-        if (node.parent_index() == NULL_INDEX)
-        {
-            set_root_index(l);
-        }
-        else if (RedBlackTreeNodeView parent = tree_storage_at(node.parent_index());
-                 parent.right_index() == i)
-        {
-            parent.set_right_index(l);
-        }
-        else
-        {
-            parent.set_left_index(l);
-        }
-
-        left.set_right_index(i);
-        node.set_parent_index(l);
+        LayoutLinks links = layout_links(index_to_delete);
+        FixedRedBlackTreeRebalancing<LayoutLinks>::unlink(links, index_to_delete);
     }
 
-    constexpr void fix_after_insertion(const NodeIndex& index_of_newly_added)
+    constexpr StorageLinks storage_links()
     {
-        NodeIndex i = index_of_newly_added;
-        tree_storage().set_color(i, COLOR_RED);
-
-        while (i != NULL_INDEX && i != root_index() &&
-               tree_storage_at(tree_storage_at(i).parent_index()).color() == COLOR_RED)
-        {
-            if (parent_index_of(i) == left_index_of(parent_index_of(parent_index_of(i))))
-            {
-                const NodeIndex uncle_index = right_index_of(parent_index_of(parent_index_of(i)));
-                if (color_of(uncle_index) == COLOR_RED)
-                {
-                    set_color(parent_index_of(i), COLOR_BLACK);
-                    set_color(uncle_index, COLOR_BLACK);
-                    set_color(parent_index_of(parent_index_of(i)), COLOR_RED);
-                    i = parent_index_of(parent_index_of(i));
-                }
-                else
-                {
-                    if (i == right_index_of(parent_index_of(i)))
-                    {
-                        i = parent_index_of(i);
-                        rotate_left(i);
-                    }
-                    set_color(parent_index_of(i), COLOR_BLACK);
-                    set_color(parent_index_of(parent_index_of(i)), COLOR_RED);
-                    rotate_right(parent_index_of(parent_index_of(i)));
-                }
-            }
-            else
-            {
-                const NodeIndex uncle_index = left_index_of(parent_index_of(parent_index_of(i)));
-                if (color_of(uncle_index) == COLOR_RED)
-                {
-                    set_color(parent_index_of(i), COLOR_BLACK);
-                    set_color(uncle_index, COLOR_BLACK);
-                    set_color(parent_index_of(parent_index_of(i)), COLOR_RED);
-                    i = parent_index_of(parent_index_of(i));
-                }
-                else
-                {
-                    if (i == left_index_of(parent_index_of(i)))
-                    {
-                        i = parent_index_of(i);
-                        rotate_right(i);
-                    }
-                    set_color(parent_index_of(i), COLOR_BLACK);
-                    set_color(parent_index_of(parent_index_of(i)), COLOR_RED);
-                    rotate_left(parent_index_of(parent_index_of(i)));
-                }
-            }
-        }
-
-        tree_storage_at(root_index()).set_color(COLOR_BLACK);
+        return {tree_storage(), IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_};
+    }
+    constexpr LayoutLinks layout_links(const NodeIndex& live_index)
+    {
+        return tree_storage().link_layout(live_index, IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_);
     }
 
     constexpr SuccessorIndexAndRepositionedIndex delete_at_and_return_successor_and_repositioned(
@@ -649,68 +612,7 @@ private:
             Ops::swap_nodes_excluding_key_and_value(*this, index_to_delete, successor_index);
         }
 
-        // Start fixup at replacement node, if it exists
-        const NodeIndex replacement_node_index = [this, &index_to_delete]()
-        {
-            const RedBlackTreeNodeView node_to_delete = tree_storage_at(index_to_delete);
-            return node_to_delete.left_index() != NULL_INDEX ? node_to_delete.left_index()
-                                                             : node_to_delete.right_index();
-        }();
-
-        // If there is at least 1 child
-        if (replacement_node_index != NULL_INDEX)
-        {
-            RedBlackTreeNodeView node_to_delete = tree_storage_at(index_to_delete);
-            RedBlackTreeNodeView replacement_node = tree_storage_at(replacement_node_index);
-            replacement_node.set_parent_index(node_to_delete.parent_index());
-            // If we become the root, update the root_index
-            if (node_to_delete.parent_index() == NULL_INDEX)
-            {
-                set_root_index(replacement_node_index);
-            }
-            else if (RedBlackTreeNodeView parent_node =
-                         tree_storage_at(node_to_delete.parent_index());
-                     index_to_delete == parent_node.left_index())
-            {
-                parent_node.set_left_index(replacement_node_index);
-            }
-            else
-            {
-                parent_node.set_right_index(replacement_node_index);
-            }
-
-            node_to_delete.set_parent_index(NULL_INDEX);
-            node_to_delete.set_left_index(NULL_INDEX);
-            node_to_delete.set_right_index(NULL_INDEX);
-
-            if (node_to_delete.color() == COLOR_BLACK)
-            {
-                fix_after_deletion(replacement_node_index);
-            }
-        }
-        else
-        {
-            // If there are no children
-            RedBlackTreeNodeView node_to_delete = tree_storage_at(index_to_delete);
-            if (node_to_delete.color() == COLOR_BLACK)
-            {
-                fix_after_deletion(index_to_delete);
-            }
-
-            if (node_to_delete.parent_index() != NULL_INDEX)
-            {
-                RedBlackTreeNodeView parent_node = tree_storage_at(node_to_delete.parent_index());
-                if (index_to_delete == parent_node.left_index())
-                {
-                    parent_node.set_left_index(NULL_INDEX);
-                }
-                else if (index_to_delete == parent_node.right_index())
-                {
-                    parent_node.set_right_index(NULL_INDEX);
-                }
-                node_to_delete.set_parent_index(NULL_INDEX);
-            }
-        }
+        unlink(index_to_delete);
 
         const NodeIndex repositioned_index =
             tree_storage().delete_at_and_return_repositioned_index(index_to_delete);
@@ -729,85 +631,6 @@ private:
         return ret;
     }
 
-    constexpr void fix_after_deletion(const NodeIndex& index_of_deleted)
-    {
-        NodeIndex i = index_of_deleted;
-
-        while (i != root_index() && color_of(i) == COLOR_BLACK)
-        {
-            if (i == left_index_of(parent_index_of(i)))
-            {
-                NodeIndex sibling_index = right_index_of(parent_index_of(i));
-
-                if (color_of(sibling_index) == COLOR_RED)
-                {
-                    set_color(sibling_index, COLOR_BLACK);
-                    set_color(parent_index_of(i), COLOR_RED);
-                    rotate_left(parent_index_of(i));
-                    sibling_index = right_index_of(parent_index_of(i));
-                }
-
-                if (color_of(left_index_of(sibling_index)) == COLOR_BLACK &&
-                    color_of(right_index_of(sibling_index)) == COLOR_BLACK)
-                {
-                    set_color(sibling_index, COLOR_RED);
-                    i = parent_index_of(i);
-                }
-                else
-                {
-                    if (color_of(right_index_of(sibling_index)) == COLOR_BLACK)
-                    {
-                        set_color(left_index_of(sibling_index), COLOR_BLACK);
-                        set_color(sibling_index, COLOR_RED);
-                        rotate_right(sibling_index);
-                        sibling_index = right_index_of(parent_index_of(i));
-                    }
-                    set_color(sibling_index, color_of(parent_index_of(i)));
-                    set_color(parent_index_of(i), COLOR_BLACK);
-                    set_color(right_index_of(sibling_index), COLOR_BLACK);
-                    rotate_left(parent_index_of(i));
-                    i = root_index();
-                }
-            }
-            else
-            {
-                NodeIndex sibling_index = left_index_of(parent_index_of(i));
-
-                if (color_of(sibling_index) == COLOR_RED)
-                {
-                    set_color(sibling_index, COLOR_BLACK);
-                    set_color(parent_index_of(i), COLOR_RED);
-                    rotate_right(parent_index_of(i));
-                    sibling_index = left_index_of(parent_index_of(i));
-                }
-
-                if (color_of(right_index_of(sibling_index)) == COLOR_BLACK &&
-                    color_of(left_index_of(sibling_index)) == COLOR_BLACK)
-                {
-                    set_color(sibling_index, COLOR_RED);
-                    i = parent_index_of(i);
-                }
-                else
-                {
-                    if (color_of(left_index_of(sibling_index)) == COLOR_BLACK)
-                    {
-                        set_color(right_index_of(sibling_index), COLOR_BLACK);
-                        set_color(sibling_index, COLOR_RED);
-                        rotate_left(sibling_index);
-                        sibling_index = left_index_of(parent_index_of(i));
-                    }
-                    set_color(sibling_index, color_of(parent_index_of(i)));
-                    set_color(parent_index_of(i), COLOR_BLACK);
-                    set_color(left_index_of(sibling_index), COLOR_BLACK);
-                    rotate_right(parent_index_of(i));
-                    i = root_index();
-                }
-            }
-        }
-
-        set_color(i, COLOR_BLACK);
-    }
-
     constexpr void fixup_repositioned_index(NodeIndex& i,
                                             const NodeIndex old_index,
                                             const NodeIndex new_index) const noexcept
@@ -876,6 +699,7 @@ public:
     = default;
 
     // TODO: Use O(N) algorithm. Do non-recursive
+    // Nodes are appended after their equivalents, so multi-containers keep duplicates in order.
     constexpr FixedRedBlackTree(const FixedRedBlackTree& other)
       : FixedRedBlackTree()
     {
@@ -883,14 +707,15 @@ public:
              i = other.index_of_successor_at(i))
         {
             const auto node = other.tree_storage_at(i);
-            NodeIndexAndParentIndex np = this->index_of_node_with_parent(node.key());
+            NodeIndexAndParentIndex np =
+                this->index_of_insertion_point_after_equivalents(node.key());
             if constexpr (Base::HAS_ASSOCIATED_VALUE)
             {
-                this->insert_if_not_present_at(np, node.key(), node.value());
+                this->insert_new_at(np, node.key(), node.value());
             }
             else
             {
-                this->insert_if_not_present_at(np, node.key());
+                this->insert_new_at(np, node.key());
             }
         }
     }
@@ -901,14 +726,15 @@ public:
              i = other.index_of_successor_at(i))
         {
             auto node = other.tree_storage_at(i);
-            NodeIndexAndParentIndex np = this->index_of_node_with_parent(node.key());
+            NodeIndexAndParentIndex np =
+                this->index_of_insertion_point_after_equivalents(node.key());
             if constexpr (Base::HAS_ASSOCIATED_VALUE)
             {
-                this->insert_if_not_present_at(np, std::move(node.key()), std::move(node.value()));
+                this->insert_new_at(np, std::move(node.key()), std::move(node.value()));
             }
             else
             {
-                this->insert_if_not_present_at(np, std::move(node.key()));
+                this->insert_new_at(np, std::move(node.key()));
             }
         }
         // Clear the moved-out-of-map. This is consistent with both std::map
@@ -927,14 +753,15 @@ public:
              i = other.index_of_successor_at(i))
         {
             const auto node = other.tree_storage_at(i);
-            NodeIndexAndParentIndex np = this->index_of_node_with_parent(node.key());
+            NodeIndexAndParentIndex np =
+                this->index_of_insertion_point_after_equivalents(node.key());
             if constexpr (Base::HAS_ASSOCIATED_VALUE)
             {
-                this->insert_if_not_present_at(np, node.key(), node.value());
+                this->insert_new_at(np, node.key(), node.value());
             }
             else
             {
-                this->insert_if_not_present_at(np, node.key());
+                this->insert_new_at(np, node.key());
             }
         }
         return *this;
@@ -951,14 +778,15 @@ public:
              i = other.index_of_successor_at(i))
         {
             auto node = other.tree_storage_at(i);
-            NodeIndexAndParentIndex np = this->index_of_node_with_parent(node.key());
+            NodeIndexAndParentIndex np =
+                this->index_of_insertion_point_after_equivalents(node.key());
             if constexpr (Base::HAS_ASSOCIATED_VALUE)
             {
-                this->insert_if_not_present_at(np, std::move(node.key()), std::move(node.value()));
+                this->insert_new_at(np, std::move(node.key()), std::move(node.value()));
             }
             else
             {
-                this->insert_if_not_present_at(np, std::move(node.key()));
+                this->insert_new_at(np, std::move(node.key()));
             }
         }
         // The trivial assignment operator does not `other.clear()`, so don't do it here either for
@@ -0,0 +1,668 @@
+#pragma once
+
+#include "fixed_containers/fixed_red_black_tree_nodes.hpp"
+#include "fixed_containers/fixed_red_black_tree_types.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace fixed_containers::fixed_red_black_tree_detail
+{
+// Rotations and recoloring only ever touch the parent/left/right/color links of the nodes and the
+// root index; they never look at keys or values. They are therefore written against a "Links"
+// accessor instead of against the tree, so the same code can be shared by every tree.
+//
+// Two accessors are provided:
+// - RedBlackTreeLinkLayout is a small runtime descriptor (addresses of the links of node 0, the
+//   distance between nodes and the root index). Its type only depends on the node color
+//   compactness, so at run time there is one copy of the rebalancing code per compactness,
+//   instead of one per (K, V, MAXIMUM_SIZE, Compare, Storage) combination.
+// - RedBlackTreeStorageLinks goes through the tree storage. It is used during constant evaluation,
+//   where reinterpreting node bytes is not allowed, and is never emitted in the binary.
+//
+// Augmented trees (e.g. an interval tree keeping the maximum end of each subtree) additionally
+// provide `update_augmentation(i)`, which recomputes the summary of node `i` from the node itself
+// and its two children. The rebalancing code calls it wherever the nodes below a node change.
+// Trees whose accessor does not provide it pay nothing.
+
+template <class Links>
+concept AugmentedRedBlackTreeLinks =
+    requires(Links& links, const NodeIndex& i) { links.update_augmentation(i); };
+
+template <class TreeStorage>
+class RedBlackTreeStorageLinks
+{
+    TreeStorage* tree_storage_;
+    NodeIndex* root_index_;
+
+public:
+    constexpr RedBlackTreeStorageLinks(TreeStorage& tree_storage, NodeIndex& root_index)
+      : tree_storage_{std::addressof(tree_storage)}
+      , root_index_{std::addressof(root_index)}
+    {
+    }
+
+    [[nodiscard]] constexpr NodeIndex root_index() const { return *root_index_; }
+    constexpr void set_root_index(const NodeIndex& r) { *root_index_ = r; }
+
+    [[nodiscard]] constexpr NodeIndex parent_index(const NodeIndex& i) const
+    {
+        return tree_storage_->parent_index(i);
+    }
+    constexpr void set_parent_index(const NodeIndex& i, const NodeIndex& s)
+    {
+        tree_storage_->set_parent_index(i, s);
+    }
+    [[nodiscard]] constexpr NodeIndex left_index(const NodeIndex& i) const
+    {
+        return tree_storage_->left_index(i);
+    }
+    constexpr void set_left_index(const NodeIndex& i, const NodeIndex& s)
+    {
+        tree_storage_->set_left_index(i, s);
+    }
+    [[nodiscard]] constexpr NodeIndex right_index(const NodeIndex& i) const
+    {
+        return tree_storage_->right_index(i);
+    }
+    constexpr void set_right_index(const NodeIndex& i, const NodeIndex& s)
+    {
+        tree_storage_->set_right_index(i, s);
+    }
+    [[nodiscard]] constexpr NodeColor color(const NodeIndex& i) const
+    {
+        return tree_storage_->color(i);
+    }
+    constexpr void set_color(const NodeIndex& i, const NodeColor& c)
+    {
+        tree_storage_->set_color(i, c);
+    }
+};
+
+template <RedBlackTreeNodeColorCompactness COMPACTNESS>
+class RedBlackTreeLinkLayout
+{
+    static constexpr bool EMBEDDED_COLOR =
+        COMPACTNESS == RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR;
+    using ParentLinkType = std::conditional_t<EMBEDDED_COLOR,
+                                              NodeIndexWithColorEmbeddedInTheMostSignificantBit,
+                                              NodeIndex>;
+
+    // Addresses of the links of node 0; the links of node `i` are `i * stride_` bytes further.
+    // Node 0 need not be alive, only the nodes that are actually accessed.
+    std::byte* parent_links_;
+    std::byte* left_links_;
+    std::byte* right_links_;
+    std::byte* color_links_;
+    std::size_t stride_;
+    NodeIndex* root_index_;
+
+public:
+    // Built from the addresses of the links of a live node `i`
+    constexpr RedBlackTreeLinkLayout(const NodeIndex& i,
+                                     const std::size_t stride,
+                                     ParentLinkType& parent_of_i,
+                                     NodeIndex& left_of_i,
+                                     NodeIndex& right_of_i,
+                                     NodeColor* color_of_i,
+                                     NodeIndex& root_index)
+      : parent_links_{node_zero_address_of(parent_of_i, i, stride)}
+      , left_links_{node_zero_address_of(left_of_i, i, stride)}
+      , right_links_{node_zero_address_of(right_of_i, i, stride)}
+      , color_links_{color_of_i == nullptr ? nullptr
+                                           : node_zero_address_of(*color_of_i, i, stride)}
+      , stride_{stride}
+      , root_index_{std::addressof(root_index)}
+    {
+    }
+
+    [[nodiscard]] constexpr NodeIndex root_index() const { return *root_index_; }
+    constexpr void set_root_index(const NodeIndex& r) { *root_index_ = r; }
+
+    [[nodiscard]] constexpr NodeIndex parent_index(const NodeIndex& i) const
+    {
+        if constexpr (EMBEDDED_COLOR)
+        {
+            return link_at<ParentLinkType>(parent_links_, i).get_index();
+        }
+        else
+        {
+            return link_at<NodeIndex>(parent_links_, i);
+        }
+    }
+    constexpr void set_parent_index(const NodeIndex& i, const NodeIndex& s)
+    {
+        if constexpr (EMBEDDED_COLOR)
+        {
+            link_at<ParentLinkType>(parent_links_, i).set_index(s);
+        }
+        else
+        {
+            link_at<NodeIndex>(parent_links_, i) = s;
+        }
+    }
+    [[nodiscard]] constexpr NodeIndex left_index(const NodeIndex& i) const
+    {
+        return link_at<NodeIndex>(left_links_, i);
+    }
+    constexpr void set_left_index(const NodeIndex& i, const NodeIndex& s)
+    {
+        link_at<NodeIndex>(left_links_, i) = s;
+    }
+    [[nodiscard]] constexpr NodeIndex right_index(const NodeIndex& i) const
+    {
+        return link_at<NodeIndex>(right_links_, i);
+    }
+    constexpr void set_right_index(const NodeIndex& i, const NodeIndex& s)
+    {
+        link_at<NodeIndex>(right_links_, i) = s;
+    }
+    [[nodiscard]] constexpr NodeColor color(const NodeIndex& i) const
+    {
+        if constexpr (EMBEDDED_COLOR)
+        {
+            return link_at<ParentLinkType>(parent_links_, i).get_color();
+        }
+        else
+        {
+            return link_at<NodeColor>(color_links_, i);
+        }
+    }
+    constexpr void set_color(const NodeIndex& i, const NodeColor& c)
+    {
+        if constexpr (EMBEDDED_COLOR)
+        {
+            link_at<ParentLinkType>(parent_links_, i).set_color(c);
+        }
+        else
+        {
+            link_at<NodeColor>(color_links_, i) = c;
+        }
+    }
+
+private:
+    template <class T>
+    static constexpr std::byte* node_zero_address_of(T& link_of_i,
+                                                     const NodeIndex& i,
+                                                     const std::size_t stride)
+    {
+        return reinterpret_cast<std::byte*>(std::addressof(link_of_i)) - (i * stride);
+    }
+
+    template <class T>
+    [[nodiscard]] constexpr T& link_at(std::byte* links, const NodeIndex& i) const
+    {
+        return *reinterpret_cast<T*>(links + (i * stride_));
+    }
+};
+
+template <class Links>
+class FixedRedBlackTreeRebalancing
+{
+public:
+    constexpr FixedRedBlackTreeRebalancing() = delete;
+    constexpr ~FixedRedBlackTreeRebalancing() = delete;
+
+    static constexpr void fix_after_insertion(Links& links, const NodeIndex& index_of_newly_added)
+    {
+        NodeIndex i = index_of_newly_added;
+        links.set_color(i, COLOR_RED);
+        // Rotations keep the set of nodes below the rotated pair, so after this only the two
+        // rotated nodes need to be refreshed
+        update_augmentation_up_to_root(links, i);
+
+        while (i != NULL_INDEX && i != links.root_index() &&
+               links.color(links.parent_index(i)) == COLOR_RED)
+        {
+            if (parent_index_of(links, i) ==
+                left_index_of(links, parent_index_of(links, parent_index_of(links, i))))
+            {
+                const NodeIndex uncle_index =
+                    right_index_of(links, parent_index_of(links, parent_index_of(links, i)));
+                if (color_of(links, uncle_index) == COLOR_RED)
+                {
+                    set_color(links, parent_index_of(links, i), COLOR_BLACK);
+                    set_color(links, uncle_index, COLOR_BLACK);
+                    set_color(links, parent_index_of(links, parent_index_of(links, i)), COLOR_RED);
+                    i = parent_index_of(links, parent_index_of(links, i));
+                }
+                else
+                {
+                    if (i == right_index_of(links, parent_index_of(links, i)))
+                    {
+                        i = parent_index_of(links, i);
+                        rotate_left(links, i);
+                    }
+                    set_color(links, parent_index_of(links, i), COLOR_BLACK);
+                    set_color(links, parent_index_of(links, parent_index_of(links, i)), COLOR_RED);
+                    rotate_right(links, parent_index_of(links, parent_index_of(links, i)));
+                }
+            }
+            else
+            {
+                const NodeIndex uncle_index =
+                    left_index_of(links, parent_index_of(links, parent_index_of(links, i)));
+                if (color_of(links, uncle_index) == COLOR_RED)
+                {
+                    set_color(links, parent_index_of(links, i), COLOR_BLACK);
+                    set_color(links, uncle_index, COLOR_BLACK);
+                    set_color(links, parent_index_of(links, parent_index_of(links, i)), COLOR_RED);
+                    i = parent_index_of(links, parent_index_of(links, i));
+                }
+                else
+                {
+                    if (i == left_index_of(links, parent_index_of(links, i)))
+                    {
+                        i = parent_index_of(links, i);
+                        rotate_right(links, i);
+                    }
+                    set_color(links, parent_index_of(links, i), COLOR_BLACK);
+                    set_color(links, parent_index_of(links, parent_index_of(links, i)), COLOR_RED);
+                    rotate_left(links, parent_index_of(links, parent_index_of(links, i)));
+                }
+            }
+        }
+
+        links.set_color(links.root_index(), COLOR_BLACK);
+    }
+
+    // Detaches a node with at most one child from the tree and rebalances. The node itself is left
+    // in place with all of its links cleared.
+    static constexpr void unlink(Links& links, const NodeIndex& index_to_delete)
+    {
+        // Start fixup at replacement node, if it exists
+        const NodeIndex replacement_node_index = links.left_index(index_to_delete) != NULL_INDEX
+                                                     ? links.left_index(index_to_delete)
+                                                     : links.right_index(index_to_delete);
+
+        // If there is at least 1 child
+        if (replacement_node_index != NULL_INDEX)
+        {
+            const NodeIndex parent_index = links.parent_index(index_to_delete);
+            links.set_parent_index(replacement_node_index, parent_index);
+            // If we become the root, update the root_index
+            if (parent_index == NULL_INDEX)
+            {
+                links.set_root_index(replacement_node_index);
+            }
+            else if (index_to_delete == links.left_index(parent_index))
+            {
+                links.set_left_index(parent_index, replacement_node_index);
+            }
+            else
+            {
+                links.set_right_index(parent_index, replacement_node_index);
+            }
+
+            links.set_parent_index(index_to_delete, NULL_INDEX);
+            links.set_left_index(index_to_delete, NULL_INDEX);
+            links.set_right_index(index_to_delete, NULL_INDEX);
+            update_augmentation_up_to_root(links, parent_index);
+
+            if (links.color(index_to_delete) == COLOR_BLACK)
+            {
+                fix_after_deletion(links, replacement_node_index);
+            }
+        }
+        else
+        {
+            // If there are no children
+            if (links.color(index_to_delete) == COLOR_BLACK)
+            {
+                fix_after_deletion(links, index_to_delete);
+            }
+
+            const NodeIndex parent_index = links.parent_index(index_to_delete);
+            // The last node of the tree
+            if (parent_index == NULL_INDEX)
+            {
+                links.set_root_index(NULL_INDEX);
+            }
+            else
+            {
+                if (index_to_delete == links.left_index(parent_index))
+                {
+                    links.set_left_index(parent_index, NULL_INDEX);
+                }
+                else if (index_to_delete == links.right_index(parent_index))
+                {
+                    links.set_right_index(parent_index, NULL_INDEX);
+                }
+                links.set_parent_index(index_to_delete, NULL_INDEX);
+                update_augmentation_up_to_root(links, parent_index);
+            }
+        }
+    }
+
+    // Detaches any node from the tree and rebalances. A node with two children first trades places
+    // with its successor (links and colors only, the payloads stay where they are), so that it has
+    // at most one child.
+    static constexpr void erase(Links& links, const NodeIndex& index_to_delete)
+    {
+        if (links.left_index(index_to_delete) != NULL_INDEX &&
+            links.right_index(index_to_delete) != NULL_INDEX)
+        {
+            NodeIndex successor_index = links.right_index(index_to_delete);
+            while (links.left_index(successor_index) != NULL_INDEX)
+            {
+                successor_index = links.left_index(successor_index);
+            }
+            swap_positions(links, index_to_delete, successor_index);
+        }
+        unlink(links, index_to_delete);
+    }
+
+    // Structurally swaps two nodes: every link pointing to `i` now points to `j` and vice versa.
+    // Same as FixedRedBlackTreeOps::swap_nodes_excluding_key_and_value(), expressed over Links.
+    static constexpr void swap_positions(Links& links, const NodeIndex& i, const NodeIndex& j)
+    {
+        if (links.parent_index(j) == i)
+        {
+            swap_positions_impl(links, j, i);
+        }
+        else
+        {
+            swap_positions_impl(links, i, j);
+        }
+        // Both nodes now summarize the subtree of the other one. Whichever is lower, the second
+        // pass also fixes up what the first one computed from the other stale node.
+        update_augmentation_up_to_root(links, i);
+        update_augmentation_up_to_root(links, j);
+    }
+
+    static constexpr void fix_after_deletion(Links& links, const NodeIndex& index_of_deleted)
+    {
+        NodeIndex i = index_of_deleted;
+
+        while (i != links.root_index() && color_of(links, i) == COLOR_BLACK)
+        {
+            if (i == left_index_of(links, parent_index_of(links, i)))
+            {
+                NodeIndex sibling_index = right_index_of(links, parent_index_of(links, i));
+
+                if (color_of(links, sibling_index) == COLOR_RED)
+                {
+                    set_color(links, sibling_index, COLOR_BLACK);
+                    set_color(links, parent_index_of(links, i), COLOR_RED);
+                    rotate_left(links, parent_index_of(links, i));
+                    sibling_index = right_index_of(links, parent_index_of(links, i));
+                }
+
+                if (color_of(links, left_index_of(links, sibling_index)) == COLOR_BLACK &&
+                    color_of(links, right_index_of(links, sibling_index)) == COLOR_BLACK)
+                {
+                    set_color(links, sibling_index, COLOR_RED);
+                    i = parent_index_of(links, i);
+                }
+                else
+                {
+                    if (color_of(links, right_index_of(links, sibling_index)) == COLOR_BLACK)
+                    {
+                        set_color(links, left_index_of(links, sibling_index), COLOR_BLACK);
+                        set_color(links, sibling_index, COLOR_RED);
+                        rotate_right(links, sibling_index);
+                        sibling_index = right_index_of(links, parent_index_of(links, i));
+                    }
+                    set_color(links, sibling_index, color_of(links, parent_index_of(links, i)));
+                    set_color(links, parent_index_of(links, i), COLOR_BLACK);
+                    set_color(links, right_index_of(links, sibling_index), COLOR_BLACK);
+                    rotate_left(links, parent_index_of(links, i));
+                    i = links.root_index();
+                }
+            }
+            else
+            {
+                NodeIndex sibling_index = left_index_of(links, parent_index_of(links, i));
+
+                if (color_of(links, sibling_index) == COLOR_RED)
+                {
+                    set_color(links, sibling_index, COLOR_BLACK);
+                    set_color(links, parent_index_of(links, i), COLOR_RED);
+                    rotate_right(links, parent_index_of(links, i));
+                    sibling_index = left_index_of(links, parent_index_of(links, i));
+                }
+
+                if (color_of(links, right_index_of(links, sibling_index)) == COLOR_BLACK &&
+                    color_of(links, left_index_of(links, sibling_index)) == COLOR_BLACK)
+                {
+                    set_color(links, sibling_index, COLOR_RED);
+                    i = parent_index_of(links, i);
+                }
+                else
+                {
+                    if (color_of(links, left_index_of(links, sibling_index)) == COLOR_BLACK)
+                    {
+                        set_color(links, right_index_of(links, sibling_index), COLOR_BLACK);
+                        set_color(links, sibling_index, COLOR_RED);
+                        rotate_left(links, sibling_index);
+                        sibling_index = left_index_of(links, parent_index_of(links, i));
+                    }
+                    set_color(links, sibling_index, color_of(links, parent_index_of(links, i)));
+                    set_color(links, parent_index_of(links, i), COLOR_BLACK);
+                    set_color(links, left_index_of(links, sibling_index), COLOR_BLACK);
+                    rotate_right(links, parent_index_of(links, i));
+                    i = links.root_index();
+                }
+            }
+        }
+
+        set_color(links, i, COLOR_BLACK);
+    }
+
+    static constexpr void rotate_left(Links& links, const NodeIndex& i)
+    {
+        if (i == NULL_INDEX)
+        {
+            return;
+        }
+
+        const NodeIndex r = links.right_index(i);
+        const NodeIndex r_left = links.left_index(r);
+        links.set_right_index(i, r_left);
+        if (r_left != NULL_INDEX)
+        {
+            links.set_parent_index(r_left, i);
+        }
+        const NodeIndex parent = links.parent_index(i);
+        links.set_parent_index(r, parent);
+
+        if (parent == NULL_INDEX)
+        {
+            links.set_root_index(r);
+        }
+        else if (links.left_index(parent) == i)
+        {
+            links.set_left_index(parent, r);
+        }
+        else
+        {
+            links.set_right_index(parent, r);
+        }
+
+        links.set_left_index(r, i);
+        links.set_parent_index(i, r);
+        update_augmentation(links, i);
+        update_augmentation(links, r);
+    }
+
+    static constexpr void rotate_right(Links& links, const NodeIndex& i)
+    {
+        if (i == NULL_INDEX)
+        {
+            return;
+        }
+
+        const NodeIndex l = links.left_index(i);
+        const NodeIndex l_right = links.right_index(l);
+        links.set_left_index(i, l_right);
+        if (l_right != NULL_INDEX)
+        {
+            links.set_parent_index(l_right, i);
+        }
+        const NodeIndex parent = links.parent_index(i);
+        links.set_parent_index(l, parent);
+
+        if (parent == NULL_INDEX)
+        {
+            links.set_root_index(l);
+        }
+        else if (links.right_index(parent) == i)
+        {
+            links.set_right_index(parent, l);
+        }
+        else
+        {
+            links.set_left_index(parent, l);
+        }
+
+        links.set_right_index(l, i);
+        links.set_parent_index(i, l);
+        update_augmentation(links, i);
+        update_augmentation(links, l);
+    }
+
+private:
+    static constexpr void swap_positions_impl(Links& links, const NodeIndex& i, const NodeIndex& j)
+    {
+        // Below this, nodes are either non-neighbors or j is the parent
+        if (links.left_index(j) == i)
+        {
+            // Break the link
+            links.set_parent_index(i, NULL_INDEX);
+            links.set_left_index(j, NULL_INDEX);
+
+            redirect_neighbours(links, i, i, j);
+            redirect_neighbours(links, j, j, i);
+
+            const NodeIndex right_of_i = links.right_index(i);
+            links.set_right_index(i, links.right_index(j));
+            links.set_right_index(j, right_of_i);
+
+            links.set_parent_index(i, links.parent_index(j));
+            links.set_parent_index(j, i);
+            links.set_left_index(j, links.left_index(i));
+            links.set_left_index(i, j);
+        }
+        else if (links.right_index(j) == i)
+        {
+            // Break the link
+            links.set_parent_index(i, NULL_INDEX);
+            links.set_right_index(j, NULL_INDEX);
+
+            redirect_neighbours(links, i, i, j);
+            redirect_neighbours(links, j, j, i);
+
+            const NodeIndex left_of_i = links.left_index(i);
+            links.set_left_index(i, links.left_index(j));
+            links.set_left_index(j, left_of_i);
+
+            links.set_parent_index(i, links.parent_index(j));
+            links.set_parent_index(j, i);
+            links.set_right_index(j, links.right_index(i));
+            links.set_right_index(i, j);
+        }
+        else
+        {
+            redirect_neighbours(links, i, i, j);
+            redirect_neighbours(links, j, j, i);
+
+            const NodeIndex parent_of_i = links.parent_index(i);
+            links.set_parent_index(i, links.parent_index(j));
+            links.set_parent_index(j, parent_of_i);
+            const NodeIndex left_of_i = links.left_index(i);
+            links.set_left_index(i, links.left_index(j));
+            links.set_left_index(j, left_of_i);
+            const NodeIndex right_of_i = links.right_index(i);
+            links.set_right_index(i, links.right_index(j));
+            links.set_right_index(j, right_of_i);
+        }
+
+        if (i == links.root_index())
+        {
+            links.set_root_index(j);
+        }
+        else if (j == links.root_index())
+        {
+            links.set_root_index(i);
+        }
+
+        const NodeColor color_of_i = links.color(i);
+        links.set_color(i, links.color(j));
+        links.set_color(j, color_of_i);
+    }
+
+    // Makes the children and the parent of `node` point to `new_index` instead of `old_index`
+    static constexpr void redirect_neighbours(Links& links,
+                                              const NodeIndex& node,
+                                              const NodeIndex& old_index,
+                                              const NodeIndex& new_index)
+    {
+        if (links.left_index(node) != NULL_INDEX)
+        {
+            links.set_parent_index(links.left_index(node), new_index);
+        }
+        if (links.right_index(node) != NULL_INDEX)
+        {
+            links.set_parent_index(links.right_index(node), new_index);
+        }
+        if (const NodeIndex parent = links.parent_index(node); parent != NULL_INDEX)
+        {
+            // We are one of the two children
+            if (links.left_index(parent) == old_index)
+            {
+                links.set_left_index(parent, new_index);
+            }
+            else
+            {
+                links.set_right_index(parent, new_index);
+            }
+        }
+    }
+
+    static constexpr void update_augmentation(Links& links, const NodeIndex& i)
+    {
+        if constexpr (AugmentedRedBlackTreeLinks<Links>)
+        {
+            links.update_augmentation(i);
+        }
+    }
+    // After the set of nodes below `i` changed
+    static constexpr void update_augmentation_up_to_root(Links& links, const NodeIndex& i)
+    {
+        if constexpr (AugmentedRedBlackTreeLinks<Links>)
+        {
+            for (NodeIndex j = i; j != NULL_INDEX; j = links.parent_index(j))
+            {
+                links.update_augmentation(j);
+            }
+        }
+    }
+
+    // Accessors that automatically handle NULL_INDEX
+    [[nodiscard]] static constexpr NodeIndex parent_index_of(const Links& links, const NodeIndex& i)
+    {
+        return i == NULL_INDEX ? NULL_INDEX : links.parent_index(i);
+    }
+    [[nodiscard]] static constexpr NodeIndex left_index_of(const Links& links, const NodeIndex& i)
+    {
+        return i == NULL_INDEX ? NULL_INDEX : links.left_index(i);
+    }
+    [[nodiscard]] static constexpr NodeIndex right_index_of(const Links& links, const NodeIndex& i)
+    {
+        return i == NULL_INDEX ? NULL_INDEX : links.right_index(i);
+    }
+    [[nodiscard]] static constexpr NodeColor color_of(const Links& links, const NodeIndex& i)
+    {
+        // null nodes are treated as COLOR_BLACK
+        if (i == NULL_INDEX) return COLOR_BLACK;
+        return links.color(i);
+    }
+    static constexpr void set_color(Links& links, const NodeIndex& i, const NodeColor& color)
+    {
+        if (i == NULL_INDEX) return;
+        links.set_color(i, color);
+    }
+};
+
+}  // namespace fixed_containers::fixed_red_black_tree_detail
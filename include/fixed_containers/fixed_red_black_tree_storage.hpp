@@ -2,8 +2,10 @@
 
 #include "fixed_containers/fixed_index_based_storage.hpp"
 #include "fixed_containers/fixed_red_black_tree_nodes.hpp"
+#include "fixed_containers/fixed_red_black_tree_rebalancing.hpp"
 #include "fixed_containers/fixed_red_black_tree_types.hpp"
 
+#include <memory>
 #include <type_traits>
 #include <utility>
 
@@ -144,6 +146,35 @@ public:
         return storage().delete_at_and_return_repositioned_index(i);
     }
 
+    // Describes where the links of every node are, starting from a live node `i`.
+    // Runtime-only, as the layout reinterprets node bytes.
+    constexpr RedBlackTreeLinkLayout<COMPACTNESS> link_layout(const NodeIndex& i,
+                                                              NodeIndex& root_index)
+    {
+        using Storage = StorageTemplate<NodeType, MAXIMUM_SIZE>;
+        NodeType& node = storage().at(i);
+        if constexpr (COMPACTNESS == RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR)
+        {
+            return {i,
+                    Storage::ELEMENT_STRIDE,
+                    node.IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_and_color_,
+                    node.IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_,
+                    node.IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_,
+                    nullptr,
+                    root_index};
+        }
+        else
+        {
+            return {i,
+                    Storage::ELEMENT_STRIDE,
+                    node.IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_,
+                    node.IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_,
+                    node.IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_,
+                    std::addressof(node.IMPLEMENTATION_DETAIL_DO_NOT_USE_color_),
+                    root_index};
+        }
+    }
+
 private:
     constexpr const StorageTemplate<NodeType, MAXIMUM_SIZE>& storage() const
     {
@@ -5,6 +5,7 @@
 
 #include <array>
 #include <cstdint>
+#include <span>
 #include <utility>
 
 // This is a modified version of the dense hashmap from https://github.com/martinus/unordered_dense,
@@ -97,6 +98,84 @@ struct Bucket
     }
 };
 
+// Probing and bucket shifting only depend on the bucket array, so they operate on a span and are
+// shared by all tables, instead of being instantiated for every (K, V, MAXIMUM_VALUE_COUNT,
+// BUCKET_COUNT, Hash, KeyEqual) combination. The ideal bucket of a hash is computed by the table,
+// where the bucket count is a constant.
+[[nodiscard]] constexpr Bucket::ValueIndexType next_bucket_index_in(
+    const std::span<const Bucket> buckets, const Bucket::ValueIndexType bucket_index)
+{
+    if (bucket_index + 1 < buckets.size())
+    {
+        return bucket_index + 1;
+    }
+    return 0;
+}
+
+// Where a key is, or where it would be inserted
+struct BucketLocation
+{
+    Bucket::ValueIndexType bucket_index;
+    // 0 if the key was found, otherwise what the new bucket would hold
+    Bucket::DistAndFingerprintType dist_and_fingerprint;
+};
+
+// Probes from `table_loc`, the ideal bucket of the hash of the key, with the `dist_and_fingerprint`
+// of that hash. `is_key_at(value_index)` compares the key with the one of the value at that index.
+template <typename IsKeyAt>
+[[nodiscard]] constexpr BucketLocation find_bucket_in(
+    const std::span<const Bucket> buckets,
+    Bucket::ValueIndexType table_loc,
+    Bucket::DistAndFingerprintType dist_and_fingerprint,
+    const IsKeyAt& is_key_at)
+{
+    while (true)
+    {
+        const Bucket& bucket = buckets[table_loc];
+        if (bucket.dist_and_fingerprint_ == dist_and_fingerprint && is_key_at(bucket.value_index_))
+        {
+            return {table_loc, 0};
+        }
+        // If we found a bucket that is closer to its "ideal" location than we would be if we
+        // matched, then it is impossible that the key will show up. This check also triggers
+        // when we find an empty bucket. Note that this is also the location that we will insert
+        // the key if it ends up getting inserted.
+        if (dist_and_fingerprint > bucket.dist_and_fingerprint_)
+        {
+            return {table_loc, dist_and_fingerprint};
+        }
+        dist_and_fingerprint = Bucket::increment_dist(dist_and_fingerprint);
+        table_loc = next_bucket_index_in(buckets, table_loc);
+    }
+}
+
+constexpr void place_and_shift_up_in(const std::span<Bucket> buckets,
+                                     Bucket bucket,
+                                     Bucket::ValueIndexType table_loc)
+{
+    // replace the current bucket at the location with the given bucket, bubbling up elements
+    // until we hit an empty one
+    while (0 != buckets[table_loc].dist_and_fingerprint_)
+    {
+        bucket = std::exchange(buckets[table_loc], bucket);
+        bucket = bucket.plus_dist();
+        table_loc = next_bucket_index_in(buckets, table_loc);
+    }
+    buckets[table_loc] = bucket;
+}
+
+constexpr void erase_bucket_in(const std::span<Bucket> buckets, Bucket::ValueIndexType table_loc)
+{
+    // shift down until either empty or an element with correct spot is found
+    Bucket::ValueIndexType next_loc = next_bucket_index_in(buckets, table_loc);
+    while (buckets[next_loc].dist_and_fingerprint_ >= Bucket::DIST_INC * 2)
+    {
+        buckets[table_loc] = buckets[next_loc].minus_dist();
+        table_loc = std::exchange(next_loc, next_bucket_index_in(buckets, next_loc));
+    }
+    buckets[table_loc] = {};
+}
+
 template <typename K,
           typename V,
           std::size_t MAXIMUM_VALUE_COUNT,
@@ -182,29 +261,12 @@ public:
 
     constexpr void place_and_shift_up(Bucket bucket, SizeType table_loc)
     {
-        // replace the current bucket at the location with the given bucket, bubbling up elements
-        // until we hit an empty one
-        while (0 != bucket_at(table_loc).dist_and_fingerprint_)
-        {
-            bucket = std::exchange(bucket_at(table_loc), bucket);
-            bucket = bucket.plus_dist();
-            table_loc = next_bucket_index(table_loc);
-        }
-        bucket_at(table_loc) = bucket;
+        place_and_shift_up_in(IMPLEMENTATION_DETAIL_DO_NOT_USE_bucket_array_, bucket, table_loc);
     }
 
     constexpr void erase_bucket(const OpaqueIndexType& i)
     {
-        SizeType table_loc = i.bucket_index;
-
-        // shift down until either empty or an element with correct spot is found
-        SizeType next_loc = next_bucket_index(table_loc);
-        while (bucket_at(next_loc).dist_and_fingerprint_ >= Bucket::DIST_INC * 2)
-        {
-            bucket_at(table_loc) = bucket_at(next_loc).minus_dist();
-            table_loc = std::exchange(next_loc, next_bucket_index(next_loc));
-        }
-        bucket_at(table_loc) = {};
+        erase_bucket_in(IMPLEMENTATION_DETAIL_DO_NOT_USE_bucket_array_, i.bucket_index);
     }
 
     constexpr SizeType erase_value(SizeType value_index)
@@ -267,33 +329,19 @@ public:
         return bucket_at(i.bucket_index).value_index_;
     }
 
-    constexpr OpaqueIndexType opaque_index_of(const K& k) const
+    // `Key` may differ from K for heterogeneous lookups, provided Hash accepts it and KeyEqual can
+    // compare it to K.
+    template <typename Key = K>
+    constexpr OpaqueIndexType opaque_index_of(const Key& k) const
     {
-        std::uint64_t h = hash(k);
-        Bucket::DistAndFingerprintType dist_and_fingerprint =
-            Bucket::dist_and_fingerprint_from_hash(h);
-        SizeType table_loc = bucket_index_from_hash(h);
-        Bucket bucket = bucket_at(table_loc);
-
-        while (true)
-        {
-            if (bucket.dist_and_fingerprint_ == dist_and_fingerprint &&
-                key_equal(k, key_at(bucket.value_index_)))
-            {
-                return {table_loc, 0};
-            }
-            // If we found a bucket that is closer to its "ideal" location than we would be if we
-            // matched, then it is impossible that the key will show up. This check also triggers
-            // when we find an empty bucket. Note that this is also the location that we will insert
-            // the key if it ends up getting inserted.
-            if (dist_and_fingerprint > bucket.dist_and_fingerprint_)
-            {
-                return {table_loc, dist_and_fingerprint};
-            }
-            dist_and_fingerprint = Bucket::increment_dist(dist_and_fingerprint);
-            table_loc = next_bucket_index(table_loc);
-            bucket = bucket_at(table_loc);
-        }
+        const std::uint64_t h = hash(k);
+        const BucketLocation location =
+            find_bucket_in(IMPLEMENTATION_DETAIL_DO_NOT_USE_bucket_array_,
+                           bucket_index_from_hash(h),
+                           Bucket::dist_and_fingerprint_from_hash(h),
+                           [this, &k](const SizeType value_index)
+                           { return key_equal(k, key_at(value_index)); });
+        return {location.bucket_index, location.dist_and_fingerprint};
     }
 
     constexpr bool exists(const OpaqueIndexType& i) const
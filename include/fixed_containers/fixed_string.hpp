@@ -324,9 +324,32 @@ public:
         return *this;
     }
 
+    /**
+     * Appends `count` characters written by `writer(char* destination)`, with a single capacity
+     * check for all of them. `writer` must write exactly `count` characters.
+     */
+    template <typename CharWriter>
+    constexpr FixedString& append_written(
+        size_type count,
+        const CharWriter& writer,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        const std::size_t new_length = length() + count;
+        if (preconditions::test(count <= MAXIMUM_LENGTH - length()))
+        {
+            Checking::length_error(new_length, loc);
+        }
+        writer(std::next(data(), static_cast<std::ptrdiff_t>(length())));
+        // This bypasses the vector's element-wise insertion, as the characters are already in place
+        vec().IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = new_length;
+        null_terminate(loc);
+        return *this;
+    }
+
     constexpr FixedString& operator+=(CharT ch)
     {
-        return append(ch, std_transition::source_location::current());
+        push_back(ch, std_transition::source_location::current());
+        return *this;
     }
     constexpr FixedString& operator+=(const CharT* s)
     {
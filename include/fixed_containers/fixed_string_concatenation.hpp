@@ -0,0 +1,321 @@
+#pragma once
+
+#include "fixed_containers/fixed_string.hpp"
+#include "fixed_containers/sequence_container_checking.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers::fixed_string_concatenation_detail
+{
+// Static maximum length of pieces whose length is only known at runtime
+inline constexpr std::size_t DYNAMIC_LENGTH = std::numeric_limits<std::size_t>::max();
+
+[[nodiscard]] constexpr std::size_t add_static_lengths(const std::size_t lhs,
+                                                       const std::size_t rhs) noexcept
+{
+    if (lhs == DYNAMIC_LENGTH || rhs == DYNAMIC_LENGTH)
+    {
+        return DYNAMIC_LENGTH;
+    }
+    return lhs + rhs;
+}
+
+template <std::size_t STATIC_MAX_LENGTH_ARG>
+struct ViewPiece
+{
+    static constexpr std::size_t STATIC_MAX_LENGTH = STATIC_MAX_LENGTH_ARG;
+
+    std::string_view view;
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return view.size(); }
+    constexpr char* write(char* destination) const noexcept
+    {
+        return std::copy(view.begin(), view.end(), destination);
+    }
+};
+
+struct CharPiece
+{
+    static constexpr std::size_t STATIC_MAX_LENGTH = 1;
+
+    char ch;
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return 1; }
+    constexpr char* write(char* destination) const noexcept
+    {
+        *destination = ch;
+        return std::next(destination);
+    }
+};
+
+// Decimal representation of an integer, like std::to_chars() but usable in constant expressions.
+template <std::integral T>
+struct IntegerPiece
+{
+    using UnsignedType = std::make_unsigned_t<T>;
+    static constexpr std::size_t STATIC_MAX_LENGTH =
+        static_cast<std::size_t>(std::numeric_limits<T>::digits10) + 1 +
+        (std::is_signed_v<T> ? 1 : 0);
+
+    T value;
+
+    [[nodiscard]] constexpr bool is_negative() const noexcept
+    {
+        if constexpr (std::is_signed_v<T>)
+        {
+            return value < 0;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    [[nodiscard]] constexpr UnsignedType magnitude() const noexcept
+    {
+        // Negating in the unsigned type is well-defined, including for the minimum value.
+        const auto as_unsigned = static_cast<UnsignedType>(value);
+        return is_negative() ? static_cast<UnsignedType>(UnsignedType{0} - as_unsigned)
+                             : as_unsigned;
+    }
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept
+    {
+        std::size_t digit_count = 1;
+        for (UnsignedType rest = magnitude(); rest >= 10; rest /= 10)
+        {
+            digit_count++;
+        }
+        return digit_count + (is_negative() ? 1 : 0);
+    }
+    constexpr char* write(char* destination) const noexcept
+    {
+        char* const end = std::next(destination, static_cast<std::ptrdiff_t>(size()));
+        char* cursor = end;
+        UnsignedType rest = magnitude();
+        do
+        {
+            cursor = std::prev(cursor);
+            *cursor = static_cast<char>('0' + static_cast<char>(rest % 10));
+            rest /= 10;
+        } while (rest != 0);
+        if (is_negative())
+        {
+            *destination = '-';
+        }
+        return end;
+    }
+};
+
+template <std::size_t MAXIMUM_LENGTH, typename CheckingType>
+constexpr ViewPiece<MAXIMUM_LENGTH> to_piece(
+    const FixedString<MAXIMUM_LENGTH, CheckingType>& str) noexcept
+{
+    return {std::string_view{str}};
+}
+template <std::size_t N>
+constexpr ViewPiece<N - 1> to_piece(const char (&str)[N]) noexcept
+{
+    return {std::string_view{std::begin(str), N - 1}};
+}
+// Also covers StringLiteral, std::string and const char*
+constexpr ViewPiece<DYNAMIC_LENGTH> to_piece(const std::string_view& view) noexcept
+{
+    return {view};
+}
+constexpr CharPiece to_piece(const char ch) noexcept { return {ch}; }
+template <std::integral T>
+    requires(not std::same_as<T, char> && not std::same_as<T, bool>)
+constexpr IntegerPiece<T> to_piece(const T value) noexcept
+{
+    return {value};
+}
+
+template <typename T>
+concept Piece = requires(const T& t) { to_piece(t); };
+
+template <typename T>
+struct IsFixedString : std::false_type
+{
+};
+template <std::size_t MAXIMUM_LENGTH, typename CheckingType>
+struct IsFixedString<FixedString<MAXIMUM_LENGTH, CheckingType>> : std::true_type
+{
+};
+
+template <typename T>
+using PieceType = decltype(to_piece(std::declval<const T&>()));
+}  // namespace fixed_containers::fixed_string_concatenation_detail
+
+namespace fixed_containers
+{
+/**
+ * A lazily evaluated `a + b + c` chain of FixedStrings, string views, string literals, chars and
+ * integers. Nothing is copied until the chain is converted to (or appended to) a FixedString; then
+ * the total length is computed once, checked once against the destination's capacity, and each
+ * piece is written directly into the destination's inline buffer.
+ *
+ * When every piece has a statically known maximum length (FixedStrings, char array literals, chars
+ * and integers), `to_fixed_string()` returns a FixedString sized for the longest possible result,
+ * so it can never overflow. In constant expressions, an overflowing conversion fails to compile.
+ *
+ * Like std::string_view, the chain refers to the strings it was built from and is meant to be
+ * consumed within the same full-expression; do not store it.
+ */
+template <typename... Pieces>
+class FixedStringConcatenation
+{
+    std::tuple<Pieces...> pieces_;
+
+public:
+    static constexpr std::size_t STATIC_MAX_LENGTH = []()
+    {
+        std::size_t out = 0;
+        ((out = fixed_string_concatenation_detail::add_static_lengths(out,
+                                                                      Pieces::STATIC_MAX_LENGTH)),
+         ...);
+        return out;
+    }();
+
+    [[nodiscard]] static constexpr bool has_static_max_length() noexcept
+    {
+        return STATIC_MAX_LENGTH != fixed_string_concatenation_detail::DYNAMIC_LENGTH;
+    }
+
+    explicit constexpr FixedStringConcatenation(const Pieces&... parts) noexcept
+      : pieces_{parts...}
+    {
+    }
+
+    [[nodiscard]] constexpr const std::tuple<Pieces...>& pieces() const noexcept { return pieces_; }
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept
+    {
+        return std::apply([](const auto&... parts)
+                          { return (std::size_t{0} + ... + parts.size()); },
+                          pieces_);
+    }
+
+    // Writes all pieces, which must fit, starting at `destination`. Returns the end.
+    constexpr char* write(char* destination) const noexcept
+    {
+        std::apply([&destination](const auto&... parts)
+                   { ((destination = parts.write(destination)), ...); },
+                   pieces_);
+        return destination;
+    }
+
+    template <std::size_t MAXIMUM_LENGTH, customize::SequenceContainerChecking CheckingType>
+    constexpr void append_to(
+        FixedString<MAXIMUM_LENGTH, CheckingType>& str,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        str.append_written(
+            size(), [this](char* destination) { write(destination); }, loc);
+    }
+
+    template <std::size_t MAXIMUM_LENGTH, customize::SequenceContainerChecking CheckingType>
+    explicit(false) constexpr operator FixedString<MAXIMUM_LENGTH, CheckingType>() const
+    {
+        FixedString<MAXIMUM_LENGTH, CheckingType> out{};
+        append_to(out);
+        return out;
+    }
+
+    // A FixedString just large enough for the longest possible result
+    [[nodiscard]] constexpr FixedString<STATIC_MAX_LENGTH> to_fixed_string() const
+        requires(has_static_max_length())
+    {
+        return *this;
+    }
+
+    template <fixed_string_concatenation_detail::Piece T>
+    [[nodiscard]] friend constexpr auto operator+(const FixedStringConcatenation& lhs,
+                                                  const T& rhs) noexcept
+    {
+        return std::apply(
+            [&rhs](const auto&... parts)
+            {
+                return FixedStringConcatenation<Pieces...,
+                                                fixed_string_concatenation_detail::PieceType<T>>{
+                    parts..., fixed_string_concatenation_detail::to_piece(rhs)};
+            },
+            lhs.pieces_);
+    }
+    template <fixed_string_concatenation_detail::Piece T>
+    [[nodiscard]] friend constexpr auto operator+(const T& lhs,
+                                                  const FixedStringConcatenation& rhs) noexcept
+    {
+        return std::apply(
+            [&lhs](const auto&... parts)
+            {
+                return FixedStringConcatenation<fixed_string_concatenation_detail::PieceType<T>,
+                                                Pieces...>{
+                    fixed_string_concatenation_detail::to_piece(lhs), parts...};
+            },
+            rhs.pieces_);
+    }
+    template <typename... OtherPieces>
+    [[nodiscard]] friend constexpr auto operator+(
+        const FixedStringConcatenation& lhs,
+        const FixedStringConcatenation<OtherPieces...>& rhs) noexcept
+    {
+        return std::apply(
+            [&rhs](const auto&... lhs_pieces)
+            {
+                return std::apply(
+                    [&lhs_pieces...](const auto&... rhs_pieces)
+                    {
+                        return FixedStringConcatenation<Pieces..., OtherPieces...>{
+                            lhs_pieces..., rhs_pieces...};
+                    },
+                    rhs.pieces());
+            },
+            lhs.pieces_);
+    }
+};
+
+template <std::size_t MAXIMUM_LENGTH,
+          customize::SequenceContainerChecking CheckingType,
+          fixed_string_concatenation_detail::Piece T>
+[[nodiscard]] constexpr auto operator+(const FixedString<MAXIMUM_LENGTH, CheckingType>& lhs,
+                                       const T& rhs) noexcept
+{
+    using namespace fixed_string_concatenation_detail;
+    return FixedStringConcatenation<ViewPiece<MAXIMUM_LENGTH>, PieceType<T>>{to_piece(lhs),
+                                                                             to_piece(rhs)};
+}
+template <std::size_t MAXIMUM_LENGTH,
+          customize::SequenceContainerChecking CheckingType,
+          fixed_string_concatenation_detail::Piece T>
+    requires(not fixed_string_concatenation_detail::IsFixedString<T>::value)
+[[nodiscard]] constexpr auto operator+(
+    const T& lhs, const FixedString<MAXIMUM_LENGTH, CheckingType>& rhs) noexcept
+{
+    using namespace fixed_string_concatenation_detail;
+    return FixedStringConcatenation<PieceType<T>, ViewPiece<MAXIMUM_LENGTH>>{to_piece(lhs),
+                                                                             to_piece(rhs)};
+}
+
+// Appends all pieces with a single capacity check.
+template <std::size_t MAXIMUM_LENGTH,
+          customize::SequenceContainerChecking CheckingType,
+          typename... Pieces>
+constexpr FixedString<MAXIMUM_LENGTH, CheckingType>& operator+=(
+    FixedString<MAXIMUM_LENGTH, CheckingType>& lhs,
+    const FixedStringConcatenation<Pieces...>& rhs)
+{
+    rhs.append_to(lhs);
+    return lhs;
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,208 @@
+#pragma once
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_robinhood_hashtable.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/string_key_arena.hpp"
+#include "fixed_containers/wyhash.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+namespace fixed_containers::fixed_string_pool_detail
+{
+// The smallest unsigned type that can hold the ids [0, MAXIMUM_STRING_COUNT)
+template <std::size_t MAXIMUM_STRING_COUNT>
+using SmallestIdType =
+    std::conditional_t<(MAXIMUM_STRING_COUNT - 1 <= std::numeric_limits<std::uint8_t>::max()),
+                       std::uint8_t,
+                       std::conditional_t<(MAXIMUM_STRING_COUNT - 1 <=
+                                           std::numeric_limits<std::uint16_t>::max()),
+                                          std::uint16_t,
+                                          std::uint32_t>>;
+
+using string_key_arena_detail::ArenaSpan;
+
+// The hashtable only stores ids. Lookups go through this key type, which carries the pre-computed
+// hash and the pool's storage, so that Hash and KeyEqual can be stateless.
+struct LookupKey
+{
+    std::string_view text;
+    std::uint64_t hash;
+    const char* arena;
+    const ArenaSpan* spans;
+};
+
+struct LookupKeyHash
+{
+    constexpr std::uint64_t operator()(const LookupKey& key) const { return key.hash; }
+};
+
+struct LookupKeyEqual
+{
+    template <typename IdType>
+    constexpr bool operator()(const LookupKey& key, const IdType id) const
+    {
+        const ArenaSpan& span = key.spans[id];
+        return std::string_view{key.arena + span.offset, span.length} == key.text;
+    }
+};
+}  // namespace fixed_containers::fixed_string_pool_detail
+
+namespace fixed_containers
+{
+/**
+ * Interns up to MAXIMUM_STRING_COUNT distinct strings, with MAXIMUM_BYTE_COUNT total characters,
+ * and assigns them dense ids in insertion order: 0, 1, 2...
+ *
+ * All characters live in one contiguous arena, so each string costs its length plus a small,
+ * fixed amount of bookkeeping. Looking up an id hashes the string once. Going back from an id to
+ * its string is an array access. Containers keyed by the (1, 2 or 4 byte) ids are then much
+ * smaller, and faster to hash and compare, than ones keyed by FixedString.
+ *
+ * Strings are never removed, so ids and the returned string_views remain valid for the pool's
+ * lifetime. Fully constexpr, e.g. for static symbol tables:
+ *
+ *     constexpr FixedStringPool<3, 16> SYMBOLS{"AAPL", "MSFT", "NVDA"};
+ *     static_assert(SYMBOLS.find("MSFT") == 1);
+ */
+template <std::size_t MAXIMUM_STRING_COUNT,
+          std::size_t MAXIMUM_BYTE_COUNT,
+          typename IdType = fixed_string_pool_detail::SmallestIdType<MAXIMUM_STRING_COUNT>>
+    requires(MAXIMUM_STRING_COUNT > 0 && std::is_unsigned_v<IdType> &&
+             MAXIMUM_STRING_COUNT - 1 <= std::numeric_limits<IdType>::max())
+class FixedStringPool
+{
+    using ArenaSpan = fixed_string_pool_detail::ArenaSpan;
+    using LookupKey = fixed_string_pool_detail::LookupKey;
+    using IndexType = fixed_robinhood_hashtable_detail::FixedRobinhoodHashtable<
+        IdType,
+        EmptyValue,
+        MAXIMUM_STRING_COUNT,
+        fixed_robinhood_hashtable_detail::default_bucket_count(MAXIMUM_STRING_COUNT),
+        fixed_string_pool_detail::LookupKeyHash,
+        fixed_string_pool_detail::LookupKeyEqual>;
+
+public:
+    using id_type = IdType;
+    using size_type = std::size_t;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept
+    {
+        return MAXIMUM_STRING_COUNT;
+    }
+    [[nodiscard]] static constexpr std::size_t static_max_byte_count() noexcept
+    {
+        return MAXIMUM_BYTE_COUNT;
+    }
+
+private:
+    string_key_arena_detail::StringKeyArena<MAXIMUM_BYTE_COUNT> arena_;
+    FixedVector<ArenaSpan, MAXIMUM_STRING_COUNT> spans_;
+    IndexType index_;
+
+public:
+    constexpr FixedStringPool() noexcept
+      : arena_{}
+      , spans_{}
+      , index_{}
+    {
+    }
+
+    constexpr FixedStringPool(std::initializer_list<std::string_view> strings) noexcept
+      : FixedStringPool()
+    {
+        for (const std::string_view& str : strings)
+        {
+            intern(str);
+        }
+    }
+
+public:
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return MAXIMUM_STRING_COUNT; }
+    [[nodiscard]] constexpr std::size_t max_byte_count() const noexcept
+    {
+        return MAXIMUM_BYTE_COUNT;
+    }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return spans_.size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return spans_.empty(); }
+    // Characters used in the arena
+    [[nodiscard]] constexpr std::size_t byte_count() const noexcept
+    {
+        return arena_.live_byte_count();
+    }
+
+    // Returns the id of `str`, adding it if not already present. Aborts if the pool is full.
+    constexpr id_type intern(const std::string_view str)
+    {
+        const std::optional<id_type> out = try_intern(str);
+        assert_or_abort(out.has_value());
+        return *out;
+    }
+
+    // Like intern(), but returns std::nullopt if `str` would need to be added and does not fit.
+    constexpr std::optional<id_type> try_intern(const std::string_view str)
+    {
+        const LookupKey key = lookup_key_of(str);
+        const typename IndexType::OpaqueIndexType index = index_.opaque_index_of(key);
+        if (index_.exists(index))
+        {
+            return index_.key_at(index_.iterated_index_from(index));
+        }
+        if (spans_.size() >= MAXIMUM_STRING_COUNT || !arena_.can_append(str.size()))
+        {
+            return std::nullopt;
+        }
+
+        const auto id = static_cast<id_type>(spans_.size());
+        spans_.push_back(arena_.append(str));
+        index_.emplace(index, id);
+        return id;
+    }
+
+    [[nodiscard]] constexpr std::optional<id_type> find(const std::string_view str) const
+    {
+        const typename IndexType::OpaqueIndexType index =
+            index_.opaque_index_of(lookup_key_of(str));
+        if (!index_.exists(index))
+        {
+            return std::nullopt;
+        }
+        return index_.key_at(index_.iterated_index_from(index));
+    }
+
+    [[nodiscard]] constexpr bool contains(const std::string_view str) const
+    {
+        return find(str).has_value();
+    }
+
+    [[nodiscard]] constexpr std::string_view at(const id_type id) const
+    {
+        return arena_.view(spans_.at(id));
+    }
+    [[nodiscard]] constexpr std::string_view operator[](const id_type id) const { return at(id); }
+
+    // Invalidates all ids and string_views
+    constexpr void clear() noexcept
+    {
+        // The index can't erase by id, as its Hash only understands LookupKey. Reset it wholesale.
+        index_ = IndexType{};
+        spans_.clear();
+        arena_.clear();
+    }
+
+private:
+    [[nodiscard]] constexpr LookupKey lookup_key_of(const std::string_view str) const
+    {
+        return {str, wyhash::hash<std::string_view>{}(str), arena_.data(), spans_.data()};
+    }
+};
+
+}  // namespace fixed_containers
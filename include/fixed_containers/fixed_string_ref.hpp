@@ -0,0 +1,436 @@
+#pragma once
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_string.hpp"
+#include "fixed_containers/fixed_vector_ref.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/sequence_container_checking.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <string_view>
+
+namespace fixed_containers
+{
+/**
+ * Mutable reference to a FixedString<MAXIMUM_LENGTH> of any MAXIMUM_LENGTH, with the full
+ * string API. The capacity is a run-time value, so there is a single instantiation of each member
+ * function, regardless of how many string capacities the program uses.
+ *
+ * The referred-to string stays null-terminated. Like other references, it must not outlive the
+ * referred-to string.
+ */
+template <customize::SequenceContainerChecking CheckingType =
+              customize::SequenceContainerAbortChecking<char, std::dynamic_extent>>
+class FixedStringRef
+{
+    using Checking = CheckingType;
+    using CharT = char;
+    using VecRef = FixedVectorRef<CharT, CheckingType>;
+
+    struct ScopedNullTermination
+    {
+        FixedStringRef* self_;
+        std_transition::source_location loc_;
+
+        constexpr ScopedNullTermination(FixedStringRef* self,
+                                        const std_transition::source_location& loc) noexcept
+          : self_(self)
+          , loc_(loc)
+        {
+        }
+
+        constexpr ~ScopedNullTermination() noexcept { self_->null_terminate(loc_); }
+    };
+
+public:
+    using value_type = typename VecRef::value_type;
+    using size_type = typename VecRef::size_type;
+    using difference_type = typename VecRef::difference_type;
+    using pointer = typename VecRef::pointer;
+    using const_pointer = typename VecRef::const_pointer;
+    using reference = typename VecRef::reference;
+    using const_reference = typename VecRef::const_reference;
+    using const_iterator = typename VecRef::const_iterator;
+    using iterator = typename VecRef::iterator;
+    using reverse_iterator = typename VecRef::reverse_iterator;
+    using const_reverse_iterator = typename VecRef::const_reverse_iterator;
+
+private:
+    // The capacity of the vector is the maximum length: the slot after it is for the terminator
+    VecRef vec_;
+
+public:
+    // Only from strings with the same checking, see `fixed_vector_ref_detail::ReferenceChecking`
+    template <std::size_t MAXIMUM_LENGTH, customize::SequenceContainerChecking CheckingType2>
+        requires std::same_as<
+            fixed_vector_ref_detail::ReferenceCheckingType<CharT, MAXIMUM_LENGTH, CheckingType2>,
+            CheckingType>
+    explicit(false) constexpr FixedStringRef(
+        FixedString<MAXIMUM_LENGTH, CheckingType2>& str) noexcept
+      : vec_{str.IMPLEMENTATION_DETAIL_DO_NOT_USE_data_.data(),
+             std::addressof(
+                 str.IMPLEMENTATION_DETAIL_DO_NOT_USE_data_.IMPLEMENTATION_DETAIL_DO_NOT_USE_size_),
+             MAXIMUM_LENGTH}
+    {
+    }
+
+    constexpr FixedStringRef& assign(
+        size_type count,
+        CharT ch,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        vec().assign(count, ch, loc);
+        null_terminate(loc);
+        return *this;
+    }
+    template <class InputIt>
+    constexpr FixedStringRef& assign(
+        InputIt first,
+        InputIt last,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        vec().assign(first, last, loc);
+        null_terminate(loc);
+        return *this;
+    }
+    constexpr FixedStringRef& assign(
+        std::initializer_list<CharT> ilist,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        vec().assign(ilist, loc);
+        null_terminate(loc);
+        return *this;
+    }
+    constexpr FixedStringRef& assign(
+        const std::string_view& view,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        vec().assign(view.begin(), view.end(), loc);
+        null_terminate(loc);
+        return *this;
+    }
+
+    [[nodiscard]] constexpr reference operator[](size_type i) noexcept { return vec()[i]; }
+    [[nodiscard]] constexpr const_reference operator[](size_type i) const noexcept
+    {
+        return vec()[i];
+    }
+
+    [[nodiscard]] constexpr reference at(size_type i,
+                                         const std_transition::source_location& loc =
+                                             std_transition::source_location::current()) noexcept
+    {
+        return vec().at(i, loc);
+    }
+    [[nodiscard]] constexpr const_reference at(
+        size_type i,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const noexcept
+    {
+        return vec().at(i, loc);
+    }
+
+    constexpr reference front(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        return vec().front(loc);
+    }
+    constexpr const_reference front(const std_transition::source_location& loc =
+                                        std_transition::source_location::current()) const
+    {
+        return vec().front(loc);
+    }
+    constexpr reference back(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        return vec().back(loc);
+    }
+    constexpr const_reference back(const std_transition::source_location& loc =
+                                       std_transition::source_location::current()) const
+    {
+        return vec().back(loc);
+    }
+
+    [[nodiscard]] constexpr const char* data() const noexcept { return vec().data(); }
+    [[nodiscard]] constexpr char* data() noexcept { return vec().data(); }
+    [[nodiscard]] constexpr const CharT* c_str() const noexcept { return data(); }
+
+    explicit(false) constexpr operator std::string_view() const
+    {
+        return std::string_view(data(), length());
+    }
+
+    constexpr iterator begin() noexcept { return vec().begin(); }
+    constexpr const_iterator begin() const noexcept { return cbegin(); }
+    constexpr const_iterator cbegin() const noexcept { return vec().cbegin(); }
+    constexpr iterator end() noexcept { return vec().end(); }
+    constexpr const_iterator end() const noexcept { return cend(); }
+    constexpr const_iterator cend() const noexcept { return vec().cend(); }
+
+    constexpr reverse_iterator rbegin() noexcept { return vec().rbegin(); }
+    constexpr const_reverse_iterator rbegin() const noexcept { return crbegin(); }
+    constexpr const_reverse_iterator crbegin() const noexcept { return vec().crbegin(); }
+    constexpr reverse_iterator rend() noexcept { return vec().rend(); }
+    constexpr const_reverse_iterator rend() const noexcept { return crend(); }
+    constexpr const_reverse_iterator crend() const noexcept { return vec().crend(); }
+
+    [[nodiscard]] constexpr bool empty() const noexcept { return length() == 0; }
+    [[nodiscard]] constexpr std::size_t length() const noexcept { return vec().size(); }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return length(); }
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return vec().max_size(); }
+    constexpr void reserve(const std::size_t new_capacity,
+                           const std_transition::source_location& loc =
+                               std_transition::source_location::current()) noexcept
+    {
+        vec().reserve(new_capacity, loc);
+    }
+    [[nodiscard]] constexpr std::size_t capacity() const noexcept { return max_size(); }
+
+    constexpr void clear() noexcept
+    {
+        vec().clear();
+        null_terminate(std_transition::source_location::current());
+    }
+
+    constexpr iterator insert(
+        const_iterator it,
+        CharT v,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        ScopedNullTermination guard{this, loc};
+        return vec().insert(it, v, loc);
+    }
+    template <InputIterator InputIt>
+    constexpr iterator insert(
+        const_iterator it,
+        InputIt first,
+        InputIt last,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        ScopedNullTermination guard{this, loc};
+        return vec().insert(it, first, last, loc);
+    }
+    constexpr iterator insert(
+        const_iterator it,
+        std::initializer_list<CharT> ilist,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        ScopedNullTermination guard{this, loc};
+        return vec().insert(it, ilist, loc);
+    }
+    constexpr iterator insert(
+        const_iterator it,
+        std::string_view s,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        ScopedNullTermination guard{this, loc};
+        return vec().insert(it, s.begin(), s.end(), loc);
+    }
+
+    constexpr iterator erase(
+        const_iterator position,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        ScopedNullTermination guard{this, loc};
+        return vec().erase(position, loc);
+    }
+    constexpr iterator erase(
+        const_iterator first,
+        const_iterator last,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        ScopedNullTermination guard{this, loc};
+        return vec().erase(first, last, loc);
+    }
+
+    constexpr void push_back(
+        CharT ch,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        vec().push_back(ch, loc);
+        null_terminate(loc);
+    }
+
+    constexpr void pop_back(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        vec().pop_back(loc);
+        null_terminate(loc);
+    }
+
+    template <class InputIt>
+    constexpr FixedStringRef& append(
+        InputIt first,
+        InputIt last,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        vec().insert(vec().cend(), first, last, loc);
+        null_terminate(loc);
+        return *this;
+    }
+    constexpr FixedStringRef& append(
+        std::initializer_list<CharT> ilist,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        vec().insert(vec().cend(), ilist, loc);
+        null_terminate(loc);
+        return *this;
+    }
+    constexpr FixedStringRef& append(
+        const std::string_view& t,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        vec().insert(vec().cend(), t.begin(), t.end(), loc);
+        null_terminate(loc);
+        return *this;
+    }
+
+    constexpr FixedStringRef& operator+=(CharT ch)
+    {
+        push_back(ch, std_transition::source_location::current());
+        return *this;
+    }
+    constexpr FixedStringRef& operator+=(const CharT* s)
+    {
+        return append(std::string_view{s}, std_transition::source_location::current());
+    }
+    constexpr FixedStringRef& operator+=(std::initializer_list<CharT> ilist)
+    {
+        return append(ilist, std_transition::source_location::current());
+    }
+    constexpr FixedStringRef& operator+=(const std::string_view& t)
+    {
+        return append(t, std_transition::source_location::current());
+    }
+
+    [[nodiscard]] constexpr int compare(std::string_view view) const
+    {
+        return as_view().compare(view);
+    }
+
+    template <std::size_t MAXIMUM_LENGTH, customize::SequenceContainerChecking CheckingType2>
+    constexpr bool operator==(const FixedString<MAXIMUM_LENGTH, CheckingType2>& other) const
+    {
+        return as_view() == std::string_view{other};
+    }
+    template <customize::SequenceContainerChecking CheckingType2>
+    constexpr bool operator==(const FixedStringRef<CheckingType2>& other) const
+    {
+        return as_view() == std::string_view{other};
+    }
+    constexpr bool operator==(const CharT* other) const
+    {
+        return as_view() == std::string_view{other};
+    }
+    constexpr bool operator==(std::string_view view) const noexcept { return as_view() == view; }
+
+    template <std::size_t MAXIMUM_LENGTH, customize::SequenceContainerChecking CheckingType2>
+    constexpr std::strong_ordering operator<=>(
+        const FixedString<MAXIMUM_LENGTH, CheckingType2>& other) const noexcept
+    {
+        return as_view() <=> std::string_view{other};
+    }
+    template <customize::SequenceContainerChecking CheckingType2>
+    constexpr std::strong_ordering operator<=>(
+        const FixedStringRef<CheckingType2>& other) const noexcept
+    {
+        return as_view() <=> std::string_view{other};
+    }
+    constexpr std::strong_ordering operator<=>(const CharT* other) const noexcept
+    {
+        return as_view() <=> std::string_view{other};
+    }
+    constexpr std::strong_ordering operator<=>(const std::string_view& other) const noexcept
+    {
+        return as_view() <=> other;
+    }
+
+    [[nodiscard]] constexpr bool starts_with(const std::string_view& prefix) const noexcept
+    {
+        return as_view().starts_with(prefix);
+    }
+    [[nodiscard]] constexpr bool starts_with(char x) const noexcept
+    {
+        return as_view().starts_with(x);
+    }
+    [[nodiscard]] constexpr bool starts_with(const char* x) const noexcept
+    {
+        return as_view().starts_with(x);
+    }
+
+    [[nodiscard]] constexpr bool ends_with(const std::string_view& suffix) const noexcept
+    {
+        return as_view().ends_with(suffix);
+    }
+    [[nodiscard]] constexpr bool ends_with(char x) const noexcept { return as_view().ends_with(x); }
+    [[nodiscard]] constexpr bool ends_with(const char* x) const noexcept
+    {
+        return as_view().ends_with(x);
+    }
+
+    [[nodiscard]] constexpr std::string_view substr(
+        size_type pos = 0,
+        size_t len = std::string_view::npos,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        if (preconditions::test(pos < length()))
+        {
+            Checking::out_of_range(pos, length(), loc);
+        }
+
+        return as_view().substr(pos, len);
+    }
+
+    constexpr void resize(
+        size_type count,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        resize(count, CharT{}, loc);
+    }
+    constexpr void resize(
+        size_type count,
+        CharT ch,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        vec().resize(count, ch, loc);
+        null_terminate(loc);
+    }
+
+private:
+    constexpr void null_terminate(const std_transition::source_location& loc)
+    {
+        const std::size_t n = length();
+        if (preconditions::test(n <= max_size()))
+        {
+            Checking::length_error(n + 1, loc);
+        }
+
+        // This bypasses the vector's bounds check, the terminator slot is past its capacity
+        *std::next(data(), static_cast<std::ptrdiff_t>(n)) = '\0';
+    }
+
+    [[nodiscard]] constexpr std::string_view as_view() const { return *this; }
+
+    constexpr const VecRef& vec() const { return vec_; }
+    constexpr VecRef& vec() { return vec_; }
+};
+
+template <std::size_t MAXIMUM_LENGTH, typename CheckingType>
+FixedStringRef(FixedString<MAXIMUM_LENGTH, CheckingType>&) -> FixedStringRef<
+    fixed_vector_ref_detail::ReferenceCheckingType<char, MAXIMUM_LENGTH, CheckingType>>;
+
+template <typename CheckingType>
+[[nodiscard]] constexpr bool is_full(const FixedStringRef<CheckingType>& c)
+{
+    return c.size() >= c.max_size();
+}
+
+}  // namespace fixed_containers
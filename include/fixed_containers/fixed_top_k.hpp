@@ -0,0 +1,186 @@
+#pragma once
+
+#include "fixed_containers/fixed_count_min_sketch.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/wyhash.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <utility>
+
+namespace fixed_containers
+{
+template <typename K>
+struct FixedTopKEntry
+{
+    K key;
+    std::uint64_t count;
+
+    constexpr bool operator==(const FixedTopKEntry& other) const = default;
+};
+
+/**
+ * Heavy hitters of a stream: the MAXIMUM_SIZE keys with the highest counts, with counts estimated
+ * by a FixedCountMinSketch<K, WIDTH, DEPTH, Hash>. Candidates are kept in a min-heap on their
+ * estimate, in a FixedVector: a key enters when its estimate exceeds that of the smallest entry,
+ * which it replaces. Only the sketch sees every key, so memory does not depend on the number of
+ * distinct keys.
+ *
+ * Reported counts carry the sketch's error: they are never below the true counts. Keys are
+ * compared with `==` when looking up the heap, which is scanned linearly, so MAXIMUM_SIZE is meant
+ * to be small (tens).
+ *
+ * Two instances can be merged: the sketches are merged, and the candidates of both are ranked
+ * again by their estimates in the merged sketch.
+ * Properties:
+ *  - constexpr
+ *  - trivially copyable (if K and Hash are)
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ */
+template <typename K,
+          std::size_t MAXIMUM_SIZE,
+          std::size_t WIDTH = 2048,
+          std::size_t DEPTH = 4,
+          class Hash = wyhash::hash<K>>
+class FixedTopK
+{
+    using Entry = FixedTopKEntry<K>;
+    using Sketch = FixedCountMinSketch<K, WIDTH, DEPTH, Hash>;
+    using Heap = FixedVector<Entry, MAXIMUM_SIZE>;
+
+public:
+    using key_type = K;
+    using value_type = Entry;
+
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    Sketch IMPLEMENTATION_DETAIL_DO_NOT_USE_sketch_;
+    // Min-heap on `count`
+    Heap IMPLEMENTATION_DETAIL_DO_NOT_USE_heap_;
+
+public:
+    constexpr FixedTopK(const Hash& hash = Hash()) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_sketch_(hash)
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_heap_{}
+    {
+    }
+
+public:
+    // Returns the estimate for `key`, including this addition
+    constexpr std::uint64_t add(const K& key, const std::uint64_t count = 1)
+    {
+        const std::uint64_t estimate = IMPLEMENTATION_DETAIL_DO_NOT_USE_sketch_.add(key, count);
+        offer(key, estimate);
+        return estimate;
+    }
+
+    [[nodiscard]] constexpr std::uint64_t estimate(const K& key) const
+    {
+        return sketch().estimate(key);
+    }
+
+    // Precondition: `other` hashes the same way
+    constexpr void merge(const FixedTopK& other)
+    {
+        FixedVector<K, 2 * MAXIMUM_SIZE> candidates{};
+        for (const Entry& entry : heap())
+        {
+            candidates.push_back(entry.key);
+        }
+        for (const Entry& entry : other.heap())
+        {
+            candidates.push_back(entry.key);
+        }
+
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_sketch_.merge(other.sketch());
+        heap().clear();
+        for (const K& key : candidates)
+        {
+            offer(key, sketch().estimate(key));
+        }
+    }
+
+    constexpr void clear() noexcept
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_sketch_.clear();
+        heap().clear();
+    }
+
+    // The heavy hitters, by decreasing count
+    [[nodiscard]] constexpr FixedVector<Entry, MAXIMUM_SIZE> top() const
+    {
+        FixedVector<Entry, MAXIMUM_SIZE> out = heap();
+        std::sort(out.begin(), out.end(), has_higher_count);
+        return out;
+    }
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return heap().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return heap().empty(); }
+    [[nodiscard]] constexpr const Sketch& sketch() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_sketch_;
+    }
+
+    [[nodiscard]] constexpr bool operator==(const FixedTopK& other) const = default;
+
+private:
+    static constexpr bool has_higher_count(const Entry& lhs, const Entry& rhs)
+    {
+        return lhs.count > rhs.count;
+    }
+
+    constexpr Heap& heap() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_heap_; }
+    constexpr const Heap& heap() const { return IMPLEMENTATION_DETAIL_DO_NOT_USE_heap_; }
+
+    // Estimates only grow, so an entry that is updated can only move down the heap
+    constexpr void offer(const K& key, const std::uint64_t estimate)
+    {
+        for (std::size_t i = 0; i < heap().size(); i++)
+        {
+            if (heap()[i].key == key)
+            {
+                heap()[i].count = estimate;
+                sift_down(i);
+                return;
+            }
+        }
+
+        if (heap().size() < MAXIMUM_SIZE)
+        {
+            heap().push_back(Entry{key, estimate});
+            std::push_heap(heap().begin(), heap().end(), has_higher_count);
+        }
+        else if (estimate > heap().front().count)
+        {
+            heap().front() = Entry{key, estimate};
+            sift_down(0);
+        }
+    }
+
+    constexpr void sift_down(std::size_t i)
+    {
+        while (true)
+        {
+            std::size_t smallest = i;
+            for (const std::size_t child : {(2 * i) + 1, (2 * i) + 2})
+            {
+                if (child < heap().size() && heap()[child].count < heap()[smallest].count)
+                {
+                    smallest = child;
+                }
+            }
+            if (smallest == i)
+            {
+                return;
+            }
+            std::swap(heap()[i], heap()[smallest]);
+            i = smallest;
+        }
+    }
+};
+
+}  // namespace fixed_containers
@@ -573,12 +573,29 @@ public:
             }
         }
 
+        if constexpr (algorithm::BitwiseEqualityComparable<T>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return algorithm::equal(data(), size(), other.data(), other.size());
+            }
+        }
+
         return std::ranges::equal(*this, other);
     }
 
     template <std::size_t MAXIMUM_SIZE_2, customize::SequenceContainerChecking CheckingType2>
     constexpr auto operator<=>(const FixedVectorBase<T, MAXIMUM_SIZE_2, CheckingType2>& other) const
     {
+        if constexpr (algorithm::BitwiseEqualityComparable<T>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return algorithm::lexicographical_compare_three_way(
+                    data(), size(), other.data(), other.size());
+            }
+        }
+
         return std::lexicographical_compare_three_way(
             cbegin(), cend(), other.cbegin(), other.cend());
     }
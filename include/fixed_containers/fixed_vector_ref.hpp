@@ -0,0 +1,533 @@
+#pragma once
+
+#include "fixed_containers/algorithm.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/memory.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/sequence_container_checking.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers::fixed_vector_ref_detail
+{
+// The checking of a reference to a container of `MAXIMUM_SIZE` elements with `CheckingType`.
+// The default checking is parameterized by the capacity, which the reference erases. Any other
+// checking is kept as is, so that errors are reported the same way through the reference.
+template <typename T, std::size_t MAXIMUM_SIZE, typename CheckingType>
+struct ReferenceChecking
+{
+    using type = CheckingType;
+};
+template <typename T, std::size_t MAXIMUM_SIZE>
+struct ReferenceChecking<T,
+                         MAXIMUM_SIZE,
+                         customize::SequenceContainerAbortChecking<T, MAXIMUM_SIZE>>
+{
+    using type = customize::SequenceContainerAbortChecking<T, std::dynamic_extent>;
+};
+
+template <typename T, std::size_t MAXIMUM_SIZE, typename CheckingType>
+using ReferenceCheckingType = typename ReferenceChecking<T, MAXIMUM_SIZE, CheckingType>::type;
+}  // namespace fixed_containers::fixed_vector_ref_detail
+
+namespace fixed_containers
+{
+/**
+ * Mutable reference to a FixedVector<T, MAXIMUM_SIZE> of any MAXIMUM_SIZE, with the full
+ * vector API. It holds the element pointer, a pointer to the size and the capacity as a run-time
+ * value, so all of its member functions are instantiated once per `T`, instead of once per
+ * `T` and `MAXIMUM_SIZE` like those of FixedVector.
+ *
+ * Meant for function parameters: code that takes a `FixedVectorRef<T>` instead of being
+ * templated on the capacity has a single copy in the binary. Like other references, it must not
+ * outlive the referred-to vector. Iterators are plain pointers.
+ */
+template <typename T,
+          customize::SequenceContainerChecking CheckingType =
+              customize::SequenceContainerAbortChecking<T, std::dynamic_extent>>
+class FixedVectorRef
+{
+    static_assert(IsNotReference<T>, "References are not allowed");
+    static_assert(std::same_as<std::remove_cv_t<T>, T>,
+                  "Vector must have a non-const, non-volatile value_type");
+    using Checking = CheckingType;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using reference = T&;
+    using const_reference = const T&;
+    using const_iterator = const T*;
+    using iterator = T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+private:
+    T* data_;
+    std::size_t* size_;
+    std::size_t capacity_;
+
+public:
+    /**
+     * From raw parts: storage for `capacity` elements, whose first `*size` are alive.
+     */
+    constexpr FixedVectorRef(T* data, std::size_t* size, const std::size_t capacity) noexcept
+      : data_{data}
+      , size_{size}
+      , capacity_{capacity}
+    {
+    }
+
+    // Only from vectors with the same checking, see `fixed_vector_ref_detail::ReferenceChecking`
+    template <std::size_t MAXIMUM_SIZE, customize::SequenceContainerChecking CheckingType2>
+        requires std::same_as<
+            fixed_vector_ref_detail::ReferenceCheckingType<T, MAXIMUM_SIZE, CheckingType2>,
+            CheckingType>
+    explicit(false) constexpr FixedVectorRef(
+        FixedVector<T, MAXIMUM_SIZE, CheckingType2>& vector) noexcept
+      : FixedVectorRef{vector.data(),
+                       std::addressof(vector.IMPLEMENTATION_DETAIL_DO_NOT_USE_size_),
+                       MAXIMUM_SIZE}
+    {
+    }
+
+    constexpr void resize(
+        size_type count,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        this->resize(count, T{}, loc);
+    }
+    constexpr void resize(
+        size_type count,
+        const value_type& v,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_target_size(count, loc);
+
+        // Reinitialize the new members if we are enlarging
+        while (size() < count)
+        {
+            memory::construct_at_address_of(unchecked_at(size()), v);
+            increment_size();
+        }
+        // Destroy extras if we are making it smaller.
+        destroy_range(std::next(begin(), static_cast<difference_type>(count)), end());
+        set_size(count);
+    }
+
+    constexpr void push_back(
+        const value_type& v,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_full(loc);
+        memory::construct_at_address_of(unchecked_at(size()), v);
+        increment_size();
+    }
+    constexpr void push_back(
+        value_type&& v,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_full(loc);
+        memory::construct_at_address_of(unchecked_at(size()), std::move(v));
+        increment_size();
+    }
+    template <class... Args>
+    constexpr reference emplace_back(Args&&... args)
+    {
+        check_not_full(std_transition::source_location::current());
+        memory::construct_at_address_of(unchecked_at(size()), std::forward<Args>(args)...);
+        increment_size();
+        return unchecked_at(size() - 1);
+    }
+
+    constexpr void pop_back(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_empty(loc);
+        destroy_range(std::prev(end()), end());
+        decrement_size();
+    }
+
+    constexpr iterator insert(
+        const_iterator it,
+        const value_type& v,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_full(loc);
+        iterator entry_it = advance_all_after_iterator_by_n(it, 1);
+        memory::construct_at_address_of(*entry_it, v);
+        return entry_it;
+    }
+    constexpr iterator insert(
+        const_iterator it,
+        value_type&& v,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_full(loc);
+        iterator entry_it = advance_all_after_iterator_by_n(it, 1);
+        memory::construct_at_address_of(*entry_it, std::move(v));
+        return entry_it;
+    }
+    template <InputIterator InputIt>
+    constexpr iterator insert(
+        const_iterator it,
+        InputIt first,
+        InputIt last,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        return insert_internal(
+            typename std::iterator_traits<InputIt>::iterator_category{}, it, first, last, loc);
+    }
+    constexpr iterator insert(
+        const_iterator it,
+        std::initializer_list<T> ilist,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        return insert_internal(
+            std::random_access_iterator_tag{}, it, ilist.begin(), ilist.end(), loc);
+    }
+
+    template <class... Args>
+    constexpr iterator emplace(const_iterator it, Args&&... args)
+    {
+        check_not_full(std_transition::source_location::current());
+        iterator entry_it = advance_all_after_iterator_by_n(it, 1);
+        memory::construct_at_address_of(*entry_it, std::forward<Args>(args)...);
+        return entry_it;
+    }
+
+    constexpr void assign(
+        size_type count,
+        const value_type& v,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_target_size(count, loc);
+        this->clear();
+        this->resize(count, v, loc);
+    }
+    template <InputIterator InputIt>
+    constexpr void assign(
+        InputIt first,
+        InputIt last,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        this->clear();
+        this->insert(cend(), first, last, loc);
+    }
+    constexpr void assign(
+        std::initializer_list<T> ilist,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        this->clear();
+        this->insert(cend(), ilist, loc);
+    }
+
+    constexpr iterator erase(const_iterator first,
+                             const_iterator last,
+                             const std_transition::source_location& loc =
+                                 std_transition::source_location::current()) noexcept
+    {
+        if (preconditions::test(first <= last))
+        {
+            Checking::invalid_argument("first > last, range is invalid", loc);
+        }
+        if (preconditions::test(first >= cbegin() && last <= cend()))
+        {
+            Checking::invalid_argument("iterators exceed container range", loc);
+        }
+
+        const auto entry_count_to_remove = std::distance(first, last);
+        iterator read_start_it = const_to_mutable_it(last);
+        iterator read_end_it = end();
+        iterator write_start_it = const_to_mutable_it(first);
+
+        if (!std::is_constant_evaluated())
+        {
+            // Same as FixedVector::erase(): Clang rejects the relocation at compile-time
+            destroy_range(write_start_it, read_start_it);
+            algorithm::uninitialized_relocate(read_start_it, read_end_it, write_start_it);
+        }
+        else
+        {
+            iterator write_end_it = std::move(read_start_it, read_end_it, write_start_it);
+            destroy_range(write_end_it, read_end_it);
+        }
+
+        decrement_size(static_cast<std::size_t>(entry_count_to_remove));
+        return write_start_it;
+    }
+    constexpr iterator erase(const_iterator it,
+                             const std_transition::source_location& loc =
+                                 std_transition::source_location::current()) noexcept
+    {
+        return erase(it, std::next(it), loc);
+    }
+
+    constexpr void clear() noexcept
+    {
+        destroy_range(begin(), end());
+        set_size(0);
+    }
+
+    constexpr reference operator[](size_type i) noexcept
+    {
+        // Cannot capture real source_location for operator[]
+        // This operator should not range-check according to the spec, but we want the extra safety.
+        return at(i, std_transition::source_location::current());
+    }
+    constexpr const_reference operator[](size_type i) const noexcept
+    {
+        // Cannot capture real source_location for operator[]
+        // This operator should not range-check according to the spec, but we want the extra safety.
+        return at(i, std_transition::source_location::current());
+    }
+
+    constexpr reference at(size_type i,
+                           const std_transition::source_location& loc =
+                               std_transition::source_location::current()) noexcept
+    {
+        if (preconditions::test(i < size()))
+        {
+            Checking::out_of_range(i, size(), loc);
+        }
+        return unchecked_at(i);
+    }
+    constexpr const_reference at(size_type i,
+                                 const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) const noexcept
+    {
+        if (preconditions::test(i < size()))
+        {
+            Checking::out_of_range(i, size(), loc);
+        }
+        return unchecked_at(i);
+    }
+
+    constexpr reference front(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_empty(loc);
+        return unchecked_at(0);
+    }
+    constexpr const_reference front(const std_transition::source_location& loc =
+                                        std_transition::source_location::current()) const
+    {
+        check_not_empty(loc);
+        return unchecked_at(0);
+    }
+    constexpr reference back(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_empty(loc);
+        return unchecked_at(size() - 1);
+    }
+    constexpr const_reference back(const std_transition::source_location& loc =
+                                       std_transition::source_location::current()) const
+    {
+        check_not_empty(loc);
+        return unchecked_at(size() - 1);
+    }
+
+    constexpr value_type* data() noexcept { return data_; }
+    constexpr const value_type* data() const noexcept { return data_; }
+
+    constexpr iterator begin() noexcept { return data_; }
+    constexpr const_iterator begin() const noexcept { return cbegin(); }
+    constexpr const_iterator cbegin() const noexcept { return data_; }
+    constexpr iterator end() noexcept { return std::next(begin(), difference_size()); }
+    constexpr const_iterator end() const noexcept { return cend(); }
+    constexpr const_iterator cend() const noexcept
+    {
+        return std::next(cbegin(), difference_size());
+    }
+
+    constexpr reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    constexpr const_reverse_iterator rbegin() const noexcept { return crbegin(); }
+    constexpr const_reverse_iterator crbegin() const noexcept
+    {
+        return const_reverse_iterator(cend());
+    }
+    constexpr reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    constexpr const_reverse_iterator rend() const noexcept { return crend(); }
+    constexpr const_reverse_iterator crend() const noexcept
+    {
+        return const_reverse_iterator(cbegin());
+    }
+
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return capacity_; }
+    [[nodiscard]] constexpr std::size_t capacity() const noexcept { return max_size(); }
+    constexpr void reserve(const std::size_t new_capacity,
+                           const std_transition::source_location& loc =
+                               std_transition::source_location::current()) noexcept
+    {
+        check_target_size(new_capacity, loc);
+        // Do nothing
+    }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return *size_; }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+
+    template <customize::SequenceContainerChecking CheckingType2>
+    constexpr bool operator==(const FixedVectorRef<T, CheckingType2>& other) const
+    {
+        return algorithm::equal(data(), size(), other.data(), other.size());
+    }
+
+    template <customize::SequenceContainerChecking CheckingType2>
+    constexpr auto operator<=>(const FixedVectorRef<T, CheckingType2>& other) const
+    {
+        return algorithm::lexicographical_compare_three_way(
+            data(), size(), other.data(), other.size());
+    }
+
+private:
+    constexpr void check_target_size(size_type target_size,
+                                     const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(target_size <= capacity_))
+        {
+            Checking::length_error(target_size, loc);
+        }
+    }
+    constexpr void check_not_full(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(size() < capacity_))
+        {
+            Checking::length_error(capacity_ + 1, loc);
+        }
+    }
+    constexpr void check_not_empty(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(!empty()))
+        {
+            Checking::empty_container_access(loc);
+        }
+    }
+
+    constexpr iterator advance_all_after_iterator_by_n(const const_iterator it, const std::size_t n)
+    {
+        const std::ptrdiff_t value_count_to_move = std::distance(it, cend());
+        increment_size(n);  // Increment now so iterators are all within valid range
+
+        iterator read_start_it = const_to_mutable_it(it);
+        iterator read_end_it = std::next(read_start_it, value_count_to_move);
+        iterator write_end_it =
+            std::next(read_start_it, static_cast<std::ptrdiff_t>(n) + value_count_to_move);
+        algorithm::uninitialized_relocate_backward(read_start_it, read_end_it, write_end_it);
+
+        return read_start_it;
+    }
+
+    template <InputIterator InputIt>
+    constexpr iterator insert_internal(std::forward_iterator_tag,
+                                       const_iterator it,
+                                       InputIt first,
+                                       InputIt last,
+                                       const std_transition::source_location& loc)
+    {
+        const auto entry_count_to_add = static_cast<std::size_t>(std::distance(first, last));
+        check_target_size(size() + entry_count_to_add, loc);
+
+        iterator write_it = advance_all_after_iterator_by_n(it, entry_count_to_add);
+        for (iterator w_it = write_it; first != last; std::advance(first, 1), std::advance(w_it, 1))
+        {
+            memory::construct_at_address_of(*w_it, *first);
+        }
+        return write_it;
+    }
+
+    template <InputIterator InputIt>
+    constexpr iterator insert_internal(std::input_iterator_tag,
+                                       const_iterator it,
+                                       InputIt first,
+                                       InputIt last,
+                                       const std_transition::source_location& loc)
+    {
+        iterator first_it = const_to_mutable_it(it);
+        iterator middle_it = end();
+
+        // Place everything at the end
+        for (; first != last && size() < capacity_; ++first)
+        {
+            memory::construct_at_address_of(unchecked_at(size()), *first);
+            increment_size();
+        }
+
+        if (first != last)  // Reached capacity
+        {
+            std::size_t excess_element_count = 0;
+            for (; first != last; ++first)
+            {
+                excess_element_count++;
+            }
+
+            Checking::length_error(capacity_ + excess_element_count, loc);
+        }
+
+        // Rotate into the correct places
+        std::rotate(first_it, middle_it, end());
+
+        return first_it;
+    }
+
+    constexpr iterator const_to_mutable_it(const_iterator it)
+    {
+        return std::next(begin(), std::distance(cbegin(), it));
+    }
+
+    [[nodiscard]] constexpr difference_type difference_size() const
+    {
+        return static_cast<difference_type>(size());
+    }
+
+    constexpr void increment_size(const std::size_t n = 1) { *size_ += n; }
+    constexpr void decrement_size(const std::size_t n = 1) { *size_ -= n; }
+    constexpr void set_size(const std::size_t size) { *size_ = size; }
+
+    constexpr const T& unchecked_at(const std::size_t i) const
+    {
+        return *std::next(data_, static_cast<difference_type>(i));
+    }
+    constexpr T& unchecked_at(const std::size_t i)
+    {
+        return *std::next(data_, static_cast<difference_type>(i));
+    }
+
+    constexpr void destroy_range(iterator /*first*/, iterator /*last*/)
+        requires TriviallyDestructible<T>
+    {
+    }
+    constexpr void destroy_range(iterator first, iterator last)
+        requires NotTriviallyDestructible<T>
+    {
+        for (; first != last; ++first)
+        {
+            memory::destroy_at_address_of(*first);
+        }
+    }
+};
+
+template <typename T, std::size_t MAXIMUM_SIZE, typename CheckingType>
+FixedVectorRef(FixedVector<T, MAXIMUM_SIZE, CheckingType>&) -> FixedVectorRef<
+    T,
+    fixed_vector_ref_detail::ReferenceCheckingType<T, MAXIMUM_SIZE, CheckingType>>;
+
+template <typename T, typename CheckingType>
+[[nodiscard]] constexpr bool is_full(const FixedVectorRef<T, CheckingType>& c)
+{
+    return c.size() >= c.max_size();
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,153 @@
+#pragma once
+
+#include "fixed_containers/cache_line_padded.hpp"
+#include "fixed_containers/circular_indexing.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/integer_range.hpp"
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity Chase-Lev work-stealing deque.
+ *
+ * A single owner thread calls `push()` and `pop()` at the bottom, while any number of thief
+ * threads call `steal()` at the top. Memory orderings follow "Correct and Efficient Work-Stealing
+ * for Weak Memory Models" (Le, Pop, Cohen, Zappa Nardelli - PPoPP 2013), with the standalone
+ * fences folded into the neighbouring atomic operations so that ThreadSanitizer (which does not
+ * model fences) understands the synchronization. Unlike the original algorithm, the ring is never
+ * grown: `push()` reports failure instead.
+ *
+ * Elements are stored in `std::atomic<T>` slots, because a thief may read a slot concurrently
+ * with the owner overwriting it (the thief then fails its CAS and discards the value). As such,
+ * `T` is restricted to trivially copyable types, typically a pointer or an index into a pool.
+ */
+template <TriviallyCopyable T, std::size_t MAXIMUM_SIZE>
+    requires(std::has_single_bit(MAXIMUM_SIZE))
+class FixedWorkStealingDeque
+{
+    static constexpr auto RING_RANGE = IntegerRange::closed_open<0, MAXIMUM_SIZE>();
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+
+private:
+    // `top` is contended by thieves and `bottom` is owned by the worker
+    alignas(CACHE_LINE_SIZE) std::atomic<std::int64_t> top_;
+    alignas(CACHE_LINE_SIZE) std::atomic<std::int64_t> bottom_;
+    alignas(CACHE_LINE_SIZE) std::array<std::atomic<T>, MAXIMUM_SIZE> ring_;
+
+public:
+    FixedWorkStealingDeque() noexcept
+      : top_{0}
+      , bottom_{0}
+      , ring_{}
+    {
+    }
+
+    FixedWorkStealingDeque(const FixedWorkStealingDeque&) = delete;
+    FixedWorkStealingDeque(FixedWorkStealingDeque&&) noexcept = delete;
+    FixedWorkStealingDeque& operator=(const FixedWorkStealingDeque&) = delete;
+    FixedWorkStealingDeque& operator=(FixedWorkStealingDeque&&) noexcept = delete;
+    ~FixedWorkStealingDeque() = default;
+
+public:
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return MAXIMUM_SIZE; }
+
+    // Only exact when called by the owner with no concurrent thieves.
+    [[nodiscard]] std::size_t size_approx() const noexcept
+    {
+        const std::int64_t b = bottom_.load(std::memory_order_relaxed);
+        const std::int64_t t = top_.load(std::memory_order_relaxed);
+        return b > t ? static_cast<std::size_t>(b - t) : 0;
+    }
+    [[nodiscard]] bool empty_approx() const noexcept { return size_approx() == 0; }
+
+    // Owner only. Returns false if the deque is full.
+    bool push(const T& value) noexcept
+    {
+        const std::int64_t b = bottom_.load(std::memory_order_relaxed);
+        const std::int64_t t = top_.load(std::memory_order_acquire);
+        if (b - t >= static_cast<std::int64_t>(MAXIMUM_SIZE))
+        {
+            return false;
+        }
+
+        slot_at(b).store(value, std::memory_order_relaxed);
+        bottom_.store(b + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Owner only. LIFO with respect to `push()`.
+    std::optional<T> pop() noexcept
+    {
+        const std::int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+        // The store to `bottom` must not be reordered with the load of `top` (store-load)
+        bottom_.store(b, std::memory_order_seq_cst);
+        std::int64_t t = top_.load(std::memory_order_seq_cst);
+
+        if (t > b)
+        {
+            // Empty
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+
+        std::optional<T> out{slot_at(b).load(std::memory_order_relaxed)};
+        if (t == b)
+        {
+            // Last element, race against thieves
+            if (!top_.compare_exchange_strong(
+                    t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                out.reset();
+            }
+            bottom_.store(b + 1, std::memory_order_relaxed);
+        }
+        return out;
+    }
+
+    // Any thread. FIFO with respect to `push()`.
+    // Returns std::nullopt if the deque is empty or if another thread won the race for the
+    // top element.
+    std::optional<T> steal() noexcept
+    {
+        std::int64_t t = top_.load(std::memory_order_seq_cst);
+        const std::int64_t b = bottom_.load(std::memory_order_seq_cst);
+
+        if (t >= b)
+        {
+            return std::nullopt;
+        }
+
+        const T value = slot_at(t).load(std::memory_order_relaxed);
+        if (!top_.compare_exchange_strong(
+                t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return std::nullopt;
+        }
+        return value;
+    }
+
+private:
+    std::atomic<T>& slot_at(const std::int64_t i) noexcept
+    {
+        // `i` is never negative when a slot is accessed. The range is a compile-time power of two,
+        // so the wraparound lowers to a mask.
+        return ring_[circular_indexing::increment_index_with_wraparound(
+                         RING_RANGE, 0, static_cast<std::size_t>(i))
+                         .integer];
+    }
+};
+
+}  // namespace fixed_containers
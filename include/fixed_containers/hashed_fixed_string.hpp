@@ -0,0 +1,311 @@
+#pragma once
+
+#include "fixed_containers/fixed_string.hpp"
+#include "fixed_containers/sequence_container_checking.hpp"
+#include "fixed_containers/source_location.hpp"
+#include "fixed_containers/wyhash.hpp"
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string_view>
+
+namespace fixed_containers
+{
+/**
+ * A FixedString that carries the wyhash of its contents, so looking the same key up in several
+ * hashed containers hashes it once, on construction, rather than once per container.
+ *
+ * The hash is maintained eagerly: every mutating member recomputes it. To keep that invariant,
+ * characters are only exposed through const access; mutate through the members below, or via
+ * `assign()` with a modified copy.
+ *
+ * `wyhash::hash<HashedFixedString>` returns the cached hash, and `operator==` compares hashes
+ * before comparing bytes, so the default `std::equal_to` rejects almost every mismatch without
+ * touching the characters.
+ */
+template <std::size_t MAXIMUM_LENGTH,
+          customize::SequenceContainerChecking CheckingType =
+              customize::SequenceContainerAbortChecking<char, MAXIMUM_LENGTH>>
+class HashedFixedString
+{
+    using CharT = char;
+    using Self = HashedFixedString<MAXIMUM_LENGTH, CheckingType>;
+    using FixedStringType = FixedString<MAXIMUM_LENGTH, CheckingType>;
+
+public:
+    using value_type = typename FixedStringType::value_type;
+    using size_type = typename FixedStringType::size_type;
+    using difference_type = typename FixedStringType::difference_type;
+    using const_pointer = typename FixedStringType::const_pointer;
+    using const_reference = typename FixedStringType::const_reference;
+    using const_iterator = typename FixedStringType::const_iterator;
+    using const_reverse_iterator = typename FixedStringType::const_reverse_iterator;
+
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_LENGTH; }
+
+    [[nodiscard]] static constexpr std::uint64_t hash_of(const std::string_view& view) noexcept
+    {
+        return wyhash::hash<std::string_view>{}(view);
+    }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    FixedStringType IMPLEMENTATION_DETAIL_DO_NOT_USE_string_;
+    std::uint64_t IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_;
+
+public:
+    constexpr HashedFixedString() noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_string_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_{hash_of({})}
+    {
+    }
+
+    constexpr HashedFixedString(
+        const CharT* s,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : HashedFixedString(std::string_view{s}, loc)
+    {
+    }
+
+    explicit(false) constexpr HashedFixedString(
+        const std::string_view& view,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_string_{view, loc}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_{hash_of(view)}
+    {
+    }
+
+    template <customize::SequenceContainerChecking CheckingType2>
+    explicit(false) constexpr HashedFixedString(
+        const FixedString<MAXIMUM_LENGTH, CheckingType2>& str,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+      : HashedFixedString(std::string_view{str}, loc)
+    {
+    }
+
+    [[nodiscard]] constexpr std::uint64_t hash() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_;
+    }
+
+    [[nodiscard]] constexpr const FixedStringType& str() const noexcept { return string(); }
+    explicit(false) constexpr operator std::string_view() const noexcept { return as_view(); }
+
+    [[nodiscard]] constexpr const_reference operator[](size_type i) const noexcept
+    {
+        return string()[i];
+    }
+    [[nodiscard]] constexpr const_reference at(
+        size_type i,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const noexcept
+    {
+        return string().at(i, loc);
+    }
+    constexpr const_reference front(const std_transition::source_location& loc =
+                                        std_transition::source_location::current()) const
+    {
+        return string().front(loc);
+    }
+    constexpr const_reference back(const std_transition::source_location& loc =
+                                       std_transition::source_location::current()) const
+    {
+        return string().back(loc);
+    }
+
+    [[nodiscard]] constexpr const char* data() const noexcept { return string().data(); }
+    [[nodiscard]] constexpr const CharT* c_str() const noexcept { return data(); }
+
+    constexpr const_iterator begin() const noexcept { return cbegin(); }
+    constexpr const_iterator cbegin() const noexcept { return string().cbegin(); }
+    constexpr const_iterator end() const noexcept { return cend(); }
+    constexpr const_iterator cend() const noexcept { return string().cend(); }
+    constexpr const_reverse_iterator rbegin() const noexcept { return crbegin(); }
+    constexpr const_reverse_iterator crbegin() const noexcept { return string().crbegin(); }
+    constexpr const_reverse_iterator rend() const noexcept { return crend(); }
+    constexpr const_reverse_iterator crend() const noexcept { return string().crend(); }
+
+    [[nodiscard]] constexpr bool empty() const noexcept { return string().empty(); }
+    [[nodiscard]] constexpr std::size_t length() const noexcept { return string().length(); }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return length(); }
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+    [[nodiscard]] constexpr std::size_t capacity() const noexcept { return max_size(); }
+
+    constexpr HashedFixedString& assign(
+        const std::string_view& t,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        string().assign(t, loc);
+        rehash();
+        return *this;
+    }
+    constexpr HashedFixedString& assign(
+        size_type count,
+        CharT ch,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        string().assign(count, ch, loc);
+        rehash();
+        return *this;
+    }
+
+    constexpr void clear() noexcept
+    {
+        string().clear();
+        rehash();
+    }
+
+    constexpr void push_back(
+        CharT ch,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        string().push_back(ch, loc);
+        rehash();
+    }
+    constexpr void pop_back(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        string().pop_back(loc);
+        rehash();
+    }
+
+    constexpr HashedFixedString& append(
+        const std::string_view& t,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        string().append(t, loc);
+        rehash();
+        return *this;
+    }
+    constexpr HashedFixedString& append(
+        std::initializer_list<CharT> ilist,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        string().append(ilist, loc);
+        rehash();
+        return *this;
+    }
+    constexpr HashedFixedString& operator+=(CharT ch)
+    {
+        return append({ch}, std_transition::source_location::current());
+    }
+    constexpr HashedFixedString& operator+=(const std::string_view& t)
+    {
+        return append(t, std_transition::source_location::current());
+    }
+
+    constexpr void resize(
+        size_type count,
+        CharT ch = CharT{},
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        string().resize(count, ch, loc);
+        rehash();
+    }
+
+    [[nodiscard]] constexpr int compare(std::string_view view) const
+    {
+        return as_view().compare(view);
+    }
+    [[nodiscard]] constexpr bool starts_with(const std::string_view& prefix) const noexcept
+    {
+        return as_view().starts_with(prefix);
+    }
+    [[nodiscard]] constexpr bool ends_with(const std::string_view& suffix) const noexcept
+    {
+        return as_view().ends_with(suffix);
+    }
+    [[nodiscard]] constexpr std::string_view substr(
+        size_type pos = 0,
+        std::size_t len = MAXIMUM_LENGTH,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        return string().substr(pos, len, loc);
+    }
+
+    // Unequal hashes mean unequal strings, so most mismatches never compare characters.
+    template <std::size_t MAXIMUM_LENGTH_2, customize::SequenceContainerChecking CheckingType2>
+    constexpr bool operator==(
+        const HashedFixedString<MAXIMUM_LENGTH_2, CheckingType2>& other) const noexcept
+    {
+        return hash() == other.hash() && as_view() == std::string_view{other};
+    }
+    constexpr bool operator==(std::string_view view) const noexcept { return as_view() == view; }
+    constexpr bool operator==(const CharT* other) const
+    {
+        return as_view() == std::string_view{other};
+    }
+
+    template <std::size_t MAXIMUM_LENGTH_2, customize::SequenceContainerChecking CheckingType2>
+    constexpr std::strong_ordering operator<=>(
+        const HashedFixedString<MAXIMUM_LENGTH_2, CheckingType2>& other) const noexcept
+    {
+        return as_view() <=> std::string_view{other};
+    }
+    constexpr std::strong_ordering operator<=>(const std::string_view& other) const noexcept
+    {
+        return as_view() <=> other;
+    }
+    constexpr std::strong_ordering operator<=>(const CharT* other) const noexcept
+    {
+        return as_view() <=> std::string_view{other};
+    }
+
+private:
+    constexpr void rehash() noexcept
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_ = hash_of(as_view());
+    }
+
+    [[nodiscard]] constexpr std::string_view as_view() const { return string(); }
+
+    constexpr const FixedStringType& string() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_string_;
+    }
+    constexpr FixedStringType& string() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_string_; }
+};
+
+template <std::size_t MAXIMUM_LENGTH, typename CheckingType>
+std::ostream& operator<<(std::ostream& os,
+                         const HashedFixedString<MAXIMUM_LENGTH, CheckingType>& str)
+{
+    return os << std::string_view{str};
+}
+
+template <std::size_t MAXIMUM_LENGTH, typename CheckingType>
+[[nodiscard]] constexpr bool is_full(const HashedFixedString<MAXIMUM_LENGTH, CheckingType>& c)
+{
+    return c.size() >= c.max_size();
+}
+
+}  // namespace fixed_containers
+
+namespace fixed_containers::wyhash
+{
+template <std::size_t MAXIMUM_LENGTH, customize::SequenceContainerChecking CheckingType>
+struct hash<HashedFixedString<MAXIMUM_LENGTH, CheckingType>>
+{
+    constexpr std::uint64_t operator()(
+        const HashedFixedString<MAXIMUM_LENGTH, CheckingType>& str) const noexcept
+    {
+        return str.hash();
+    }
+};
+}  // namespace fixed_containers::wyhash
+
+// Specializations
+namespace std
+{
+template <std::size_t MAXIMUM_LENGTH,
+          fixed_containers::customize::SequenceContainerChecking CheckingType>
+struct tuple_size<fixed_containers::HashedFixedString<MAXIMUM_LENGTH, CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
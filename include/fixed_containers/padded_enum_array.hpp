@@ -0,0 +1,116 @@
+#pragma once
+
+#include "fixed_containers/cache_line_padded.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/enum_utils.hpp"
+
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <utility>
+
+namespace fixed_containers
+{
+// Like EnumArray, but every element is aligned (and thus padded) to ALIGNMENT bytes, a cache line
+// by default. Intended for per-enum values written by different threads, such as
+// `PaddedEnumArray<Venue, std::atomic<std::uint64_t>>`, where adjacent entries of a plain EnumArray
+// would false-share.
+//
+// Elements are not contiguous, so there are no iterators and no data(). Iterate with `labels()`.
+template <class L, class T, std::size_t ALIGNMENT = CACHE_LINE_SIZE>
+class PaddedEnumArray
+{
+    using EnumAdapterType = rich_enums::EnumAdapter<L>;
+    static constexpr std::size_t ENUM_COUNT = EnumAdapterType::count();
+    using LabelArrayType = std::array<L, ENUM_COUNT>;
+    using PaddedT = CacheLinePadded<T, ALIGNMENT>;
+    using ValueArrayType = std::array<PaddedT, ENUM_COUNT>;
+    static constexpr const LabelArrayType& ENUM_VALUES = EnumAdapterType::values();
+
+public:
+    using label_type = L;
+    using value_type = T;
+    using size_type = typename ValueArrayType::size_type;
+    using difference_type = typename ValueArrayType::difference_type;
+    using reference = T&;
+    using const_reference = const T&;
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    ValueArrayType IMPLEMENTATION_DETAIL_DO_NOT_USE_values_;
+
+public:
+    constexpr PaddedEnumArray() noexcept
+        requires DefaultConstructible<T>
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_values_()
+    {
+    }
+
+    constexpr PaddedEnumArray(std::initializer_list<std::pair<const L, T>> list) noexcept
+        requires DefaultConstructible<T>
+      : PaddedEnumArray()
+    {
+        for (const auto& [label, value] : list)
+        {
+            at(label) = value;
+        }
+    }
+
+public:
+    constexpr reference at(const L& label)
+    {
+        const std::size_t ordinal = EnumAdapterType::ordinal(label);
+        return values().at(ordinal).value;
+    }
+    constexpr const_reference at(const L& label) const
+    {
+        const std::size_t ordinal = EnumAdapterType::ordinal(label);
+        return values().at(ordinal).value;
+    }
+    constexpr reference operator[](const L& label) { return at(label); }
+    constexpr const_reference operator[](const L& label) const { return at(label); }
+
+    [[nodiscard]] constexpr bool empty() const noexcept { return values().empty(); }
+    constexpr size_type size() const noexcept { return values().size(); }
+    constexpr size_type max_size() const noexcept { return values().max_size(); }
+
+    constexpr const LabelArrayType& labels() const noexcept { return ENUM_VALUES; }
+
+    constexpr void fill(const T& value)
+    {
+        for (PaddedT& padded : values())
+        {
+            padded.value = value;
+        }
+    }
+
+    constexpr bool operator==(const PaddedEnumArray& other) const
+    {
+        for (std::size_t i = 0; i < ENUM_COUNT; i++)
+        {
+            if (!(values()[i].value == other.values()[i].value))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    constexpr const ValueArrayType& values() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_values_;
+    }
+    constexpr ValueArrayType& values() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_values_; }
+};
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <typename L, typename T, std::size_t ALIGNMENT>
+struct tuple_size<fixed_containers::PaddedEnumArray<L, T, ALIGNMENT>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "fixed_containers/cache_line_padded.hpp"
+#include "fixed_containers/enum_array.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace fixed_containers::sharded_enum_counter_detail
+{
+// Threads are assigned shards round-robin, in the order they first touch any sharded counter.
+inline std::size_t this_thread_shard_hint() noexcept
+{
+    static std::atomic<std::size_t> NEXT_HINT{0};
+    thread_local const std::size_t HINT = NEXT_HINT.fetch_add(1, std::memory_order_relaxed);
+    return HINT;
+}
+}  // namespace fixed_containers::sharded_enum_counter_detail
+
+namespace fixed_containers
+{
+// Per-enum counters, updated concurrently from many threads.
+//
+// Each shard holds a full EnumArray of counters on its own cache line(s), and each thread
+// increments the shard it is assigned to. With SHARD_COUNT at least the number of writer threads,
+// increments never contend. Reads aggregate across all shards and are thus slower; they are
+// intended for periodic reporting rather than the hot path.
+template <class L, std::size_t SHARD_COUNT, class CounterType = std::uint64_t>
+    requires(SHARD_COUNT > 0)
+class ShardedEnumCounter
+{
+    using AtomicCounterType = std::atomic<CounterType>;
+    using ShardType = CacheLinePadded<EnumArray<L, AtomicCounterType>>;
+
+public:
+    using label_type = L;
+    using value_type = CounterType;
+
+public:
+    [[nodiscard]] static constexpr std::size_t shard_count() noexcept { return SHARD_COUNT; }
+
+private:
+    std::array<ShardType, SHARD_COUNT> shards_;
+
+public:
+    ShardedEnumCounter() noexcept
+      : shards_{}
+    {
+    }
+
+    ShardedEnumCounter(const ShardedEnumCounter&) = delete;
+    ShardedEnumCounter(ShardedEnumCounter&&) noexcept = delete;
+    ShardedEnumCounter& operator=(const ShardedEnumCounter&) = delete;
+    ShardedEnumCounter& operator=(ShardedEnumCounter&&) noexcept = delete;
+    ~ShardedEnumCounter() = default;
+
+public:
+    void increment(const L& label, const CounterType n = 1) noexcept
+    {
+        increment_shard(this_thread_shard_index(), label, n);
+    }
+
+    // For callers that manage their own thread-to-shard assignment (e.g. worker ids).
+    void increment_shard(const std::size_t shard_index,
+                         const L& label,
+                         const CounterType n = 1) noexcept
+    {
+        shards_.at(shard_index).value.at(label).fetch_add(n, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] CounterType load(const L& label) const noexcept
+    {
+        CounterType out{};
+        for (const ShardType& shard : shards_)
+        {
+            out += shard.value.at(label).load(std::memory_order_relaxed);
+        }
+        return out;
+    }
+
+    // Not an atomic snapshot across labels: concurrent increments may be partially included.
+    [[nodiscard]] EnumArray<L, CounterType> load_all() const noexcept
+    {
+        EnumArray<L, CounterType> out{};
+        for (const ShardType& shard : shards_)
+        {
+            for (const L& label : shard.value.labels())
+            {
+                out.at(label) += shard.value.at(label).load(std::memory_order_relaxed);
+            }
+        }
+        return out;
+    }
+
+    void reset() noexcept
+    {
+        for (ShardType& shard : shards_)
+        {
+            for (AtomicCounterType& counter : shard.value)
+            {
+                counter.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    [[nodiscard]] static std::size_t this_thread_shard_index() noexcept
+    {
+        return sharded_enum_counter_detail::this_thread_shard_hint() % SHARD_COUNT;
+    }
+};
+
+}  // namespace fixed_containers
@@ -0,0 +1,673 @@
+#pragma once
+
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/max_size.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers::sort_detail
+{
+inline constexpr std::size_t SORTING_NETWORK_MAX_SIZE = 32;
+
+// pdqsort tuning, as in the reference implementation
+inline constexpr std::ptrdiff_t INSERTION_SORT_THRESHOLD = 24;
+inline constexpr std::ptrdiff_t NINTHER_THRESHOLD = 128;
+inline constexpr std::size_t PARTIAL_INSERTION_SORT_LIMIT = 8;
+
+// Below this, pdqsort beats the radix sort's fixed cost of histogramming and prefix sums.
+inline constexpr std::size_t RADIX_SORT_MIN_SIZE = 256;
+// `sort()` only picks the radix sort when its inline scratch space is at most this large, so as to
+// not overflow the stack. `radix_sort()` accepts caller-provided scratch space for larger sizes.
+inline constexpr std::size_t MAX_INLINE_SCRATCH_BYTES = 64 * 1024;
+
+template <class Compare, class T>
+concept IsDefaultLess = std::same_as<Compare, std::less<>> || std::same_as<Compare, std::less<T>> ||
+                        std::same_as<Compare, std::ranges::less>;
+
+template <class Compare, class T>
+constexpr void compare_exchange(T& lhs, T& rhs, Compare& comp)
+{
+    if constexpr (std::is_arithmetic_v<T> && IsDefaultLess<Compare, T>)
+    {
+        // Compiles to min/max or conditional moves
+        const T lo = rhs < lhs ? rhs : lhs;
+        const T hi = rhs < lhs ? lhs : rhs;
+        lhs = lo;
+        rhs = hi;
+    }
+    else if constexpr (std::is_trivially_copyable_v<T> && sizeof(T) <= 2 * sizeof(void*))
+    {
+        const bool should_swap = comp(rhs, lhs);
+        const T first = lhs;
+        const T second = rhs;
+        lhs = should_swap ? second : first;
+        rhs = should_swap ? first : second;
+    }
+    else if (comp(rhs, lhs))
+    {
+        using std::swap;
+        swap(lhs, rhs);
+    }
+}
+
+struct NetworkComparator
+{
+    std::uint8_t lo;
+    std::uint8_t hi;
+};
+
+// Batcher's odd-even merge sort network for the next power of two, with all comparators that
+// touch an index >= `n` dropped. That is equivalent to padding the input with +infinity, which
+// those comparators would never move, so the pruned network sorts `n` elements.
+template <class Func>
+constexpr void for_each_batcher_comparator(const std::size_t n, Func&& func)
+{
+    const std::size_t padded = std::bit_ceil(n);
+    for (std::size_t p = 1; p < padded; p *= 2)
+    {
+        for (std::size_t k = p; k >= 1; k /= 2)
+        {
+            for (std::size_t j = k % p; j + k < padded; j += 2 * k)
+            {
+                for (std::size_t i = 0; i < k && i + j + k < n; i++)
+                {
+                    if ((i + j) / (2 * p) == (i + j + k) / (2 * p))
+                    {
+                        func(i + j, i + j + k);
+                    }
+                }
+            }
+        }
+    }
+}
+
+constexpr std::size_t batcher_network_size(const std::size_t n)
+{
+    std::size_t out = 0;
+    for_each_batcher_comparator(n, [&out](std::size_t /*lo*/, std::size_t /*hi*/) { out++; });
+    return out;
+}
+
+template <std::size_t N>
+inline constexpr auto BATCHER_NETWORK = []()
+{
+    std::array<NetworkComparator, batcher_network_size(N)> out{};
+    std::size_t count = 0;
+    for_each_batcher_comparator(N,
+                                [&](const std::size_t lo, const std::size_t hi)
+                                {
+                                    out.at(count) = {static_cast<std::uint8_t>(lo),
+                                                     static_cast<std::uint8_t>(hi)};
+                                    count++;
+                                });
+    return out;
+}();
+
+// Fully unrolled. Only instantiated for the few power-of-two sizes used by padded_network_sort().
+template <std::size_t N, class It, class Compare>
+constexpr void unrolled_network_sort(It first, Compare& comp)
+{
+    constexpr const auto& NETWORK = BATCHER_NETWORK<N>;
+    [&]<std::size_t... IS>(std::index_sequence<IS...>)
+    {
+        (compare_exchange(first[NETWORK[IS].lo], first[NETWORK[IS].hi], comp), ...);
+    }(std::make_index_sequence<NETWORK.size()>{});
+}
+
+template <std::size_t N, class It, class Compare>
+constexpr void network_sort(It first, Compare& comp)
+{
+    for (const NetworkComparator& comparator : BATCHER_NETWORK<N>)
+    {
+        compare_exchange(first[comparator.lo], first[comparator.hi], comp);
+    }
+}
+
+// Sorts a local copy padded to N elements with the largest value, which the compiler can keep in
+// registers while running the branchless, unrolled network.
+template <std::size_t N, class It, class Compare>
+constexpr void padded_network_sort(It first, const std::size_t n, Compare& comp)
+{
+    using T = std::iter_value_t<It>;
+    constexpr T PADDING = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                               : std::numeric_limits<T>::max();
+    std::array<T, N> values{};
+    for (std::size_t i = 0; i < N; i++)
+    {
+        values[i] = i < n ? first[static_cast<std::ptrdiff_t>(i)] : PADDING;
+    }
+    unrolled_network_sort<N>(values.begin(), comp);
+    for (std::size_t i = 0; i < n; i++)
+    {
+        first[static_cast<std::ptrdiff_t>(i)] = values[i];
+    }
+}
+
+// Sorts n <= MAXIMUM_N elements with a sorting network.
+// Arithmetic elements in the default order are padded to the next power of two, so that only
+// log2(MAXIMUM_N) networks are instantiated. Otherwise, the network for exactly n elements is used.
+template <std::size_t MAXIMUM_N, class It, class Compare>
+constexpr void sorting_network_sort_dispatch(It first, const std::size_t n, Compare& comp)
+{
+    using T = std::iter_value_t<It>;
+    if (n <= 1)
+    {
+        return;
+    }
+    if constexpr (std::is_arithmetic_v<T> && IsDefaultLess<Compare, T>)
+    {
+        [&]<std::size_t... LOG2_SIZES>(std::index_sequence<LOG2_SIZES...>)
+        {
+            (void)((n <= (std::size_t{1} << LOG2_SIZES) &&
+                    (padded_network_sort<(std::size_t{1} << LOG2_SIZES)>(first, n, comp), true)) ||
+                   ...);
+        }(std::make_index_sequence<std::bit_width(std::bit_ceil(MAXIMUM_N))>{});
+    }
+    else
+    {
+        [&]<std::size_t... NS>(std::index_sequence<NS...>)
+        {
+            (void)((n == NS && (network_sort<NS>(first, comp), true)) || ...);
+        }(std::make_index_sequence<MAXIMUM_N + 1>{});
+    }
+}
+
+// pdqsort, following Orson Peters' reference implementation (branchy partitioning variant)
+template <class It, class Compare>
+constexpr void insertion_sort(It begin, It end, Compare& comp)
+{
+    if (begin == end)
+    {
+        return;
+    }
+    for (It cur = begin + 1; cur != end; ++cur)
+    {
+        It sift = cur;
+        It sift_1 = cur - 1;
+        if (comp(*sift, *sift_1))
+        {
+            std::iter_value_t<It> tmp = std::move(*sift);
+            do
+            {
+                *sift-- = std::move(*sift_1);
+            } while (sift != begin && comp(tmp, *--sift_1));
+            *sift = std::move(tmp);
+        }
+    }
+}
+
+// Requires an element before `begin` that is not greater than any element in the range.
+template <class It, class Compare>
+constexpr void unguarded_insertion_sort(It begin, It end, Compare& comp)
+{
+    if (begin == end)
+    {
+        return;
+    }
+    for (It cur = begin + 1; cur != end; ++cur)
+    {
+        It sift = cur;
+        It sift_1 = cur - 1;
+        if (comp(*sift, *sift_1))
+        {
+            std::iter_value_t<It> tmp = std::move(*sift);
+            do
+            {
+                *sift-- = std::move(*sift_1);
+            } while (comp(tmp, *--sift_1));
+            *sift = std::move(tmp);
+        }
+    }
+}
+
+// Returns false, leaving the range partially sorted, if more than
+// PARTIAL_INSERTION_SORT_LIMIT elements would have to be moved.
+template <class It, class Compare>
+constexpr bool partial_insertion_sort(It begin, It end, Compare& comp)
+{
+    if (begin == end)
+    {
+        return true;
+    }
+    std::size_t limit = 0;
+    for (It cur = begin + 1; cur != end; ++cur)
+    {
+        It sift = cur;
+        It sift_1 = cur - 1;
+        if (comp(*sift, *sift_1))
+        {
+            std::iter_value_t<It> tmp = std::move(*sift);
+            do
+            {
+                *sift-- = std::move(*sift_1);
+            } while (sift != begin && comp(tmp, *--sift_1));
+            *sift = std::move(tmp);
+            limit += static_cast<std::size_t>(cur - sift);
+        }
+        if (limit > PARTIAL_INSERTION_SORT_LIMIT)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <class It, class Compare>
+constexpr void sort2(It a, It b, Compare& comp)
+{
+    if (comp(*b, *a))
+    {
+        std::iter_swap(a, b);
+    }
+}
+
+template <class It, class Compare>
+constexpr void sort3(It a, It b, It c, Compare& comp)
+{
+    sort2(a, b, comp);
+    sort2(b, c, comp);
+    sort2(a, b, comp);
+}
+
+template <class It>
+struct PartitionResult
+{
+    It pivot_position;
+    bool was_already_partitioned;
+};
+
+// Partitions around the pivot *begin. Elements equal to the pivot go to the right.
+template <class It, class Compare>
+constexpr PartitionResult<It> partition_right(It begin, It end, Compare& comp)
+{
+    std::iter_value_t<It> pivot = std::move(*begin);
+    It first = begin;
+    It last = end;
+
+    // Guarded by the median-of-3 pivot selection
+    while (comp(*++first, pivot))
+    {
+    }
+    if (first - 1 == begin)
+    {
+        while (first < last && !comp(*--last, pivot))
+        {
+        }
+    }
+    else
+    {
+        while (!comp(*--last, pivot))
+        {
+        }
+    }
+
+    const bool was_already_partitioned = first >= last;
+    while (first < last)
+    {
+        std::iter_swap(first, last);
+        while (comp(*++first, pivot))
+        {
+        }
+        while (!comp(*--last, pivot))
+        {
+        }
+    }
+
+    It pivot_position = first - 1;
+    *begin = std::move(*pivot_position);
+    *pivot_position = std::move(pivot);
+    return {pivot_position, was_already_partitioned};
+}
+
+// Partitions around the pivot *begin. Elements equal to the pivot go to the left. Used when the
+// pivot equals the element preceding the range, which makes the left partition all-equal.
+template <class It, class Compare>
+constexpr It partition_left(It begin, It end, Compare& comp)
+{
+    std::iter_value_t<It> pivot = std::move(*begin);
+    It first = begin;
+    It last = end;
+
+    while (comp(pivot, *--last))
+    {
+    }
+    if (last + 1 == end)
+    {
+        while (first < last && !comp(pivot, *++first))
+        {
+        }
+    }
+    else
+    {
+        while (!comp(pivot, *++first))
+        {
+        }
+    }
+
+    while (first < last)
+    {
+        std::iter_swap(first, last);
+        while (comp(pivot, *--last))
+        {
+        }
+        while (!comp(pivot, *++first))
+        {
+        }
+    }
+
+    It pivot_position = last;
+    *begin = std::move(*pivot_position);
+    *pivot_position = std::move(pivot);
+    return pivot_position;
+}
+
+// Breaks patterns that could cause repeated unbalanced partitions.
+template <class It>
+constexpr void shuffle_partition_ends(It begin, It end, const std::ptrdiff_t size)
+{
+    std::iter_swap(begin, begin + size / 4);
+    std::iter_swap(end - 1, end - size / 4);
+    if (size > NINTHER_THRESHOLD)
+    {
+        std::iter_swap(begin + 1, begin + (size / 4 + 1));
+        std::iter_swap(begin + 2, begin + (size / 4 + 2));
+        std::iter_swap(end - 2, end - (size / 4 + 1));
+        std::iter_swap(end - 3, end - (size / 4 + 2));
+    }
+}
+
+template <class It, class Compare>
+constexpr void pdqsort_loop(It begin, It end, Compare& comp, int bad_allowed, bool leftmost)
+{
+    while (true)
+    {
+        const std::ptrdiff_t size = end - begin;
+        if (size < INSERTION_SORT_THRESHOLD)
+        {
+            if (leftmost)
+            {
+                insertion_sort(begin, end, comp);
+            }
+            else
+            {
+                unguarded_insertion_sort(begin, end, comp);
+            }
+            return;
+        }
+
+        // Median of 3, or pseudomedian of 9 for large ranges, moved to *begin
+        const std::ptrdiff_t s2 = size / 2;
+        if (size > NINTHER_THRESHOLD)
+        {
+            sort3(begin, begin + s2, end - 1, comp);
+            sort3(begin + 1, begin + (s2 - 1), end - 2, comp);
+            sort3(begin + 2, begin + (s2 + 1), end - 3, comp);
+            sort3(begin + (s2 - 1), begin + s2, begin + (s2 + 1), comp);
+            std::iter_swap(begin, begin + s2);
+        }
+        else
+        {
+            sort3(begin + s2, begin, end - 1, comp);
+        }
+
+        // If the pivot equals the preceding element, everything equal to it can be skipped
+        if (!leftmost && !comp(*(begin - 1), *begin))
+        {
+            begin = partition_left(begin, end, comp) + 1;
+            continue;
+        }
+
+        const auto [pivot_position, was_already_partitioned] = partition_right(begin, end, comp);
+        const std::ptrdiff_t l_size = pivot_position - begin;
+        const std::ptrdiff_t r_size = end - (pivot_position + 1);
+        const bool highly_unbalanced = l_size < size / 8 || r_size < size / 8;
+
+        if (highly_unbalanced)
+        {
+            // Too many bad partitions: fall back to the guaranteed O(n log n) heapsort
+            if (--bad_allowed == 0)
+            {
+                std::make_heap(begin, end, comp);
+                std::sort_heap(begin, end, comp);
+                return;
+            }
+            if (l_size >= INSERTION_SORT_THRESHOLD)
+            {
+                shuffle_partition_ends(begin, pivot_position, l_size);
+            }
+            if (r_size >= INSERTION_SORT_THRESHOLD)
+            {
+                shuffle_partition_ends(pivot_position + 1, end, r_size);
+            }
+        }
+        else if (was_already_partitioned &&
+                 partial_insertion_sort(begin, pivot_position, comp) &&
+                 partial_insertion_sort(pivot_position + 1, end, comp))
+        {
+            // Likely already (nearly) sorted input
+            return;
+        }
+
+        pdqsort_loop(begin, pivot_position, comp, bad_allowed, leftmost);
+        begin = pivot_position + 1;
+        leftmost = false;
+    }
+}
+
+template <class It, class Compare>
+constexpr void pdqsort(It begin, It end, Compare& comp)
+{
+    const auto size = static_cast<std::size_t>(end - begin);
+    pdqsort_loop(begin, end, comp, std::bit_width(size), true);
+}
+
+// Radix sort
+template <class K>
+concept RadixSortableKey =
+    (std::integral<K> && !std::same_as<K, bool>) ||
+    (std::floating_point<K> && (sizeof(K) == sizeof(std::uint32_t) ||
+                                sizeof(K) == sizeof(std::uint64_t)));
+
+template <class K>
+using RadixKeyBits = std::make_unsigned_t<std::conditional_t<
+    std::floating_point<K>,
+    std::conditional_t<sizeof(K) == sizeof(std::uint32_t), std::int32_t, std::int64_t>,
+    K>>;
+
+// Maps a key to unsigned bits that compare, as unsigned integers, in the order of the keys.
+template <RadixSortableKey K>
+constexpr RadixKeyBits<K> to_radix_key_bits(const K key)
+{
+    using U = RadixKeyBits<K>;
+    constexpr U SIGN_BIT = static_cast<U>(U{1} << (sizeof(U) * 8 - 1));
+    if constexpr (std::unsigned_integral<K>)
+    {
+        return key;
+    }
+    else if constexpr (std::signed_integral<K>)
+    {
+        return static_cast<U>(static_cast<U>(key) ^ SIGN_BIT);
+    }
+    else
+    {
+        // Negative floats are ordered in reverse by their magnitude bits
+        const U bits = std::bit_cast<U>(key);
+        return (bits & SIGN_BIT) != 0 ? static_cast<U>(~bits) : static_cast<U>(bits | SIGN_BIT);
+    }
+}
+
+// Stable LSD radix sort with 8-bit digits. Digits that are the same for every element are skipped.
+template <class It, class ScratchIt, class KeyExtractor>
+constexpr void radix_sort_impl(It first, const std::size_t n, ScratchIt scratch, KeyExtractor& key)
+{
+    using K = std::remove_cvref_t<std::invoke_result_t<KeyExtractor&, std::iter_reference_t<It>>>;
+    using U = RadixKeyBits<K>;
+    constexpr std::size_t DIGIT_COUNT = sizeof(U);
+    constexpr std::size_t BUCKET_COUNT = 256;
+
+    if (n <= 1)
+    {
+        return;
+    }
+
+    const auto digit_of = [&key](auto&& value, const std::size_t digit) -> std::size_t
+    {
+        const U bits = to_radix_key_bits(std::invoke(key, value));
+        return static_cast<std::size_t>((bits >> (digit * 8)) & 0xFF);
+    };
+
+    std::array<std::array<std::size_t, BUCKET_COUNT>, DIGIT_COUNT> histograms{};
+    for (std::size_t i = 0; i < n; i++)
+    {
+        const U bits = to_radix_key_bits(std::invoke(key, first[i]));
+        for (std::size_t digit = 0; digit < DIGIT_COUNT; digit++)
+        {
+            histograms[digit][static_cast<std::size_t>((bits >> (digit * 8)) & 0xFF)]++;
+        }
+    }
+
+    const auto scatter = [&](auto source, auto destination, const std::size_t digit)
+    {
+        std::array<std::size_t, BUCKET_COUNT> offsets{};
+        std::size_t sum = 0;
+        for (std::size_t bucket = 0; bucket < BUCKET_COUNT; bucket++)
+        {
+            offsets[bucket] = sum;
+            sum += histograms[digit][bucket];
+        }
+        for (std::size_t i = 0; i < n; i++)
+        {
+            destination[offsets[digit_of(source[i], digit)]++] = std::move(source[i]);
+        }
+    };
+
+    // Computed before elements are moved from
+    const U first_bits = to_radix_key_bits(std::invoke(key, first[0]));
+    bool is_in_scratch = false;
+    for (std::size_t digit = 0; digit < DIGIT_COUNT; digit++)
+    {
+        if (histograms[digit][static_cast<std::size_t>((first_bits >> (digit * 8)) & 0xFF)] == n)
+        {
+            continue;
+        }
+        if (is_in_scratch)
+        {
+            scatter(scratch, first, digit);
+        }
+        else
+        {
+            scatter(first, scratch, digit);
+        }
+        is_in_scratch = !is_in_scratch;
+    }
+
+    if (is_in_scratch)
+    {
+        std::move(scratch, scratch + static_cast<std::ptrdiff_t>(n), first);
+    }
+}
+}  // namespace fixed_containers::sort_detail
+
+namespace fixed_containers
+{
+template <class Container>
+concept FixedSortableContainer = requires(Container& c) {
+    max_size<Container>::value;
+    { c.begin() } -> std::random_access_iterator;
+    { c.end() } -> std::random_access_iterator;
+};
+
+template <class Container, class KeyExtractor>
+concept RadixSortableBy = std::invocable<KeyExtractor&, typename Container::reference> &&
+                          sort_detail::RadixSortableKey<std::remove_cvref_t<
+                              std::invoke_result_t<KeyExtractor&, typename Container::reference>>>;
+
+// Unstable sort that is constexpr and allocation-free.
+// Ranges of up to 32 elements are sorted with a sorting network, larger ones with pdqsort.
+template <std::random_access_iterator It, class Compare = std::less<>>
+constexpr void sort(It first, It last, Compare comp = {})
+{
+    const auto n = static_cast<std::size_t>(last - first);
+    if (n <= sort_detail::SORTING_NETWORK_MAX_SIZE)
+    {
+        sort_detail::sorting_network_sort_dispatch<sort_detail::SORTING_NETWORK_MAX_SIZE>(
+            first, n, comp);
+        return;
+    }
+    sort_detail::pdqsort(first, last, comp);
+}
+
+// Unstable sort for FixedVector, FixedDeque, EnumArray and other containers with a compile-time
+// capacity, which is used to pick the algorithm:
+// - Sorting networks for sizes up to 32, instantiated only up to the capacity.
+// - LSD radix sort for integral and floating point elements in the default order, if the inline
+//   scratch space it needs for the capacity is small enough.
+// - pdqsort otherwise.
+template <FixedSortableContainer Container, class Compare = std::less<>>
+constexpr void sort(Container& container, Compare comp = {})
+{
+    using T = typename Container::value_type;
+    constexpr std::size_t CAPACITY = max_size_v<Container>;
+    const std::size_t n = container.size();
+
+    if constexpr (sort_detail::IsDefaultLess<Compare, T> && sort_detail::RadixSortableKey<T> &&
+                  CAPACITY >= sort_detail::RADIX_SORT_MIN_SIZE &&
+                  CAPACITY * sizeof(T) <= sort_detail::MAX_INLINE_SCRATCH_BYTES)
+    {
+        if (n >= sort_detail::RADIX_SORT_MIN_SIZE)
+        {
+            FixedVector<T, CAPACITY> scratch{};
+            scratch.resize(n);
+            std::identity key{};
+            sort_detail::radix_sort_impl(container.begin(), n, scratch.begin(), key);
+            return;
+        }
+    }
+
+    if constexpr (CAPACITY <= sort_detail::SORTING_NETWORK_MAX_SIZE)
+    {
+        sort_detail::sorting_network_sort_dispatch<CAPACITY>(container.begin(), n, comp);
+    }
+    else
+    {
+        fixed_containers::sort(container.begin(), container.end(), comp);
+    }
+}
+
+// Stable radix sort by an integral or floating point key, e.g. a member pointer.
+// The scratch space is a FixedVector of the container's capacity, so it lives on the stack. For
+// large capacities use the overload that takes the scratch space.
+template <FixedSortableContainer Container, class KeyExtractor = std::identity>
+    requires RadixSortableBy<Container, KeyExtractor>
+constexpr void radix_sort(Container& container, KeyExtractor key = {})
+{
+    FixedVector<typename Container::value_type, max_size_v<Container>> scratch{};
+    radix_sort(container, scratch, key);
+}
+
+template <FixedSortableContainer Container,
+          std::size_t SCRATCH_MAXIMUM_SIZE,
+          class KeyExtractor = std::identity>
+    requires RadixSortableBy<Container, KeyExtractor> &&
+             (SCRATCH_MAXIMUM_SIZE >= max_size_v<Container>)
+constexpr void radix_sort(
+    Container& container,
+    FixedVector<typename Container::value_type, SCRATCH_MAXIMUM_SIZE>& scratch,
+    KeyExtractor key = {})
+{
+    const std::size_t n = container.size();
+    scratch.resize(n);
+    sort_detail::radix_sort_impl(container.begin(), n, scratch.begin(), key);
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/sort.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+
+namespace fixed_containers::string_key_arena_detail
+{
+// Location of a string's characters in a StringKeyArena
+struct ArenaSpan
+{
+    std::uint32_t offset;
+    std::uint32_t length;
+};
+
+/**
+ * Contiguous storage for the characters of variable-length string keys, so containers can store
+ * an 8-byte ArenaSpan per key instead of sizing every key for the longest one.
+ *
+ * Appending is a bump of the end offset. Releasing a span only accounts for its bytes; they are
+ * reclaimed by compact(), which the owning container calls when an append would otherwise not
+ * fit. Each compaction reclaims everything released so far, so its cost is amortized over the
+ * erases that made it necessary.
+ */
+template <std::size_t MAXIMUM_BYTE_COUNT>
+    requires(MAXIMUM_BYTE_COUNT <= std::numeric_limits<std::uint32_t>::max())
+class StringKeyArena
+{
+    std::array<char, MAXIMUM_BYTE_COUNT> bytes_;
+    std::size_t end_;
+    std::size_t released_;
+
+public:
+    constexpr StringKeyArena() noexcept
+      : bytes_{}
+      , end_{0}
+      , released_{0}
+    {
+    }
+
+    [[nodiscard]] constexpr const char* data() const noexcept { return bytes_.data(); }
+    [[nodiscard]] constexpr std::string_view view(const ArenaSpan& span) const noexcept
+    {
+        return {bytes_.data() + span.offset, span.length};
+    }
+
+    // Bytes of spans that have not been released
+    [[nodiscard]] constexpr std::size_t live_byte_count() const noexcept
+    {
+        return end_ - released_;
+    }
+    // Bytes of released spans, not yet reclaimed by compact()
+    [[nodiscard]] constexpr std::size_t released_byte_count() const noexcept { return released_; }
+
+    [[nodiscard]] constexpr bool can_append(const std::size_t length) const noexcept
+    {
+        return length <= MAXIMUM_BYTE_COUNT - end_;
+    }
+    [[nodiscard]] constexpr bool can_append_after_compaction(
+        const std::size_t length) const noexcept
+    {
+        return length <= MAXIMUM_BYTE_COUNT - live_byte_count();
+    }
+
+    constexpr ArenaSpan append(const std::string_view str) noexcept
+    {
+        assert_or_abort(can_append(str.size()));
+        const ArenaSpan span{static_cast<std::uint32_t>(end_),
+                             static_cast<std::uint32_t>(str.size())};
+        std::copy(str.begin(), str.end(), bytes_.begin() + static_cast<std::ptrdiff_t>(end_));
+        end_ += str.size();
+        return span;
+    }
+
+    constexpr void release(const ArenaSpan& span) noexcept { released_ += span.length; }
+
+    // Slides the characters of `live_spans`, which must be all the spans that have not been
+    // released, to the front of the arena and updates their offsets. Reorders `live_spans`.
+    template <std::size_t MAXIMUM_SPAN_COUNT>
+    constexpr void compact(FixedVector<ArenaSpan*, MAXIMUM_SPAN_COUNT>& live_spans) noexcept
+    {
+        // In offset order, every destination is at or before its source, so a forward copy never
+        // overwrites characters that have yet to be moved.
+        sort(live_spans, [](const ArenaSpan* lhs, const ArenaSpan* rhs)
+             { return lhs->offset < rhs->offset; });
+        std::size_t cursor = 0;
+        for (ArenaSpan* span : live_spans)
+        {
+            const auto source = bytes_.begin() + static_cast<std::ptrdiff_t>(span->offset);
+            std::copy(source,
+                      source + static_cast<std::ptrdiff_t>(span->length),
+                      bytes_.begin() + static_cast<std::ptrdiff_t>(cursor));
+            span->offset = static_cast<std::uint32_t>(cursor);
+            cursor += span->length;
+        }
+        assert_or_abort(cursor == live_byte_count());
+        end_ = cursor;
+        released_ = 0;
+    }
+
+    constexpr void clear() noexcept
+    {
+        end_ = 0;
+        released_ = 0;
+    }
+};
+}  // namespace fixed_containers::string_key_arena_detail
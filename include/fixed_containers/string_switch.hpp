@@ -0,0 +1,230 @@
+#pragma once
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/string_literal.hpp"
+#include "fixed_containers/wyhash.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+
+namespace fixed_containers::string_switch_detail
+{
+template <std::size_t CASE_COUNT>
+using IndexType = std::conditional_t<(CASE_COUNT < std::numeric_limits<std::uint8_t>::max()),
+                                     std::uint8_t,
+                                     std::uint16_t>;
+
+// Displacements tried per bucket before construction gives up
+inline constexpr std::size_t MAXIMUM_DISPLACEMENT = std::numeric_limits<std::uint16_t>::max();
+
+[[nodiscard]] constexpr std::uint64_t hash(const std::string_view& token) noexcept
+{
+    return wyhash::hash<std::string_view>{}(token);
+}
+
+// The low bits of the hash pick the slot (after mixing), so buckets use the high bits.
+template <std::size_t BUCKET_COUNT>
+[[nodiscard]] constexpr std::size_t bucket_of(const std::uint64_t hash) noexcept
+{
+    return static_cast<std::size_t>((hash >> 32U) % BUCKET_COUNT);
+}
+
+template <std::size_t SLOT_COUNT>
+[[nodiscard]] constexpr std::size_t slot_of(const std::uint64_t hash,
+                                            const std::uint16_t displacement) noexcept
+{
+    static_assert(std::has_single_bit(SLOT_COUNT));
+    constexpr std::uint64_t DISPLACEMENT_MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+    const std::uint64_t mixed =
+        wyhash_detail::mix(hash, DISPLACEMENT_MULTIPLIER * (std::uint64_t{displacement} + 1));
+    return static_cast<std::size_t>(mixed & (SLOT_COUNT - 1));
+}
+}  // namespace fixed_containers::string_switch_detail
+
+namespace fixed_containers
+{
+/**
+ * Constant-time dispatch on a string token against a compile-time list of cases, replacing
+ * if/else chains of string compares.
+ *
+ * Construction is consteval and builds a perfect hash ("hash and displace"): cases are grouped
+ * into buckets by their wyhash, and each bucket stores the displacement that sends all of its
+ * cases to otherwise unused slots. A lookup is one hash, two array reads and a single verifying
+ * compare, regardless of the number of cases. Duplicate cases and unresolvable collisions fail to
+ * compile.
+ *
+ * ```
+ * static constexpr StringSwitch MESSAGE_TYPES{"NEW", "CANCEL", "REPLACE"};
+ * switch (MESSAGE_TYPES.find(token))
+ * {
+ * case MESSAGE_TYPES.case_index("NEW"): ...
+ * case MESSAGE_TYPES.case_index("CANCEL"): ...
+ * case MESSAGE_TYPES.case_index("REPLACE"): ...
+ * case MESSAGE_TYPES.NOT_FOUND: ...
+ * }
+ * ```
+ */
+template <std::size_t CASE_COUNT>
+    requires(CASE_COUNT > 0 && CASE_COUNT < std::numeric_limits<std::uint16_t>::max())
+class StringSwitch
+{
+    using IndexType = string_switch_detail::IndexType<CASE_COUNT>;
+    static constexpr std::size_t BUCKET_COUNT = (CASE_COUNT + 1) / 2;
+    // At most half full, so displacements are found after a handful of attempts
+    static constexpr std::size_t SLOT_COUNT = std::bit_ceil(CASE_COUNT) * 2;
+    static constexpr IndexType EMPTY_SLOT = static_cast<IndexType>(CASE_COUNT);
+
+public:
+    // Returned by find() for tokens that are not a case
+    static constexpr std::size_t NOT_FOUND = CASE_COUNT;
+
+private:
+    std::array<StringLiteral, CASE_COUNT> cases_;
+    std::array<std::uint16_t, BUCKET_COUNT> displacements_;
+    std::array<IndexType, SLOT_COUNT> slots_;
+
+public:
+    template <typename... Cases>
+        requires(sizeof...(Cases) == CASE_COUNT)
+    consteval StringSwitch(const Cases&... cases) noexcept
+      : cases_{StringLiteral{cases}...}
+      , displacements_{}
+      , slots_{}
+    {
+        build();
+    }
+
+    [[nodiscard]] static constexpr std::size_t size() noexcept { return CASE_COUNT; }
+    [[nodiscard]] constexpr const std::array<StringLiteral, CASE_COUNT>& cases() const noexcept
+    {
+        return cases_;
+    }
+    [[nodiscard]] constexpr const StringLiteral& operator[](const std::size_t i) const noexcept
+    {
+        return cases_.at(i);
+    }
+
+    // Index of the case equal to `token`, or NOT_FOUND
+    [[nodiscard]] constexpr std::size_t find(const std::string_view& token) const noexcept
+    {
+        const std::uint64_t hash = string_switch_detail::hash(token);
+        const std::uint16_t displacement =
+            displacements_[string_switch_detail::bucket_of<BUCKET_COUNT>(hash)];
+        const IndexType index =
+            slots_[string_switch_detail::slot_of<SLOT_COUNT>(hash, displacement)];
+        if (index != EMPTY_SLOT && cases_[index].as_view() == token)
+        {
+            return index;
+        }
+        return NOT_FOUND;
+    }
+
+    [[nodiscard]] constexpr bool contains(const std::string_view& token) const noexcept
+    {
+        return find(token) != NOT_FOUND;
+    }
+
+    // For `case` labels: a token that is not a case fails to compile
+    [[nodiscard]] consteval std::size_t case_index(const std::string_view& token) const noexcept
+    {
+        const std::size_t index = find(token);
+        assert_or_abort(index != NOT_FOUND);
+        return index;
+    }
+
+private:
+    consteval void build() noexcept
+    {
+        std::array<std::uint64_t, CASE_COUNT> hashes{};
+        std::array<std::size_t, CASE_COUNT> buckets{};
+        std::array<std::size_t, BUCKET_COUNT> bucket_sizes{};
+        for (std::size_t i = 0; i < CASE_COUNT; i++)
+        {
+            for (std::size_t j = 0; j < i; j++)
+            {
+                // Duplicate case
+                assert_or_abort(cases_[i].as_view() != cases_[j].as_view());
+            }
+            hashes[i] = string_switch_detail::hash(cases_[i].as_view());
+            buckets[i] = string_switch_detail::bucket_of<BUCKET_COUNT>(hashes[i]);
+            bucket_sizes[buckets[i]]++;
+        }
+
+        // Place the largest buckets first, while most slots are still free
+        std::array<IndexType, CASE_COUNT> order{};
+        for (std::size_t i = 0; i < CASE_COUNT; i++)
+        {
+            order[i] = static_cast<IndexType>(i);
+        }
+        std::sort(order.begin(),
+                  order.end(),
+                  [&](const IndexType lhs, const IndexType rhs)
+                  {
+                      if (bucket_sizes[buckets[lhs]] != bucket_sizes[buckets[rhs]])
+                      {
+                          return bucket_sizes[buckets[lhs]] > bucket_sizes[buckets[rhs]];
+                      }
+                      return buckets[lhs] < buckets[rhs];
+                  });
+
+        slots_.fill(EMPTY_SLOT);
+        std::size_t group_begin = 0;
+        while (group_begin < CASE_COUNT)
+        {
+            const std::size_t bucket = buckets[order[group_begin]];
+            const std::size_t group_end = group_begin + bucket_sizes[bucket];
+            displacements_[bucket] = find_displacement(hashes, order, group_begin, group_end);
+            for (std::size_t k = group_begin; k < group_end; k++)
+            {
+                slots_[string_switch_detail::slot_of<SLOT_COUNT>(
+                    hashes[order[k]], displacements_[bucket])] = order[k];
+            }
+            group_begin = group_end;
+        }
+    }
+
+    // First displacement that sends every case of the group to a distinct, empty slot
+    [[nodiscard]] consteval std::uint16_t find_displacement(
+        const std::array<std::uint64_t, CASE_COUNT>& hashes,
+        const std::array<IndexType, CASE_COUNT>& order,
+        const std::size_t group_begin,
+        const std::size_t group_end) const noexcept
+    {
+        for (std::size_t displacement = 0;
+             displacement < string_switch_detail::MAXIMUM_DISPLACEMENT;
+             displacement++)
+        {
+            const auto candidate = static_cast<std::uint16_t>(displacement);
+            bool fits = true;
+            for (std::size_t k = group_begin; fits && k < group_end; k++)
+            {
+                const std::size_t slot =
+                    string_switch_detail::slot_of<SLOT_COUNT>(hashes[order[k]], candidate);
+                fits = slots_[slot] == EMPTY_SLOT;
+                for (std::size_t l = group_begin; fits && l < k; l++)
+                {
+                    fits = slot != string_switch_detail::slot_of<SLOT_COUNT>(hashes[order[l]],
+                                                                            candidate);
+                }
+            }
+            if (fits)
+            {
+                return candidate;
+            }
+        }
+        // Unresolvable collision
+        assert_or_abort(false);
+        return 0;
+    }
+};
+
+template <typename... Cases>
+StringSwitch(const Cases&...) -> StringSwitch<sizeof...(Cases)>;
+
+}  // namespace fixed_containers
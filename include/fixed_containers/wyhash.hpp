@@ -1,12 +1,15 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <functional>
 #include <iterator>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <type_traits>
 
 // This is a stripped-down implementation of wyhash: https://github.com/wangyi-fudan/wyhash
 // No big-endian support (because different values on different machines don't matter),
@@ -62,35 +65,63 @@ constexpr void mum(std::uint64_t* a, std::uint64_t* b)
 }
 
 // read functions. WARNING: we don't care about endianness, so results are different on big endian!
-[[nodiscard]] inline auto r8(const std::uint8_t* p) -> std::uint64_t
+// During constant evaluation bytes are assembled as little endian, matching the runtime results on
+// little endian machines. `ByteT` is any 1-byte type, as pointers can't be reinterpreted in
+// constant expressions.
+template <typename ByteT>
+[[nodiscard]] constexpr auto read_little_endian(const ByteT* p, std::size_t count) -> std::uint64_t
 {
+    std::uint64_t v{};
+    for (std::size_t i = 0; i < count; i++)
+    {
+        const auto byte = static_cast<std::uint8_t>(*std::next(p, static_cast<std::ptrdiff_t>(i)));
+        v |= static_cast<std::uint64_t>(byte) << (8U * i);
+    }
+    return v;
+}
+
+template <typename ByteT>
+[[nodiscard]] constexpr auto r8(const ByteT* p) -> std::uint64_t
+{
+    if (std::is_constant_evaluated())
+    {
+        return read_little_endian(p, 8U);
+    }
     std::uint64_t v{};
     std::memcpy(&v, p, 8U);
     return v;
 }
 
-[[nodiscard]] inline auto r4(const std::uint8_t* p) -> std::uint64_t
+template <typename ByteT>
+[[nodiscard]] constexpr auto r4(const ByteT* p) -> std::uint64_t
 {
+    if (std::is_constant_evaluated())
+    {
+        return read_little_endian(p, 4U);
+    }
     std::uint32_t v{};
     std::memcpy(&v, p, 4);
     return v;
 }
 
 // reads 1, 2, or 3 bytes
-[[nodiscard]] inline auto r3(const std::uint8_t* p, std::int64_t k) -> std::uint64_t
+template <typename ByteT>
+[[nodiscard]] constexpr auto r3(const ByteT* p, std::int64_t k) -> std::uint64_t
 {
-    return (static_cast<std::uint64_t>(*p) << 16U) |
-           (static_cast<std::uint64_t>(*std::next(p, k >> 1U)) << 8U) | *std::next(p, k - 1);
+    return (static_cast<std::uint64_t>(static_cast<std::uint8_t>(*p)) << 16U) |
+           (static_cast<std::uint64_t>(static_cast<std::uint8_t>(*std::next(p, k >> 1U))) << 8U) |
+           static_cast<std::uint8_t>(*std::next(p, k - 1));
 }
 
-[[maybe_unused]] [[nodiscard]] inline auto hash(void const* key, std::int64_t len) -> std::uint64_t
+template <typename ByteT>
+    requires(sizeof(ByteT) == 1)
+[[nodiscard]] constexpr auto hash_bytes(const ByteT* p, std::int64_t len) -> std::uint64_t
 {
     constexpr auto secret = std::array{UINT64_C(0xa0761d6478bd642f),
                                        UINT64_C(0xe7037ed1a0b428db),
                                        UINT64_C(0x8ebc6af09c88c6e3),
                                        UINT64_C(0x589965cc75374cc3)};
 
-    auto const* p = static_cast<std::uint8_t const*>(key);
     std::uint64_t seed = secret[0];
     std::uint64_t a{};
     std::uint64_t b{};
@@ -143,11 +174,24 @@ constexpr void mum(std::uint64_t* a, std::uint64_t* b)
     return mix(secret[1] ^ static_cast<std::uint64_t>(len), mix(a ^ secret[1], b ^ seed));
 }
 
+[[maybe_unused]] [[nodiscard]] inline auto hash(void const* key, std::int64_t len) -> std::uint64_t
+{
+    return hash_bytes(static_cast<std::uint8_t const*>(key), len);
+}
+
 [[nodiscard]] constexpr std::uint64_t hash(std::uint64_t x)
 {
     return mix(x, UINT64_C(0x9E3779B97F4A7C15));
 }
 
+// Mixes a hash again with a seed, for independent hashes of one key (e.g. the rows of a sketch).
+// Also needed where all bits must look random: `hash(std::uint64_t)` is one multiplication, so
+// hashes of consecutive integers are evenly spread but not independent.
+[[nodiscard]] constexpr std::uint64_t hash_with_seed(std::uint64_t hash, std::uint64_t seed)
+{
+    return mix(hash ^ seed, UINT64_C(0xe7037ed1a0b428db));
+}
+
 }  // namespace fixed_containers::wyhash_detail
 
 namespace fixed_containers::wyhash
@@ -178,9 +222,17 @@ struct hash<std::basic_string<CharT>>
 template <typename CharT>
 struct hash<std::basic_string_view<CharT>>
 {
-    std::uint64_t operator()(std::basic_string_view<CharT> const& sv) const noexcept
+    constexpr std::uint64_t operator()(std::basic_string_view<CharT> const& sv) const noexcept
     {
-        return wyhash_detail::hash(sv.data(), static_cast<std::int64_t>(sizeof(CharT) * sv.size()));
+        if constexpr (sizeof(CharT) == 1)
+        {
+            return wyhash_detail::hash_bytes(sv.data(), static_cast<std::int64_t>(sv.size()));
+        }
+        else
+        {
+            return wyhash_detail::hash(sv.data(),
+                                       static_cast<std::int64_t>(sizeof(CharT) * sv.size()));
+        }
     }
 };
 
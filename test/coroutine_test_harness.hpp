@@ -0,0 +1,80 @@
+#pragma once
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/fixed_queue.hpp"
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdlib>
+
+namespace fixed_containers::coroutine_test_harness
+{
+// Fire-and-forget coroutine. Starts eagerly and destroys its own frame on completion.
+struct DetachedTask
+{
+    struct promise_type
+    {
+        DetachedTask get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::abort(); }
+    };
+};
+
+// Runs posted coroutines one at a time, in FIFO order, on the calling thread.
+template <std::size_t MAXIMUM_PENDING = 256>
+class SingleThreadedExecutor
+{
+    FixedQueue<std::coroutine_handle<>, MAXIMUM_PENDING> pending_{};
+
+public:
+    void post(const std::coroutine_handle<> handle) { pending_.push(handle); }
+
+    // Awaitable that reschedules the awaiting coroutine behind everything already posted.
+    auto yield()
+    {
+        struct YieldAwaiter
+        {
+            SingleThreadedExecutor* executor;
+            [[nodiscard]] bool await_ready() const noexcept { return false; }
+            void await_suspend(const std::coroutine_handle<> handle) const
+            {
+                executor->post(handle);
+            }
+            void await_resume() const noexcept {}
+        };
+        return YieldAwaiter{this};
+    }
+
+    // Returns the number of resumptions performed.
+    std::size_t run()
+    {
+        std::size_t count = 0;
+        while (!pending_.empty())
+        {
+            const std::coroutine_handle<> handle = pending_.front();
+            pending_.pop();
+            handle.resume();
+            count++;
+        }
+        return count;
+    }
+
+    [[nodiscard]] bool idle() const { return pending_.empty(); }
+};
+
+// FixedChannel resumer that defers waiters to an executor instead of resuming them inline.
+template <std::size_t MAXIMUM_PENDING = 256>
+struct ExecutorResumer
+{
+    SingleThreadedExecutor<MAXIMUM_PENDING>* executor;
+
+    void operator()(const std::coroutine_handle<> handle) const
+    {
+        assert_or_abort(executor != nullptr);
+        executor->post(handle);
+    }
+};
+
+}  // namespace fixed_containers::coroutine_test_harness
@@ -366,6 +366,20 @@ TEST(EnumArray, Comparison)
         static_assert(s2 > s1);
         static_assert(s2 >= s1);
     }
+
+    // Numeric order, not byte order
+    {
+        constexpr EnumArray<TestEnum1, int> s1{{TestEnum1::ONE, 10}, {TestEnum1::TWO, -1}};
+        constexpr EnumArray<TestEnum1, int> s2{{TestEnum1::ONE, 10}, {TestEnum1::TWO, 1}};
+
+        static_assert(s1 < s2);
+        static_assert(s2 > s1);
+
+        EXPECT_TRUE(s1 < s2);
+        EXPECT_TRUE(s2 > s1);
+        EXPECT_TRUE(s1 == s1);
+        EXPECT_TRUE(s1 != s2);
+    }
 }
 
 TEST(EnumArray, NonDefaultConstructible)
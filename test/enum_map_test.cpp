@@ -21,6 +21,7 @@
 #include <iterator>
 #include <map>
 #include <memory>
+#include <string_view>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -1933,6 +1934,39 @@ INSTANTIATE_TYPED_TEST_SUITE_P(EnumMap,
                                EnumMapInstanceCheckTypes,
                                NameProviderForTypeParameterizedTest);
 
+TEST(EnumMap, MakeEnumFunctionMap)
+{
+    constexpr auto HANDLERS = make_enum_function_map<TestEnum1, int(int)>(
+        [](auto constant, int payload)
+        {
+            if constexpr (constant.value() == TestEnum1::THREE)
+            {
+                return -payload;
+            }
+            else
+            {
+                return payload + static_cast<int>(constant.ordinal());
+            }
+        });
+    static_assert(HANDLERS.size() == 4);
+    static_assert(HANDLERS.at(TestEnum1::ONE)(10) == 10);
+    static_assert(HANDLERS.at(TestEnum1::TWO)(10) == 11);
+    static_assert(HANDLERS.at(TestEnum1::THREE)(10) == -10);
+
+    auto handlers = HANDLERS;
+    handlers[TestEnum1::FOUR] = [](int payload) { return payload * 100; };
+    EXPECT_EQ(13, HANDLERS.at(TestEnum1::FOUR)(10));
+    EXPECT_EQ(1000, handlers.at(TestEnum1::FOUR)(10));
+}
+
+TEST(EnumMap, MakeEnumFunctionMapRichEnum)
+{
+    constexpr auto NAMES = make_enum_function_map<TestRichEnum1, std::string_view()>(
+        [](auto constant) { return constant.value().to_string(); });
+    static_assert(NAMES.at(TestRichEnum1::C_ONE())() == "C_ONE");
+    static_assert(NAMES.at(TestRichEnum1::C_FOUR())() == "C_FOUR");
+}
+
 }  // namespace fixed_containers
 
 namespace another_namespace_unrelated_to_the_fixed_containers_namespace
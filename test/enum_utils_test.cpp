@@ -9,6 +9,7 @@
 
 #include <cstddef>
 #include <optional>
+#include <string_view>
 #include <type_traits>
 
 namespace fixed_containers::rich_enums_detail
@@ -354,4 +355,90 @@ TEST(RichEnum, UsageInSwitchCase)
     static_assert(22 == result);
 }
 
+namespace
+{
+template <class... Ts>
+struct Overloaded : Ts...
+{
+    using Ts::operator()...;
+};
+}  // namespace
+
+static_assert(EnumConstantOf<TestEnum1::THREE>::ordinal() == 2);
+static_assert(EnumConstantOf<TestEnum1::THREE>::value() == TestEnum1::THREE);
+static_assert(EnumConstantOf<TestRichEnum1::C_TWO()>::ordinal() == 1);
+static_assert(
+    std::is_same_v<EnumConstantOf<TestRichEnum1::C_TWO()>, EnumConstant<TestRichEnum1, 1>>);
+
+TEST(EnumVisit, BuiltinEnum)
+{
+    constexpr auto NAME_OF = [](const TestEnum1& value)
+    {
+        return visit(value,
+                     Overloaded{
+                         [](EnumConstantOf<TestEnum1::ONE>) { return std::string_view{"one"}; },
+                         [](EnumConstantOf<TestEnum1::TWO>) { return std::string_view{"two"}; },
+                         [](auto) { return std::string_view{"other"}; },
+                     });
+    };
+    static_assert(NAME_OF(TestEnum1::ONE) == "one");
+    static_assert(NAME_OF(TestEnum1::TWO) == "two");
+    static_assert(NAME_OF(TestEnum1::FOUR) == "other");
+
+    EXPECT_EQ("two", NAME_OF(TestEnum1::TWO));
+}
+
+TEST(EnumVisit, RichEnum)
+{
+    constexpr auto TIMES_TEN = [](const TestRichEnum1& value)
+    {
+        return visit(value,
+                     [](auto constant)
+                     {
+                         if constexpr (constant.value() == TestRichEnum1::C_FOUR())
+                         {
+                             return std::size_t{0};
+                         }
+                         else
+                         {
+                             return constant.ordinal() * 10;
+                         }
+                     });
+    };
+    static_assert(TIMES_TEN(TestRichEnum1::C_ONE()) == 0);
+    static_assert(TIMES_TEN(TestRichEnum1::C_THREE()) == 20);
+    static_assert(TIMES_TEN(TestRichEnum1::C_FOUR()) == 0);
+
+    EXPECT_EQ(10, TIMES_TEN(TestRichEnum1::C_TWO()));
+}
+
+TEST(EnumVisit, StatefulVisitor)
+{
+    int one_count = 0;
+    int other_count = 0;
+    auto counter = Overloaded{
+        [&](EnumConstantOf<TestEnum1::ONE>) { one_count++; },
+        [&](auto) { other_count++; },
+    };
+    for (const TestEnum1 value : {TestEnum1::ONE, TestEnum1::TWO, TestEnum1::ONE, TestEnum1::FOUR})
+    {
+        visit(value, counter);
+    }
+    EXPECT_EQ(2, one_count);
+    EXPECT_EQ(2, other_count);
+}
+
+TEST(EnumVisit, ConvertsToEnumValue)
+{
+    const TestRichEnum1& value = visit(TestRichEnum1::C_THREE(),
+                                       [](auto constant) -> const TestRichEnum1&
+                                       { return constant; });
+    EXPECT_EQ(TestRichEnum1::C_THREE(), value);
+}
+
+TEST(EnumVisit, InvalidRichEnumValue)
+{
+    EXPECT_DEATH(visit(TestRichEnum1{}, [](auto) {}), "");
+}
+
 }  // namespace fixed_containers::rich_enums
@@ -0,0 +1,136 @@
+#include "fixed_containers/enum_map.hpp"
+#include "fixed_containers/enum_utils.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+enum class MessageTypeBackingEnum
+{
+    HEARTBEAT,
+    LOGON,
+    LOGOUT,
+    NEW_ORDER,
+    CANCEL,
+    REPLACE,
+    EXECUTION,
+    REJECT,
+    QUOTE,
+    QUOTE_CANCEL,
+    MARKET_DATA,
+    MARKET_DATA_INCREMENTAL,
+    SECURITY_DEFINITION,
+    TRADING_STATUS,
+    NEWS,
+    RESEND,
+};
+
+class MessageType : public rich_enums::SkeletalRichEnum<MessageType, MessageTypeBackingEnum>
+{
+    friend SkeletalRichEnum::ValuesFriend;
+    using SkeletalRichEnum::SkeletalRichEnum;
+
+public:
+    static constexpr const std::array<MessageType, count()>& values()
+    {
+        return rich_enums::SkeletalRichEnumValues<MessageType>::VALUES;
+    }
+};
+
+constexpr std::size_t MESSAGE_COUNT = 4096;
+
+const std::vector<MessageType>& messages()
+{
+    static const std::vector<MessageType> MESSAGES = []()
+    {
+        std::mt19937_64 rng{7};
+        std::vector<MessageType> out{};
+        const auto& values = rich_enums::EnumAdapter<MessageType>::values();
+        for (std::size_t i = 0; i < MESSAGE_COUNT; i++)
+        {
+            out.push_back(values.at(rng() % values.size()));
+        }
+        return out;
+    }();
+    return MESSAGES;
+}
+
+// A distinct, non-trivial handler per message type
+template <std::size_t ORDINAL>
+std::uint64_t handle(std::uint64_t state)
+{
+    return (state * (2 * ORDINAL + 3)) ^ (state >> (ORDINAL % 7 + 1));
+}
+
+std::uint64_t dispatch_with_if_chain(const MessageType& type, const std::uint64_t state)
+{
+    const auto& values = rich_enums::EnumAdapter<MessageType>::values();
+    std::uint64_t out = state;
+    [&]<std::size_t... ORDINALS>(std::index_sequence<ORDINALS...>)
+    {
+        static_cast<void>(((type == values[ORDINALS] ? (out = handle<ORDINALS>(state), true)
+                                                      : false) ||
+                           ...));
+    }(std::make_index_sequence<values.size()>{});
+    return out;
+}
+
+std::uint64_t dispatch_with_visit(const MessageType& type, const std::uint64_t state)
+{
+    return rich_enums::visit(type,
+                             [state](auto constant)
+                             { return handle<decltype(constant)::ordinal()>(state); });
+}
+
+template <typename Dispatch>
+void benchmark_dispatch(benchmark::State& state, const Dispatch& dispatch)
+{
+    for (auto _ : state)
+    {
+        std::uint64_t sum = 1;
+        for (const MessageType& type : messages())
+        {
+            sum = dispatch(type, sum) + 1;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(MESSAGE_COUNT));
+}
+}  // namespace
+
+static void benchmark_enum_dispatch_if_chain(benchmark::State& state)
+{
+    benchmark_dispatch(state, dispatch_with_if_chain);
+}
+BENCHMARK(benchmark_enum_dispatch_if_chain);
+
+static void benchmark_enum_dispatch_visit(benchmark::State& state)
+{
+    benchmark_dispatch(state, dispatch_with_visit);
+}
+BENCHMARK(benchmark_enum_dispatch_visit);
+
+static void benchmark_enum_dispatch_function_map(benchmark::State& state)
+{
+    static constexpr auto HANDLERS =
+        make_enum_function_map<MessageType, std::uint64_t(std::uint64_t)>(
+            [](auto constant, std::uint64_t message_state)
+            { return handle<decltype(constant)::ordinal()>(message_state); });
+    benchmark_dispatch(state,
+                       [](const MessageType& type, const std::uint64_t message_state)
+                       { return HANDLERS.at(type)(message_state); });
+}
+BENCHMARK(benchmark_enum_dispatch_function_map);
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -0,0 +1,173 @@
+#include "fixed_containers/fixed_arena_string_map.hpp"
+#include "fixed_containers/fixed_arena_string_unordered_map.hpp"
+
+#include "fixed_containers/fixed_map.hpp"
+#include "fixed_containers/fixed_string.hpp"
+#include "fixed_containers/fixed_unordered_map.hpp"
+#include "fixed_containers/wyhash.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+// A symbol table: keys averaging ~9 characters, with a maximum of 64.
+constexpr std::size_t KEY_COUNT = 2048;
+constexpr std::size_t MAX_KEY_LENGTH = 64;
+constexpr std::size_t QUERY_COUNT = 4096;
+
+using KeyType = FixedString<MAX_KEY_LENGTH>;
+
+struct FixedStringHash
+{
+    std::uint64_t operator()(const KeyType& key) const
+    {
+        return wyhash::hash<std::string_view>{}(std::string_view{key});
+    }
+};
+
+using FixedStringUnorderedMapType =
+    FixedUnorderedMap<KeyType, std::int64_t, KEY_COUNT, FixedStringHash>;
+using ArenaUnorderedMapType = FixedArenaStringUnorderedMap<std::int64_t, KEY_COUNT, KEY_COUNT * 10>;
+using FixedStringMapType = FixedMap<KeyType, std::int64_t, KEY_COUNT>;
+using ArenaMapType = FixedArenaStringMap<std::int64_t, KEY_COUNT, KEY_COUNT * 10>;
+
+const std::vector<std::string>& keys()
+{
+    static const std::vector<std::string> KEYS = []()
+    {
+        std::mt19937_64 rng{42};
+        std::vector<std::string> out{};
+        for (std::size_t i = 0; i < KEY_COUNT; i++)
+        {
+            // Mostly short keys, with the occasional long one.
+            const std::size_t length = (i % 64 == 0) ? MAX_KEY_LENGTH : 6 + (rng() % 6);
+            std::string key = std::to_string(i) + ":";
+            while (key.size() < length)
+            {
+                key.push_back(static_cast<char>('a' + (rng() % 26)));
+            }
+            out.push_back(key);
+        }
+        return out;
+    }();
+    return KEYS;
+}
+
+const std::vector<std::string>& queries()
+{
+    static const std::vector<std::string> QUERIES = []()
+    {
+        std::mt19937_64 rng{7};
+        std::vector<std::string> out{};
+        for (std::size_t i = 0; i < QUERY_COUNT; i++)
+        {
+            out.push_back(keys()[rng() % KEY_COUNT]);
+        }
+        return out;
+    }();
+    return QUERIES;
+}
+
+// Static, as the maps are too large for the stack.
+template <typename MapType>
+const MapType& filled_map()
+{
+    static const MapType MAP = []()
+    {
+        MapType out{};
+        std::int64_t i = 0;
+        for (const std::string& key : keys())
+        {
+            if constexpr (requires { out.try_emplace(std::string_view{key}, i); })
+            {
+                out.try_emplace(std::string_view{key}, i);
+            }
+            else
+            {
+                out.try_emplace(KeyType{key}, i);
+            }
+            i++;
+        }
+        return out;
+    }();
+    return MAP;
+}
+
+template <typename MapType>
+void benchmark_lookup(benchmark::State& state)
+{
+    const MapType& map = filled_map<MapType>();
+    for (auto _ : state)
+    {
+        std::int64_t sum = 0;
+        for (const std::string& query : queries())
+        {
+            if constexpr (requires { map.at(std::string_view{query}); })
+            {
+                sum += map.at(std::string_view{query});
+            }
+            else
+            {
+                sum += map.at(KeyType{query});
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(QUERY_COUNT));
+    state.counters["bytes"] = static_cast<double>(sizeof(MapType));
+}
+}  // namespace
+
+static void benchmark_unordered_lookup_fixed_string_key(benchmark::State& state)
+{
+    benchmark_lookup<FixedStringUnorderedMapType>(state);
+}
+BENCHMARK(benchmark_unordered_lookup_fixed_string_key);
+
+static void benchmark_unordered_lookup_arena_string_key(benchmark::State& state)
+{
+    benchmark_lookup<ArenaUnorderedMapType>(state);
+}
+BENCHMARK(benchmark_unordered_lookup_arena_string_key);
+
+static void benchmark_ordered_lookup_fixed_string_key(benchmark::State& state)
+{
+    benchmark_lookup<FixedStringMapType>(state);
+}
+BENCHMARK(benchmark_ordered_lookup_fixed_string_key);
+
+static void benchmark_ordered_lookup_arena_string_key(benchmark::State& state)
+{
+    benchmark_lookup<ArenaMapType>(state);
+}
+BENCHMARK(benchmark_ordered_lookup_arena_string_key);
+
+// Erase and re-insert a key at a time, so the arena is periodically compacted.
+static void benchmark_unordered_churn_arena_string_key(benchmark::State& state)
+{
+    static ArenaUnorderedMapType map{};
+    map = filled_map<ArenaUnorderedMapType>();
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        const std::string& key = keys()[i % KEY_COUNT];
+        map.erase(key);
+        map.try_emplace(key, static_cast<std::int64_t>(i));
+        i++;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(benchmark_unordered_churn_arena_string_key);
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
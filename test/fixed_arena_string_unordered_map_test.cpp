@@ -0,0 +1,229 @@
+#include "fixed_containers/fixed_arena_string_unordered_map.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_string.hpp"
+#include "fixed_containers/fixed_unordered_map.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <random>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace fixed_containers
+{
+namespace
+{
+using MapType = FixedArenaStringUnorderedMap<int, 10, 64>;
+static_assert(TriviallyCopyable<MapType>);
+static_assert(std::forward_iterator<MapType::iterator>);
+static_assert(std::forward_iterator<MapType::const_iterator>);
+static_assert(std::is_same_v<std::iter_reference_t<MapType::iterator>,
+                             std::pair<std::string_view, int&>>);
+static_assert(std::is_same_v<std::iter_reference_t<MapType::const_iterator>,
+                             std::pair<std::string_view, const int&>>);
+
+// Keys averaging 9 characters, with a maximum of 64
+static_assert(sizeof(FixedArenaStringUnorderedMap<int, 100, 100 * 9>) <
+              sizeof(FixedUnorderedMap<FixedString<64>, int, 100>) / 2);
+}  // namespace
+
+TEST(FixedArenaStringUnorderedMap, DefaultConstructor)
+{
+    constexpr MapType MAP{};
+    static_assert(MAP.empty());
+    static_assert(MAP.size() == 0);
+    static_assert(MAP.max_size() == 10);
+    static_assert(MAP.key_byte_count() == 0);
+    static_assert(MAP.max_key_byte_count() == 64);
+    static_assert(MapType::static_max_size() == 10);
+    static_assert(MapType::static_max_key_byte_count() == 64);
+}
+
+TEST(FixedArenaStringUnorderedMap, InitializerList)
+{
+    constexpr MapType MAP{{"AAPL", 1}, {"MSFT", 2}, {"BRK.B", 3}, {"AAPL", 4}};
+    static_assert(MAP.size() == 3);
+    static_assert(MAP.key_byte_count() == 13);
+    static_assert(MAP.at("AAPL") == 1);
+    static_assert(MAP.at("BRK.B") == 3);
+    static_assert(MAP.contains("MSFT"));
+    static_assert(!MAP.contains("MSF"));
+    static_assert(MAP.count("GOOG") == 0);
+
+    EXPECT_EQ(2, MAP.at(std::string{"MSFT"}));
+    EXPECT_EQ(MAP.cend(), MAP.find("GOOG"));
+    EXPECT_EQ("MSFT", (*MAP.find("MSFT")).first);
+}
+
+TEST(FixedArenaStringUnorderedMap, TryEmplaceAndInsertOrAssign)
+{
+    MapType s{};
+    {
+        auto [it, was_inserted] = s.try_emplace("a", 1);
+        EXPECT_TRUE(was_inserted);
+        EXPECT_EQ("a", it->first);
+        EXPECT_EQ(1, it->second);
+    }
+    {
+        auto [it, was_inserted] = s.try_emplace(std::string{"a"}, 2);
+        EXPECT_FALSE(was_inserted);
+        EXPECT_EQ(1, it->second);
+    }
+    {
+        auto [it, was_inserted] = s.insert_or_assign("a", 3);
+        EXPECT_FALSE(was_inserted);
+        EXPECT_EQ(3, it->second);
+    }
+    {
+        auto [it, was_inserted] = s.insert_or_assign("bb", 4);
+        EXPECT_TRUE(was_inserted);
+        EXPECT_EQ(4, it->second);
+    }
+    s["ccc"] += 5;
+    s["a"] += 5;
+    EXPECT_EQ(3, s.size());
+    EXPECT_EQ(6, s.key_byte_count());
+    EXPECT_EQ(8, s.at("a"));
+    EXPECT_EQ(4, s.at("bb"));
+    EXPECT_EQ(5, s.at("ccc"));
+}
+
+TEST(FixedArenaStringUnorderedMap, EmptyKey)
+{
+    MapType s{};
+    s[""] = 7;
+    s["x"] = 8;
+    EXPECT_EQ(7, s.at(""));
+    EXPECT_EQ(1, s.erase(""));
+    EXPECT_FALSE(s.contains(""));
+    EXPECT_EQ(8, s.at("x"));
+}
+
+TEST(FixedArenaStringUnorderedMap, Iteration)
+{
+    MapType s{{"one", 1}, {"two", 2}, {"three", 3}};
+    std::map<std::string, int> seen{};
+    for (auto&& [key, value] : s)
+    {
+        value *= 10;
+        seen[std::string{key}] = value;
+    }
+    EXPECT_EQ((std::map<std::string, int>{{"one", 10}, {"two", 20}, {"three", 30}}), seen);
+    EXPECT_EQ(3, std::distance(s.cbegin(), s.cend()));
+}
+
+TEST(FixedArenaStringUnorderedMap, Erase)
+{
+    MapType s{{"one", 1}, {"two", 2}, {"three", 3}};
+    EXPECT_EQ(1, s.erase("two"));
+    EXPECT_EQ(0, s.erase("two"));
+    EXPECT_EQ(2, s.size());
+    EXPECT_EQ(8, s.key_byte_count());
+
+    auto it = s.erase(s.find("one"));
+    EXPECT_EQ(1, s.size());
+    EXPECT_TRUE(it == s.end() || it->first == "three");
+    EXPECT_EQ(3, s.at("three"));
+
+    s.erase(s.begin());
+    EXPECT_TRUE(s.empty());
+    EXPECT_EQ(0, s.key_byte_count());
+}
+
+TEST(FixedArenaStringUnorderedMap, CompactsWhenArenaIsFull)
+{
+    FixedArenaStringUnorderedMap<int, 4, 8> s{};
+    s["abcd"] = 1;
+    s["efgh"] = 2;
+    s.erase("abcd");
+    EXPECT_EQ(4, s.key_byte_count());
+
+    // Needs the bytes released by "abcd"
+    s["ijk"] = 3;
+    EXPECT_EQ(7, s.key_byte_count());
+    EXPECT_EQ(2, s.at("efgh"));
+    EXPECT_EQ(3, s.at("ijk"));
+    EXPECT_FALSE(s.contains("abcd"));
+
+    s["l"] = 4;
+    EXPECT_EQ(8, s.key_byte_count());
+    EXPECT_EQ(3, s.size());
+    EXPECT_EQ(4, s.at("l"));
+}
+
+TEST(FixedArenaStringUnorderedMap, AbortsWhenKeysDoNotFit)
+{
+    FixedArenaStringUnorderedMap<int, 4, 8> s{};
+    s["abcdef"] = 1;
+    EXPECT_DEATH(s["ghi"] = 2, "");
+}
+
+TEST(FixedArenaStringUnorderedMap, ChurnMatchesStdMap)
+{
+    constexpr std::size_t CAPACITY = 64;
+    // Keys are at most 16 characters long
+    FixedArenaStringUnorderedMap<int, CAPACITY, CAPACITY * 16> s{};
+    std::map<std::string, int> expected{};
+    std::mt19937 rng{11};
+    for (int step = 0; step < 20'000; step++)
+    {
+        const std::string key = std::to_string(rng() % 200) + std::string(rng() % 14, 'x');
+        if (expected.size() < CAPACITY && rng() % 2 == 0)
+        {
+            s[key] = step;
+            expected[key] = step;
+        }
+        else
+        {
+            EXPECT_EQ(expected.erase(key), s.erase(key));
+        }
+    }
+    ASSERT_EQ(expected.size(), s.size());
+    std::size_t expected_byte_count = 0;
+    for (const auto& [key, value] : expected)
+    {
+        EXPECT_EQ(value, s.at(key));
+        expected_byte_count += key.size();
+    }
+    EXPECT_EQ(expected_byte_count, s.key_byte_count());
+}
+
+TEST(FixedArenaStringUnorderedMap, Clear)
+{
+    MapType s{{"one", 1}, {"two", 2}};
+    s.clear();
+    EXPECT_TRUE(s.empty());
+    EXPECT_EQ(0, s.key_byte_count());
+    EXPECT_FALSE(s.contains("one"));
+    s["one"] = 3;
+    EXPECT_EQ(3, s.at("one"));
+}
+
+TEST(FixedArenaStringUnorderedMap, CopyIsIndependent)
+{
+    MapType s{{"one", 1}};
+    MapType copy = s;
+    s["two"] = 2;
+    copy["one"] = 5;
+    EXPECT_EQ(1, copy.size());
+    EXPECT_EQ(5, copy.at("one"));
+    EXPECT_EQ(1, s.at("one"));
+}
+
+TEST(FixedArenaStringUnorderedMap, NonTrivialValues)
+{
+    FixedArenaStringUnorderedMap<std::string, 8, 64> s{};
+    s.try_emplace("k", 3, 'z');
+    s["j"] = "value";
+    EXPECT_EQ("zzz", s.at("k"));
+    s.erase("k");
+    EXPECT_EQ("value", s.at("j"));
+}
+
+}  // namespace fixed_containers
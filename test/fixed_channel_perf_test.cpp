@@ -0,0 +1,161 @@
+#include "fixed_containers/fixed_channel.hpp"
+
+#include "coroutine_test_harness.hpp"
+
+#include "fixed_containers/fixed_vector.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace fixed_containers
+{
+namespace
+{
+using coroutine_test_harness::DetachedTask;
+using coroutine_test_harness::ExecutorResumer;
+using coroutine_test_harness::SingleThreadedExecutor;
+
+template <typename Channel>
+DetachedTask produce(Channel& out, const std::int64_t count)
+{
+    for (std::int64_t i = 0; i < count; i++)
+    {
+        co_await out.send(i);
+    }
+    out.close();
+}
+
+// Forwards every message to the next channel: one hop.
+template <typename Channel>
+DetachedTask forward(Channel& in, Channel& out)
+{
+    while (const std::optional<std::int64_t> value = co_await in.receive())
+    {
+        co_await out.send(*value);
+    }
+    out.close();
+}
+
+template <typename Channel>
+DetachedTask consume(Channel& in, std::int64_t& sum)
+{
+    while (const std::optional<std::int64_t> value = co_await in.receive())
+    {
+        sum += *value;
+    }
+}
+
+template <typename Channel, std::size_t BATCH>
+DetachedTask consume_batched(Channel& in, std::int64_t& sum)
+{
+    while (true)
+    {
+        FixedVector<std::int64_t, BATCH> batch{};
+        if (co_await in.receive_n(batch) == 0)
+        {
+            co_return;
+        }
+        for (const std::int64_t value : batch)
+        {
+            sum += value;
+        }
+    }
+}
+
+constexpr std::int64_t MESSAGES = 1024;
+constexpr std::size_t STAGES = 4;
+}  // namespace
+
+// A producer, STAGES forwarding coroutines and a consumer, resumed inline.
+template <std::size_t CHANNEL_SIZE>
+static void benchmark_channel_pipeline_inline(benchmark::State& state)
+{
+    using ChannelType = FixedChannel<std::int64_t, CHANNEL_SIZE>;
+    for (auto _ : state)
+    {
+        std::array<ChannelType, STAGES + 1> channels{};
+        std::int64_t sum = 0;
+        consume(channels[STAGES], sum);
+        for (std::size_t i = STAGES; i > 0; i--)
+        {
+            forward(channels[i - 1], channels[i]);
+        }
+        produce(channels[0], MESSAGES);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * MESSAGES * static_cast<std::int64_t>(STAGES + 1));
+    state.SetLabel("items = message hops");
+}
+BENCHMARK(benchmark_channel_pipeline_inline<1>);
+BENCHMARK(benchmark_channel_pipeline_inline<16>);
+BENCHMARK(benchmark_channel_pipeline_inline<256>);
+
+// Same pipeline, with every wakeup going through the executor's run queue.
+template <std::size_t CHANNEL_SIZE>
+static void benchmark_channel_pipeline_executor(benchmark::State& state)
+{
+    using ExecutorType = SingleThreadedExecutor<STAGES + 2>;
+    using ChannelType = FixedChannel<std::int64_t, CHANNEL_SIZE, ExecutorResumer<STAGES + 2>>;
+    for (auto _ : state)
+    {
+        ExecutorType executor{};
+        const ExecutorResumer<STAGES + 2> resumer{&executor};
+        std::array<ChannelType, STAGES + 1> channels{ChannelType{resumer},
+                                                     ChannelType{resumer},
+                                                     ChannelType{resumer},
+                                                     ChannelType{resumer},
+                                                     ChannelType{resumer}};
+        std::int64_t sum = 0;
+        consume(channels[STAGES], sum);
+        for (std::size_t i = STAGES; i > 0; i--)
+        {
+            forward(channels[i - 1], channels[i]);
+        }
+        produce(channels[0], MESSAGES);
+        executor.run();
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * MESSAGES * static_cast<std::int64_t>(STAGES + 1));
+    state.SetLabel("items = message hops");
+}
+BENCHMARK(benchmark_channel_pipeline_executor<1>);
+BENCHMARK(benchmark_channel_pipeline_executor<16>);
+BENCHMARK(benchmark_channel_pipeline_executor<256>);
+
+// Single hop, comparing per-message receive() with receive_n() batches. Wakeups are deferred, so
+// the producer fills the buffer before the consumer runs.
+template <std::size_t BATCH>
+static void benchmark_channel_receive_n(benchmark::State& state)
+{
+    using ChannelType = FixedChannel<std::int64_t, 64, ExecutorResumer<2>>;
+    for (auto _ : state)
+    {
+        SingleThreadedExecutor<2> executor{};
+        ChannelType channel{ExecutorResumer<2>{&executor}};
+        std::int64_t sum = 0;
+        if constexpr (BATCH == 1)
+        {
+            consume(channel, sum);
+        }
+        else
+        {
+            consume_batched<ChannelType, BATCH>(channel, sum);
+        }
+        produce(channel, MESSAGES);
+        executor.run();
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * MESSAGES);
+    state.SetLabel("items = message hops");
+}
+BENCHMARK(benchmark_channel_receive_n<1>);
+BENCHMARK(benchmark_channel_receive_n<16>);
+BENCHMARK(benchmark_channel_receive_n<64>);
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -0,0 +1,265 @@
+#include "fixed_containers/fixed_channel.hpp"
+
+#include "coroutine_test_harness.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <optional>
+
+namespace fixed_containers
+{
+namespace
+{
+using coroutine_test_harness::DetachedTask;
+using coroutine_test_harness::ExecutorResumer;
+using coroutine_test_harness::SingleThreadedExecutor;
+
+using ChannelType = FixedChannel<int, 3>;
+static_assert(NotCopyConstructible<ChannelType>);
+static_assert(NotMoveConstructible<ChannelType>);
+static_assert(ChannelType::static_max_size() == 3);
+
+using DeferredChannelType = FixedChannel<int, 2, ExecutorResumer<>>;
+
+template <typename Channel>
+DetachedTask send_all(Channel& channel, const int first, const int count, int& sent)
+{
+    for (int i = first; i < first + count; i++)
+    {
+        if (!co_await channel.send(i))
+        {
+            co_return;
+        }
+        sent++;
+    }
+}
+
+template <typename Channel, std::size_t N>
+DetachedTask receive_until_closed(Channel& channel, FixedVector<int, N>& received)
+{
+    while (std::optional<int> value = co_await channel.receive())
+    {
+        received.push_back(*value);
+    }
+}
+
+template <typename Channel, std::size_t BATCH, std::size_t N>
+DetachedTask receive_batches_until_closed(Channel& channel,
+                                          FixedVector<int, N>& received,
+                                          FixedVector<std::size_t, N>& batch_sizes)
+{
+    while (true)
+    {
+        FixedVector<int, BATCH> batch{};
+        const std::size_t count = co_await channel.receive_n(batch);
+        if (count == 0)
+        {
+            co_return;
+        }
+        batch_sizes.push_back(count);
+        for (const int value : batch)
+        {
+            received.push_back(value);
+        }
+    }
+}
+}  // namespace
+
+TEST(FixedChannel, DefaultConstructor)
+{
+    const ChannelType channel{};
+    EXPECT_TRUE(channel.empty());
+    EXPECT_EQ(0, channel.size());
+    EXPECT_EQ(3, channel.max_size());
+    EXPECT_FALSE(channel.closed());
+}
+
+TEST(FixedChannel, TrySendAndTryReceive)
+{
+    ChannelType channel{};
+    EXPECT_EQ(std::nullopt, channel.try_receive());
+
+    EXPECT_TRUE(channel.try_send(1));
+    EXPECT_TRUE(channel.try_send(2));
+    EXPECT_TRUE(channel.try_send(3));
+    EXPECT_FALSE(channel.try_send(4));
+    EXPECT_EQ(3, channel.size());
+
+    EXPECT_EQ(1, channel.try_receive());
+    EXPECT_EQ(2, channel.try_receive());
+    EXPECT_EQ(3, channel.try_receive());
+    EXPECT_EQ(std::nullopt, channel.try_receive());
+}
+
+TEST(FixedChannel, SenderSuspendsWhenFull)
+{
+    ChannelType channel{};
+    int sent = 0;
+    send_all(channel, 0, 5, sent);
+    EXPECT_EQ(3, sent);
+    EXPECT_EQ(3, channel.size());
+
+    // Each receive frees a slot, which the suspended sender fills
+    EXPECT_EQ(0, channel.try_receive());
+    EXPECT_EQ(4, sent);
+    EXPECT_EQ(3, channel.size());
+
+    EXPECT_EQ(1, channel.try_receive());
+    EXPECT_EQ(5, sent);
+    EXPECT_EQ(3, channel.size());
+
+    EXPECT_EQ(2, channel.try_receive());
+    EXPECT_EQ(3, channel.try_receive());
+    EXPECT_EQ(4, channel.try_receive());
+    EXPECT_TRUE(channel.empty());
+}
+
+TEST(FixedChannel, ReceiverSuspendsWhenEmptyAndGetsDirectHandoff)
+{
+    ChannelType channel{};
+    FixedVector<int, 8> received{};
+    receive_until_closed(channel, received);
+    EXPECT_TRUE(received.empty());
+
+    EXPECT_TRUE(channel.try_send(7));
+    // Handed directly to the waiting receiver, bypassing the buffer
+    EXPECT_EQ((FixedVector<int, 8>{7}), received);
+    EXPECT_TRUE(channel.empty());
+
+    channel.close();
+    EXPECT_EQ((FixedVector<int, 8>{7}), received);
+}
+
+TEST(FixedChannel, ProducerConsumerPreservesOrder)
+{
+    ChannelType channel{};
+    FixedVector<int, 32> received{};
+    int sent = 0;
+    receive_until_closed(channel, received);
+    send_all(channel, 0, 20, sent);
+    channel.close();
+
+    EXPECT_EQ(20, sent);
+    ASSERT_EQ(20, received.size());
+    for (int i = 0; i < 20; i++)
+    {
+        EXPECT_EQ(i, received[static_cast<std::size_t>(i)]);
+    }
+}
+
+TEST(FixedChannel, MultipleSendersAreServedInFifoOrder)
+{
+    FixedChannel<int, 1> channel{};
+    int sent_a = 0;
+    int sent_b = 0;
+    send_all(channel, 100, 2, sent_a);  // 100 buffered, 101 waits
+    send_all(channel, 200, 1, sent_b);  // 200 waits behind 101
+    EXPECT_EQ(1, sent_a);
+    EXPECT_EQ(0, sent_b);
+
+    EXPECT_EQ(100, channel.try_receive());
+    EXPECT_EQ(2, sent_a);
+    EXPECT_EQ(0, sent_b);
+    EXPECT_EQ(101, channel.try_receive());
+    EXPECT_EQ(1, sent_b);
+    EXPECT_EQ(200, channel.try_receive());
+}
+
+TEST(FixedChannel, CloseWakesWaitingSendersWithFailure)
+{
+    FixedChannel<int, 1> channel{};
+    int sent = 0;
+    send_all(channel, 0, 3, sent);
+    EXPECT_EQ(1, sent);
+
+    channel.close();
+    EXPECT_EQ(1, sent);
+    EXPECT_FALSE(channel.try_send(9));
+
+    // Buffered elements remain receivable after close
+    EXPECT_EQ(0, channel.try_receive());
+    EXPECT_EQ(std::nullopt, channel.try_receive());
+}
+
+TEST(FixedChannel, ReceiveAfterCloseDrainsThenEnds)
+{
+    ChannelType channel{};
+    channel.try_send(1);
+    channel.try_send(2);
+    channel.close();
+
+    FixedVector<int, 8> received{};
+    receive_until_closed(channel, received);
+    EXPECT_EQ((FixedVector<int, 8>{1, 2}), received);
+}
+
+TEST(FixedChannel, ReceiveNDrainsInBulk)
+{
+    FixedChannel<int, 8> channel{};
+    for (int i = 0; i < 7; i++)
+    {
+        channel.try_send(i);
+    }
+
+    FixedVector<int, 16> received{};
+    FixedVector<std::size_t, 16> batch_sizes{};
+    receive_batches_until_closed<FixedChannel<int, 8>, 4>(channel, received, batch_sizes);
+    // 4 then the remaining 3, then suspended on an empty channel
+    EXPECT_EQ((FixedVector<std::size_t, 16>{4, 3}), batch_sizes);
+
+    channel.try_send(7);
+    EXPECT_EQ((FixedVector<std::size_t, 16>{4, 3, 1}), batch_sizes);
+
+    channel.close();
+    EXPECT_EQ((FixedVector<int, 16>{0, 1, 2, 3, 4, 5, 6, 7}), received);
+}
+
+TEST(FixedChannel, ReceiveNRefillsFromWaitingSenders)
+{
+    FixedChannel<int, 2> channel{};
+    int sent = 0;
+    send_all(channel, 0, 6, sent);
+    EXPECT_EQ(2, sent);
+
+    FixedVector<int, 16> received{};
+    FixedVector<std::size_t, 16> batch_sizes{};
+    receive_batches_until_closed<FixedChannel<int, 2>, 8>(channel, received, batch_sizes);
+    // Draining frees slots that the waiting sender refills, so one batch collects everything
+    EXPECT_EQ(6, sent);
+    EXPECT_EQ((FixedVector<std::size_t, 16>{6}), batch_sizes);
+    EXPECT_EQ((FixedVector<int, 16>{0, 1, 2, 3, 4, 5}), received);
+
+    channel.close();
+}
+
+TEST(FixedChannel, ExecutorResumerDefersWakeups)
+{
+    SingleThreadedExecutor<> executor{};
+    DeferredChannelType channel{ExecutorResumer<>{&executor}};
+
+    FixedVector<int, 32> received{};
+    int sent = 0;
+    receive_until_closed(channel, received);
+    send_all(channel, 0, 10, sent);
+    // The receiver has been handed 0 but not resumed, so the sender filled the buffer
+    EXPECT_TRUE(received.empty());
+    EXPECT_EQ(3, sent);
+
+    executor.run();
+    EXPECT_EQ(10, sent);
+    EXPECT_TRUE(executor.idle());
+
+    channel.close();
+    executor.run();
+    ASSERT_EQ(10, received.size());
+    for (int i = 0; i < 10; i++)
+    {
+        EXPECT_EQ(i, received[static_cast<std::size_t>(i)]);
+    }
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,103 @@
+#include "fixed_containers/fixed_compressed_int_set.hpp"
+#include "fixed_containers/fixed_set.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t CAPACITY = 8192;
+
+// Order ids of a session: increasing, with gaps from orders of other sessions
+template <typename SetType>
+void fill(SetType& s, const std::uint64_t seed)
+{
+    std::uint64_t id = 1'000'000'000;
+    std::uint64_t state = seed;
+    while (s.size() < CAPACITY)
+    {
+        state = (state * 6364136223846793005ULL) + 1442695040888963407ULL;
+        id += 1 + ((state >> 33U) % 8);
+        s.insert(id);
+    }
+}
+
+template <typename SetType>
+void benchmark_contains(benchmark::State& state)
+{
+    static SetType s{};
+    fill(s, 1);
+    std::uint64_t probe = 1'000'000'000;
+    for (auto _ : state)
+    {
+        probe = 1'000'000'000 + ((probe * 2654435761ULL) % (CAPACITY * 5));
+        benchmark::DoNotOptimize(s.contains(probe));
+    }
+}
+
+struct CountingIterator
+{
+    using difference_type = std::ptrdiff_t;
+    std::size_t* count;
+    constexpr CountingIterator& operator*() { return *this; }
+    constexpr CountingIterator& operator=(const std::uint64_t /*unused*/)
+    {
+        ++*count;
+        return *this;
+    }
+    constexpr CountingIterator& operator++() { return *this; }
+    constexpr CountingIterator operator++(int) { return *this; }
+};
+}  // namespace
+
+static void benchmark_contains_fixed_set(benchmark::State& state)
+{
+    benchmark_contains<FixedSet<std::uint64_t, CAPACITY>>(state);
+}
+BENCHMARK(benchmark_contains_fixed_set);
+
+static void benchmark_contains_fixed_compressed_int_set(benchmark::State& state)
+{
+    benchmark_contains<FixedCompressedIntSet<CAPACITY>>(state);
+}
+BENCHMARK(benchmark_contains_fixed_compressed_int_set);
+
+static void benchmark_intersection_fixed_set(benchmark::State& state)
+{
+    static FixedSet<std::uint64_t, CAPACITY> a{};
+    static FixedSet<std::uint64_t, CAPACITY> b{};
+    fill(a, 1);
+    fill(b, 2);
+    for (auto _ : state)
+    {
+        std::size_t count = 0;
+        std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), CountingIterator{&count});
+        benchmark::DoNotOptimize(count);
+    }
+}
+BENCHMARK(benchmark_intersection_fixed_set);
+
+static void benchmark_intersection_fixed_compressed_int_set(benchmark::State& state)
+{
+    static FixedCompressedIntSet<CAPACITY> a{};
+    static FixedCompressedIntSet<CAPACITY> b{};
+    fill(a, 1);
+    fill(b, 2);
+    for (auto _ : state)
+    {
+        std::size_t count = 0;
+        a.set_intersection(b, CountingIterator{&count});
+        benchmark::DoNotOptimize(count);
+    }
+}
+BENCHMARK(benchmark_intersection_fixed_compressed_int_set);
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -0,0 +1,282 @@
+#include "fixed_containers/fixed_compressed_int_set.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_set.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <set>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using OrderIds = FixedCompressedIntSet<1024>;
+static_assert(TriviallyCopyable<OrderIds>);
+static_assert(NotTrivial<OrderIds>);
+static_assert(StandardLayout<OrderIds>);
+static_assert(IsStructuralType<OrderIds>);
+
+static_assert(std::bidirectional_iterator<OrderIds::const_iterator>);
+static_assert(std::is_same_v<std::iter_reference_t<OrderIds::const_iterator>, std::uint64_t>);
+static_assert(std::ranges::bidirectional_range<OrderIds>);
+
+// Even with the budget for values of any spread, a fraction of the tree
+using OrderIdsTree = FixedSet<std::uint64_t, 1024>;
+static_assert(sizeof(OrderIds) * 3 < sizeof(OrderIdsTree));
+// A budget of 16 bits per value
+static_assert(sizeof(FixedCompressedIntSet<1024, 256>) * 10 < sizeof(OrderIdsTree));
+
+std::uint64_t next_random(std::uint64_t& state)
+{
+    state ^= state << 13U;
+    state ^= state >> 7U;
+    state ^= state << 17U;
+    return state;
+}
+
+template <typename SetType>
+void expect_same_as_model(const SetType& s, const std::set<std::uint64_t>& model)
+{
+    ASSERT_EQ(model.size(), s.size());
+    ASSERT_TRUE(std::ranges::equal(model, s));
+    ASSERT_TRUE(
+        std::ranges::equal(std::ranges::reverse_view(model), std::ranges::reverse_view(s)));
+}
+
+}  // namespace
+
+TEST(FixedCompressedIntSet, DefaultConstructor)
+{
+    constexpr FixedCompressedIntSet<100> s1{};
+    static_assert(s1.empty());
+    static_assert(s1.max_size() == 100);
+    static_assert(s1.begin() == s1.end());
+    static_assert(s1.rbegin() == s1.rend());
+}
+
+TEST(FixedCompressedIntSet, Initializer)
+{
+    constexpr FixedCompressedIntSet<10> s1{7, 1'000'000'000'000, 3, 7, 0};
+    static_assert(s1.size() == 4);
+    static_assert(
+        std::ranges::equal(s1, std::array<std::uint64_t, 4>{0, 3, 7, 1'000'000'000'000}));
+}
+
+TEST(FixedCompressedIntSet, Insert)
+{
+    static constexpr auto S1 = []()
+    {
+        FixedCompressedIntSet<200> s{};
+        // Enough to split blocks, in an order that inserts in the middle of them
+        for (std::uint64_t i = 0; i < 150; i++)
+        {
+            const auto [it, inserted] = s.insert(((i * 37) % 150) * 3);
+            assert_or_abort(inserted && *it == ((i * 37) % 150) * 3);
+        }
+        const auto [it, inserted] = s.insert(300);
+        assert_or_abort(!inserted && *it == 300);
+        return s;
+    }();
+
+    static_assert(S1.size() == 150);
+    static_assert(S1.contains(0));
+    static_assert(S1.contains(447));
+    static_assert(!S1.contains(448));
+    static_assert(!S1.contains(1000));
+    static_assert(*S1.begin() == 0);
+    static_assert(*S1.rbegin() == 447);
+    static_assert(std::ranges::distance(S1) == 150);
+}
+
+TEST(FixedCompressedIntSet, Erase)
+{
+    constexpr auto s1 = []()
+    {
+        FixedCompressedIntSet<200> s{};
+        for (std::uint64_t i = 0; i < 200; i++)
+        {
+            s.insert(i);
+        }
+        for (std::uint64_t i = 0; i < 200; i++)
+        {
+            if (i % 10 != 0)
+            {
+                assert_or_abort(s.erase(i) == 1);
+            }
+        }
+        assert_or_abort(s.erase(5) == 0);
+        assert_or_abort(s.erase(1000) == 0);
+        return s;
+    }();
+
+    static_assert(s1.size() == 20);
+    static_assert(s1.contains(190));
+    static_assert(!s1.contains(191));
+    // Merged back into a single block
+    static_assert(s1.used_words() == 3);
+
+    FixedCompressedIntSet<10> s2{1, 2, 3};
+    auto it = s2.erase(s2.find(2));
+    EXPECT_EQ(3, *it);
+    it = s2.erase(it);
+    EXPECT_EQ(s2.end(), it);
+    s2.erase(1);
+    EXPECT_TRUE(s2.empty());
+    EXPECT_EQ(0, s2.used_words());
+}
+
+TEST(FixedCompressedIntSet, Bounds)
+{
+    static constexpr FixedCompressedIntSet<10> S1{10, 20, 30};
+
+    static_assert(*S1.lower_bound(10) == 10);
+    static_assert(*S1.lower_bound(11) == 20);
+    static_assert(*S1.upper_bound(10) == 20);
+    static_assert(*S1.lower_bound(0) == 10);
+    static_assert(S1.lower_bound(31) == S1.end());
+    static_assert(S1.upper_bound(30) == S1.end());
+    static_assert(S1.find(20) != S1.end());
+    static_assert(S1.find(25) == S1.end());
+    static_assert(S1.count(30) == 1);
+}
+
+TEST(FixedCompressedIntSet, DenseIdsPackTightly)
+{
+    // Appended in order, consecutive ids fill whole blocks, at 6 bits each
+    FixedCompressedIntSet<4096, 4096 * 6 / 64> s{};
+    for (std::uint64_t i = 0; i < 4096; i++)
+    {
+        s.insert(1'000'000'000 + i);
+    }
+    EXPECT_TRUE(is_full(s));
+    EXPECT_EQ(4096 * 6 / 64, s.used_words());
+    EXPECT_EQ(1'000'000'000 + 4095, *s.rbegin());
+}
+
+TEST(FixedCompressedIntSet, MatchesModel)
+{
+    FixedCompressedIntSet<2000> s{};
+    std::set<std::uint64_t> model{};
+    std::uint64_t state = 88172645463325252ULL;
+
+    for (std::size_t step = 0; step < 20000; step++)
+    {
+        const std::uint64_t r = next_random(state);
+        // Clustered ids, with the odd outlier to widen blocks
+        const std::uint64_t value = r % 16 == 0 ? r : (r >> 8U) % 4000;
+        if (model.size() < 1500 && r % 3 != 0)
+        {
+            const auto [it, inserted] = s.insert(value);
+            ASSERT_EQ(model.insert(value).second, inserted);
+            ASSERT_EQ(value, *it);
+        }
+        else
+        {
+            ASSERT_EQ(model.erase(value), s.erase(value));
+        }
+
+        const std::uint64_t probe = (next_random(state) >> 8U) % 4000;
+        ASSERT_EQ(model.contains(probe), s.contains(probe));
+        const auto lower = model.lower_bound(probe);
+        ASSERT_EQ(lower == model.end(), s.lower_bound(probe) == s.end());
+        if (lower != model.end())
+        {
+            ASSERT_EQ(*lower, *s.lower_bound(probe));
+        }
+        if (step % 500 == 0)
+        {
+            expect_same_as_model(s, model);
+        }
+    }
+    expect_same_as_model(s, model);
+    ASSERT_LE(s.used_words(), s.size());
+
+    while (!model.empty())
+    {
+        const std::uint64_t value = *std::next(model.begin(), next_random(state) % model.size());
+        model.erase(value);
+        ASSERT_EQ(1, s.erase(value));
+    }
+    EXPECT_TRUE(s.empty());
+    EXPECT_EQ(0, s.used_words());
+}
+
+TEST(FixedCompressedIntSet, SetIntersection)
+{
+    constexpr auto intersect = []()
+    {
+        FixedCompressedIntSet<300> a{};
+        FixedCompressedIntSet<300> b{};
+        for (std::uint64_t i = 0; i < 300; i++)
+        {
+            a.insert(i * 2);
+            b.insert(i * 3);
+        }
+        std::array<std::uint64_t, 100> out{};
+        const auto end = a.set_intersection(b, out.begin());
+        assert_or_abort(end == out.begin() + 100);
+        return out;
+    }();
+    static_assert(intersect[0] == 0);
+    static_assert(intersect[1] == 6);
+    static_assert(intersect[99] == 594);
+
+    FixedCompressedIntSet<5000> a{};
+    FixedCompressedIntSet<3000> b{};
+    std::uint64_t state = 1234567;
+    for (std::size_t i = 0; i < 5000; i++)
+    {
+        // Mostly disjoint ranges, so that whole blocks are skipped
+        a.insert(next_random(state) % 1'000'000);
+    }
+    for (std::size_t i = 0; i < 3000 && !is_full(b); i++)
+    {
+        const std::uint64_t r = next_random(state);
+        b.insert(r % 4 == 0 ? r % 1'000'000 : 2'000'000 + (r % 1'000'000));
+    }
+    std::vector<std::uint64_t> expected{};
+    std::ranges::set_intersection(a, b, std::back_inserter(expected));
+    std::vector<std::uint64_t> actual{};
+    a.set_intersection(b, std::back_inserter(actual));
+    EXPECT_FALSE(expected.empty());
+    EXPECT_EQ(expected, actual);
+
+    std::vector<std::uint64_t> reversed{};
+    b.set_intersection(a, std::back_inserter(reversed));
+    EXPECT_EQ(expected, reversed);
+}
+
+TEST(FixedCompressedIntSet, Equality)
+{
+    constexpr FixedCompressedIntSet<10> s1{1, 2, 3};
+    constexpr FixedCompressedIntSet<20> s2{3, 2, 1};
+    constexpr FixedCompressedIntSet<10> s3{1, 2};
+
+    static_assert(s1 == s2);
+    static_assert(s1 != s3);
+}
+
+TEST(FixedCompressedIntSet, ExceedsCapacity)
+{
+    FixedCompressedIntSet<2> s1{1, 2};
+    s1.insert(2);
+    EXPECT_DEATH(s1.insert(3), "");
+
+    // Two words of budget: fine for dense ids, not for far apart ones
+    FixedCompressedIntSet<100, 2> s2{};
+    for (std::uint64_t i = 0; i < 20; i++)
+    {
+        s2.insert(i);
+    }
+    EXPECT_DEATH(s2.insert(1ULL << 40U), "");
+}
+
+}  // namespace fixed_containers
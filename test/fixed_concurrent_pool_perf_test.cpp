@@ -0,0 +1,99 @@
+#include "fixed_containers/fixed_concurrent_pool.hpp"
+#include "fixed_containers/fixed_index_based_storage.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace fixed_containers
+{
+namespace
+{
+struct Order
+{
+    std::uint64_t id;
+    std::int64_t price;
+    std::int64_t quantity;
+};
+
+constexpr std::size_t CAP = 4096;
+constexpr std::size_t BATCH = 8;
+
+// Baseline: the single-threaded pool behind a lock.
+class MutexPool
+{
+    std::mutex mutex_{};
+    FixedIndexBasedPoolStorage<Order, CAP> storage_{};
+
+public:
+    std::size_t emplace_and_return_index(const Order& order)
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+        return storage_.emplace_and_return_index(order);
+    }
+    std::size_t delete_at_and_return_repositioned_index(const std::size_t i)
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+        return storage_.delete_at_and_return_repositioned_index(i);
+    }
+};
+
+template <typename Allocator>
+void allocate_and_free_batch(Allocator& allocator, std::array<std::size_t, BATCH>& indices)
+{
+    for (std::size_t& i : indices)
+    {
+        i = allocator.emplace_and_return_index(Order{.id = 1, .price = 2, .quantity = 3});
+    }
+    benchmark::DoNotOptimize(indices);
+    for (const std::size_t i : indices)
+    {
+        allocator.delete_at_and_return_repositioned_index(i);
+    }
+}
+}  // namespace
+
+static void benchmark_mutex_pool(benchmark::State& state)
+{
+    static MutexPool pool{};
+    std::array<std::size_t, BATCH> indices{};
+    for (auto _ : state)
+    {
+        allocate_and_free_batch(pool, indices);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(BATCH));
+}
+
+static void benchmark_concurrent_pool(benchmark::State& state)
+{
+    static FixedConcurrentPool<Order, CAP> pool{};
+    std::array<std::size_t, BATCH> indices{};
+    for (auto _ : state)
+    {
+        allocate_and_free_batch(pool, indices);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(BATCH));
+}
+
+static void benchmark_concurrent_pool_with_magazine(benchmark::State& state)
+{
+    static FixedConcurrentPool<Order, CAP> pool{};
+    FixedConcurrentPool<Order, CAP>::Magazine magazine{pool};
+    std::array<std::size_t, BATCH> indices{};
+    for (auto _ : state)
+    {
+        allocate_and_free_batch(magazine, indices);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(BATCH));
+}
+
+BENCHMARK(benchmark_mutex_pool)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(benchmark_concurrent_pool)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(benchmark_concurrent_pool_with_magazine)->ThreadRange(1, 32)->UseRealTime();
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
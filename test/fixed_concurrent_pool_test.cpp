@@ -0,0 +1,235 @@
+#include "fixed_containers/fixed_concurrent_pool.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_index_based_storage.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using PoolType = FixedConcurrentPool<int, 8, 4>;
+static_assert(IsFixedIndexBasedStorage<PoolType>);
+static_assert(NotCopyConstructible<PoolType>);
+static_assert(NotMoveConstructible<PoolType>);
+static_assert(PoolType::static_max_size() == 8);
+}  // namespace
+
+TEST(FixedConcurrentPool, DefaultConstructor)
+{
+    const PoolType v1{};
+    EXPECT_FALSE(v1.full());
+    EXPECT_EQ(8, v1.max_size());
+}
+
+TEST(FixedConcurrentPool, EmplaceAndDelete)
+{
+    PoolType v1{};
+    const std::size_t i0 = v1.emplace_and_return_index(10);
+    const std::size_t i1 = v1.emplace_and_return_index(11);
+    EXPECT_NE(i0, i1);
+    EXPECT_EQ(10, v1.at(i0));
+    EXPECT_EQ(11, v1.at(i1));
+
+    v1.at(i0) = 20;
+    EXPECT_EQ(20, v1.at(i0));
+
+    EXPECT_EQ(i0, v1.delete_at_and_return_repositioned_index(i0));
+    EXPECT_EQ(11, v1.at(i1));
+
+    // Freed slots are reused, most recent first
+    EXPECT_EQ(i0, v1.emplace_and_return_index(30));
+    EXPECT_EQ(30, v1.at(i0));
+}
+
+TEST(FixedConcurrentPool, Full)
+{
+    PoolType v1{};
+    std::set<std::size_t> indices{};
+    for (int i = 0; i < 8; i++)
+    {
+        indices.insert(v1.emplace_and_return_index(i));
+    }
+    EXPECT_EQ(8, indices.size());
+    EXPECT_TRUE(v1.full());
+    EXPECT_EQ(std::nullopt, v1.try_emplace_and_return_index(99));
+
+    v1.delete_at_and_return_repositioned_index(3);
+    EXPECT_FALSE(v1.full());
+    EXPECT_EQ(3, v1.try_emplace_and_return_index(99));
+    EXPECT_EQ(99, v1.at(3));
+}
+
+TEST(FixedConcurrentPool, MagazineRefillsInBatches)
+{
+    PoolType v1{};
+    PoolType::Magazine magazine{v1};
+    EXPECT_EQ(0, magazine.cached_count());
+
+    const std::size_t i0 = magazine.emplace_and_return_index(1);
+    EXPECT_EQ(1, v1.at(i0));
+    // Refilled half a magazine, one of which was handed out
+    EXPECT_EQ(1, magazine.cached_count());
+
+    magazine.delete_at_and_return_repositioned_index(i0);
+    EXPECT_EQ(2, magazine.cached_count());
+}
+
+TEST(FixedConcurrentPool, MagazineFlushesWhenFull)
+{
+    PoolType v1{};
+    PoolType::Magazine magazine{v1};
+    std::vector<std::size_t> indices{};
+    for (int i = 0; i < 8; i++)
+    {
+        indices.push_back(v1.emplace_and_return_index(i));
+    }
+    EXPECT_TRUE(v1.full());
+
+    for (std::size_t i = 0; i < 4; i++)
+    {
+        magazine.delete_at_and_return_repositioned_index(indices[i]);
+    }
+    EXPECT_EQ(4, magazine.cached_count());
+    EXPECT_TRUE(v1.full());
+
+    // Half of the magazine goes back to the shared free list
+    magazine.delete_at_and_return_repositioned_index(indices[4]);
+    EXPECT_EQ(3, magazine.cached_count());
+    EXPECT_FALSE(v1.full());
+    EXPECT_TRUE(v1.try_emplace_and_return_index(0).has_value());
+    EXPECT_TRUE(v1.try_emplace_and_return_index(0).has_value());
+    EXPECT_FALSE(v1.try_emplace_and_return_index(0).has_value());
+}
+
+TEST(FixedConcurrentPool, MagazineDestructorReturnsIndices)
+{
+    PoolType v1{};
+    {
+        PoolType::Magazine magazine{v1};
+        for (int i = 0; i < 8; i++)
+        {
+            magazine.emplace_and_return_index(i);
+        }
+        EXPECT_EQ(std::nullopt, magazine.try_emplace_and_return_index(99));
+        for (std::size_t i = 0; i < 8; i++)
+        {
+            magazine.delete_at_and_return_repositioned_index(i);
+        }
+        EXPECT_TRUE(v1.try_emplace_and_return_index(0).has_value());
+    }
+
+    std::set<std::size_t> indices{};
+    while (const std::optional<std::size_t> i = v1.try_emplace_and_return_index(0))
+    {
+        indices.insert(*i);
+    }
+    EXPECT_EQ(7, indices.size());
+}
+
+// Intended to also be run under ThreadSanitizer.
+// Producers allocate, consumers free, so every slot crosses threads.
+TEST(FixedConcurrentPool, StressAllocateAndFreeOnDifferentThreads)
+{
+    static constexpr std::size_t CAPACITY = 256;
+    static constexpr std::size_t PAIR_COUNT = 2;
+    static constexpr std::size_t ITEMS_PER_PRODUCER = 50'000;
+
+    FixedConcurrentPool<std::size_t, CAPACITY, 8> pool{};
+    std::array<std::atomic<bool>, CAPACITY> in_use{};
+    std::atomic<std::size_t> double_allocations{0};
+
+    std::mutex handoff_mutex{};
+    std::vector<std::size_t> handoff{};
+    std::atomic<std::size_t> producers_done{0};
+
+    std::vector<std::thread> threads{};
+    for (std::size_t p = 0; p < PAIR_COUNT; p++)
+    {
+        threads.emplace_back(
+            [&, p]()
+            {
+                FixedConcurrentPool<std::size_t, CAPACITY, 8>::Magazine magazine{pool};
+                for (std::size_t n = 0; n < ITEMS_PER_PRODUCER;)
+                {
+                    const std::optional<std::size_t> i =
+                        (n % 2 == 0) ? magazine.try_emplace_and_return_index(p)
+                                     : pool.try_emplace_and_return_index(p);
+                    if (!i.has_value())
+                    {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    if (in_use[*i].exchange(true))
+                    {
+                        double_allocations.fetch_add(1);
+                    }
+                    const std::lock_guard<std::mutex> lock{handoff_mutex};
+                    handoff.push_back(*i);
+                    n++;
+                }
+                producers_done.fetch_add(1);
+            });
+        threads.emplace_back(
+            [&, p]()
+            {
+                FixedConcurrentPool<std::size_t, CAPACITY, 8>::Magazine magazine{pool};
+                std::size_t n = 0;
+                while (true)
+                {
+                    std::optional<std::size_t> i{};
+                    {
+                        const std::lock_guard<std::mutex> lock{handoff_mutex};
+                        if (!handoff.empty())
+                        {
+                            i = handoff.back();
+                            handoff.pop_back();
+                        }
+                    }
+                    if (!i.has_value())
+                    {
+                        if (producers_done.load() == PAIR_COUNT)
+                        {
+                            break;
+                        }
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    EXPECT_LT(pool.at(*i), PAIR_COUNT);
+                    in_use[*i].store(false);
+                    if ((n++ + p) % 2 == 0)
+                    {
+                        magazine.delete_at_and_return_repositioned_index(*i);
+                    }
+                    else
+                    {
+                        pool.delete_at_and_return_repositioned_index(*i);
+                    }
+                }
+            });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(0, double_allocations.load());
+    std::set<std::size_t> indices{};
+    while (const std::optional<std::size_t> i = pool.try_emplace_and_return_index(0))
+    {
+        indices.insert(*i);
+    }
+    EXPECT_EQ(CAPACITY, indices.size());
+}
+
+}  // namespace fixed_containers
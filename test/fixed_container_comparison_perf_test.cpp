@@ -0,0 +1,104 @@
+#include "fixed_containers/fixed_deque.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t ELEMENT_COUNT = 4096;
+
+// Change detection: two equal snapshots, except for the very last element
+template <typename ContainerType>
+ContainerType make_snapshot(const std::int32_t last)
+{
+    ContainerType out{};
+    for (std::size_t i = 0; i + 1 < ELEMENT_COUNT; i++)
+    {
+        out.push_back(static_cast<std::int32_t>(i * 7) - 1000);
+    }
+    out.push_back(last);
+    return out;
+}
+
+template <typename ContainerType, typename Compare>
+void benchmark_compare(benchmark::State& state, const Compare& compare)
+{
+    const auto left = make_snapshot<ContainerType>(1);
+    auto right = make_snapshot<ContainerType>(2);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(right);
+        benchmark::DoNotOptimize(compare(left, right));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(ELEMENT_COUNT));
+}
+
+using VectorType = FixedVector<std::int32_t, ELEMENT_COUNT>;
+using DequeType = FixedDeque<std::int32_t, ELEMENT_COUNT>;
+}  // namespace
+
+static void benchmark_fixed_vector_equality_element_wise(benchmark::State& state)
+{
+    benchmark_compare<VectorType>(state,
+                                  [](const VectorType& left, const VectorType& right)
+                                  { return std::ranges::equal(left, right); });
+}
+BENCHMARK(benchmark_fixed_vector_equality_element_wise);
+
+static void benchmark_fixed_vector_equality(benchmark::State& state)
+{
+    benchmark_compare<VectorType>(
+        state, [](const VectorType& left, const VectorType& right) { return left == right; });
+}
+BENCHMARK(benchmark_fixed_vector_equality);
+
+static void benchmark_fixed_vector_three_way_element_wise(benchmark::State& state)
+{
+    benchmark_compare<VectorType>(state,
+                                  [](const VectorType& left, const VectorType& right)
+                                  {
+                                      return std::lexicographical_compare_three_way(
+                                          left.cbegin(), left.cend(), right.cbegin(), right.cend());
+                                  });
+}
+BENCHMARK(benchmark_fixed_vector_three_way_element_wise);
+
+static void benchmark_fixed_vector_three_way(benchmark::State& state)
+{
+    benchmark_compare<VectorType>(
+        state, [](const VectorType& left, const VectorType& right) { return left <=> right; });
+}
+BENCHMARK(benchmark_fixed_vector_three_way);
+
+static void benchmark_fixed_deque_equality_element_wise(benchmark::State& state)
+{
+    benchmark_compare<DequeType>(state,
+                                 [](const DequeType& left, const DequeType& right)
+                                 { return std::ranges::equal(left, right); });
+}
+BENCHMARK(benchmark_fixed_deque_equality_element_wise);
+
+static void benchmark_fixed_deque_equality(benchmark::State& state)
+{
+    benchmark_compare<DequeType>(
+        state, [](const DequeType& left, const DequeType& right) { return left == right; });
+}
+BENCHMARK(benchmark_fixed_deque_equality);
+
+static void benchmark_fixed_deque_three_way(benchmark::State& state)
+{
+    benchmark_compare<DequeType>(
+        state, [](const DequeType& left, const DequeType& right) { return left <=> right; });
+}
+BENCHMARK(benchmark_fixed_deque_three_way);
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
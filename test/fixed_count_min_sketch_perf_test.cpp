@@ -0,0 +1,73 @@
+#include "fixed_containers/fixed_count_min_sketch.hpp"
+#include "fixed_containers/fixed_hyper_log_log.hpp"
+#include "fixed_containers/fixed_top_k.hpp"
+#include "fixed_containers/fixed_unordered_map.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace fixed_containers
+{
+namespace
+{
+// Client ids, skewed towards low ids
+constexpr std::uint64_t next_client(std::uint64_t& state)
+{
+    state ^= state << 13U;
+    state ^= state >> 7U;
+    state ^= state << 17U;
+    return (state % 1'000'000) >> ((state >> 40U) % 8);
+}
+}  // namespace
+
+// Exact counts, for comparison: needs room for every distinct client
+static void benchmark_count_fixed_unordered_map(benchmark::State& state)
+{
+    static FixedUnorderedMap<std::uint64_t, std::uint64_t, 1'000'000> counts{};
+    std::uint64_t seed = 88172645463325252ULL;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(++counts[next_client(seed)]);
+    }
+}
+BENCHMARK(benchmark_count_fixed_unordered_map);
+
+static void benchmark_count_fixed_count_min_sketch(benchmark::State& state)
+{
+    static FixedCountMinSketch<std::uint64_t, 4096, 4> counts{};
+    std::uint64_t seed = 88172645463325252ULL;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(counts.add(next_client(seed)));
+    }
+}
+BENCHMARK(benchmark_count_fixed_count_min_sketch);
+
+static void benchmark_count_fixed_top_k(benchmark::State& state)
+{
+    static FixedTopK<std::uint64_t, 16, 4096, 4> top{};
+    std::uint64_t seed = 88172645463325252ULL;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(top.add(next_client(seed)));
+    }
+}
+BENCHMARK(benchmark_count_fixed_top_k);
+
+static void benchmark_add_fixed_hyper_log_log(benchmark::State& state)
+{
+    static FixedHyperLogLog<std::uint64_t, 12> distinct{};
+    std::uint64_t seed = 88172645463325252ULL;
+    for (auto _ : state)
+    {
+        distinct.add(next_client(seed));
+    }
+    benchmark::DoNotOptimize(distinct.estimate());
+}
+BENCHMARK(benchmark_add_fixed_hyper_log_log);
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -0,0 +1,112 @@
+#include "fixed_containers/fixed_count_min_sketch.hpp"
+
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+
+namespace fixed_containers
+{
+namespace
+{
+using ClientCounts = FixedCountMinSketch<std::uint64_t, 1024, 4>;
+static_assert(TriviallyCopyable<ClientCounts>);
+static_assert(StandardLayout<ClientCounts>);
+static_assert(IsStructuralType<ClientCounts>);
+static_assert(sizeof(ClientCounts) <= (1024 * 4 * sizeof(std::uint64_t)) + 16);
+
+std::uint64_t next_random(std::uint64_t& state)
+{
+    state ^= state << 13U;
+    state ^= state >> 7U;
+    state ^= state << 17U;
+    return state;
+}
+}  // namespace
+
+TEST(FixedCountMinSketch, Add)
+{
+    constexpr auto s1 = []()
+    {
+        FixedCountMinSketch<std::string_view, 64, 3> s{};
+        s.add("AAPL");
+        s.add("MSFT", 5);
+        s.add("AAPL");
+        return s;
+    }();
+
+    static_assert(s1.total_count() == 7);
+    static_assert(s1.estimate("AAPL") == 2);
+    static_assert(s1.estimate("MSFT") == 5);
+    static_assert(s1.estimate("GOOG") == 0);
+    static_assert(s1.width() == 64);
+    static_assert(s1.depth() == 3);
+
+    FixedCountMinSketch<std::string_view, 64, 3> s2{};
+    EXPECT_TRUE(s2.empty());
+    EXPECT_EQ(1, s2.add("AAPL"));
+    EXPECT_EQ(3, s2.add("AAPL", 2));
+}
+
+TEST(FixedCountMinSketch, ErrorBound)
+{
+    // 100k additions over 20k keys: estimates stay within e / WIDTH * total of the truth
+    static ClientCounts s{};
+    std::unordered_map<std::uint64_t, std::uint64_t> exact{};
+    std::uint64_t state = 88172645463325252ULL;
+    for (std::size_t i = 0; i < 100'000; i++)
+    {
+        const std::uint64_t r = next_random(state);
+        // Skewed: low ids are much more frequent
+        const std::uint64_t client = (r % 20'000) >> ((r >> 40U) % 8);
+        s.add(client);
+        exact[client]++;
+    }
+
+    const double bound = 2.72 / 1024.0 * static_cast<double>(s.total_count());
+    std::size_t over_bound = 0;
+    for (const auto& [client, count] : exact)
+    {
+        const std::uint64_t estimate = s.estimate(client);
+        EXPECT_GE(estimate, count);
+        if (static_cast<double>(estimate - count) > bound)
+        {
+            over_bound++;
+        }
+    }
+    // The bound holds with probability 1 - e^-4 per key
+    EXPECT_LT(over_bound, exact.size() / 50);
+}
+
+TEST(FixedCountMinSketch, Merge)
+{
+    ClientCounts a{};
+    ClientCounts b{};
+    ClientCounts both{};
+    std::uint64_t state = 1;
+    for (std::size_t i = 0; i < 10'000; i++)
+    {
+        const std::uint64_t client = next_random(state) % 3000;
+        (i % 3 == 0 ? a : b).add(client);
+        both.add(client);
+    }
+    a.merge(b);
+    EXPECT_EQ(both, a);
+    EXPECT_EQ(10'000, a.total_count());
+}
+
+TEST(FixedCountMinSketch, Clear)
+{
+    ClientCounts s{};
+    s.add(42, 10);
+    s.clear();
+    EXPECT_TRUE(s.empty());
+    EXPECT_EQ(0, s.estimate(42));
+    EXPECT_EQ(ClientCounts{}, s);
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,183 @@
+#include "fixed_containers/fixed_dd_sketch.hpp"
+
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using LatencySketch = FixedDdSketch<1024>;
+static_assert(TriviallyCopyable<LatencySketch>);
+static_assert(StandardLayout<LatencySketch>);
+static_assert(IsStructuralType<LatencySketch>);
+
+double relative_error(const double expected, const double actual)
+{
+    return std::abs(actual - expected) / expected;
+}
+
+std::vector<double> heavy_tailed_values(std::uint64_t seed, const std::size_t count)
+{
+    std::vector<double> out{};
+    for (std::size_t i = 0; i < count; i++)
+    {
+        seed ^= seed << 13U;
+        seed ^= seed >> 7U;
+        seed ^= seed << 17U;
+        out.push_back(static_cast<double>(1 + (seed % 1000)) *
+                      std::pow(2.0, static_cast<double>((seed >> 32U) % 24)));
+    }
+    return out;
+}
+
+}  // namespace
+
+TEST(FixedDdSketch, ApproximateLog2)
+{
+    static_assert(fixed_dd_sketch_detail::approximate_log2(1.0) == 0.0);
+    static_assert(fixed_dd_sketch_detail::approximate_log2(8.0) == 3.0);
+    static_assert(fixed_dd_sketch_detail::approximate_log2(0.5) == -1.0);
+
+    for (double x = 0.001; x < 1e9; x *= 1.37)
+    {
+        const double y = fixed_dd_sketch_detail::approximate_log2(x);
+        EXPECT_NEAR(std::log2(x), y, 0.01);
+        EXPECT_NEAR(x, fixed_dd_sketch_detail::approximate_exp2(y), x * 1e-12);
+    }
+    EXPECT_NEAR(std::log(1.01 / 0.99), fixed_dd_sketch_detail::log_gamma(0.01), 1e-15);
+}
+
+TEST(FixedDdSketch, Record)
+{
+    constexpr auto s1 = []()
+    {
+        FixedDdSketch<64> s{};
+        s.record(0.0);
+        s.record(100.0, 2);
+        s.record(1000.0);
+        return s;
+    }();
+
+    static_assert(s1.count() == 4);
+    static_assert(s1.sum() == 1200.0);
+    static_assert(s1.min() == 0.0);
+    static_assert(s1.max() == 1000.0);
+    static_assert(s1.bucket_count() == 2);
+    static_assert(s1.value_at_quantile(0.0) == 0.0);
+    static_assert(s1.value_at_quantile(1.0) == 1000.0);
+
+    constexpr double MEDIAN = s1.value_at_quantile(0.5);
+    static_assert(MEDIAN >= 99.0 && MEDIAN <= 101.0);
+}
+
+TEST(FixedDdSketch, RecordZeroCount)
+{
+    constexpr auto s1 = []()
+    {
+        FixedDdSketch<64> s{};
+        s.record(5000.0, 0);
+        s.record(10.0);
+        s.record(0.0, 0);
+        return s;
+    }();
+
+    static_assert(s1.count() == 1);
+    static_assert(s1.sum() == 10.0);
+    static_assert(s1.min() == 10.0);
+    static_assert(s1.max() == 10.0);
+    static_assert(s1.bucket_count() == 1);
+    static_assert(s1.value_at_quantile(1.0) == 10.0);
+}
+
+TEST(FixedDdSketch, QuantilesWithinRelativeAccuracy)
+{
+    const std::vector<double> values = heavy_tailed_values(88172645463325252ULL, 50'000);
+    LatencySketch s{};
+    for (const double value : values)
+    {
+        s.record(value);
+    }
+    std::vector<double> sorted = values;
+    std::ranges::sort(sorted);
+
+    for (const double quantile : {0.0, 0.01, 0.25, 0.5, 0.9, 0.99, 0.999, 1.0})
+    {
+        const auto rank =
+            static_cast<std::size_t>(quantile * static_cast<double>(sorted.size() - 1));
+        EXPECT_LE(relative_error(sorted.at(rank), s.value_at_quantile(quantile)), 0.01)
+            << quantile;
+    }
+    EXPECT_LE(s.bucket_count(), 1024);
+}
+
+TEST(FixedDdSketch, Merge)
+{
+    const std::vector<double> a_values = heavy_tailed_values(1, 10'000);
+    const std::vector<double> b_values = heavy_tailed_values(2, 30'000);
+    // Large enough that none of them has to merge buckets
+    FixedDdSketch<2048> a{};
+    FixedDdSketch<1536> b{};
+    FixedDdSketch<2048> both{};
+    for (const double value : a_values)
+    {
+        a.record(value);
+        both.record(value);
+    }
+    for (const double value : b_values)
+    {
+        b.record(value);
+        both.record(value);
+    }
+    a.merge(b);
+
+    EXPECT_EQ(40'000, a.count());
+    EXPECT_EQ(both.min(), a.min());
+    EXPECT_EQ(both.max(), a.max());
+    for (const double quantile : {0.01, 0.5, 0.99})
+    {
+        EXPECT_EQ(both.value_at_quantile(quantile), a.value_at_quantile(quantile));
+    }
+}
+
+TEST(FixedDdSketch, CollapsesLowestBuckets)
+{
+    // 8 buckets, far fewer than the values need: the top quantiles stay accurate
+    FixedDdSketch<8> s{};
+    for (std::size_t i = 1; i <= 1000; i++)
+    {
+        s.record(static_cast<double>(i));
+    }
+    EXPECT_EQ(8, s.bucket_count());
+    EXPECT_LE(relative_error(1000.0, s.value_at_quantile(1.0)), 0.01);
+    EXPECT_LE(relative_error(995.0, s.value_at_quantile(0.995)), 0.01);
+    EXPECT_EQ(1.0, s.value_at_quantile(0.0));
+}
+
+TEST(FixedDdSketch, Clear)
+{
+    FixedDdSketch<64> s{0.02};
+    s.record(5.0);
+    s.clear();
+    EXPECT_TRUE(s.empty());
+    EXPECT_EQ(0.02, s.relative_accuracy());
+    EXPECT_EQ(FixedDdSketch<64>{0.02}, s);
+}
+
+TEST(FixedDdSketch, InvalidArguments)
+{
+    FixedDdSketch<64> s{};
+    EXPECT_DEATH(s.record(-1.0), "");
+    EXPECT_DEATH(FixedDdSketch<64>{1.5}, "");
+    FixedDdSketch<64> other{0.05};
+    EXPECT_DEATH(s.merge(other), "");
+}
+
+}  // namespace fixed_containers
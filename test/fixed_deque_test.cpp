@@ -12,7 +12,9 @@
 
 #include <algorithm>
 #include <array>
+#include <compare>
 #include <cstddef>
+#include <cstdint>
 #include <deque>
 #include <initializer_list>
 #include <iterator>
@@ -845,6 +847,67 @@ TEST(FixedDeque, Comparison)
     run_test(FixedDequeInitialStateLastIndex{});
 }
 
+TEST(FixedDeque, ComparisonMatchesElementWise)
+{
+    // Evaluated at compile-time this runs the scalar path, at run-time the one comparing the
+    // contiguous segments. Deques from the two factories wrap around at different positions.
+    auto run_test = []<IsFixedDequeFactory LeftFactory, IsFixedDequeFactory RightFactory>(
+                        LeftFactory&&, RightFactory&&)
+    {
+        constexpr auto matches_element_wise = []()
+        {
+            using DequeType = FixedDeque<std::int64_t, 24>;
+            const auto matches = [](const DequeType& left, const DequeType& right)
+            {
+                return (left == right) == std::ranges::equal(left, right) &&
+                       (left <=> right) ==
+                           std::lexicographical_compare_three_way(
+                               left.cbegin(), left.cend(), right.cbegin(), right.cend());
+            };
+
+            bool out = true;
+            for (const std::size_t size : {0, 1, 7, 8, 9, 20})
+            {
+                DequeType left = LeftFactory::template create<std::int64_t, 24>();
+                DequeType right = RightFactory::template create<std::int64_t, 24>();
+                for (std::size_t i = 0; i < size; i++)
+                {
+                    // Negative values, so that the byte order differs from the numeric order
+                    left.push_back((static_cast<std::int64_t>(i) * 1000) - 5000);
+                    right.push_back((static_cast<std::int64_t>(i) * 1000) - 5000);
+                }
+                out = out && matches(left, right);
+                for (std::size_t i = 0; i < size; i++)
+                {
+                    for (const std::int64_t delta : {-1, 256})
+                    {
+                        DequeType changed = right;
+                        changed[i] += delta;
+                        out = out && matches(left, changed) && matches(changed, left);
+                    }
+                }
+                if (size > 0)
+                {
+                    DequeType shorter = right;
+                    shorter.pop_back();
+                    out = out && matches(left, shorter) && matches(shorter, left);
+                    shorter = right;
+                    shorter.pop_front();
+                    out = out && matches(left, shorter) && matches(shorter, left);
+                }
+            }
+            return out;
+        };
+
+        static_assert(matches_element_wise());
+        EXPECT_TRUE(matches_element_wise());
+    };
+
+    run_test(FixedDequeInitialStateFirstIndex{}, FixedDequeInitialStateFirstIndex{});
+    run_test(FixedDequeInitialStateFirstIndex{}, FixedDequeInitialStateLastIndex{});
+    run_test(FixedDequeInitialStateLastIndex{}, FixedDequeInitialStateLastIndex{});
+}
+
 TEST(FixedDeque, IteratorAssignment)
 {
     FixedDeque<int, 8>::iterator it;              // Default construction
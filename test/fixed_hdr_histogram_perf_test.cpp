@@ -0,0 +1,79 @@
+#include "fixed_containers/fixed_dd_sketch.hpp"
+#include "fixed_containers/fixed_hdr_histogram.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace fixed_containers
+{
+namespace
+{
+// Latencies in nanoseconds, heavy tailed: 1us to about 1s
+constexpr std::uint64_t next_latency(std::uint64_t& state)
+{
+    state ^= state << 13U;
+    state ^= state >> 7U;
+    state ^= state << 17U;
+    return (1 + (state % 1000)) << (10 + ((state >> 32U) % 10));
+}
+}  // namespace
+
+static void benchmark_record_fixed_hdr_histogram(benchmark::State& state)
+{
+    static FixedHdrHistogram<1, 3'600'000'000'000, 3> h{};
+    std::uint64_t seed = 88172645463325252ULL;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(h.record(next_latency(seed)));
+    }
+    benchmark::DoNotOptimize(h.value_at_percentile(99.0));
+}
+BENCHMARK(benchmark_record_fixed_hdr_histogram);
+
+static void benchmark_record_fixed_dd_sketch(benchmark::State& state)
+{
+    static FixedDdSketch<1024> s{};
+    std::uint64_t seed = 88172645463325252ULL;
+    for (auto _ : state)
+    {
+        s.record(static_cast<double>(next_latency(seed)));
+    }
+    benchmark::DoNotOptimize(s.value_at_quantile(0.99));
+}
+BENCHMARK(benchmark_record_fixed_dd_sketch);
+
+static void benchmark_percentile_fixed_hdr_histogram(benchmark::State& state)
+{
+    static FixedHdrHistogram<1, 3'600'000'000'000, 3> h{};
+    std::uint64_t seed = 88172645463325252ULL;
+    for (std::size_t i = 0; i < 100'000; i++)
+    {
+        h.record(next_latency(seed));
+    }
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(h.value_at_percentile(99.9));
+    }
+}
+BENCHMARK(benchmark_percentile_fixed_hdr_histogram);
+
+static void benchmark_quantile_fixed_dd_sketch(benchmark::State& state)
+{
+    static FixedDdSketch<1024> s{};
+    std::uint64_t seed = 88172645463325252ULL;
+    for (std::size_t i = 0; i < 100'000; i++)
+    {
+        s.record(static_cast<double>(next_latency(seed)));
+    }
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(s.value_at_quantile(0.999));
+    }
+}
+BENCHMARK(benchmark_quantile_fixed_dd_sketch);
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
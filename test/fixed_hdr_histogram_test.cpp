@@ -0,0 +1,174 @@
+#include "fixed_containers/fixed_hdr_histogram.hpp"
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+// Nanosecond latencies up to an hour, to 3 significant digits
+using LatencyHistogram = FixedHdrHistogram<1, 3'600'000'000'000, 3>;
+static_assert(TriviallyCopyable<LatencyHistogram>);
+static_assert(StandardLayout<LatencyHistogram>);
+static_assert(IsStructuralType<LatencyHistogram>);
+
+// Same sizes as HdrHistogram itself
+static_assert(LatencyHistogram::counts_length() == 33 * 1024);
+static_assert(FixedHdrHistogram<1, 1000, 1>::counts_length() == 7 * 16);
+static_assert(FixedHdrHistogram<1000, 1'000'000, 2>::counts_length() == 5 * 128);
+
+}  // namespace
+
+TEST(FixedHdrHistogram, EquivalentValues)
+{
+    static_assert(LatencyHistogram::lowest_equivalent_value(1'234'567) == 1'233'920);
+    static_assert(LatencyHistogram::highest_equivalent_value(1'234'567) == 1'234'943);
+    static_assert(LatencyHistogram::lowest_equivalent_value(2047) == 2047);
+    static_assert(LatencyHistogram::highest_equivalent_value(2047) == 2047);
+    static_assert(LatencyHistogram::lowest_equivalent_value(2049) == 2048);
+    static_assert(LatencyHistogram::values_are_equivalent(10'007, 10'000));
+    static_assert(!LatencyHistogram::values_are_equivalent(10'008, 10'007));
+
+    // Lowest discernible value of 1000, rounded down to a power of two
+    using Coarse = FixedHdrHistogram<1000, 1'000'000, 2>;
+    static_assert(Coarse::lowest_equivalent_value(999) == 512);
+    static_assert(Coarse::highest_equivalent_value(0) == 511);
+}
+
+TEST(FixedHdrHistogram, Record)
+{
+    constexpr auto h1 = []()
+    {
+        FixedHdrHistogram<1, 1'000'000, 3> h{};
+        h.record(0);
+        h.record(5, 3);
+        h.record(123'456);
+        const bool recorded = h.record(1'000'001);
+        assert_or_abort(!recorded);
+        return h;
+    }();
+
+    static_assert(h1.total_count() == 5);
+    static_assert(h1.count_at_value(5) == 3);
+    static_assert(h1.count_at_value(123'500) == 1);
+    static_assert(h1.count_at_value(6) == 0);
+    static_assert(h1.min() == 0);
+    static_assert(h1.max() == 123'456);
+}
+
+TEST(FixedHdrHistogram, RecordZeroCount)
+{
+    constexpr auto h1 = []()
+    {
+        FixedHdrHistogram<1, 1'000'000, 3> h{};
+        const bool recorded = h.record(900'000, 0);
+        assert_or_abort(recorded);
+        h.record(10);
+        h.record(1, 0);
+        return h;
+    }();
+
+    static_assert(h1.total_count() == 1);
+    static_assert(h1.count_at_value(900'000) == 0);
+    static_assert(h1.min() == 10);
+    static_assert(h1.max() == 10);
+    static_assert(h1.value_at_percentile(100.0) == 10);
+
+    static_assert([]()
+                  {
+                      FixedHdrHistogram<1, 1'000'000, 3> h{};
+                      h.record(7, 0);
+                      return h.empty() && h.min() == 0 && h.max() == 0;
+                  }());
+}
+
+TEST(FixedHdrHistogram, Percentiles)
+{
+    static auto h = []()
+    {
+        LatencyHistogram out{};
+        for (std::uint64_t i = 1; i <= 10'000; i++)
+        {
+            out.record(i * 1000);
+        }
+        out.record(100'000'000);
+        return out;
+    }();
+
+    EXPECT_EQ(10'001, h.total_count());
+    EXPECT_EQ(1000, h.value_at_percentile(0.0));
+    EXPECT_TRUE(LatencyHistogram::values_are_equivalent(5'000'000, h.value_at_percentile(50.0)));
+    EXPECT_TRUE(LatencyHistogram::values_are_equivalent(9'900'000, h.value_at_percentile(99.0)));
+    EXPECT_EQ(100'000'000, h.value_at_percentile(100.0));
+    EXPECT_NEAR(5'010'498.0, h.mean(), 5'010'498.0 * 0.001);
+}
+
+TEST(FixedHdrHistogram, PercentilesMatchSortedValues)
+{
+    static FixedHdrHistogram<1, 10'000'000'000, 2> h{};
+    std::vector<std::uint64_t> values{};
+    std::uint64_t state = 88172645463325252ULL;
+    for (std::size_t i = 0; i < 20'000; i++)
+    {
+        state ^= state << 13U;
+        state ^= state >> 7U;
+        state ^= state << 17U;
+        // Heavy tailed, like latencies
+        const std::uint64_t value = (state % 1000) << ((state >> 32U) % 20);
+        values.push_back(value);
+        h.record(value);
+    }
+    std::ranges::sort(values);
+
+    for (const double percentile : {1.0, 10.0, 50.0, 90.0, 99.0, 99.9, 99.99})
+    {
+        const auto rank = static_cast<std::size_t>((percentile / 100.0) * 20'000 + 0.5) - 1;
+        const std::uint64_t actual = values.at(rank);
+        EXPECT_LE(h.lowest_equivalent_value(actual), h.value_at_percentile(percentile));
+        EXPECT_GE(h.highest_equivalent_value(actual), h.value_at_percentile(percentile));
+    }
+}
+
+TEST(FixedHdrHistogram, Merge)
+{
+    constexpr auto h1 = []()
+    {
+        FixedHdrHistogram<1, 1'000'000, 3> a{};
+        FixedHdrHistogram<1, 1'000'000, 3> b{};
+        FixedHdrHistogram<1, 1'000'000, 3> c{};
+        a.record(10);
+        a.record(20);
+        b.record(5);
+        b.record(500'000);
+        a.merge(b);
+        a.merge(c);
+        return a;
+    }();
+
+    static_assert(h1.total_count() == 4);
+    static_assert(h1.min() == 5);
+    static_assert(h1.max() == 500'000);
+    static_assert(h1.value_at_percentile(50.0) == 10);
+    static_assert(h1.value_at_percentile(75.0) == 20);
+}
+
+TEST(FixedHdrHistogram, Clear)
+{
+    FixedHdrHistogram<1, 1'000'000, 3> h{};
+    h.record(10);
+    h.clear();
+    EXPECT_TRUE(h.empty());
+    EXPECT_EQ(0, h.max());
+    EXPECT_EQ(0, h.value_at_percentile(50.0));
+    EXPECT_EQ((FixedHdrHistogram<1, 1'000'000, 3>{}), h);
+}
+
+}  // namespace fixed_containers
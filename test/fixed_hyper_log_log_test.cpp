@@ -0,0 +1,103 @@
+#include "fixed_containers/fixed_hyper_log_log.hpp"
+
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace fixed_containers
+{
+namespace
+{
+using DistinctSymbols = FixedHyperLogLog<std::uint64_t, 12>;
+static_assert(TriviallyCopyable<DistinctSymbols>);
+static_assert(StandardLayout<DistinctSymbols>);
+static_assert(IsStructuralType<DistinctSymbols>);
+static_assert(sizeof(DistinctSymbols) <= 4096 + 8);
+
+double relative_error(const double expected, const double actual)
+{
+    return std::abs(actual - expected) / expected;
+}
+}  // namespace
+
+TEST(FixedHyperLogLog, Log)
+{
+    static_assert(fixed_hyper_log_log_detail::log(1.0) == 0.0);
+    for (double x = 1e-6; x < 1e12; x *= 1.71)
+    {
+        const double expected = std::log(x);
+        EXPECT_NEAR(expected, fixed_hyper_log_log_detail::log(x), 1e-14 * (1 + std::abs(expected)));
+    }
+}
+
+TEST(FixedHyperLogLog, SmallCounts)
+{
+    constexpr auto h1 = []()
+    {
+        FixedHyperLogLog<std::string_view, 10> h{};
+        for (const std::string_view symbol : {"AAPL", "MSFT", "GOOG", "AAPL", "MSFT", "AMZN"})
+        {
+            h.add(symbol);
+        }
+        return h;
+    }();
+
+    static_assert(h1.register_count() == 1024);
+    static_assert(h1.estimate() > 3.9 && h1.estimate() < 4.1);
+    static_assert(FixedHyperLogLog<std::string_view, 10>{}.empty());
+    static_assert(FixedHyperLogLog<std::string_view, 10>{}.estimate() == 0.0);
+}
+
+TEST(FixedHyperLogLog, Estimate)
+{
+    DistinctSymbols h{};
+    std::uint64_t next_checkpoint = 100;
+    for (std::uint64_t i = 1; i <= 1'000'000; i++)
+    {
+        h.add(i);
+        h.add(i / 2);  // Duplicates do not count
+        if (i == next_checkpoint)
+        {
+            // Standard error is 1.04 / sqrt(4096) = 1.6%
+            EXPECT_LE(relative_error(static_cast<double>(i), h.estimate()), 0.05) << i;
+            next_checkpoint *= 10;
+        }
+    }
+}
+
+TEST(FixedHyperLogLog, Merge)
+{
+    DistinctSymbols a{};
+    DistinctSymbols b{};
+    DistinctSymbols both{};
+    for (std::uint64_t i = 0; i < 60'000; i++)
+    {
+        a.add(i);
+        both.add(i);
+    }
+    for (std::uint64_t i = 40'000; i < 100'000; i++)
+    {
+        b.add(i);
+        both.add(i);
+    }
+    a.merge(b);
+    EXPECT_EQ(both, a);
+    EXPECT_LE(relative_error(100'000.0, a.estimate()), 0.05);
+}
+
+TEST(FixedHyperLogLog, Clear)
+{
+    DistinctSymbols h{};
+    h.add(42);
+    EXPECT_FALSE(h.empty());
+    h.clear();
+    EXPECT_TRUE(h.empty());
+    EXPECT_EQ(DistinctSymbols{}, h);
+}
+
+}  // namespace fixed_containers
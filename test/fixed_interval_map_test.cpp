@@ -0,0 +1,297 @@
+#include "fixed_containers/fixed_interval_map.hpp"
+
+#include "instance_counter.hpp"
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <tuple>
+
+namespace fixed_containers
+{
+namespace
+{
+using ES_1 = FixedIntervalMap<int, int, 10>;
+static_assert(TriviallyCopyable<ES_1>);
+static_assert(NotTrivial<ES_1>);
+static_assert(StandardLayout<ES_1>);
+static_assert(IsStructuralType<ES_1>);
+
+static_assert(std::bidirectional_iterator<ES_1::const_iterator>);
+static_assert(std::is_same_v<std::iter_reference_t<ES_1::const_iterator>,
+                             IntervalMapEntryView<int, int>>);
+
+using Bounds = std::tuple<int, int, int>;
+
+template <std::size_t N>
+constexpr bool intervals_equal(const auto& range, const std::array<Bounds, N>& expected)
+{
+    return std::ranges::equal(range,
+                              expected,
+                              [](const IntervalMapEntryView<int, int>& entry, const Bounds& b)
+                              { return Bounds{entry.lower, entry.upper, entry.value} == b; });
+}
+
+}  // namespace
+
+TEST(FixedIntervalMap, DefaultConstructor)
+{
+    constexpr FixedIntervalMap<int, int, 10> s1{};
+    static_assert(s1.empty());
+    static_assert(s1.max_size() == 10);
+}
+
+TEST(FixedIntervalMap, AssignDisjoint)
+{
+    constexpr auto s1 = []()
+    {
+        FixedIntervalMap<int, int, 10> s{};
+        s.assign(20, 30, 2);
+        s.assign(0, 10, 1);
+        s.assign(5, 5, 9);  // Empty
+        return s;
+    }();
+
+    static_assert(s1.size() == 2);
+    static_assert(intervals_equal(s1, std::array{Bounds{0, 10, 1}, Bounds{20, 30, 2}}));
+    static_assert(s1.at(0) == 1);
+    static_assert(s1.at(9) == 1);
+    static_assert(s1.at(25) == 2);
+    static_assert(!s1.contains(10));
+    static_assert(!s1.contains(-1));
+    static_assert(!s1.contains(30));
+    static_assert(s1.find(15) == s1.cend());
+    static_assert(s1.find(29)->lower == 20);
+}
+
+TEST(FixedIntervalMap, AssignCoalescesAdjacentEqualValues)
+{
+    constexpr auto s1 = []()
+    {
+        FixedIntervalMap<int, int, 10> s{};
+        s.assign(0, 10, 1);
+        s.assign(20, 30, 1);
+        s.assign(10, 20, 1);  // Bridges both neighbours
+        s.assign(30, 40, 2);  // Touches, but with a different value
+        s.assign(45, 50, 2);
+        s.assign(40, 45, 2);  // Merges with the following interval
+        return s;
+    }();
+
+    static_assert(intervals_equal(s1, std::array{Bounds{0, 30, 1}, Bounds{30, 50, 2}}));
+}
+
+TEST(FixedIntervalMap, AssignSplitsContainingInterval)
+{
+    constexpr auto s1 = []()
+    {
+        FixedIntervalMap<int, int, 10> s{};
+        s.assign(0, 100, 1);
+        s.assign(40, 60, 2);
+        s.assign(45, 50, 2);  // Already mapped, no-op
+        return s;
+    }();
+
+    static_assert(intervals_equal(
+        s1, std::array{Bounds{0, 40, 1}, Bounds{40, 60, 2}, Bounds{60, 100, 1}}));
+}
+
+TEST(FixedIntervalMap, AssignOverMany)
+{
+    constexpr auto s1 = []()
+    {
+        FixedIntervalMap<int, int, 10> s{};
+        for (int i = 0; i < 8; i++)
+        {
+            s.assign(i * 10, (i * 10) + 5, i);
+        }
+        // Trims [10, 15) and [60, 65), drops everything in between
+        s.assign(12, 62, 9);
+        return s;
+    }();
+
+    static_assert(intervals_equal(s1,
+                                  std::array{Bounds{0, 5, 0},
+                                             Bounds{10, 12, 1},
+                                             Bounds{12, 62, 9},
+                                             Bounds{62, 65, 6},
+                                             Bounds{70, 75, 7}}));
+}
+
+TEST(FixedIntervalMap, EraseRange)
+{
+    constexpr auto s1 = []()
+    {
+        FixedIntervalMap<int, int, 10> s{};
+        s.assign(0, 10, 1);
+        s.assign(10, 20, 2);
+        s.assign(20, 30, 3);
+        s.erase(5, 25);
+        s.erase(0, 2);
+        s.erase(40, 50);  // Nothing there
+        return s;
+    }();
+
+    static_assert(intervals_equal(s1, std::array{Bounds{2, 5, 1}, Bounds{25, 30, 3}}));
+
+    constexpr auto s2 = []()
+    {
+        FixedIntervalMap<int, int, 10> s{};
+        s.assign(0, 10, 1);
+        s.erase(3, 6);  // Punches a hole
+        auto it = s.erase(s.find(8));
+        assert_or_abort(it == s.cend());
+        return s;
+    }();
+
+    static_assert(intervals_equal(s2, std::array{Bounds{0, 3, 1}}));
+}
+
+TEST(FixedIntervalMap, Overlapping)
+{
+    static constexpr auto S1 = []()
+    {
+        FixedIntervalMap<int, int, 10> s{};
+        s.assign(0, 10, 1);
+        s.assign(20, 30, 2);
+        s.assign(30, 40, 3);
+        s.assign(50, 60, 4);
+        return s;
+    }();
+
+    static_assert(intervals_equal(S1.overlapping(5, 25),
+                                  std::array{Bounds{0, 10, 1}, Bounds{20, 30, 2}}));
+    static_assert(intervals_equal(S1.overlapping(10, 20), std::array<Bounds, 0>{}));
+    static_assert(
+        intervals_equal(S1.overlapping(29, 51),
+                        std::array{Bounds{20, 30, 2}, Bounds{30, 40, 3}, Bounds{50, 60, 4}}));
+    static_assert(intervals_equal(S1.overlapping(30, 31), std::array{Bounds{30, 40, 3}}));
+    static_assert(intervals_equal(S1.overlapping(-5, 0), std::array<Bounds, 0>{}));
+    static_assert(std::ranges::distance(S1.overlapping(-100, 100)) == 4);
+}
+
+TEST(FixedIntervalMap, ReverseIteration)
+{
+    FixedIntervalMap<int, int, 10> s{};
+    s.assign(0, 10, 1);
+    s.assign(20, 30, 2);
+    EXPECT_TRUE(intervals_equal(std::ranges::reverse_view(s),
+                                std::array{Bounds{20, 30, 2}, Bounds{0, 10, 1}}));
+}
+
+TEST(FixedIntervalMap, MatchesPointwiseModel)
+{
+    constexpr int DOMAIN = 64;
+    FixedIntervalMap<int, int, DOMAIN> s{};
+    std::array<std::optional<int>, DOMAIN> model{};
+
+    unsigned state = 12345;
+    const auto next = [&state](const unsigned bound)
+    {
+        state = (state * 1103515245U) + 12345U;
+        return static_cast<int>((state >> 16U) % bound);
+    };
+
+    for (int step = 0; step < 2000; step++)
+    {
+        const int a = next(DOMAIN + 1);
+        const int b = next(DOMAIN + 1);
+        const int lower = std::min(a, b);
+        const int upper = std::max(a, b);
+        if (next(4) == 0)
+        {
+            s.erase(lower, upper);
+            std::fill(model.begin() + lower, model.begin() + upper, std::nullopt);
+        }
+        else
+        {
+            const int value = next(3);
+            s.assign(lower, upper, value);
+            std::fill(model.begin() + lower, model.begin() + upper, value);
+        }
+
+        for (int p = 0; p < DOMAIN; p++)
+        {
+            const auto model_value = model.at(static_cast<std::size_t>(p));
+            ASSERT_EQ(model_value.has_value(), s.contains(p));
+            if (model_value.has_value())
+            {
+                ASSERT_EQ(*model_value, s.at(p));
+            }
+        }
+        // Coalesced: no two touching intervals map to the same value
+        for (auto it = s.begin(); it != s.end() && std::next(it) != s.end(); ++it)
+        {
+            ASSERT_TRUE(it->upper != std::next(it)->lower || it->value != std::next(it)->value);
+        }
+    }
+}
+
+TEST(FixedIntervalMap, Equality)
+{
+    FixedIntervalMap<int, int, 10> s1{};
+    s1.assign(0, 5, 1);
+    s1.assign(5, 10, 1);
+    FixedIntervalMap<int, int, 20> s2{};
+    s2.assign(0, 10, 1);
+    FixedIntervalMap<int, int, 10> s3{};
+    s3.assign(0, 10, 2);
+
+    EXPECT_EQ(s1, s2);
+    EXPECT_NE(s1, s3);
+}
+
+TEST(FixedIntervalMap, NonTriviallyCopyable)
+{
+    using InstanceCounterType = instance_counter::InstanceCounterNonTrivialAssignment<int>;
+    using MapType = FixedIntervalMap<int, InstanceCounterType, 10>;
+    static_assert(!TriviallyCopyable<MapType>);
+
+    InstanceCounterType::counter = 0;
+    {
+        MapType s1{};
+        s1.assign(0, 100, InstanceCounterType{1});
+        s1.assign(40, 60, InstanceCounterType{2});
+        EXPECT_EQ(3, InstanceCounterType::counter);
+
+        const MapType s2{s1};
+        EXPECT_EQ(6, InstanceCounterType::counter);
+        EXPECT_EQ(2, s2.at(50).get());
+
+        s1.assign(40, 60, InstanceCounterType{1});
+        EXPECT_EQ(1, s1.size());
+        EXPECT_EQ(4, InstanceCounterType::counter);
+    }
+    EXPECT_EQ(0, InstanceCounterType::counter);
+}
+
+TEST(FixedIntervalMap, ExceedsCapacity)
+{
+    FixedIntervalMap<int, int, 2> s{};
+    s.assign(0, 100, 1);
+    s.assign(10, 20, 1);  // No-op, needs no capacity
+    s.assign(0, 50, 2);
+    EXPECT_TRUE(is_full(s));
+    s.assign(0, 100, 3);  // Replaces both
+    EXPECT_EQ(1, s.size());
+    s.assign(90, 100, 4);
+    EXPECT_DEATH(s.assign(40, 60, 5), "");
+}
+
+TEST(FixedIntervalMap, InvalidArguments)
+{
+    FixedIntervalMap<int, int, 4> s{};
+    s.assign(0, 10, 1);
+    EXPECT_DEATH((void)s.at(10), "");
+    EXPECT_DEATH(s.erase(s.cend()), "");
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,386 @@
+#include "fixed_containers/fixed_interval_tree.hpp"
+
+#include "instance_counter.hpp"
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using ES_1 = FixedIntervalTree<int, int, 10>;
+static_assert(TriviallyCopyable<ES_1>);
+static_assert(NotTrivial<ES_1>);
+static_assert(StandardLayout<ES_1>);
+static_assert(IsStructuralType<ES_1>);
+
+static_assert(std::bidirectional_iterator<ES_1::const_iterator>);
+static_assert(std::is_same_v<std::iter_reference_t<ES_1::const_iterator>,
+                             IntervalTreeEntryView<int, int>>);
+
+using Bounds = std::tuple<int, int, int>;
+
+template <std::size_t N>
+constexpr bool intervals_equal(const auto& range, const std::array<Bounds, N>& expected)
+{
+    return std::ranges::equal(range,
+                              expected,
+                              [](const IntervalTreeEntryView<int, int>& entry, const Bounds& b)
+                              { return Bounds{entry.lower, entry.upper, entry.value} == b; });
+}
+
+template <std::size_t MAXIMUM_SIZE>
+constexpr int sum_of_values_containing(const FixedIntervalTree<int, int, MAXIMUM_SIZE>& s,
+                                       const int point)
+{
+    int out = 0;
+    s.for_each_containing(point,
+                          [&out](const IntervalTreeEntryView<int, int>& e) { out += e.value; });
+    return out;
+}
+
+template <std::size_t MAXIMUM_SIZE>
+std::vector<Bounds> collect_containing(const FixedIntervalTree<int, int, MAXIMUM_SIZE>& s,
+                                       const int point)
+{
+    std::vector<Bounds> out{};
+    s.for_each_containing(point,
+                          [&out](const IntervalTreeEntryView<int, int>& e)
+                          { out.emplace_back(e.lower, e.upper, e.value); });
+    return out;
+}
+
+template <std::size_t MAXIMUM_SIZE>
+std::vector<Bounds> collect_overlapping(const FixedIntervalTree<int, int, MAXIMUM_SIZE>& s,
+                                        const int lower,
+                                        const int upper)
+{
+    std::vector<Bounds> out{};
+    s.for_each_overlapping(lower,
+                           upper,
+                           [&out](const IntervalTreeEntryView<int, int>& e)
+                           { out.emplace_back(e.lower, e.upper, e.value); });
+    return out;
+}
+
+// Checks the ordering, the red-black properties and the max_end of every node. Returns the black
+// height of the subtree at `i`.
+template <std::size_t MAXIMUM_SIZE>
+int check_subtree(const FixedIntervalTree<int, int, MAXIMUM_SIZE>& s,
+                  const fixed_red_black_tree_detail::NodeIndex i,
+                  const fixed_red_black_tree_detail::NodeIndex parent)
+{
+    using fixed_red_black_tree_detail::COLOR_BLACK;
+    using fixed_red_black_tree_detail::COLOR_RED;
+    using fixed_red_black_tree_detail::NULL_INDEX;
+    if (i == NULL_INDEX)
+    {
+        return 1;
+    }
+
+    const auto& node = s.IMPLEMENTATION_DETAIL_DO_NOT_USE_nodes_.at(i);
+    EXPECT_EQ(parent, node.parent_index);
+    int expected_max_end = node.upper;
+    for (const auto child : {node.left_index, node.right_index})
+    {
+        if (child == NULL_INDEX)
+        {
+            continue;
+        }
+        const auto& child_node = s.IMPLEMENTATION_DETAIL_DO_NOT_USE_nodes_.at(child);
+        expected_max_end = std::max(expected_max_end, child_node.max_end);
+        EXPECT_FALSE(node.color == COLOR_RED && child_node.color == COLOR_RED);
+    }
+    EXPECT_EQ(expected_max_end, node.max_end);
+    if (node.left_index != NULL_INDEX)
+    {
+        EXPECT_LE(s.IMPLEMENTATION_DETAIL_DO_NOT_USE_nodes_.at(node.left_index).lower, node.lower);
+    }
+    if (node.right_index != NULL_INDEX)
+    {
+        EXPECT_GE(s.IMPLEMENTATION_DETAIL_DO_NOT_USE_nodes_.at(node.right_index).lower, node.lower);
+    }
+
+    const int left_height = check_subtree(s, node.left_index, i);
+    const int right_height = check_subtree(s, node.right_index, i);
+    EXPECT_EQ(left_height, right_height);
+    return left_height + (node.color == COLOR_BLACK ? 1 : 0);
+}
+
+template <std::size_t MAXIMUM_SIZE>
+void check_invariants(const FixedIntervalTree<int, int, MAXIMUM_SIZE>& s)
+{
+    check_subtree(s,
+                  s.IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_,
+                  fixed_red_black_tree_detail::NULL_INDEX);
+}
+
+}  // namespace
+
+TEST(FixedIntervalTree, DefaultConstructor)
+{
+    constexpr FixedIntervalTree<int, int, 10> s1{};
+    static_assert(s1.empty());
+    static_assert(s1.max_size() == 10);
+    static_assert(s1.begin() == s1.end());
+}
+
+TEST(FixedIntervalTree, Insert)
+{
+    constexpr auto s1 = []()
+    {
+        FixedIntervalTree<int, int, 10> s{};
+        s.insert(20, 30, 1);
+        s.insert(0, 100, 2);
+        s.insert(20, 25, 3);  // Same lower bound: after the earlier one
+        s.insert(20, 30, 4);  // Duplicates are kept
+        const auto it = s.insert(5, 6, 5);
+        assert_or_abort(it->lower == 5 && it->value == 5);
+        return s;
+    }();
+
+    static_assert(s1.size() == 5);
+    static_assert(intervals_equal(s1,
+                                  std::array{Bounds{0, 100, 2},
+                                             Bounds{5, 6, 5},
+                                             Bounds{20, 30, 1},
+                                             Bounds{20, 25, 3},
+                                             Bounds{20, 30, 4}}));
+}
+
+TEST(FixedIntervalTree, ForEachContaining)
+{
+    constexpr auto s1 = []()
+    {
+        FixedIntervalTree<int, int, 10> s{};
+        s.insert(0, 10, 1);
+        s.insert(5, 15, 10);
+        s.insert(10, 20, 100);
+        s.insert(30, 40, 1000);
+        return s;
+    }();
+
+    static_assert(sum_of_values_containing(s1, -1) == 0);
+    static_assert(sum_of_values_containing(s1, 0) == 1);
+    static_assert(sum_of_values_containing(s1, 7) == 11);
+    static_assert(sum_of_values_containing(s1, 10) == 110);  // Upper bounds are excluded
+    static_assert(sum_of_values_containing(s1, 25) == 0);
+    static_assert(sum_of_values_containing(s1, 39) == 1000);
+    static_assert(sum_of_values_containing(s1, 40) == 0);
+
+    EXPECT_EQ((std::vector<Bounds>{{0, 10, 1}, {5, 15, 10}}), collect_containing(s1, 9));
+}
+
+TEST(FixedIntervalTree, ForEachOverlapping)
+{
+    FixedIntervalTree<int, int, 10> s1{};
+    s1.insert(0, 10, 1);
+    s1.insert(5, 15, 2);
+    s1.insert(10, 20, 3);
+    s1.insert(30, 40, 4);
+
+    EXPECT_EQ((std::vector<Bounds>{{0, 10, 1}, {5, 15, 2}, {10, 20, 3}}),
+              collect_overlapping(s1, 8, 12));
+    EXPECT_EQ((std::vector<Bounds>{{10, 20, 3}}), collect_overlapping(s1, 15, 30));
+    EXPECT_EQ((std::vector<Bounds>{}), collect_overlapping(s1, 20, 30));
+    EXPECT_EQ((std::vector<Bounds>{}), collect_overlapping(s1, 12, 12));  // Empty
+    EXPECT_EQ(4, collect_overlapping(s1, -100, 100).size());
+}
+
+TEST(FixedIntervalTree, Erase)
+{
+    constexpr auto s1 = []()
+    {
+        FixedIntervalTree<int, int, 10> s{};
+        s.insert(0, 10, 1);
+        s.insert(5, 15, 2);
+        s.insert(10, 20, 3);
+        const auto it = s.erase(s.find(5, 15));
+        assert_or_abort(it->lower == 10);
+        return s;
+    }();
+
+    static_assert(intervals_equal(s1, std::array{Bounds{0, 10, 1}, Bounds{10, 20, 3}}));
+    static_assert(sum_of_values_containing(s1, 12) == 3);
+}
+
+TEST(FixedIntervalTree, Find)
+{
+    FixedIntervalTree<int, int, 10> s1{};
+    s1.insert(0, 10, 1);
+    s1.insert(0, 20, 2);
+    s1.insert(0, 20, 3);
+
+    EXPECT_EQ(2, s1.find(0, 20)->value);
+    EXPECT_EQ(1, s1.find(0, 10)->value);
+    EXPECT_EQ(s1.cend(), s1.find(0, 15));
+    EXPECT_EQ(s1.cend(), s1.find(1, 10));
+}
+
+TEST(FixedIntervalTree, ReverseIteration)
+{
+    FixedIntervalTree<int, int, 10> s{};
+    s.insert(20, 30, 2);
+    s.insert(0, 10, 1);
+    EXPECT_TRUE(intervals_equal(std::ranges::reverse_view(s),
+                                std::array{Bounds{20, 30, 2}, Bounds{0, 10, 1}}));
+}
+
+TEST(FixedIntervalTree, MatchesBruteForce)
+{
+    constexpr int DOMAIN = 100;
+    constexpr std::size_t CAPACITY = 64;
+    FixedIntervalTree<int, int, CAPACITY> s{};
+    std::vector<Bounds> model{};
+
+    unsigned state = 12345;
+    const auto next = [&state](const unsigned bound)
+    {
+        state = (state * 1103515245U) + 12345U;
+        return static_cast<int>((state >> 16U) % bound);
+    };
+
+    // Enough erasures on a large tree to go through every rotation case of the fix-ups
+    for (int step = 0; step < 3000; step++)
+    {
+        if (s.size() == CAPACITY || (!s.empty() && next(5) < 2))
+        {
+            auto it = std::next(s.begin(), next(static_cast<unsigned>(s.size())));
+            const Bounds erased{it->lower, it->upper, it->value};
+            s.erase(it);
+            model.erase(std::ranges::find(model, erased));
+        }
+        else
+        {
+            const int lower = next(DOMAIN);
+            const int upper = lower + 1 + next(static_cast<unsigned>(DOMAIN / 4));
+            s.insert(lower, upper, step);
+            model.emplace_back(lower, upper, step);
+        }
+        ASSERT_EQ(model.size(), s.size());
+        check_invariants(s);
+
+        // Results come in iteration order: by lower bound, then by insertion order
+        std::vector<Bounds> sorted = model;
+        std::ranges::stable_sort(sorted, {}, [](const Bounds& b) { return std::get<0>(b); });
+        ASSERT_TRUE(std::ranges::equal(
+            s,
+            sorted,
+            [](const IntervalTreeEntryView<int, int>& entry, const Bounds& b)
+            { return Bounds{entry.lower, entry.upper, entry.value} == b; }));
+
+        for (int p = -1; p <= DOMAIN + (DOMAIN / 4); p++)
+        {
+            std::vector<Bounds> expected{};
+            std::ranges::copy_if(sorted,
+                                 std::back_inserter(expected),
+                                 [p](const Bounds& b)
+                                 { return std::get<0>(b) <= p && p < std::get<1>(b); });
+            ASSERT_EQ(expected, collect_containing(s, p));
+        }
+
+        const int a = next(DOMAIN);
+        const int b = a + next(static_cast<unsigned>(DOMAIN / 2));
+        std::vector<Bounds> expected{};
+        std::ranges::copy_if(sorted,
+                             std::back_inserter(expected),
+                             [a, b](const Bounds& x)
+                             { return a < b && std::get<0>(x) < b && a < std::get<1>(x); });
+        ASSERT_EQ(expected, collect_overlapping(s, a, b));
+    }
+}
+
+TEST(FixedIntervalTree, EraseWithRotationsKeepsMaxEnd)
+{
+    // Ascending lower bounds with the longest interval first, so that max_end comes from a
+    // different node in almost every subtree
+    FixedIntervalTree<int, int, 32> s{};
+    for (int i = 0; i < 32; i++)
+    {
+        s.insert(i, 100 - (i * 2), i);
+    }
+    check_invariants(s);
+
+    // Erase the root, which has two children, until the tree is empty
+    while (!s.empty())
+    {
+        const auto root = s.IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_;
+        const int lower = s.IMPLEMENTATION_DETAIL_DO_NOT_USE_nodes_.at(root).lower;
+        const int upper = s.IMPLEMENTATION_DETAIL_DO_NOT_USE_nodes_.at(root).upper;
+        s.erase(s.find(lower, upper));
+        check_invariants(s);
+
+        for (int p = 0; p < 100; p++)
+        {
+            int expected = 0;
+            for (const auto& e : s)
+            {
+                expected += e.lower <= p && p < e.upper ? e.value : 0;
+            }
+            ASSERT_EQ(expected, sum_of_values_containing(s, p));
+        }
+    }
+}
+
+TEST(FixedIntervalTree, NonTriviallyCopyable)
+{
+    using InstanceCounterType = instance_counter::InstanceCounterNonTrivialAssignment<int>;
+    using TreeType = FixedIntervalTree<int, InstanceCounterType, 10>;
+    static_assert(!TriviallyCopyable<TreeType>);
+
+    InstanceCounterType::counter = 0;
+    {
+        TreeType s1{};
+        s1.insert(0, 100, InstanceCounterType{1});
+        s1.insert(40, 60, InstanceCounterType{2});
+        s1.insert(50, 70, InstanceCounterType{3});
+        EXPECT_EQ(3, InstanceCounterType::counter);
+
+        const TreeType s2{s1};
+        EXPECT_EQ(6, InstanceCounterType::counter);
+        int sum = 0;
+        s2.for_each_containing(55, [&sum](const auto& e) { sum += e.value.get(); });
+        EXPECT_EQ(6, sum);
+
+        TreeType s3{std::move(s1)};
+        EXPECT_EQ(6, InstanceCounterType::counter);
+        EXPECT_TRUE(s1.empty());  // NOLINT(bugprone-use-after-move)
+
+        s3.erase(s3.begin());
+        EXPECT_EQ(5, InstanceCounterType::counter);
+        s3.clear();
+        EXPECT_EQ(3, InstanceCounterType::counter);
+    }
+    EXPECT_EQ(0, InstanceCounterType::counter);
+}
+
+TEST(FixedIntervalTree, ExceedsCapacity)
+{
+    FixedIntervalTree<int, int, 2> s{};
+    s.insert(0, 100, 1);
+    s.insert(0, 100, 1);
+    EXPECT_TRUE(is_full(s));
+    EXPECT_DEATH(s.insert(40, 60, 5), "");
+}
+
+TEST(FixedIntervalTree, InvalidArguments)
+{
+    FixedIntervalTree<int, int, 4> s{};
+    s.insert(0, 10, 1);
+    EXPECT_DEATH(s.insert(10, 10, 1), "");
+    EXPECT_DEATH(s.erase(s.cend()), "");
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,298 @@
+#include "fixed_containers/fixed_intrusive_list_pool.hpp"
+
+#include "instance_counter.hpp"
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <utility>
+
+namespace fixed_containers
+{
+namespace
+{
+struct Order
+{
+    int id;
+    int price;
+};
+
+// Membership 0: price levels, 1: accounts, 2: expiry
+constexpr std::size_t PRICE_LEVELS = 0;
+constexpr std::size_t ACCOUNTS = 1;
+constexpr std::size_t EXPIRY = 2;
+using OrderPool = FixedIntrusiveListPool<Order, 16, std::index_sequence<4, 3, 1>>;
+
+// Static assert for expected type properties
+namespace trivially_copyable_pool
+{
+static_assert(TriviallyCopyable<OrderPool>);
+static_assert(NotTrivial<OrderPool>);
+static_assert(StandardLayout<OrderPool>);
+static_assert(IsStructuralType<OrderPool>);
+
+static_assert(std::bidirectional_iterator<OrderPool::list_reference::iterator>);
+static_assert(std::bidirectional_iterator<OrderPool::const_list_reference::iterator>);
+static_assert(std::ranges::bidirectional_range<OrderPool::list_reference>);
+
+static_assert(OrderPool::membership_count() == 3);
+static_assert(OrderPool::list_count(PRICE_LEVELS) == 4);
+static_assert(OrderPool::list_count(EXPIRY) == 1);
+}  // namespace trivially_copyable_pool
+
+constexpr auto ids_of(const auto& list)
+{
+    std::array<int, 16> out{};
+    std::size_t n = 0;
+    for (const Order& order : list)
+    {
+        out.at(n++) = order.id;
+    }
+    return std::pair{out, n};
+}
+
+template <std::size_t N>
+constexpr bool ids_equal(const auto& list, const std::array<int, N>& expected)
+{
+    const auto [ids, n] = ids_of(list);
+    return n == N && std::equal(expected.begin(), expected.end(), ids.begin());
+}
+
+}  // namespace
+
+TEST(FixedIntrusiveListPool, DefaultConstructor)
+{
+    constexpr OrderPool p{};
+    static_assert(p.empty());
+    static_assert(p.max_size() == 16);
+    static_assert(p.list(PRICE_LEVELS, 3).empty());
+    static_assert(p.list(EXPIRY, 0).empty());
+}
+
+TEST(FixedIntrusiveListPool, EmplaceAndAt)
+{
+    constexpr auto p1 = []()
+    {
+        OrderPool p{};
+        const std::size_t i = p.emplace(Order{1, 100});
+        const std::size_t j = p.emplace(Order{2, 101});
+        p.at(j).price = 102;
+        assert_or_abort(i != j);
+        return p;
+    }();
+
+    static_assert(p1.size() == 2);
+    static_assert(p1.contains(0));
+    static_assert(p1.contains(1));
+    static_assert(!p1.contains(2));
+    static_assert(p1.at(0).id == 1);
+    static_assert(p1[1].price == 102);
+    static_assert(!p1.is_linked(PRICE_LEVELS, 0));
+    static_assert(p1.list_of(ACCOUNTS, 0) == OrderPool::NOT_LINKED);
+}
+
+TEST(FixedIntrusiveListPool, MultipleMemberships)
+{
+    constexpr auto p1 = []()
+    {
+        OrderPool p{};
+        for (int id = 0; id < 6; id++)
+        {
+            const std::size_t i = p.emplace(Order{id, 100 + (id % 2)});
+            p.list(PRICE_LEVELS, static_cast<std::size_t>(id % 2)).link_back(i);
+            p.list(ACCOUNTS, static_cast<std::size_t>(id % 3)).link_back(i);
+            p.list(EXPIRY, 0).link_front(i);
+        }
+        return p;
+    }();
+
+    static_assert(p1.size() == 6);
+    static_assert(ids_equal(p1.list(PRICE_LEVELS, 0), std::array{0, 2, 4}));
+    static_assert(ids_equal(p1.list(PRICE_LEVELS, 1), std::array{1, 3, 5}));
+    static_assert(p1.list(PRICE_LEVELS, 2).empty());
+    static_assert(ids_equal(p1.list(ACCOUNTS, 0), std::array{0, 3}));
+    static_assert(ids_equal(p1.list(ACCOUNTS, 2), std::array{2, 5}));
+    static_assert(ids_equal(p1.list(EXPIRY, 0), std::array{5, 4, 3, 2, 1, 0}));
+    static_assert(p1.list(EXPIRY, 0).size() == 6);
+    static_assert(p1.list(EXPIRY, 0).front().id == 5);
+    static_assert(p1.list(EXPIRY, 0).back().id == 0);
+    static_assert(p1.list_of(ACCOUNTS, 4) == 1);
+}
+
+TEST(FixedIntrusiveListPool, Unlink)
+{
+    constexpr auto p1 = []()
+    {
+        OrderPool p{};
+        for (int id = 0; id < 4; id++)
+        {
+            const std::size_t i = p.emplace(Order{id, 100});
+            p.list(PRICE_LEVELS, 0).link_back(i);
+            p.list(EXPIRY, 0).link_back(i);
+        }
+        // Order 1 is filled at its price level but stays in the expiry list
+        p.unlink(PRICE_LEVELS, 1);
+        // Unlinking twice is a no-op
+        p.unlink(PRICE_LEVELS, 1);
+        auto level = p.list(PRICE_LEVELS, 0);
+        auto it = level.unlink(level.cbegin());
+        assert_or_abort(it->id == 2);
+        return p;
+    }();
+
+    static_assert(p1.size() == 4);
+    static_assert(ids_equal(p1.list(PRICE_LEVELS, 0), std::array{2, 3}));
+    static_assert(p1.list(PRICE_LEVELS, 0).size() == 2);
+    static_assert(ids_equal(p1.list(EXPIRY, 0), std::array{0, 1, 2, 3}));
+    static_assert(!p1.is_linked(PRICE_LEVELS, 1));
+    static_assert(p1.is_linked(EXPIRY, 1));
+}
+
+TEST(FixedIntrusiveListPool, EraseUnlinksEverywhere)
+{
+    constexpr auto p1 = []()
+    {
+        OrderPool p{};
+        for (int id = 0; id < 4; id++)
+        {
+            const std::size_t i = p.emplace(Order{id, 100});
+            p.list(PRICE_LEVELS, 0).link_back(i);
+            p.list(ACCOUNTS, 1).link_back(i);
+            p.list(EXPIRY, 0).link_back(i);
+        }
+        p.erase(2);
+        // The slot is reused
+        const std::size_t i = p.emplace(Order{9, 100});
+        assert_or_abort(i == 2);
+        p.list(PRICE_LEVELS, 0).link_front(i);
+        return p;
+    }();
+
+    static_assert(p1.size() == 4);
+    static_assert(ids_equal(p1.list(PRICE_LEVELS, 0), std::array{9, 0, 1, 3}));
+    static_assert(ids_equal(p1.list(ACCOUNTS, 1), std::array{0, 1, 3}));
+    static_assert(ids_equal(p1.list(EXPIRY, 0), std::array{0, 1, 3}));
+    static_assert(!p1.is_linked(EXPIRY, 2));
+}
+
+TEST(FixedIntrusiveListPool, LinkBefore)
+{
+    constexpr auto p1 = []()
+    {
+        OrderPool p{};
+        auto level = p.list(PRICE_LEVELS, 3);
+        level.link_back(p.emplace(Order{0, 100}));
+        level.link_back(p.emplace(Order{2, 100}));
+        auto it = level.link_before(std::next(level.cbegin()), p.emplace(Order{1, 100}));
+        assert_or_abort(it->id == 1);
+        assert_or_abort(level.index_of(it) == 2);
+        return p;
+    }();
+
+    static_assert(ids_equal(p1.list(PRICE_LEVELS, 3), std::array{0, 1, 2}));
+    static_assert(p1.list(PRICE_LEVELS, 3).front_index() == 0);
+    static_assert(p1.list(PRICE_LEVELS, 3).back_index() == 1);
+}
+
+TEST(FixedIntrusiveListPool, MoveBetweenLists)
+{
+    OrderPool p{};
+    const std::size_t i = p.emplace(Order{0, 100});
+    p.list(PRICE_LEVELS, 0).link_back(i);
+    p.list(EXPIRY, 0).link_back(i);
+
+    // Price change: move to another level without touching the other memberships
+    p.unlink(PRICE_LEVELS, i);
+    p.at(i).price = 101;
+    p.list(PRICE_LEVELS, 1).link_back(i);
+
+    EXPECT_TRUE(p.list(PRICE_LEVELS, 0).empty());
+    EXPECT_EQ(101, p.list(PRICE_LEVELS, 1).front().price);
+    EXPECT_EQ(1, p.list_of(PRICE_LEVELS, i));
+    EXPECT_EQ(0, p.list_of(EXPIRY, i));
+}
+
+TEST(FixedIntrusiveListPool, ReverseIteration)
+{
+    OrderPool p{};
+    for (int id = 0; id < 3; id++)
+    {
+        p.list(ACCOUNTS, 2).link_back(p.emplace(Order{id, 100}));
+    }
+    const auto& p_const_ref = p;
+    const OrderPool::const_list_reference account = p_const_ref.list(ACCOUNTS, 2);
+    EXPECT_TRUE(std::ranges::equal(std::ranges::reverse_view(account) |
+                                       std::views::transform([](const Order& o) { return o.id; }),
+                                   std::array{2, 1, 0}));
+}
+
+TEST(FixedIntrusiveListPool, Clear)
+{
+    OrderPool p{};
+    for (int id = 0; id < 5; id++)
+    {
+        p.list(ACCOUNTS, 0).link_back(p.emplace(Order{id, 100}));
+    }
+    p.emplace(Order{5, 100});
+    p.clear();
+    EXPECT_TRUE(p.empty());
+    EXPECT_TRUE(p.list(ACCOUNTS, 0).empty());
+    EXPECT_EQ(0, p.list(ACCOUNTS, 0).size());
+}
+
+TEST(FixedIntrusiveListPool, ExceedsCapacity)
+{
+    FixedIntrusiveListPool<int, 2, std::index_sequence<1>> p{};
+    p.emplace(1);
+    p.emplace(2);
+    EXPECT_TRUE(is_full(p));
+    EXPECT_DEATH(p.emplace(3), "");
+}
+
+TEST(FixedIntrusiveListPool, InvalidArguments)
+{
+    OrderPool p{};
+    const std::size_t i = p.emplace(Order{0, 100});
+    p.list(PRICE_LEVELS, 0).link_back(i);
+
+    EXPECT_DEATH(p.list(PRICE_LEVELS, 1).link_back(i), "");  // Already linked in membership 0
+    EXPECT_DEATH((void)p.list(PRICE_LEVELS, 4), "");
+    EXPECT_DEATH((void)p.list(3, 0), "");
+    EXPECT_DEATH((void)p.at(5), "");
+    EXPECT_DEATH(p.erase(5), "");
+    EXPECT_DEATH((void)p.list(ACCOUNTS, 0).front(), "");
+}
+
+TEST(FixedIntrusiveListPool, NonTriviallyCopyable)
+{
+    using InstanceCounterType = instance_counter::InstanceCounterNonTrivialAssignment<
+        FixedIntrusiveListPool<int, 8, std::index_sequence<2, 1>>>;
+    using PoolType = FixedIntrusiveListPool<InstanceCounterType, 8, std::index_sequence<2, 1>>;
+    static_assert(!std::is_copy_constructible_v<PoolType>);
+    static_assert(!std::is_move_constructible_v<PoolType>);
+
+    InstanceCounterType::counter = 0;
+    {
+        PoolType p{};
+        const std::size_t i = p.emplace(1);
+        const std::size_t j = p.emplace(2);
+        p.emplace(3);
+        p.list(0, 1).link_back(i);
+        p.list(1, 0).link_back(j);
+        EXPECT_EQ(3, InstanceCounterType::counter);
+
+        p.erase(i);
+        EXPECT_EQ(2, InstanceCounterType::counter);
+        EXPECT_TRUE(p.list(0, 1).empty());
+    }
+    EXPECT_EQ(0, InstanceCounterType::counter);
+}
+
+}  // namespace fixed_containers
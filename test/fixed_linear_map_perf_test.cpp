@@ -0,0 +1,70 @@
+#include "fixed_containers/fixed_linear_map.hpp"
+#include "fixed_containers/fixed_map.hpp"
+#include "fixed_containers/fixed_unordered_map.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t LOOKUP_COUNT = 1024;
+
+// Keys present in the map, in a pseudo-random order so that branches do not learn the pattern
+template <std::size_t SIZE>
+constexpr std::array<std::uint32_t, LOOKUP_COUNT> make_lookups()
+{
+    std::array<std::uint32_t, LOOKUP_COUNT> out{};
+    std::uint64_t state = 88172645463325252ULL;
+    for (std::uint32_t& key : out)
+    {
+        state ^= state << 13U;
+        state ^= state >> 7U;
+        state ^= state << 17U;
+        key = static_cast<std::uint32_t>(state % SIZE) * 7;
+    }
+    return out;
+}
+
+template <typename MapType, std::size_t SIZE>
+void benchmark_find(benchmark::State& state)
+{
+    static constexpr auto LOOKUPS = make_lookups<SIZE>();
+    MapType map{};
+    for (std::uint32_t i = 0; i < SIZE; i++)
+    {
+        map.try_emplace(i * 7, i);
+    }
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(map.find(LOOKUPS[i]));
+        i = (i + 1) % LOOKUP_COUNT;
+    }
+}
+}  // namespace
+
+BENCHMARK(benchmark_find<FixedLinearMap<std::uint32_t, std::uint32_t, 4>, 4>);
+BENCHMARK(benchmark_find<FixedMap<std::uint32_t, std::uint32_t, 4>, 4>);
+BENCHMARK(benchmark_find<FixedUnorderedMap<std::uint32_t, std::uint32_t, 4>, 4>);
+
+BENCHMARK(benchmark_find<FixedLinearMap<std::uint32_t, std::uint32_t, 8>, 8>);
+BENCHMARK(benchmark_find<FixedMap<std::uint32_t, std::uint32_t, 8>, 8>);
+BENCHMARK(benchmark_find<FixedUnorderedMap<std::uint32_t, std::uint32_t, 8>, 8>);
+
+BENCHMARK(benchmark_find<FixedLinearMap<std::uint32_t, std::uint32_t, 16>, 16>);
+BENCHMARK(benchmark_find<FixedMap<std::uint32_t, std::uint32_t, 16>, 16>);
+BENCHMARK(benchmark_find<FixedUnorderedMap<std::uint32_t, std::uint32_t, 16>, 16>);
+
+BENCHMARK(benchmark_find<FixedLinearMap<std::uint32_t, std::uint32_t, 32>, 32>);
+BENCHMARK(benchmark_find<FixedMap<std::uint32_t, std::uint32_t, 32>, 32>);
+BENCHMARK(benchmark_find<FixedUnorderedMap<std::uint32_t, std::uint32_t, 32>, 32>);
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
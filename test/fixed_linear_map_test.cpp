@@ -0,0 +1,341 @@
+#include "fixed_containers/fixed_linear_map.hpp"
+
+#include "mock_testing_types.hpp"
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers
+{
+namespace
+{
+using ES_1 = FixedLinearMap<int, int, 10>;
+static_assert(TriviallyCopyable<ES_1>);
+static_assert(NotTrivial<ES_1>);
+static_assert(StandardLayout<ES_1>);
+static_assert(IsStructuralType<ES_1>);
+
+static_assert(std::random_access_iterator<ES_1::iterator>);
+static_assert(std::random_access_iterator<ES_1::const_iterator>);
+static_assert(std::is_trivially_copyable_v<ES_1::iterator>);
+static_assert(std::is_same_v<std::iter_reference_t<ES_1::iterator>, std::pair<const int&, int&>>);
+static_assert(
+    std::is_same_v<std::iter_reference_t<ES_1::const_iterator>, std::pair<const int&, const int&>>);
+static_assert(std::ranges::random_access_range<ES_1>);
+
+// The keys are dense: one int per entry
+static_assert(sizeof(FixedLinearMap<std::uint32_t, std::uint32_t, 16>) <=
+              (16 * 4 * 2) + (2 * sizeof(std::size_t)) + 8);
+
+// Case-insensitive for ASCII letters
+struct CaseInsensitiveEqual
+{
+    constexpr bool operator()(const std::string_view lhs, const std::string_view rhs) const
+    {
+        return std::ranges::equal(lhs,
+                                  rhs,
+                                  [](const char a, const char b)
+                                  { return (a | 0x20) == (b | 0x20); });
+    }
+};
+}  // namespace
+
+TEST(FixedLinearMap, DefaultConstructor)
+{
+    constexpr ES_1 s1{};
+    static_assert(s1.empty());
+    static_assert(s1.max_size() == 10);
+    static_assert(ES_1::static_max_size() == 10);
+    static_assert(!is_full(s1));
+}
+
+TEST(FixedLinearMap, Initializer)
+{
+    constexpr FixedLinearMap<int, int, 10> s1{{2, 20}, {4, 40}, {2, 99}};
+    static_assert(s1.size() == 2);
+    static_assert(s1.at(2) == 20);
+    static_assert(s1.at(4) == 40);
+
+    constexpr std::array<std::pair<int, int>, 2> ENTRIES{{{1, 10}, {3, 30}}};
+    constexpr FixedLinearMap<int, int, 2> s2{ENTRIES.begin(), ENTRIES.end()};
+    static_assert(s2.size() == 2);
+    static_assert(is_full(s2));
+}
+
+TEST(FixedLinearMap, OperatorBracket)
+{
+    constexpr auto s1 = []()
+    {
+        FixedLinearMap<int, int, 10> s{};
+        s[2] = 25;
+        s[4] = 45;
+        s[2] += 1;
+        return s;
+    }();
+    static_assert(s1.size() == 2);
+    static_assert(s1.at(2) == 26);
+    static_assert(s1.at(4) == 45);
+
+    FixedLinearMap<int, int, 2> s2{};
+    s2[1] = 1;
+    s2[2] = 2;
+    EXPECT_DEATH(s2[3] = 3, "");
+}
+
+TEST(FixedLinearMap, At)
+{
+    FixedLinearMap<int, int, 10> s1{{2, 20}, {4, 40}};
+    s1.at(4) = 41;
+    EXPECT_EQ(41, s1.at(4));
+    EXPECT_DEATH((void)s1.at(3), "");
+    EXPECT_DEATH((void)std::as_const(s1).at(3), "");
+}
+
+TEST(FixedLinearMap, Insert)
+{
+    constexpr auto s1 = []()
+    {
+        FixedLinearMap<int, int, 10> s{};
+        auto [it, inserted] = s.insert({2, 20});
+        assert_or_abort(inserted && it->first == 2 && it->second == 20);
+        auto [it2, inserted2] = s.insert({2, 99});
+        assert_or_abort(!inserted2 && it2 == it && it2->second == 20);
+        s.insert({{4, 40}, {5, 50}});
+        return s;
+    }();
+    static_assert(s1.size() == 3);
+    static_assert(s1.at(2) == 20);
+    static_assert(s1.at(5) == 50);
+
+    FixedLinearMap<int, int, 1> s2{{1, 1}};
+    EXPECT_DEATH(s2.insert({2, 2}), "");
+}
+
+TEST(FixedLinearMap, InsertOrAssign)
+{
+    constexpr auto s1 = []()
+    {
+        FixedLinearMap<int, int, 10> s{};
+        auto [it, inserted] = s.insert_or_assign(2, 20);
+        assert_or_abort(inserted && it->second == 20);
+        auto [it2, inserted2] = s.insert_or_assign(2, 22);
+        assert_or_abort(!inserted2 && it2->second == 22);
+        s.insert_or_assign(s.cbegin(), 4, 40);
+        return s;
+    }();
+    static_assert(s1.size() == 2);
+    static_assert(s1.at(2) == 22);
+    static_assert(s1.at(4) == 40);
+}
+
+TEST(FixedLinearMap, TryEmplace)
+{
+    FixedLinearMap<int, std::string, 10> s1{};
+    auto [it, inserted] = s1.try_emplace(1, 3, 'a');
+    EXPECT_TRUE(inserted);
+    EXPECT_EQ("aaa", it->second);
+    std::tie(it, inserted) = s1.try_emplace(1, "ignored");
+    EXPECT_FALSE(inserted);
+    EXPECT_EQ("aaa", it->second);
+
+    std::tie(it, inserted) = s1.emplace(2, "bb");
+    EXPECT_TRUE(inserted);
+    EXPECT_EQ("bb", s1.at(2));
+    std::tie(it, inserted) = s1.emplace(std::pair<int, std::string>{3, "c"});
+    EXPECT_TRUE(inserted);
+    EXPECT_EQ(3, s1.size());
+}
+
+TEST(FixedLinearMap, EraseMovesLastEntryIntoTheHole)
+{
+    constexpr auto s1 = []()
+    {
+        FixedLinearMap<int, int, 10> s{{1, 10}, {2, 20}, {3, 30}, {4, 40}};
+        const auto it = s.erase(s.find(2));
+        assert_or_abort(it->first == 4);
+        assert_or_abort(s.erase(3) == 1);
+        assert_or_abort(s.erase(3) == 0);
+        return s;
+    }();
+    static_assert(s1.size() == 2);
+    static_assert(s1.begin()->first == 1);
+    static_assert(std::next(s1.begin())->first == 4);
+    static_assert(!s1.contains(2));
+    static_assert(!s1.contains(3));
+}
+
+TEST(FixedLinearMap, EraseRange)
+{
+    constexpr auto erase_range = [](const std::size_t from, const std::size_t to)
+    {
+        FixedLinearMap<int, int, 10> s{{0, 0}, {1, 1}, {2, 2}, {3, 3}, {4, 4}, {5, 5}};
+        const auto first = std::next(s.cbegin(), static_cast<std::ptrdiff_t>(from));
+        const auto last = std::next(s.cbegin(), static_cast<std::ptrdiff_t>(to));
+        s.erase(first, last);
+        return s;
+    };
+
+    // Fewer entries after the hole than in it
+    static_assert(erase_range(1, 5) == FixedLinearMap<int, int, 10>{{0, 0}, {5, 5}});
+    // More entries after the hole than in it
+    static_assert(erase_range(1, 2) ==
+                  FixedLinearMap<int, int, 10>{{0, 0}, {2, 2}, {3, 3}, {4, 4}, {5, 5}});
+    static_assert(erase_range(0, 6).empty());
+    static_assert(erase_range(3, 3).size() == 6);
+
+    constexpr auto s1 = erase_range(0, 2);
+    static_assert(s1.begin()->first == 4);
+    static_assert(std::next(s1.begin())->first == 5);
+}
+
+TEST(FixedLinearMap, EraseIf)
+{
+    constexpr auto s1 = []()
+    {
+        FixedLinearMap<int, int, 10> s{{1, 10}, {2, 20}, {3, 30}, {4, 40}, {5, 50}, {6, 60}};
+        const std::size_t removed =
+            erase_if(s, [](const auto& entry) { return entry.first % 2 == 0 || entry.first == 5; });
+        assert_or_abort(removed == 4);
+        return s;
+    }();
+    static_assert(s1 == FixedLinearMap<int, int, 10>{{1, 10}, {3, 30}});
+}
+
+TEST(FixedLinearMap, Iterators)
+{
+    constexpr FixedLinearMap<int, int, 10> s1{{3, 30}, {1, 10}, {2, 20}};
+    // Insertion order
+    static_assert(s1.begin()->first == 3);
+    static_assert(s1.rbegin()->first == 2);
+    static_assert(std::distance(s1.begin(), s1.end()) == 3);
+    static_assert(std::distance(s1.rbegin(), s1.rend()) == 3);
+    static_assert(s1.begin()[2].second == 20);
+
+    FixedLinearMap<int, int, 10> s2{{3, 30}, {1, 10}};
+    for (auto&& [key, value] : s2)
+    {
+        value += key;
+    }
+    EXPECT_EQ(33, s2.at(3));
+    EXPECT_EQ(11, s2.at(1));
+    ES_1::const_iterator it = s2.begin();
+    EXPECT_EQ(s2.cbegin(), it);
+}
+
+TEST(FixedLinearMap, Find)
+{
+    constexpr FixedLinearMap<int, int, 40> s1 = []()
+    {
+        FixedLinearMap<int, int, 40> s{};
+        for (int i = 0; i < 37; i++)
+        {
+            s[i * 3] = i;
+        }
+        return s;
+    }();
+    static_assert(s1.find(0)->second == 0);
+    static_assert(s1.find(108)->second == 36);
+    static_assert(s1.find(1) == s1.cend());
+    static_assert(s1.contains(96));
+    static_assert(s1.count(97) == 0);
+
+    // Past the blocks of the fast path, and at their boundaries
+    for (int i = 0; i < 37; i++)
+    {
+        EXPECT_EQ(i, s1.find(i * 3)->second);
+        EXPECT_FALSE(s1.contains((i * 3) + 1));
+    }
+
+    FixedLinearMap<int, int, 10> s2{{1, 10}};
+    s2.find(1)->second = 11;
+    EXPECT_EQ(11, s2.at(1));
+}
+
+TEST(FixedLinearMap, CustomKeyEqual)
+{
+    constexpr auto s1 = []()
+    {
+        FixedLinearMap<std::string_view, int, 10, CaseInsensitiveEqual> s{};
+        s["AAPL"] = 1;
+        s["aapl"] += 1;
+        s["Msft"] = 5;
+        return s;
+    }();
+    static_assert(s1.size() == 2);
+    static_assert(s1.at("aaPL") == 2);
+    static_assert(s1.contains("MSFT"));
+}
+
+TEST(FixedLinearMap, Equality)
+{
+    constexpr FixedLinearMap<int, int, 10> s1{{1, 10}, {2, 20}};
+    constexpr FixedLinearMap<int, int, 5> s2{{2, 20}, {1, 10}};
+    constexpr FixedLinearMap<int, int, 10> s3{{1, 10}, {2, 21}};
+    constexpr FixedLinearMap<int, int, 10> s4{{1, 10}};
+    static_assert(s1 == s2);
+    static_assert(s1 != s3);
+    static_assert(s1 != s4);
+    static_assert(s4 != s1);
+}
+
+TEST(FixedLinearMap, NonTriviallyCopyable)
+{
+    using MapType = FixedLinearMap<MockNonTrivialInt, MockNonTrivialInt, 5>;
+    static_assert(!TriviallyCopyable<MapType>);
+
+    MapType s1{};
+    s1.try_emplace(1, 10);
+    s1.try_emplace(2, 20);
+    s1.try_emplace(3, 30);
+    s1.erase(1);
+    MapType s2 = s1;
+    EXPECT_EQ(s1, s2);
+    EXPECT_EQ(30, s2.at(3).value);
+    s2.clear();
+    EXPECT_TRUE(s2.empty());
+}
+
+TEST(FixedLinearMap, MatchesStdMap)
+{
+    FixedLinearMap<std::int64_t, std::int64_t, 32> s1{};
+    std::map<std::int64_t, std::int64_t> expected{};
+    std::uint64_t state = 88172645463325252ULL;
+    for (std::size_t i = 0; i < 5000; i++)
+    {
+        state ^= state << 13U;
+        state ^= state >> 7U;
+        state ^= state << 17U;
+        const auto key = static_cast<std::int64_t>(state % 48);
+        if (state % 3 == 0 || s1.size() == 32)
+        {
+            EXPECT_EQ(expected.erase(key), s1.erase(key));
+        }
+        else
+        {
+            s1[key] += static_cast<std::int64_t>(i);
+            expected[key] += static_cast<std::int64_t>(i);
+        }
+        ASSERT_EQ(expected.size(), s1.size());
+    }
+    for (const auto& [key, value] : s1)
+    {
+        EXPECT_EQ(expected.at(key), value);
+    }
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,157 @@
+#include "fixed_containers/fixed_linear_set.hpp"
+
+#include "mock_testing_types.hpp"
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <set>
+#include <string>
+#include <type_traits>
+
+namespace fixed_containers
+{
+namespace
+{
+using ES_1 = FixedLinearSet<int, 10>;
+static_assert(TriviallyCopyable<ES_1>);
+static_assert(NotTrivial<ES_1>);
+static_assert(StandardLayout<ES_1>);
+static_assert(IsStructuralType<ES_1>);
+
+static_assert(std::random_access_iterator<ES_1::const_iterator>);
+static_assert(std::is_same_v<ES_1::iterator, ES_1::const_iterator>);
+static_assert(std::is_same_v<std::iter_reference_t<ES_1::iterator>, const int&>);
+static_assert(std::ranges::random_access_range<ES_1>);
+
+enum class Side : std::uint8_t
+{
+    BUY,
+    SELL,
+};
+}  // namespace
+
+TEST(FixedLinearSet, Insert)
+{
+    constexpr auto s1 = []()
+    {
+        FixedLinearSet<int, 10> s{};
+        auto [it, inserted] = s.insert(2);
+        assert_or_abort(inserted && *it == 2);
+        auto [it2, inserted2] = s.insert(2);
+        assert_or_abort(!inserted2 && it2 == it);
+        s.insert({4, 5, 4});
+        s.emplace(7);
+        return s;
+    }();
+    static_assert(s1.size() == 4);
+    static_assert(s1.contains(4));
+    static_assert(s1.count(7) == 1);
+    static_assert(!s1.contains(3));
+    // Insertion order
+    static_assert(*s1.begin() == 2);
+    static_assert(*s1.rbegin() == 7);
+
+    FixedLinearSet<int, 2> s2{1, 2};
+    static_assert(FixedLinearSet<int, 2>{1, 2}.size() == 2);
+    EXPECT_TRUE(is_full(s2));
+    EXPECT_DEATH(s2.insert(3), "");
+}
+
+TEST(FixedLinearSet, Erase)
+{
+    constexpr auto s1 = []()
+    {
+        FixedLinearSet<int, 10> s{1, 2, 3, 4, 5, 6};
+        const auto it = s.erase(s.find(2));
+        assert_or_abort(*it == 6);
+        assert_or_abort(s.erase(3) == 1);
+        assert_or_abort(s.erase(3) == 0);
+        s.erase(s.begin(), std::next(s.begin()));
+        return s;
+    }();
+    static_assert(s1 == FixedLinearSet<int, 10>{4, 5, 6});
+
+    constexpr auto s2 = []()
+    {
+        FixedLinearSet<int, 10> s{1, 2, 3, 4, 5, 6};
+        erase_if(s, [](const int i) { return i % 3 != 0; });
+        return s;
+    }();
+    static_assert(s2 == FixedLinearSet<int, 10>{3, 6});
+}
+
+TEST(FixedLinearSet, Find)
+{
+    static constexpr FixedLinearSet<Side, 2> S1{Side::SELL};
+    static_assert(S1.find(Side::SELL) == S1.cbegin());
+    static_assert(S1.find(Side::BUY) == S1.cend());
+
+    // Keys of one byte: a single block of the fast path holds 32 of them
+    FixedLinearSet<std::uint8_t, 64> s2{};
+    for (std::uint8_t i = 0; i < 64; i++)
+    {
+        s2.insert(static_cast<std::uint8_t>(i * 2));
+    }
+    for (std::uint8_t i = 0; i < 64; i++)
+    {
+        EXPECT_EQ(i, std::distance(s2.begin(), s2.find(static_cast<std::uint8_t>(i * 2))));
+        EXPECT_FALSE(s2.contains(static_cast<std::uint8_t>((i * 2) + 1)));
+    }
+}
+
+TEST(FixedLinearSet, Equality)
+{
+    static_assert(FixedLinearSet<int, 10>{1, 2} == FixedLinearSet<int, 4>{2, 1});
+    static_assert(FixedLinearSet<int, 10>{1, 2} != FixedLinearSet<int, 10>{1, 3});
+    static_assert(FixedLinearSet<int, 10>{1, 2} != FixedLinearSet<int, 10>{1});
+}
+
+TEST(FixedLinearSet, NonTriviallyCopyable)
+{
+    FixedLinearSet<std::string, 5> s1{"a", "b", "c"};
+    s1.erase("a");
+    const FixedLinearSet<std::string, 5> s2 = s1;
+    EXPECT_EQ(s1, s2);
+    EXPECT_TRUE(s2.contains("c"));
+    EXPECT_FALSE(s2.contains("a"));
+
+    FixedLinearSet<MockNonTrivialInt, 5> s3{};
+    s3.insert(MockNonTrivialInt{1});
+    s3.emplace(2);
+    EXPECT_EQ(2, s3.size());
+}
+
+TEST(FixedLinearSet, MatchesStdSet)
+{
+    FixedLinearSet<std::uint16_t, 32> s1{};
+    std::set<std::uint16_t> expected{};
+    std::uint64_t state = 88172645463325252ULL;
+    for (std::size_t i = 0; i < 5000; i++)
+    {
+        state ^= state << 13U;
+        state ^= state >> 7U;
+        state ^= state << 17U;
+        const auto key = static_cast<std::uint16_t>(state % 48);
+        if (state % 3 == 0 || s1.size() == 32)
+        {
+            EXPECT_EQ(expected.erase(key), s1.erase(key));
+        }
+        else
+        {
+            EXPECT_EQ(expected.insert(key).second, s1.insert(key).second);
+        }
+        ASSERT_EQ(expected.size(), s1.size());
+    }
+    for (const std::uint16_t key : s1)
+    {
+        EXPECT_TRUE(expected.contains(key));
+    }
+}
+
+}  // namespace fixed_containers
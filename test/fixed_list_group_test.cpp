@@ -0,0 +1,405 @@
+#include "fixed_containers/fixed_list_group.hpp"
+
+#include "instance_counter.hpp"
+#include "mock_testing_types.hpp"
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <utility>
+
+namespace fixed_containers
+{
+namespace
+{
+// Static assert for expected type properties
+namespace trivially_copyable_list_group
+{
+using GroupType = FixedListGroup<int, 5, 3>;
+static_assert(TriviallyCopyable<GroupType>);
+static_assert(NotTrivial<GroupType>);
+static_assert(StandardLayout<GroupType>);
+static_assert(IsStructuralType<GroupType>);
+
+static_assert(std::bidirectional_iterator<GroupType::list_reference::iterator>);
+static_assert(std::bidirectional_iterator<GroupType::list_reference::const_iterator>);
+static_assert(std::bidirectional_iterator<GroupType::const_list_reference::iterator>);
+static_assert(std::ranges::bidirectional_range<GroupType::list_reference>);
+
+static_assert(std::is_trivially_copyable_v<GroupType::list_reference>);
+static_assert(std::is_convertible_v<GroupType::list_reference, GroupType::const_list_reference>);
+static_assert(
+    !std::is_convertible_v<GroupType::const_list_reference, GroupType::list_reference>);
+}  // namespace trivially_copyable_list_group
+
+}  // namespace
+
+TEST(FixedListGroup, DefaultConstructor)
+{
+    constexpr FixedListGroup<int, 8, 3> g{};
+    static_assert(g.empty());
+    static_assert(g.size() == 0);
+    static_assert(g.max_size() == 8);
+    static_assert(g.list_count() == 3);
+    static_assert(g.list(0).empty());
+    static_assert(g.list(2).empty());
+}
+
+TEST(FixedListGroup, PushAndPop)
+{
+    constexpr auto g1 = []()
+    {
+        FixedListGroup<int, 8, 2> g{};
+        g.list(0).push_back(1);
+        g.list(0).push_back(2);
+        g.list(0).push_front(0);
+        g.list(1).emplace_back(10);
+        g.list(1).emplace_front(9);
+        g.list(1).push_back(11);
+        g.list(1).pop_front();
+        g.list(0).pop_back();
+        return g;
+    }();
+
+    static_assert(std::ranges::equal(g1.list(0), std::array{0, 1}));
+    static_assert(std::ranges::equal(g1.list(1), std::array{10, 11}));
+    static_assert(g1.list(0).size() == 2);
+    static_assert(g1.list(1).front() == 10);
+    static_assert(g1.list(1).back() == 11);
+    static_assert(g1.size() == 4);
+}
+
+TEST(FixedListGroup, ReverseIteration)
+{
+    constexpr auto g1 = []()
+    {
+        FixedListGroup<int, 8, 2> g{};
+        g.list(1).push_back(1);
+        g.list(1).push_back(2);
+        g.list(1).push_back(3);
+        return g;
+    }();
+
+    static_assert(std::ranges::equal(std::ranges::reverse_view(g1.list(1)), std::array{3, 2, 1}));
+}
+
+TEST(FixedListGroup, SharedCapacity)
+{
+    FixedListGroup<int, 3, 2> g{};
+    g.list(0).push_back(1);
+    g.list(1).push_back(2);
+    g.list(1).push_back(3);
+    EXPECT_TRUE(g.full());
+    EXPECT_TRUE(is_full(g));
+    EXPECT_DEATH(g.list(0).push_back(4), "");
+
+    g.list(1).pop_back();
+    g.list(0).push_back(4);
+    EXPECT_TRUE(std::ranges::equal(g.list(0), std::array{1, 4}));
+}
+
+TEST(FixedListGroup, ListIndex_OutOfBounds)
+{
+    FixedListGroup<int, 3, 2> g{};
+    EXPECT_DEATH((void)g.list(2), "");
+}
+
+TEST(FixedListGroup, Front_EmptyContainer)
+{
+    FixedListGroup<int, 3, 2> g{};
+    EXPECT_DEATH((void)g.list(0).front(), "");
+    EXPECT_DEATH(g.list(1).pop_back(), "");
+}
+
+TEST(FixedListGroup, InsertAndErase)
+{
+    constexpr auto g1 = []()
+    {
+        FixedListGroup<int, 8, 2> g{};
+        auto l = g.list(1);
+        l.push_back(0);
+        l.push_back(3);
+        auto it = l.insert(std::next(l.cbegin()), 1);
+        l.emplace(std::next(it), 2);
+        l.erase(l.cbegin());
+        return g;
+    }();
+
+    static_assert(std::ranges::equal(g1.list(1), std::array{1, 2, 3}));
+    static_assert(g1.size() == 3);
+
+    constexpr auto g2 = []()
+    {
+        FixedListGroup<int, 8, 2> g{};
+        auto l = g.list(0);
+        for (int i = 0; i < 6; i++)
+        {
+            l.push_back(i);
+        }
+        auto it = l.erase(std::next(l.cbegin()), std::next(l.cbegin(), 4));
+        assert_or_abort(*it == 4);
+        assert_or_abort(1 == l.remove(5));
+        assert_or_abort(1 == l.remove_if([](int a) { return a == 0; }));
+        return g;
+    }();
+
+    static_assert(std::ranges::equal(g2.list(0), std::array{4}));
+}
+
+TEST(FixedListGroup, Clear)
+{
+    FixedListGroup<int, 8, 2> g{};
+    g.list(0).push_back(1);
+    g.list(1).push_back(2);
+    g.list(1).clear();
+    EXPECT_EQ(1, g.size());
+    EXPECT_TRUE(g.list(1).empty());
+
+    g.clear();
+    EXPECT_TRUE(g.empty());
+    EXPECT_TRUE(g.list(0).empty());
+}
+
+TEST(FixedListGroup, SpliceOne)
+{
+    constexpr auto g1 = []()
+    {
+        FixedListGroup<int, 8, 2> g{};
+        auto l0 = g.list(0);
+        auto l1 = g.list(1);
+        l0.push_back(0);
+        l0.push_back(1);
+        l1.push_back(10);
+        l1.push_back(11);
+        l1.splice(l1.cbegin(), l0, std::next(l0.cbegin()));
+        l1.splice(l1.cend(), l1, l1.cbegin());
+        return g;
+    }();
+
+    static_assert(std::ranges::equal(g1.list(0), std::array{0}));
+    static_assert(std::ranges::equal(g1.list(1), std::array{10, 11, 1}));
+    static_assert(g1.list(0).size() == 1);
+    static_assert(g1.list(1).size() == 3);
+}
+
+TEST(FixedListGroup, SpliceAll)
+{
+    constexpr auto g1 = []()
+    {
+        FixedListGroup<int, 8, 3> g{};
+        g.list(0).push_back(0);
+        g.list(0).push_back(1);
+        g.list(2).push_back(20);
+        g.list(2).push_back(21);
+        g.list(2).splice(std::next(g.list(2).cbegin()), g.list(0));
+        return g;
+    }();
+
+    static_assert(g1.list(0).empty());
+    static_assert(std::ranges::equal(g1.list(2), std::array{20, 0, 1, 21}));
+    static_assert(g1.list(2).size() == 4);
+    static_assert(g1.size() == 4);
+}
+
+TEST(FixedListGroup, SpliceRange)
+{
+    constexpr auto g1 = []()
+    {
+        FixedListGroup<int, 8, 2> g{};
+        auto l0 = g.list(0);
+        auto l1 = g.list(1);
+        for (int i = 0; i < 5; i++)
+        {
+            l0.push_back(i);
+        }
+        l1.push_back(10);
+        l1.splice(l1.cend(), l0, std::next(l0.cbegin()), std::next(l0.cbegin(), 3));
+        l0.splice(l0.cbegin(), l0, std::next(l0.cbegin(), 2), l0.cend());
+        return g;
+    }();
+
+    static_assert(std::ranges::equal(g1.list(0), std::array{4, 0, 3}));
+    static_assert(std::ranges::equal(g1.list(1), std::array{10, 1, 2}));
+    static_assert(g1.list(0).size() == 3);
+    static_assert(g1.list(1).size() == 3);
+}
+
+TEST(FixedListGroup, Splice_Invalidation)
+{
+    FixedListGroup<int, 8, 2> g{};
+    auto l0 = g.list(0);
+    auto l1 = g.list(1);
+    l0.push_back(0);
+    l0.push_back(1);
+    auto it = std::next(l0.begin());
+    const int* address{&*it};
+
+    l1.splice(l1.cend(), l0, it);
+    EXPECT_EQ(l1.begin(), it);
+    EXPECT_EQ(address, &*it);
+    *it = 5;
+    EXPECT_EQ(5, l1.front());
+}
+
+TEST(FixedListGroup, Splice_Self)
+{
+    FixedListGroup<int, 8, 2> g{};
+    g.list(0).push_back(0);
+    EXPECT_DEATH(g.list(0).splice(g.list(0).cend(), g.list(0)), "");
+}
+
+TEST(FixedListGroup, Splice_DifferentGroups)
+{
+    FixedListGroup<int, 8, 2> g1{};
+    FixedListGroup<int, 8, 2> g2{};
+    g2.list(0).push_back(0);
+    EXPECT_DEATH(g1.list(0).splice(g1.list(0).cend(), g2.list(0)), "");
+}
+
+TEST(FixedListGroup, Merge)
+{
+    constexpr auto g1 = []()
+    {
+        FixedListGroup<int, 16, 2> g{};
+        for (const int i : {1, 3, 5, 7})
+        {
+            g.list(0).push_back(i);
+        }
+        for (const int i : {0, 3, 4, 8, 9})
+        {
+            g.list(1).push_back(i);
+        }
+        g.list(0).merge(g.list(1));
+        return g;
+    }();
+
+    static_assert(std::ranges::equal(g1.list(0), std::array{0, 1, 3, 3, 4, 5, 7, 8, 9}));
+    static_assert(g1.list(0).size() == 9);
+    static_assert(g1.list(1).empty());
+}
+
+TEST(FixedListGroup, SortUniqueReverse)
+{
+    constexpr auto g1 = []()
+    {
+        FixedListGroup<int, 16, 2> g{};
+        for (const int i : {5, 3, 9, 1, 0, 7, 3, 9})
+        {
+            g.list(1).push_back(i);
+        }
+        g.list(0).push_back(100);
+        g.list(1).sort();
+        assert_or_abort(2 == g.list(1).unique());
+        g.list(1).reverse();
+        return g;
+    }();
+
+    static_assert(std::ranges::equal(g1.list(0), std::array{100}));
+    static_assert(std::ranges::equal(g1.list(1), std::array{9, 7, 5, 3, 1, 0}));
+    static_assert(std::ranges::equal(std::ranges::reverse_view(g1.list(1)),
+                                     std::array{0, 1, 3, 5, 7, 9}));
+    static_assert(g1.list(1).size() == 6);
+}
+
+TEST(FixedListGroup, Sort_Stable)
+{
+    FixedListGroup<std::pair<int, int>, 64, 2> g{};
+    for (int i = 0; i < 32; i++)
+    {
+        g.list(i % 2).push_back({(i * 37) % 5, i});
+    }
+
+    g.list(1).sort([](const auto& a, const auto& b) { return a.first < b.first; });
+    EXPECT_EQ(16, g.list(1).size());
+    EXPECT_TRUE(std::ranges::is_sorted(g.list(1)));
+}
+
+TEST(FixedListGroup, ConstListReference)
+{
+    FixedListGroup<int, 8, 2> g{};
+    g.list(0).push_back(1);
+    const auto& g_const_ref = g;
+    const FixedListGroup<int, 8, 2>::const_list_reference l0 = g_const_ref.list(0);
+    EXPECT_EQ(1, l0.front());
+    g.list(0).front() = 2;
+    EXPECT_EQ(2, *l0.begin());
+}
+
+TEST(FixedListGroup, NonTriviallyCopyable)
+{
+    using InstanceCounterType =
+        instance_counter::InstanceCounterNonTrivialAssignment<FixedListGroup<int, 8, 2>>;
+    static_assert(!TriviallyCopyable<FixedListGroup<InstanceCounterType, 8, 2>>);
+
+    InstanceCounterType::counter = 0;
+    {
+        FixedListGroup<InstanceCounterType, 8, 2> g1{};
+        g1.list(0).emplace_back(1);
+        g1.list(1).emplace_back(2);
+        g1.list(1).emplace_back(3);
+        g1.list(0).splice(g1.list(0).cbegin(), g1.list(1), g1.list(1).cbegin());
+        EXPECT_EQ(3, InstanceCounterType::counter);
+
+        FixedListGroup<InstanceCounterType, 8, 2> g2{g1};
+        EXPECT_EQ(6, InstanceCounterType::counter);
+        EXPECT_EQ(2, g2.list(0).size());
+        EXPECT_EQ(2, g2.list(0).front().get());
+        EXPECT_EQ(3, g2.list(1).front().get());
+
+        FixedListGroup<InstanceCounterType, 8, 2> g3{std::move(g2)};
+        EXPECT_EQ(6, InstanceCounterType::counter);
+        EXPECT_TRUE(g2.empty());  // NOLINT(bugprone-use-after-move)
+
+        g3 = g1;
+        EXPECT_EQ(6, InstanceCounterType::counter);
+        g3.list(1).clear();
+        EXPECT_EQ(5, InstanceCounterType::counter);
+    }
+    EXPECT_EQ(0, InstanceCounterType::counter);
+}
+
+TEST(FixedListGroup, MoveableButNotCopyable)
+{
+    FixedListGroup<MockMoveableButNotCopyable, 8, 2> g{};
+    g.list(0).emplace_back();
+    g.list(0).emplace_back();
+    g.list(1).splice(g.list(1).cend(), g.list(0));
+    EXPECT_EQ(2, g.list(1).size());
+}
+
+TEST(FixedListGroup, OrderQueues)
+{
+    // One FIFO queue of order ids per price level; orders that change price move between queues
+    // without being copied.
+    struct Order
+    {
+        int id;
+        int quantity;
+    };
+    FixedListGroup<Order, 32, 4> levels{};
+    for (int id = 0; id < 8; id++)
+    {
+        levels.list(static_cast<std::size_t>(id % 4)).push_back({id, 10 * id});
+    }
+
+    auto from = levels.list(1);
+    auto to = levels.list(3);
+    auto it = std::ranges::find_if(from, [](const Order& o) { return o.id == 5; });
+    to.splice(to.cend(), from, it);
+
+    EXPECT_EQ(1, from.size());
+    EXPECT_EQ(3, to.size());
+    EXPECT_EQ(5, to.back().id);
+    EXPECT_EQ(50, to.back().quantity);
+    EXPECT_EQ(8, levels.size());
+}
+
+}  // namespace fixed_containers
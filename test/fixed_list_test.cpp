@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <functional>
 #include <iterator>
 #include <list>
 #include <ranges>
@@ -1794,6 +1795,222 @@ TEST(FixedList, EraseIf_Invalidation)
     EXPECT_EQ(address_5, &*it5);
 }
 
+TEST(FixedList, SpliceSameList)
+{
+    constexpr auto v1 = []()
+    {
+        FixedList<int, 8> v{0, 1, 2, 3, 4, 5};
+        v.splice(v.cbegin(), v, std::next(v.cbegin(), 3), std::next(v.cbegin(), 5));
+        return v;
+    }();
+
+    static_assert(std::ranges::equal(v1, std::array<int, 6>{3, 4, 0, 1, 2, 5}));
+    static_assert(v1.size() == 6);
+
+    constexpr auto v2 = []()
+    {
+        FixedList<int, 8> v{0, 1, 2, 3};
+        v.splice(v.cend(), v, v.cbegin());
+        v.splice(v.cbegin(), v, v.cbegin());               // No-op
+        v.splice(std::next(v.cbegin()), v, v.cbegin());  // No-op
+        return v;
+    }();
+
+    static_assert(std::ranges::equal(v2, std::array<int, 4>{1, 2, 3, 0}));
+}
+
+TEST(FixedList, SpliceSameList_Invalidation)
+{
+    FixedList<int, 8> v{10, 20, 30, 40};
+    auto it1 = v.begin();
+    auto it4 = std::next(v.begin(), 3);
+    const int* address_1{&*it1};
+    const int* address_4{&*it4};
+
+    v.splice(v.cbegin(), v, it4);
+    EXPECT_TRUE(std::ranges::equal(v, std::array<int, 4>{40, 10, 20, 30}));
+    EXPECT_EQ(v.begin(), it4);
+    EXPECT_EQ(std::next(v.begin()), it1);
+    EXPECT_EQ(address_1, &*it1);
+    EXPECT_EQ(address_4, &*it4);
+}
+
+TEST(FixedList, SpliceOtherList)
+{
+    constexpr auto v1 = []()
+    {
+        FixedList<int, 8> v{0, 1, 2};
+        FixedList<int, 8> other{10, 11, 12, 13};
+        v.splice(std::next(v.cbegin()), other, std::next(other.cbegin()), other.cend());
+        assert_or_abort(other.size() == 1);
+        v.splice(v.cbegin(), other, other.cbegin());
+        assert_or_abort(other.empty());
+        return v;
+    }();
+
+    static_assert(std::ranges::equal(v1, std::array<int, 7>{10, 0, 11, 12, 13, 1, 2}));
+
+    constexpr auto v2 = []()
+    {
+        FixedList<int, 8> v{0, 1};
+        FixedList<int, 8> other{10, 11};
+        v.splice(v.cend(), other);
+        assert_or_abort(other.empty());
+        return v;
+    }();
+
+    static_assert(std::ranges::equal(v2, std::array<int, 4>{0, 1, 10, 11}));
+}
+
+TEST(FixedList, SpliceOtherList_ExceedsCapacity)
+{
+    FixedList<int, 3> v{0, 1};
+    FixedList<int, 3> other{10, 11};
+    EXPECT_DEATH(v.splice(v.cend(), other), "");
+}
+
+TEST(FixedList, Splice_Self)
+{
+    FixedList<int, 3> v{0, 1};
+    EXPECT_DEATH(v.splice(v.cend(), v), "");
+}
+
+TEST(FixedList, Merge)
+{
+    constexpr auto v1 = []()
+    {
+        FixedList<int, 10> v{1, 3, 5, 7};
+        FixedList<int, 10> other{0, 3, 4, 8, 9};
+        v.merge(other);
+        assert_or_abort(other.empty());
+        return v;
+    }();
+
+    static_assert(std::ranges::equal(v1, std::array<int, 9>{0, 1, 3, 3, 4, 5, 7, 8, 9}));
+
+    constexpr auto v2 = []()
+    {
+        FixedList<int, 10> v{7, 5, 1};
+        FixedList<int, 10> other{6, 2};
+        v.merge(other, std::greater<>{});
+        return v;
+    }();
+
+    static_assert(std::ranges::equal(v2, std::array<int, 5>{7, 6, 5, 2, 1}));
+}
+
+TEST(FixedList, Merge_ExceedsCapacity)
+{
+    FixedList<int, 3> v{0, 1};
+    FixedList<int, 3> other{10, 11};
+    EXPECT_DEATH(v.merge(other), "");
+}
+
+TEST(FixedList, Unique)
+{
+    constexpr auto v1 = []()
+    {
+        FixedList<int, 10> v{1, 1, 2, 3, 3, 3, 1, 4, 4};
+        std::size_t removed_count = v.unique();
+        assert_or_abort(4 == removed_count);
+        return v;
+    }();
+
+    static_assert(std::ranges::equal(v1, std::array<int, 5>{1, 2, 3, 1, 4}));
+
+    constexpr auto v2 = []()
+    {
+        FixedList<int, 10> v{1, 2, 4, 5, 7};
+        // Compares against the first element of each run
+        v.unique([](int a, int b) { return b - a <= 1; });
+        return v;
+    }();
+
+    static_assert(std::ranges::equal(v2, std::array<int, 3>{1, 4, 7}));
+
+    FixedList<int, 3> v3{};
+    EXPECT_EQ(0, v3.unique());
+}
+
+TEST(FixedList, Reverse)
+{
+    constexpr auto v1 = []()
+    {
+        FixedList<int, 8> v{0, 1, 2, 3, 4};
+        v.reverse();
+        return v;
+    }();
+
+    static_assert(std::ranges::equal(v1, std::array<int, 5>{4, 3, 2, 1, 0}));
+    static_assert(v1.front() == 4);
+    static_assert(v1.back() == 0);
+    static_assert(std::ranges::equal(std::ranges::reverse_view(v1), std::array{0, 1, 2, 3, 4}));
+
+    FixedList<int, 8> v2{};
+    v2.reverse();
+    EXPECT_TRUE(v2.empty());
+}
+
+TEST(FixedList, Sort)
+{
+    constexpr auto v1 = []()
+    {
+        FixedList<int, 16> v{5, 3, 9, 1, 0, 7, 8, 2, 6, 4, 3};
+        v.sort();
+        return v;
+    }();
+
+    static_assert(std::ranges::equal(v1, std::array{0, 1, 2, 3, 3, 4, 5, 6, 7, 8, 9}));
+    static_assert(std::ranges::equal(std::ranges::reverse_view(v1),
+                                     std::array{9, 8, 7, 6, 5, 4, 3, 3, 2, 1, 0}));
+
+    constexpr auto v2 = []()
+    {
+        FixedList<int, 16> v{5, 3, 9, 1};
+        v.sort(std::greater<>{});
+        return v;
+    }();
+
+    static_assert(std::ranges::equal(v2, std::array{9, 5, 3, 1}));
+}
+
+TEST(FixedList, Sort_Stable)
+{
+    FixedList<std::pair<int, int>, 64> v{};
+    for (int i = 0; i < 64; i++)
+    {
+        v.push_back({(i * 37) % 5, i});
+    }
+
+    v.sort([](const auto& a, const auto& b) { return a.first < b.first; });
+    EXPECT_EQ(64, v.size());
+    EXPECT_TRUE(std::ranges::is_sorted(v));
+}
+
+TEST(FixedList, Sort_Invalidation)
+{
+    FixedList<int, 8> v{30, 10, 20};
+    auto it1 = v.begin();
+    auto it2 = std::next(v.begin(), 1);
+    auto it3 = std::next(v.begin(), 2);
+    const int* address_1{&*it1};
+
+    v.sort();
+    EXPECT_EQ(v.begin(), it2);
+    EXPECT_EQ(std::next(v.begin()), it3);
+    EXPECT_EQ(std::next(v.begin(), 2), it1);
+    EXPECT_EQ(address_1, &*it1);
+}
+
+TEST(FixedList, Sort_MoveableButNotCopyable)
+{
+    FixedList<MockMoveableButNotCopyable, 8> v{};
+    v.emplace_back();
+    v.emplace_back();
+    v.sort([](const auto& /*a*/, const auto& /*b*/) { return false; });
+    EXPECT_EQ(2, v.size());
+}
+
 TEST(FixedList, Front)
 {
     constexpr auto v1 = []()
@@ -0,0 +1,112 @@
+#include "fixed_containers/fixed_map.hpp"
+#include "fixed_containers/fixed_unordered_map.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+
+namespace fixed_containers
+{
+namespace
+{
+// A program with many map instantiations, as in a large codebase. Everything that depends only
+// on node indices (red-black rebalancing, robinhood bucket shifting) is shared between them; only
+// key comparison and hashing are instantiated per map. Compare the size of this binary across
+// changes to the tree/hashtable internals.
+constexpr std::size_t INSTANTIATION_COUNT = 50;
+constexpr std::size_t BASE_CAPACITY = 64;
+
+template <template <typename, typename, std::size_t> typename MapTemplate, std::size_t... INDICES>
+auto make_maps(std::index_sequence<INDICES...> /*unused*/)
+{
+    return std::tuple<MapTemplate<std::int64_t, std::int64_t, BASE_CAPACITY + INDICES>...>{};
+}
+
+template <typename K, typename V, std::size_t MAXIMUM_SIZE>
+using SortedMap = FixedMap<K, V, MAXIMUM_SIZE>;
+template <typename K, typename V, std::size_t MAXIMUM_SIZE>
+using UnorderedMap = FixedUnorderedMap<K, V, MAXIMUM_SIZE>;
+
+using SortedMaps =
+    decltype(make_maps<SortedMap>(std::make_index_sequence<INSTANTIATION_COUNT>{}));
+using UnorderedMaps =
+    decltype(make_maps<UnorderedMap>(std::make_index_sequence<INSTANTIATION_COUNT>{}));
+
+// Insert and erase enough to keep rebalancing/shifting busy
+template <typename MapType>
+[[gnu::noinline]] std::int64_t churn(MapType& map, const std::int64_t seed)
+{
+    for (std::int64_t i = 0; i < 16; i++)
+    {
+        map.try_emplace((seed + i * 7919) % 1024, i);
+    }
+    std::int64_t sum = 0;
+    while (map.size() > BASE_CAPACITY / 2)
+    {
+        sum += map.begin()->second;
+        map.erase(map.begin());
+    }
+    return sum;
+}
+
+template <typename Maps>
+void benchmark_churn(benchmark::State& state)
+{
+    Maps maps{};
+    for (auto _ : state)
+    {
+        std::int64_t sum = 0;
+        std::apply([&](auto&... map) { ((sum += churn(map, sum)), ...); }, maps);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(INSTANTIATION_COUNT));
+}
+
+template <typename MapType>
+void benchmark_lookup(benchmark::State& state)
+{
+    MapType map{};
+    for (std::int64_t i = 0; i < static_cast<std::int64_t>(map.max_size()); i++)
+    {
+        map.try_emplace(i * 3, i);
+    }
+
+    std::int64_t key = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(map.find(key));
+        key = (key + 5) % static_cast<std::int64_t>(map.max_size() * 3);
+    }
+}
+}  // namespace
+
+static void benchmark_churn_fixed_map(benchmark::State& state)
+{
+    benchmark_churn<SortedMaps>(state);
+}
+BENCHMARK(benchmark_churn_fixed_map);
+
+static void benchmark_churn_fixed_unordered_map(benchmark::State& state)
+{
+    benchmark_churn<UnorderedMaps>(state);
+}
+BENCHMARK(benchmark_churn_fixed_unordered_map);
+
+static void benchmark_lookup_fixed_map(benchmark::State& state)
+{
+    benchmark_lookup<SortedMap<std::int64_t, std::int64_t, 1024>>(state);
+}
+BENCHMARK(benchmark_lookup_fixed_map);
+
+static void benchmark_lookup_fixed_unordered_map(benchmark::State& state)
+{
+    benchmark_lookup<UnorderedMap<std::int64_t, std::int64_t, 1024>>(state);
+}
+BENCHMARK(benchmark_lookup_fixed_unordered_map);
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -0,0 +1,449 @@
+#include "fixed_containers/fixed_multi_index.hpp"
+
+#include "instance_counter.hpp"
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <string_view>
+
+namespace fixed_containers
+{
+namespace
+{
+struct Order
+{
+    int id;
+    int price;
+    int sequence_number;
+};
+
+// Index 0: lookup by id, 1: price levels with time priority, 2: unique sequence numbers
+constexpr std::size_t BY_ID = 0;
+constexpr std::size_t BY_PRICE = 1;
+constexpr std::size_t BY_SEQUENCE = 2;
+using OrderBook = FixedMultiIndex<
+    Order,
+    16,
+    multi_index::IndexedBy<multi_index::HashedUnique<multi_index::Member<&Order::id>>,
+                           multi_index::OrderedNonUnique<multi_index::Member<&Order::price>>,
+                           multi_index::OrderedUnique<multi_index::Member<&Order::sequence_number>,
+                                                      std::greater<>>>>;
+
+// Static assert for expected type properties
+namespace trivially_copyable_multi_index
+{
+static_assert(TriviallyCopyable<OrderBook>);
+static_assert(NotTrivial<OrderBook>);
+static_assert(StandardLayout<OrderBook>);
+static_assert(IsStructuralType<OrderBook>);
+
+static_assert(std::bidirectional_iterator<OrderBook::const_iterator>);
+static_assert(std::bidirectional_iterator<OrderBook::index_view<BY_PRICE>::const_iterator>);
+static_assert(std::ranges::bidirectional_range<OrderBook::const_index_view<BY_SEQUENCE>>);
+// Hashed indices iterate in insertion order, like the container itself
+static_assert(
+    std::same_as<OrderBook::const_iterator, OrderBook::index_view<BY_ID>::const_iterator>);
+
+static_assert(OrderBook::index_count() == 3);
+}  // namespace trivially_copyable_multi_index
+
+constexpr OrderBook make_order_book()
+{
+    OrderBook book{};
+    book.insert({1, 100, 1});
+    book.insert({2, 101, 2});
+    book.insert({3, 100, 3});
+    book.insert({4, 99, 4});
+    book.insert({5, 101, 5});
+    return book;
+}
+
+template <std::size_t N>
+constexpr bool ids_equal(const auto& range, const std::array<int, N>& expected)
+{
+    return std::ranges::equal(range, expected, std::equal_to<>{}, &Order::id);
+}
+
+}  // namespace
+
+TEST(FixedMultiIndex, DefaultConstructor)
+{
+    constexpr OrderBook book{};
+    static_assert(book.empty());
+    static_assert(book.max_size() == 16);
+    static_assert(book.get<BY_PRICE>().empty());
+    static_assert(book.get<BY_ID>().begin() == book.get<BY_ID>().end());
+}
+
+TEST(FixedMultiIndex, Insert)
+{
+    constexpr OrderBook book = make_order_book();
+
+    static_assert(book.size() == 5);
+    static_assert(ids_equal(book, std::array{1, 2, 3, 4, 5}));
+    static_assert(ids_equal(book.get<BY_ID>(), std::array{1, 2, 3, 4, 5}));
+    // Equal prices are kept in insertion order
+    static_assert(ids_equal(book.get<BY_PRICE>(), std::array{4, 1, 3, 2, 5}));
+    static_assert(ids_equal(book.get<BY_SEQUENCE>(), std::array{5, 4, 3, 2, 1}));
+}
+
+TEST(FixedMultiIndex, InsertConflict)
+{
+    constexpr auto book = []()
+    {
+        OrderBook b = make_order_book();
+        // Duplicate id
+        auto [it1, inserted1] = b.insert({3, 200, 6});
+        assert_or_abort(!inserted1);
+        assert_or_abort(it1->price == 100);
+        // Duplicate sequence number
+        auto [it2, inserted2] = b.emplace(Order{6, 200, 2});
+        assert_or_abort(!inserted2);
+        assert_or_abort(it2->id == 2);
+        // Duplicate price is fine
+        auto [it3, inserted3] = b.insert({6, 99, 6});
+        assert_or_abort(inserted3);
+        assert_or_abort(it3->id == 6);
+        return b;
+    }();
+
+    static_assert(book.size() == 6);
+    static_assert(ids_equal(book, std::array{1, 2, 3, 4, 5, 6}));
+    static_assert(ids_equal(book.get<BY_PRICE>(), std::array{4, 6, 1, 3, 2, 5}));
+    static_assert(!book.get<BY_PRICE>().contains(200));
+}
+
+TEST(FixedMultiIndex, Find)
+{
+    constexpr OrderBook book = make_order_book();
+
+    static_assert(book.get<BY_ID>().find(4)->price == 99);
+    static_assert(book.get<BY_ID>().find(7) == book.get<BY_ID>().end());
+    static_assert(book.get<BY_ID>().contains(5));
+    static_assert(!book.get<BY_ID>().contains(0));
+    static_assert(book.get<BY_ID>().count(1) == 1);
+
+    static_assert(book.get<BY_PRICE>().find(101)->id == 2);
+    static_assert(book.get<BY_PRICE>().find(102) == book.get<BY_PRICE>().end());
+    static_assert(book.get<BY_PRICE>().count(100) == 2);
+    static_assert(book.get<BY_PRICE>().count(98) == 0);
+    static_assert(book.get<BY_SEQUENCE>().find(3)->id == 3);
+    static_assert(book.get<BY_SEQUENCE>().count(3) == 1);
+}
+
+TEST(FixedMultiIndex, Bounds)
+{
+    constexpr OrderBook book = make_order_book();
+    static_assert(book.get<BY_PRICE>().lower_bound(100)->id == 1);
+    static_assert(book.get<BY_PRICE>().upper_bound(100)->id == 2);
+    static_assert(book.get<BY_PRICE>().lower_bound(98)->id == 4);
+    static_assert(book.get<BY_PRICE>().upper_bound(101) == book.get<BY_PRICE>().end());
+    static_assert(book.get<BY_PRICE>().lower_bound(102) == book.get<BY_PRICE>().end());
+    static_assert(ids_equal(std::ranges::subrange(book.get<BY_PRICE>().lower_bound(101),
+                                                  book.get<BY_PRICE>().upper_bound(101)),
+                            std::array{2, 5}));
+
+    // Honors the comparator of the index
+    static_assert(book.get<BY_SEQUENCE>().lower_bound(3)->id == 3);
+    static_assert(book.get<BY_SEQUENCE>().upper_bound(3)->id == 2);
+}
+
+TEST(FixedMultiIndex, ReverseIteration)
+{
+    constexpr OrderBook book = make_order_book();
+
+    static_assert(ids_equal(std::ranges::reverse_view(book), std::array{5, 4, 3, 2, 1}));
+    static_assert(
+        ids_equal(std::ranges::reverse_view(book.get<BY_PRICE>()), std::array{5, 2, 3, 1, 4}));
+    static_assert(std::prev(book.get<BY_PRICE>().end())->id == 5);
+}
+
+TEST(FixedMultiIndex, Erase)
+{
+    constexpr auto book = []()
+    {
+        OrderBook b = make_order_book();
+        // Through the container
+        auto it = b.erase(b.begin());
+        assert_or_abort(it->id == 2);
+        // Through an ordered index; returns the successor in that index
+        auto by_price = b.get<BY_PRICE>();
+        auto next = by_price.erase(by_price.find(99));
+        assert_or_abort(next->id == 3);
+        // Through a hashed index, by key
+        assert_or_abort(b.get<BY_ID>().erase(5) == 1);
+        assert_or_abort(b.get<BY_ID>().erase(5) == 0);
+        return b;
+    }();
+
+    static_assert(book.size() == 2);
+    static_assert(ids_equal(book, std::array{2, 3}));
+    static_assert(ids_equal(book.get<BY_PRICE>(), std::array{3, 2}));
+    static_assert(ids_equal(book.get<BY_SEQUENCE>(), std::array{3, 2}));
+    static_assert(!book.get<BY_ID>().contains(1));
+}
+
+TEST(FixedMultiIndex, EraseLastElement)
+{
+    constexpr auto book = []()
+    {
+        OrderBook b{};
+        b.insert({1, 100, 1});
+        b.erase(b.begin());
+        b.insert({2, 101, 2});
+        b.insert({3, 100, 3});
+        return b;
+    }();
+
+    static_assert(book.size() == 2);
+    static_assert(ids_equal(book.get<BY_PRICE>(), std::array{3, 2}));
+    static_assert(ids_equal(book.get<BY_SEQUENCE>(), std::array{3, 2}));
+}
+
+TEST(FixedMultiIndex, EraseKeyNonUnique)
+{
+    constexpr auto book = []()
+    {
+        OrderBook b = make_order_book();
+        assert_or_abort(b.get<BY_PRICE>().erase(101) == 2);
+        assert_or_abort(b.get<BY_PRICE>().erase(102) == 0);
+        return b;
+    }();
+
+    static_assert(ids_equal(book, std::array{1, 3, 4}));
+    static_assert(ids_equal(book.get<BY_PRICE>(), std::array{4, 1, 3}));
+    static_assert(!book.get<BY_ID>().contains(2));
+    static_assert(!book.get<BY_ID>().contains(5));
+}
+
+TEST(FixedMultiIndex, Modify)
+{
+    constexpr auto book = []()
+    {
+        OrderBook b = make_order_book();
+        // Reprice order 4; it loses its time priority at the new level
+        const bool modified = b.get<BY_PRICE>().modify(b.get<BY_PRICE>().find(99),
+                                                       [](Order& o) { o.price = 101; });
+        assert_or_abort(modified);
+        // Re-key order 1
+        assert_or_abort(b.modify(b.get<BY_ID>().find(1), [](Order& o) { o.id = 10; }));
+        return b;
+    }();
+
+    static_assert(ids_equal(book, std::array{10, 2, 3, 4, 5}));
+    static_assert(ids_equal(book.get<BY_PRICE>(), std::array{10, 3, 2, 5, 4}));
+    static_assert(book.get<BY_ID>().contains(10));
+    static_assert(!book.get<BY_ID>().contains(1));
+}
+
+TEST(FixedMultiIndex, ModifyConflictErases)
+{
+    constexpr auto book = []()
+    {
+        OrderBook b = make_order_book();
+        const bool modified = b.modify(b.get<BY_ID>().find(2), [](Order& o) { o.id = 3; });
+        assert_or_abort(!modified);
+        return b;
+    }();
+
+    static_assert(book.size() == 4);
+    static_assert(ids_equal(book, std::array{1, 3, 4, 5}));
+    static_assert(book.get<BY_ID>().find(3)->price == 100);
+    static_assert(ids_equal(book.get<BY_SEQUENCE>(), std::array{5, 4, 3, 1}));
+}
+
+TEST(FixedMultiIndex, ModifyConflictInOrderedIndex)
+{
+    constexpr auto book = []()
+    {
+        OrderBook b = make_order_book();
+        // Sequence number 3 is taken by the neighbour of order 2
+        const bool modified =
+            b.modify(b.get<BY_ID>().find(2), [](Order& o) { o.sequence_number = 3; });
+        assert_or_abort(!modified);
+        return b;
+    }();
+
+    static_assert(ids_equal(book, std::array{1, 3, 4, 5}));
+    static_assert(ids_equal(book.get<BY_PRICE>(), std::array{4, 1, 3, 5}));
+    static_assert(!book.get<BY_ID>().contains(2));
+}
+
+TEST(FixedMultiIndex, ModifyKeepsPositionAmongEquals)
+{
+    constexpr auto book = []()
+    {
+        OrderBook b = make_order_book();
+        // Order 1 is first at price level 100; changing its id must not send it to the back
+        b.modify(b.get<BY_ID>().find(1), [](Order& o) { o.id = 10; });
+        b.get<BY_SEQUENCE>().modify(b.get<BY_SEQUENCE>().find(1),
+                                    [](Order& o) { o.sequence_number = 0; });
+        return b;
+    }();
+
+    static_assert(ids_equal(book.get<BY_PRICE>(), std::array{4, 10, 3, 2, 5}));
+    static_assert(ids_equal(book.get<BY_SEQUENCE>(), std::array{5, 4, 3, 2, 10}));
+}
+
+TEST(FixedMultiIndex, Clear)
+{
+    OrderBook book = make_order_book();
+    book.clear();
+    EXPECT_TRUE(book.empty());
+    EXPECT_FALSE(book.get<BY_ID>().contains(1));
+    EXPECT_EQ(book.get<BY_PRICE>().begin(), book.get<BY_PRICE>().end());
+
+    book.insert({1, 100, 1});
+    EXPECT_EQ(1, book.size());
+    EXPECT_EQ(100, book.get<BY_ID>().find(1)->price);
+}
+
+TEST(FixedMultiIndex, ManyInsertionsAndErasures)
+{
+    using Book = FixedMultiIndex<
+        Order,
+        64,
+        multi_index::IndexedBy<multi_index::HashedUnique<multi_index::Member<&Order::id>>,
+                               multi_index::OrderedNonUnique<multi_index::Member<&Order::price>>>>;
+    Book book{};
+    for (int id = 0; id < 64; id++)
+    {
+        book.insert({id, (id * 37) % 11, id});
+    }
+    EXPECT_TRUE(is_full(book));
+    for (int id = 0; id < 64; id += 3)
+    {
+        EXPECT_EQ(1, book.get<0>().erase(id));
+    }
+    EXPECT_EQ(42, book.size());
+    EXPECT_TRUE(std::ranges::is_sorted(book.get<1>(), std::less<>{}, &Order::price));
+
+    for (int id = 0; id < 64; id++)
+    {
+        EXPECT_EQ(id % 3 != 0, book.get<0>().contains(id));
+    }
+
+    // Time priority within a level
+    for (int price = 0; price < 11; price++)
+    {
+        auto [first, last] = book.get<1>().equal_range(price);
+        EXPECT_TRUE(std::ranges::is_sorted(std::ranges::subrange(first, last), {}, &Order::id));
+    }
+}
+
+TEST(FixedMultiIndex, CustomKeyExtractor)
+{
+    struct Person
+    {
+        std::string_view name;
+        int age;
+    };
+    struct NameLength
+    {
+        constexpr std::size_t operator()(const Person& p) const { return p.name.size(); }
+    };
+
+    constexpr auto people = []()
+    {
+        FixedMultiIndex<
+            Person,
+            8,
+            multi_index::IndexedBy<multi_index::OrderedUnique<NameLength>,
+                                   multi_index::HashedUnique<multi_index::Member<&Person::name>>>>
+            p{};
+        p.insert({"Alice", 30});
+        p.insert({"Bob", 25});
+        p.insert({"Eve", 40});  // Same name length as Bob
+        p.insert({"Charlie", 35});
+        return p;
+    }();
+
+    static_assert(people.size() == 3);
+    static_assert(people.get<0>().begin()->name == "Bob");
+    static_assert(people.get<1>().find(std::string_view{"Charlie"})->age == 35);
+    static_assert(!people.get<1>().contains(std::string_view{"Eve"}));
+}
+
+TEST(FixedMultiIndex, ExceedsCapacity)
+{
+    FixedMultiIndex<
+        Order,
+        2,
+        multi_index::IndexedBy<multi_index::HashedUnique<multi_index::Member<&Order::id>>>>
+        book{};
+    book.insert({1, 100, 1});
+    book.insert({2, 100, 2});
+    EXPECT_TRUE(is_full(book));
+    EXPECT_DEATH(book.insert({3, 100, 3}), "");
+}
+
+TEST(FixedMultiIndex, InvalidArguments)
+{
+    OrderBook book = make_order_book();
+    EXPECT_DEATH(book.erase(book.end()), "");
+    EXPECT_DEATH(book.get<BY_PRICE>().erase(book.get<BY_PRICE>().end()), "");
+    EXPECT_DEATH(book.modify(book.end(), [](Order&) {}), "");
+}
+
+TEST(FixedMultiIndex, CopyIsIndependent)
+{
+    const OrderBook book1 = make_order_book();
+    OrderBook book2 = book1;
+    book2.get<BY_ID>().erase(1);
+    book2.insert({7, 98, 7});
+
+    EXPECT_TRUE(ids_equal(book1.get<BY_PRICE>(), std::array{4, 1, 3, 2, 5}));
+    EXPECT_TRUE(ids_equal(book2.get<BY_PRICE>(), std::array{7, 4, 3, 2, 5}));
+}
+
+TEST(FixedMultiIndex, NonTriviallyCopyable)
+{
+    using InstanceCounterType = instance_counter::InstanceCounterNonTrivialAssignment<
+        FixedMultiIndex<int, 8, multi_index::IndexedBy<multi_index::OrderedUnique<std::identity>>>>;
+    struct GetValue
+    {
+        int operator()(const InstanceCounterType& v) const { return v.get(); }
+    };
+    using MultiIndexType =
+        FixedMultiIndex<InstanceCounterType,
+                        8,
+                        multi_index::IndexedBy<
+                            multi_index::HashedUnique<GetValue>,
+                            multi_index::OrderedUnique<GetValue, std::greater<>>>>;
+    static_assert(!TriviallyCopyable<MultiIndexType>);
+
+    InstanceCounterType::counter = 0;
+    {
+        MultiIndexType v1{};
+        v1.emplace(1);
+        v1.emplace(2);
+        v1.emplace(3);
+        v1.emplace(2);  // Rejected
+        EXPECT_EQ(3, InstanceCounterType::counter);
+
+        v1.get<0>().erase(1);
+        EXPECT_EQ(2, InstanceCounterType::counter);
+
+        // The copy may use different slots, so its indices are rebuilt
+        MultiIndexType v2{v1};
+        EXPECT_EQ(4, InstanceCounterType::counter);
+        EXPECT_TRUE(v2.get<0>().contains(3));
+        EXPECT_EQ(3, v2.get<1>().begin()->get());
+
+        MultiIndexType v3{std::move(v2)};
+        EXPECT_TRUE(v3.get<0>().contains(2));
+        EXPECT_TRUE(v2.empty());  // NOLINT(bugprone-use-after-move)
+    }
+    EXPECT_EQ(0, InstanceCounterType::counter);
+}
+
+}  // namespace fixed_containers
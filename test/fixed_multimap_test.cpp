@@ -0,0 +1,205 @@
+#include "fixed_containers/fixed_multimap.hpp"
+
+#include "instance_counter.hpp"
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <tuple>
+#include <utility>
+
+namespace fixed_containers
+{
+namespace
+{
+using ES_1 = FixedMultiMap<int, int, 10>;
+static_assert(TriviallyCopyable<ES_1>);
+static_assert(NotTrivial<ES_1>);
+static_assert(StandardLayout<ES_1>);
+static_assert(TriviallyCopyAssignable<ES_1>);
+static_assert(TriviallyMoveAssignable<ES_1>);
+static_assert(IsStructuralType<ES_1>);
+
+static_assert(std::bidirectional_iterator<ES_1::iterator>);
+static_assert(std::bidirectional_iterator<ES_1::const_iterator>);
+static_assert(std::is_same_v<std::iter_reference_t<ES_1::iterator>, std::pair<const int&, int&>>);
+static_assert(std::is_same_v<std::iter_reference_t<ES_1::const_iterator>,
+                             std::pair<const int&, const int&>>);
+
+template <std::size_t N>
+constexpr bool values_equal(const auto& range, const std::array<int, N>& expected)
+{
+    return std::ranges::equal(
+        range, expected, std::equal_to<>{}, [](const auto& entry) { return entry.second; });
+}
+
+}  // namespace
+
+TEST(FixedMultiMap, DefaultConstructor)
+{
+    constexpr FixedMultiMap<int, int, 10> s1{};
+    static_assert(s1.empty());
+}
+
+TEST(FixedMultiMap, Initializer)
+{
+    constexpr FixedMultiMap<int, int, 10> s1{{2, 20}, {1, 10}, {2, 21}};
+    static_assert(s1.size() == 3);
+    static_assert(values_equal(s1, std::array{10, 20, 21}));
+    static_assert(values_equal(std::ranges::reverse_view(s1), std::array{21, 20, 10}));
+}
+
+TEST(FixedMultiMap, InsertKeepsInsertionOrderAmongEquivalents)
+{
+    constexpr auto s1 = []()
+    {
+        FixedMultiMap<int, int, 16> s{};
+        for (int seq = 0; seq < 12; seq++)
+        {
+            // Keys cycle 1, 0, 2, so the tree rebalances while duplicates accumulate
+            s.insert({(seq + 1) % 3, seq});
+        }
+        auto it = s.emplace(1, 100);
+        assert_or_abort(it->second == 100);
+        it = s.emplace(std::piecewise_construct, std::forward_as_tuple(1), std::forward_as_tuple());
+        assert_or_abort(it->second == 0);
+        return s;
+    }();
+
+    static_assert(s1.size() == 14);
+    static_assert(values_equal(s1, std::array{2, 5, 8, 11, 0, 3, 6, 9, 100, 0, 1, 4, 7, 10}));
+}
+
+TEST(FixedMultiMap, EqualRangeAndCount)
+{
+    static constexpr FixedMultiMap<int, int, 10> S1{
+        {5, 0}, {3, 1}, {5, 2}, {7, 3}, {5, 4}, {3, 5}};
+
+    static_assert(S1.count(5) == 3);
+    static_assert(S1.count(3) == 2);
+    static_assert(S1.count(4) == 0);
+
+    constexpr auto RANGE_5 = S1.equal_range(5);
+    static_assert(values_equal(std::ranges::subrange(RANGE_5.first, RANGE_5.second),
+                               std::array{0, 2, 4}));
+    constexpr auto RANGE_8 = S1.equal_range(8);
+    static_assert(RANGE_8.first == RANGE_8.second);
+    static_assert(RANGE_8.first == S1.cend());
+
+    static_assert(S1.lower_bound(4)->second == 0);
+    static_assert(S1.upper_bound(5)->second == 3);
+    static_assert(S1.find(3)->second == 1);
+    static_assert(S1.find(4) == S1.cend());
+    static_assert(S1.contains(7));
+}
+
+TEST(FixedMultiMap, MutateThroughEqualRange)
+{
+    constexpr auto s1 = []()
+    {
+        FixedMultiMap<int, int, 10> s{{1, 1}, {2, 2}, {1, 3}, {2, 4}};
+        auto [first, last] = s.equal_range(2);
+        for (; first != last; ++first)
+        {
+            first->second *= 10;
+        }
+        return s;
+    }();
+
+    static_assert(values_equal(s1, std::array{1, 3, 20, 40}));
+}
+
+TEST(FixedMultiMap, EraseKey)
+{
+    constexpr auto s1 = []()
+    {
+        FixedMultiMap<int, int, 16> s{};
+        for (int i = 0; i < 12; i++)
+        {
+            s.insert({i % 4, i});
+        }
+        const std::size_t removed_2 = s.erase(2);
+        const std::size_t removed_9 = s.erase(9);
+        assert_or_abort(removed_2 == 3);
+        assert_or_abort(removed_9 == 0);
+        return s;
+    }();
+
+    static_assert(s1.size() == 9);
+    static_assert(values_equal(s1, std::array{0, 4, 8, 1, 5, 9, 3, 7, 11}));
+}
+
+TEST(FixedMultiMap, EraseIterator)
+{
+    FixedMultiMap<int, int, 10> s{{1, 0}, {2, 1}, {1, 2}, {1, 3}};
+    auto it = s.erase(std::next(s.find(1)));
+    EXPECT_EQ(3, it->second);
+    it = s.erase(s.begin(), s.upper_bound(1));
+    EXPECT_EQ(1, it->second);
+    EXPECT_EQ(1, s.size());
+}
+
+TEST(FixedMultiMap, EraseIf)
+{
+    FixedMultiMap<int, int, 10> s{{1, 1}, {1, 2}, {2, 3}, {2, 4}};
+    const std::size_t removed_count =
+        erase_if(s, [](const auto& entry) { return entry.second % 2 == 0; });
+    EXPECT_EQ(2, removed_count);
+    EXPECT_TRUE(values_equal(s, std::array{1, 3}));
+}
+
+TEST(FixedMultiMap, Equality)
+{
+    constexpr FixedMultiMap<int, int, 10> s1{{1, 1}, {1, 2}};
+    constexpr FixedMultiMap<int, int, 20> s2{{1, 1}, {1, 2}};
+    constexpr FixedMultiMap<int, int, 10> s3{{1, 2}, {1, 1}};
+
+    static_assert(s1 == s2);
+    static_assert(s1 != s3);
+}
+
+TEST(FixedMultiMap, CopyKeepsDuplicates)
+{
+    using InstanceCounterType = instance_counter::InstanceCounterNonTrivialAssignment<int>;
+    using MapType = FixedMultiMap<InstanceCounterType, InstanceCounterType, 10>;
+    static_assert(!TriviallyCopyable<MapType>);
+
+    InstanceCounterType::counter = 0;
+    {
+        MapType s1{};
+        s1.emplace(1, 10);
+        s1.emplace(1, 11);
+        s1.emplace(0, 12);
+        EXPECT_EQ(6, InstanceCounterType::counter);
+
+        const MapType s2{s1};
+        EXPECT_EQ(12, InstanceCounterType::counter);
+        EXPECT_EQ(2, s2.count(InstanceCounterType{1}));
+        EXPECT_TRUE(std::ranges::equal(s2,
+                                       std::array{12, 10, 11},
+                                       std::equal_to<>{},
+                                       [](const auto& entry) { return entry.second.get(); }));
+
+        const MapType s3{std::move(s1)};
+        EXPECT_EQ(3, s3.size());
+        EXPECT_EQ(2, s3.count(InstanceCounterType{1}));
+    }
+    EXPECT_EQ(0, InstanceCounterType::counter);
+}
+
+TEST(FixedMultiMap, ExceedsCapacity)
+{
+    FixedMultiMap<int, int, 2> s{{1, 1}, {1, 2}};
+    EXPECT_TRUE(is_full(s));
+    EXPECT_DEATH(s.insert({1, 3}), "");
+}
+
+}  // namespace fixed_containers
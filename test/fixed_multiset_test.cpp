@@ -0,0 +1,207 @@
+#include "fixed_containers/fixed_multiset.hpp"
+
+#include "instance_counter.hpp"
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+
+namespace fixed_containers
+{
+namespace
+{
+using ES_1 = FixedMultiSet<int, 10>;
+static_assert(TriviallyCopyable<ES_1>);
+static_assert(NotTrivial<ES_1>);
+static_assert(StandardLayout<ES_1>);
+static_assert(TriviallyCopyAssignable<ES_1>);
+static_assert(TriviallyMoveAssignable<ES_1>);
+static_assert(IsStructuralType<ES_1>);
+
+static_assert(std::bidirectional_iterator<ES_1::iterator>);
+static_assert(std::bidirectional_iterator<ES_1::const_iterator>);
+static_assert(std::is_same_v<std::iter_reference_t<ES_1::iterator>, const int&>);
+
+// Ordered by `key` only, so `seq` shows the relative order of equivalent keys
+struct Entry
+{
+    int key;
+    int seq;
+};
+struct ByKey
+{
+    using is_transparent = void;
+    constexpr bool operator()(const Entry& lhs, const Entry& rhs) const
+    {
+        return lhs.key < rhs.key;
+    }
+    constexpr bool operator()(const Entry& lhs, int rhs) const { return lhs.key < rhs; }
+    constexpr bool operator()(int lhs, const Entry& rhs) const { return lhs < rhs.key; }
+};
+using EntrySet = FixedMultiSet<Entry, 16, ByKey>;
+
+template <std::size_t N>
+constexpr bool seqs_equal(const auto& range, const std::array<int, N>& expected)
+{
+    return std::ranges::equal(range, expected, std::equal_to<>{}, &Entry::seq);
+}
+
+}  // namespace
+
+TEST(FixedMultiSet, DefaultConstructor)
+{
+    constexpr FixedMultiSet<int, 10> s1{};
+    static_assert(s1.empty());
+}
+
+TEST(FixedMultiSet, Initializer)
+{
+    constexpr FixedMultiSet<int, 10> s1{3, 1, 3, 2, 3};
+    static_assert(s1.size() == 5);
+    static_assert(std::ranges::equal(s1, std::array{1, 2, 3, 3, 3}));
+    static_assert(std::ranges::equal(std::ranges::reverse_view(s1), std::array{3, 3, 3, 2, 1}));
+}
+
+TEST(FixedMultiSet, InsertKeepsInsertionOrderAmongEquivalents)
+{
+    constexpr EntrySet s1 = []()
+    {
+        EntrySet s{};
+        for (int seq = 0; seq < 12; seq++)
+        {
+            // Keys cycle 1, 0, 2, so the tree rebalances while duplicates accumulate
+            s.insert(Entry{(seq + 1) % 3, seq});
+        }
+        auto it = s.emplace(1, 100);
+        assert_or_abort(it->seq == 100);
+        assert_or_abort(std::next(it) == s.lower_bound(2));
+        return s;
+    }();
+
+    static_assert(s1.size() == 13);
+    static_assert(seqs_equal(s1, std::array{2, 5, 8, 11, 0, 3, 6, 9, 100, 1, 4, 7, 10}));
+}
+
+TEST(FixedMultiSet, EqualRangeAndCount)
+{
+    static constexpr EntrySet S1{{5, 0}, {3, 1}, {5, 2}, {7, 3}, {5, 4}, {3, 5}};
+
+    static_assert(S1.count(5) == 3);
+    static_assert(S1.count(Entry{3, 0}) == 2);
+    static_assert(S1.count(4) == 0);
+    static_assert(S1.count(9) == 0);
+
+    constexpr auto RANGE_5 = S1.equal_range(5);
+    static_assert(seqs_equal(std::ranges::subrange(RANGE_5.first, RANGE_5.second),
+                             std::array{0, 2, 4}));
+    constexpr auto RANGE_4 = S1.equal_range(4);
+    static_assert(RANGE_4.first == RANGE_4.second);
+    static_assert(RANGE_4.first->key == 5);
+
+    static_assert(S1.lower_bound(3)->seq == 1);
+    static_assert(S1.upper_bound(3)->seq == 0);
+    static_assert(S1.upper_bound(7) == S1.cend());
+
+    static_assert(S1.find(5)->seq == 0);
+    static_assert(S1.find(6) == S1.cend());
+    static_assert(S1.contains(7));
+    static_assert(!S1.contains(1));
+}
+
+TEST(FixedMultiSet, EraseKey)
+{
+    constexpr auto s1 = []()
+    {
+        FixedMultiSet<int, 16> s{4, 1, 4, 2, 4, 3, 4, 4};
+        const std::size_t removed_4 = s.erase(4);
+        const std::size_t removed_9 = s.erase(9);
+        assert_or_abort(removed_4 == 5);
+        assert_or_abort(removed_9 == 0);
+        return s;
+    }();
+
+    static_assert(std::ranges::equal(s1, std::array{1, 2, 3}));
+}
+
+TEST(FixedMultiSet, EraseIterator)
+{
+    constexpr EntrySet s1 = []()
+    {
+        EntrySet s{{1, 0}, {2, 1}, {1, 2}, {1, 3}, {2, 4}};
+        // Erasing one duplicate leaves the others in order
+        auto it = s.erase(std::next(s.find(1)));
+        assert_or_abort(it->seq == 3);
+        it = s.erase(s.lower_bound(2), s.cend());
+        assert_or_abort(it == s.cend());
+        return s;
+    }();
+
+    static_assert(seqs_equal(s1, std::array{0, 3}));
+}
+
+TEST(FixedMultiSet, EraseIf)
+{
+    FixedMultiSet<int, 10> s{1, 2, 2, 3, 3, 3};
+    const std::size_t removed_count = erase_if(s, [](const int& k) { return k % 2 == 1; });
+    EXPECT_EQ(4, removed_count);
+    EXPECT_TRUE(std::ranges::equal(s, std::array{2, 2}));
+}
+
+TEST(FixedMultiSet, Equality)
+{
+    constexpr FixedMultiSet<int, 10> s1{1, 2, 2};
+    constexpr FixedMultiSet<int, 20> s2{2, 1, 2};
+    constexpr FixedMultiSet<int, 10> s3{1, 2};
+
+    static_assert(s1 == s2);
+    static_assert(s1 != s3);
+}
+
+TEST(FixedMultiSet, CopyKeepsDuplicates)
+{
+    using InstanceCounterType = instance_counter::InstanceCounterNonTrivialAssignment<int>;
+    using SetType = FixedMultiSet<InstanceCounterType, 10>;
+    static_assert(!TriviallyCopyable<SetType>);
+
+    InstanceCounterType::counter = 0;
+    {
+        SetType s1{};
+        s1.insert(InstanceCounterType{2});
+        s1.insert(InstanceCounterType{1});
+        s1.insert(InstanceCounterType{2});
+        s1.insert(InstanceCounterType{2});
+        EXPECT_EQ(4, InstanceCounterType::counter);
+
+        const SetType s2{s1};
+        EXPECT_EQ(8, InstanceCounterType::counter);
+        EXPECT_EQ(4, s2.size());
+        EXPECT_EQ(3, s2.count(InstanceCounterType{2}));
+
+        SetType s3{};
+        s3 = s1;
+        EXPECT_EQ(4, s3.size());
+
+        const SetType s4{std::move(s3)};
+        EXPECT_EQ(4, s4.size());
+        EXPECT_EQ(3, s4.count(InstanceCounterType{2}));
+        EXPECT_EQ(12, InstanceCounterType::counter);
+    }
+    EXPECT_EQ(0, InstanceCounterType::counter);
+}
+
+TEST(FixedMultiSet, ExceedsCapacity)
+{
+    FixedMultiSet<int, 3> s{1, 1, 1};
+    EXPECT_TRUE(is_full(s));
+    EXPECT_DEATH(s.insert(1), "");
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,88 @@
+#include "fixed_containers/fixed_packed_vector.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace fixed_containers
+{
+namespace
+{
+// Venue ids fit in 12 bits; the packed form is under half the footprint of uint32_t storage
+constexpr std::size_t BITS = 12;
+constexpr std::size_t CAPACITY = 4096;
+constexpr std::size_t CHUNK = 64;
+
+template <typename VectorType>
+void fill(VectorType& v)
+{
+    for (std::size_t i = 0; i < CAPACITY; i++)
+    {
+        v.push_back(static_cast<std::uint16_t>((i * 2654435761U) % (1U << BITS)));
+    }
+}
+}  // namespace
+
+static void benchmark_sum_fixed_vector(benchmark::State& state)
+{
+    FixedVector<std::uint32_t, CAPACITY> v{};
+    fill(v);
+    for (auto _ : state)
+    {
+        std::uint64_t sum = 0;
+        for (const std::uint32_t e : v)
+        {
+            sum += e;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(CAPACITY));
+}
+BENCHMARK(benchmark_sum_fixed_vector);
+
+static void benchmark_sum_fixed_packed_vector_iterate(benchmark::State& state)
+{
+    FixedPackedVector<BITS, CAPACITY> v{};
+    fill(v);
+    for (auto _ : state)
+    {
+        std::uint64_t sum = 0;
+        for (const std::uint16_t e : std::as_const(v))
+        {
+            sum += e;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(CAPACITY));
+}
+BENCHMARK(benchmark_sum_fixed_packed_vector_iterate);
+
+static void benchmark_sum_fixed_packed_vector_decode(benchmark::State& state)
+{
+    FixedPackedVector<BITS, CAPACITY> v{};
+    fill(v);
+    for (auto _ : state)
+    {
+        std::uint64_t sum = 0;
+        std::array<std::uint16_t, CHUNK> chunk{};
+        for (std::size_t i = 0; i < CAPACITY; i += CHUNK)
+        {
+            v.decode(i, chunk);
+            for (const std::uint16_t e : chunk)
+            {
+                sum += e;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(CAPACITY));
+}
+BENCHMARK(benchmark_sum_fixed_packed_vector_decode);
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -0,0 +1,253 @@
+#include "fixed_containers/fixed_packed_vector.hpp"
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+namespace fixed_containers
+{
+namespace
+{
+using VenueIds = FixedPackedVector<5, 100>;
+static_assert(TriviallyCopyable<VenueIds>);
+static_assert(NotTrivial<VenueIds>);
+static_assert(StandardLayout<VenueIds>);
+static_assert(IsStructuralType<VenueIds>);
+
+// 500 bits of payload take 8 words, plus the trailing word
+static_assert(sizeof(VenueIds) == sizeof(std::size_t) + (9 * sizeof(std::uint64_t)));
+
+static_assert(std::is_same_v<VenueIds::value_type, std::uint8_t>);
+static_assert(std::is_same_v<FixedPackedVector<9, 4>::value_type, std::uint16_t>);
+static_assert(std::is_same_v<FixedPackedVector<20, 4>::value_type, std::uint32_t>);
+static_assert(std::is_same_v<FixedPackedVector<33, 4>::value_type, std::uint64_t>);
+static_assert(VenueIds::max_value() == 31);
+static_assert(FixedPackedVector<64, 4>::max_value() == UINT64_MAX);
+
+static_assert(std::random_access_iterator<VenueIds::iterator>);
+static_assert(std::random_access_iterator<VenueIds::const_iterator>);
+static_assert(std::is_same_v<std::iter_reference_t<VenueIds::const_iterator>, std::uint8_t>);
+static_assert(std::ranges::random_access_range<VenueIds>);
+static_assert(std::ranges::random_access_range<const VenueIds>);
+
+}  // namespace
+
+TEST(FixedPackedVector, DefaultConstructor)
+{
+    constexpr VenueIds v1{};
+    static_assert(v1.empty());
+    static_assert(v1.max_size() == 100);
+}
+
+TEST(FixedPackedVector, Initializer)
+{
+    constexpr FixedPackedVector<7, 10> v1{1, 127, 0, 64};
+    static_assert(v1.size() == 4);
+    static_assert(std::ranges::equal(v1, std::array{1, 127, 0, 64}));
+
+    constexpr FixedPackedVector<7, 10> v2(3, 5);
+    static_assert(std::ranges::equal(v2, std::array{5, 5, 5}));
+}
+
+TEST(FixedPackedVector, PushBackAndAccess)
+{
+    constexpr auto v1 = []()
+    {
+        // 13 bits, so values straddle word boundaries at irregular offsets
+        FixedPackedVector<13, 50> v{};
+        for (std::uint16_t i = 0; i < 50; i++)
+        {
+            v.push_back(static_cast<std::uint16_t>((i * 331U) % 8192U));
+        }
+        v[4] = 8191;
+        v.at(5) = 0;
+        v.back() = 1;
+        return v;
+    }();
+
+    static_assert(v1.size() == 50);
+    static_assert(is_full(v1));
+    static_assert(v1[3] == 993);
+    static_assert(v1[4] == 8191);
+    static_assert(v1.at(5) == 0);
+    static_assert(v1[6] == 1986);
+    static_assert(v1.front() == 0);
+    static_assert(v1.back() == 1);
+    static_assert(v1[48] == (48U * 331U) % 8192U);
+}
+
+TEST(FixedPackedVector, NeighboursAreUntouched)
+{
+    // Every element set to all-ones and back, with neighbours checked
+    const auto check_width = []<std::size_t BITS>(std::integral_constant<std::size_t, BITS>)
+    {
+        using V = FixedPackedVector<BITS, 67>;
+        for (std::size_t i = 0; i < 67; i++)
+        {
+            V v(67, 0);
+            v[i] = V::max_value();
+            for (std::size_t j = 0; j < 67; j++)
+            {
+                ASSERT_EQ(j == i ? V::max_value() : 0, v[j]) << BITS << " " << i << " " << j;
+            }
+            V w(67, V::max_value());
+            w[i] = 0;
+            for (std::size_t j = 0; j < 67; j++)
+            {
+                ASSERT_EQ(j == i ? 0 : V::max_value(), w[j]) << BITS << " " << i << " " << j;
+            }
+        }
+    };
+    [&]<std::size_t... BITS>(std::index_sequence<BITS...>)
+    { (check_width(std::integral_constant<std::size_t, BITS>{}), ...); }(
+        std::index_sequence<1, 3, 8, 13, 20, 31, 32, 33, 47, 63, 64>{});
+}
+
+TEST(FixedPackedVector, Iterators)
+{
+    constexpr auto v1 = []()
+    {
+        FixedPackedVector<6, 10> v{1, 2, 3, 4};
+        for (auto&& e : v)
+        {
+            e = static_cast<std::uint8_t>(e * 10);
+        }
+        std::reverse(v.begin(), v.end());
+        auto it = v.begin();
+        it[1] = 63;
+        return v;
+    }();
+
+    static_assert(std::ranges::equal(v1, std::array{40, 63, 20, 10}));
+    static_assert(std::ranges::equal(std::ranges::reverse_view(v1), std::array{10, 20, 63, 40}));
+    static_assert(v1.cend() - v1.cbegin() == 4);
+    static_assert(*std::next(v1.crbegin()) == 20);
+}
+
+TEST(FixedPackedVector, ProxySwapAndCopy)
+{
+    FixedPackedVector<11, 16> v{700, 3, 2047, 12};
+    swap(v[0], v[2]);
+    EXPECT_TRUE(std::ranges::equal(v, std::array{2047, 3, 700, 12}));
+    v[1] = v[3];
+    std::ranges::copy(std::array{5, 6}, std::next(v.begin(), 2));
+    EXPECT_TRUE(std::ranges::equal(v, std::array{2047, 12, 5, 6}));
+}
+
+TEST(FixedPackedVector, DecodeAndEncode)
+{
+    constexpr auto v1 = []()
+    {
+        FixedPackedVector<20, 64> v(64, 0);
+        std::array<std::uint32_t, 40> in{};
+        for (std::size_t i = 0; i < in.size(); i++)
+        {
+            in.at(i) = static_cast<std::uint32_t>((i * 26113U) % (1U << 20U));
+        }
+        v.encode(10, in);
+        return v;
+    }();
+
+    static_assert(v1[9] == 0);
+    static_assert(v1[10] == 0);
+    static_assert(v1[11] == 26113);
+    static_assert(v1[49] == (39U * 26113U) % (1U << 20U));
+    static_assert(v1[50] == 0);
+
+    std::array<std::uint32_t, 41> out{};
+    v1.decode(10, out);
+    EXPECT_EQ(26113, out[1]);
+    EXPECT_EQ(0, out[40]);
+    for (std::size_t i = 0; i < out.size(); i++)
+    {
+        EXPECT_EQ(v1[10 + i], out.at(i));
+    }
+}
+
+TEST(FixedPackedVector, DecodeMatchesElementAccess)
+{
+    // Long enough to take the whole-block path, from aligned and unaligned starting points
+    const auto check_width = []<std::size_t BITS>(std::integral_constant<std::size_t, BITS>)
+    {
+        using V = FixedPackedVector<BITS, 300>;
+        V v{};
+        std::uint64_t state = 88172645463325252ULL;
+        while (!is_full(v))
+        {
+            state ^= state << 13U;
+            state ^= state >> 7U;
+            state ^= state << 17U;
+            v.push_back(static_cast<typename V::value_type>(state & V::max_value()));
+        }
+        std::array<typename V::value_type, 300> out{};
+        for (const std::size_t first : {0, 1, 63, 64, 100})
+        {
+            const std::span<typename V::value_type> dest{out.data(), 300 - first};
+            v.decode(first, dest);
+            for (std::size_t k = 0; k < dest.size(); k++)
+            {
+                ASSERT_EQ(v[first + k], dest[k]) << BITS << " " << first << " " << k;
+            }
+        }
+    };
+    [&]<std::size_t... BITS>(std::index_sequence<BITS...>)
+    { (check_width(std::integral_constant<std::size_t, BITS>{}), ...); }(
+        std::index_sequence<1, 3, 8, 13, 20, 31, 32, 33, 47, 63, 64>{});
+}
+
+TEST(FixedPackedVector, ResizeAndPopBack)
+{
+    FixedPackedVector<3, 10> v{1, 2, 3, 4, 5};
+    v.pop_back();
+    v.pop_back();
+    v.resize(5, 7);
+    EXPECT_TRUE(std::ranges::equal(v, std::array{1, 2, 3, 7, 7}));
+    v.resize(1);
+    v.resize(3);
+    EXPECT_TRUE(std::ranges::equal(v, std::array{1, 0, 0}));
+    v.clear();
+    EXPECT_TRUE(v.empty());
+}
+
+TEST(FixedPackedVector, Equality)
+{
+    constexpr FixedPackedVector<4, 10> v1{1, 2, 3};
+    constexpr FixedPackedVector<4, 20> v2{1, 2, 3};
+    constexpr FixedPackedVector<4, 10> v3{1, 2};
+
+    static_assert(v1 == v2);
+    static_assert(v1 != v3);
+}
+
+TEST(FixedPackedVector, InvalidArguments)
+{
+    FixedPackedVector<5, 4> v{1, 2};
+    EXPECT_DEATH(v.push_back(32), "");
+    EXPECT_DEATH(v[0] = 40, "");
+    EXPECT_DEATH((void)v.at(2), "");
+    std::array<std::uint8_t, 3> buffer{};
+    EXPECT_DEATH(v.decode(0, buffer), "");
+    const std::array<std::uint8_t, 2> too_wide{3, 32};
+    EXPECT_DEATH(v.encode(0, too_wide), "");
+}
+
+TEST(FixedPackedVector, ExceedsCapacity)
+{
+    FixedPackedVector<5, 2> v{1, 2};
+    EXPECT_DEATH(v.push_back(3), "");
+    EXPECT_DEATH(v.resize(3), "");
+    FixedPackedVector<5, 2> empty{};
+    EXPECT_DEATH(empty.pop_back(), "");
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,60 @@
+#include "fixed_containers/fixed_per_cpu.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdint>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t MAXIMUM_CPUS = 256;
+}  // namespace
+
+static void benchmark_single_atomic(benchmark::State& state)
+{
+    static std::atomic<std::uint64_t> counter{0};
+    for (auto _ : state)
+    {
+        counter.fetch_add(1, std::memory_order_relaxed);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void benchmark_per_cpu_counter(benchmark::State& state)
+{
+    static FixedPerCpuCounter<MAXIMUM_CPUS> counter{};
+    for (auto _ : state)
+    {
+        counter.add();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void benchmark_current_cpu(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(fixed_per_cpu_detail::current_cpu());
+    }
+}
+
+static void benchmark_per_cpu_counter_load(benchmark::State& state)
+{
+    static FixedPerCpuCounter<MAXIMUM_CPUS> counter{};
+    counter.add();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(counter.load());
+    }
+}
+
+BENCHMARK(benchmark_single_atomic)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(benchmark_per_cpu_counter)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(benchmark_current_cpu);
+BENCHMARK(benchmark_per_cpu_counter_load);
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
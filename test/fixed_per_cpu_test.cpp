@@ -0,0 +1,157 @@
+#include "fixed_containers/fixed_per_cpu.hpp"
+
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace fixed_containers
+{
+static_assert(NotCopyConstructible<FixedPerCpu<int, 4>>);
+static_assert(FixedPerCpu<int, 4>::static_max_size() == 4);
+
+TEST(FixedPerCpu, CurrentCpuIndexIsInRange)
+{
+    EXPECT_LT((FixedPerCpu<int, 4>::current_cpu_index()), 4);
+    EXPECT_EQ(0, (FixedPerCpu<int, 1>::current_cpu_index()));
+}
+
+TEST(FixedPerCpu, LocalAndAt)
+{
+    FixedPerCpu<int, 4> s1{};
+    EXPECT_EQ(4, s1.max_size());
+    s1.at(0) = 1;
+    s1.at(3) = 4;
+    EXPECT_EQ(1, s1.at(0));
+    EXPECT_EQ(0, s1.at(1));
+    EXPECT_EQ(4, s1.at(3));
+
+    s1.local() = 10;
+    EXPECT_EQ(10, s1.at(FixedPerCpu<int, 4>::current_cpu_index()));
+}
+
+TEST(FixedPerCpu, ForEachAndAccumulate)
+{
+    FixedPerCpu<int, 4> s1{};
+    int i = 0;
+    s1.for_each([&i](int& value) { value = ++i; });
+    EXPECT_EQ(10, s1.accumulate(0, [](const int sum, const int value) { return sum + value; }));
+
+    const FixedPerCpu<int, 4>& s2 = s1;
+    int max = 0;
+    s2.for_each([&max](const int value) { max = std::max(max, value); });
+    EXPECT_EQ(4, max);
+}
+
+TEST(FixedPerCpuCounter, AddLoadReset)
+{
+    FixedPerCpuCounter<4> s1{};
+    EXPECT_EQ(0, s1.load());
+    s1.add();
+    s1.add(5);
+    EXPECT_EQ(6, s1.load());
+    s1.reset();
+    EXPECT_EQ(0, s1.load());
+}
+
+TEST(FixedPerCpuFreeList, PushPop)
+{
+    FixedPerCpuFreeList<2, 3> s1{};
+    EXPECT_EQ(std::nullopt, s1.pop());
+
+    for (std::uint32_t i = 0; i < 6; i++)
+    {
+        EXPECT_TRUE(s1.push(i));
+    }
+    // Both per-CPU lists are full
+    EXPECT_FALSE(s1.push(99));
+    EXPECT_EQ(6, s1.size());
+
+    std::set<std::uint32_t> popped{};
+    while (const std::optional<std::uint32_t> i = s1.pop())
+    {
+        popped.insert(*i);
+    }
+    EXPECT_EQ((std::set<std::uint32_t>{0, 1, 2, 3, 4, 5}), popped);
+    EXPECT_EQ(0, s1.size());
+}
+
+// Intended to also be run under ThreadSanitizer.
+TEST(FixedPerCpuCounter, ConcurrentAdds)
+{
+    static constexpr std::size_t THREAD_COUNT = 4;
+    static constexpr std::uint64_t ADDS_PER_THREAD = 50'000;
+
+    FixedPerCpuCounter<8> s1{};
+    std::vector<std::thread> threads{};
+    for (std::size_t t = 0; t < THREAD_COUNT; t++)
+    {
+        threads.emplace_back(
+            [&s1]()
+            {
+                for (std::uint64_t i = 0; i < ADDS_PER_THREAD; i++)
+                {
+                    s1.add();
+                }
+            });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(THREAD_COUNT * ADDS_PER_THREAD, s1.load());
+}
+
+// Intended to also be run under ThreadSanitizer.
+TEST(FixedPerCpuFreeList, ConcurrentPushPop)
+{
+    static constexpr std::size_t THREAD_COUNT = 4;
+    static constexpr std::uint32_t INDEX_COUNT = 64;
+
+    FixedPerCpuFreeList<4, INDEX_COUNT> s1{};
+    for (std::uint32_t i = 0; i < INDEX_COUNT; i++)
+    {
+        s1.push(i);
+    }
+
+    std::vector<std::atomic<bool>> in_use(INDEX_COUNT);
+    std::atomic<std::size_t> double_pops{0};
+    std::vector<std::thread> threads{};
+    for (std::size_t t = 0; t < THREAD_COUNT; t++)
+    {
+        threads.emplace_back(
+            [&]()
+            {
+                for (std::size_t n = 0; n < 20'000; n++)
+                {
+                    const std::optional<std::uint32_t> i = s1.pop();
+                    if (!i.has_value())
+                    {
+                        continue;
+                    }
+                    if (in_use[*i].exchange(true))
+                    {
+                        double_pops.fetch_add(1);
+                    }
+                    in_use[*i].store(false);
+                    s1.push(*i);
+                }
+            });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(0, double_pops.load());
+    EXPECT_EQ(INDEX_COUNT, s1.size());
+}
+
+}  // namespace fixed_containers
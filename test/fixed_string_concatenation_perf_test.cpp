@@ -0,0 +1,95 @@
+#include "fixed_containers/fixed_string_concatenation.hpp"
+
+#include "fixed_containers/fixed_string.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t ORDER_COUNT = 256;
+using MessageType = FixedString<128>;
+
+struct Order
+{
+    FixedString<8> symbol;
+    FixedString<16> account;
+    std::int64_t quantity;
+    std::uint64_t price;
+};
+
+const std::array<Order, ORDER_COUNT>& orders()
+{
+    static const std::array<Order, ORDER_COUNT> ORDERS = []()
+    {
+        std::array<Order, ORDER_COUNT> out{};
+        for (std::size_t i = 0; i < ORDER_COUNT; i++)
+        {
+            out.at(i) = Order{.symbol = std::string_view{std::to_string(i % 97) + "XYZ"},
+                              .account = std::string_view{"ACCT-" + std::to_string(i)},
+                              .quantity = static_cast<std::int64_t>(i * 37) - 4000,
+                              .price = 10000 + (i * 131)};
+        }
+        return out;
+    }();
+    return ORDERS;
+}
+
+// Field by field, formatting numbers into a temporary.
+MessageType build_with_append(const Order& order)
+{
+    MessageType out{"35=D|55="};
+    out.append(order.symbol);
+    out.append("|1=");
+    out.append(order.account);
+    out.append("|38=");
+    out.append(std::string_view{std::to_string(order.quantity)});
+    out.append("|44=");
+    out.append(std::string_view{std::to_string(order.price)});
+    out.push_back('|');
+    return out;
+}
+
+MessageType build_with_concatenation(const Order& order)
+{
+    return "35=D|55=" + order.symbol + "|1=" + order.account + "|38=" + order.quantity + "|44=" +
+           order.price + '|';
+}
+
+template <auto BUILD>
+void benchmark_build(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        for (const Order& order : orders())
+        {
+            MessageType message = BUILD(order);
+            benchmark::DoNotOptimize(message);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(ORDER_COUNT));
+}
+}  // namespace
+
+static void benchmark_build_message_append(benchmark::State& state)
+{
+    benchmark_build<build_with_append>(state);
+}
+BENCHMARK(benchmark_build_message_append);
+
+static void benchmark_build_message_concatenation(benchmark::State& state)
+{
+    benchmark_build<build_with_concatenation>(state);
+}
+BENCHMARK(benchmark_build_message_concatenation);
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -0,0 +1,104 @@
+#include "fixed_containers/fixed_string_concatenation.hpp"
+
+#include "fixed_containers/fixed_string.hpp"
+#include "fixed_containers/string_literal.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr FixedString<8> SYMBOL{"AAPL"};
+constexpr FixedString<4> SIDE{"BUY"};
+
+// Chains are lazy: no FixedString is materialized until conversion.
+static_assert(!std::is_same_v<decltype(SYMBOL + SIDE), FixedString<12>>);
+static_assert(decltype(SYMBOL + ' ' + SIDE)::STATIC_MAX_LENGTH == 13);
+static_assert(decltype(SYMBOL + "=" + std::int32_t{})::STATIC_MAX_LENGTH == 8 + 1 + 11);
+static_assert(decltype(SYMBOL + std::uint8_t{})::STATIC_MAX_LENGTH == 8 + 3);
+static_assert(!decltype(SYMBOL + std::string_view{})::has_static_max_length());
+}  // namespace
+
+TEST(FixedStringConcatenation, FixedStrings)
+{
+    constexpr FixedString<16> RESULT = SYMBOL + SIDE;
+    static_assert(RESULT == "AAPLBUY");
+
+    constexpr FixedString<16> THREE = SIDE + SYMBOL + SIDE;
+    static_assert(THREE == "BUYAAPLBUY");
+
+    const FixedString<16> s = SYMBOL + SIDE;
+    EXPECT_EQ("AAPLBUY", s);
+    EXPECT_EQ(7, s.size());
+    EXPECT_EQ('\0', *std::next(s.c_str(), 7));
+}
+
+TEST(FixedStringConcatenation, MixedPieces)
+{
+    static constexpr StringLiteral TAG = "35=";
+    constexpr FixedString<64> RESULT = TAG + SYMBOL + '|' + std::string_view{"qty="} +
+                                       std::int32_t{-250} + "|px=" + std::uint64_t{10125} + '|';
+    static_assert(RESULT == "35=AAPL|qty=-250|px=10125|");
+
+    const std::string runtime_suffix = "end";
+    const FixedString<64> s = SYMBOL + '/' + runtime_suffix;
+    EXPECT_EQ("AAPL/end", s);
+}
+
+TEST(FixedStringConcatenation, Integers)
+{
+    static_assert(FixedString<32>{SIDE + 0} == "BUY0");
+    static_assert(FixedString<32>{SIDE + 7U} == "BUY7");
+    static_assert(FixedString<32>{SIDE + -7} == "BUY-7");
+    static_assert(FixedString<32>{SIDE + std::numeric_limits<std::int64_t>::min()} ==
+                  "BUY-9223372036854775808");
+    static_assert(FixedString<32>{SIDE + std::numeric_limits<std::uint64_t>::max()} ==
+                  "BUY18446744073709551615");
+    static_assert(FixedString<32>{SIDE + std::numeric_limits<std::int8_t>::min()} == "BUY-128");
+}
+
+TEST(FixedStringConcatenation, ToFixedString)
+{
+    constexpr auto RESULT = (SYMBOL + ':' + std::int16_t{-5}).to_fixed_string();
+    static_assert(std::is_same_v<decltype(RESULT), const FixedString<8 + 1 + 6>>);
+    static_assert(RESULT == "AAPL:-5");
+}
+
+TEST(FixedStringConcatenation, ChainsCompose)
+{
+    const auto header = SYMBOL + '|';
+    const FixedString<32> s = header + (SIDE + '|' + 100);
+    EXPECT_EQ("AAPL|BUY|100", s);
+}
+
+TEST(FixedStringConcatenation, AppendAssign)
+{
+    FixedString<32> s{"8=FIX|"};
+    s += SYMBOL + '|' + 42;
+    EXPECT_EQ("8=FIX|AAPL|42", s);
+    s += 'x';
+    EXPECT_EQ("8=FIX|AAPL|42x", s);
+}
+
+TEST(FixedStringConcatenation, ExactFit)
+{
+    const FixedString<7> s = SYMBOL + SIDE;
+    EXPECT_EQ("AAPLBUY", s);
+}
+
+TEST(FixedStringConcatenation, Overflow)
+{
+    EXPECT_DEATH((void)(FixedString<6>{SYMBOL + SIDE}), "");
+
+    FixedString<8> s{"AAPL"};
+    EXPECT_DEATH(s += SIDE + "xx", "");
+}
+
+}  // namespace fixed_containers
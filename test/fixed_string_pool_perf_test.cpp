@@ -0,0 +1,184 @@
+#include "fixed_containers/fixed_string_pool.hpp"
+
+#include "fixed_containers/fixed_string.hpp"
+#include "fixed_containers/fixed_unordered_map.hpp"
+#include "fixed_containers/wyhash.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t STRING_COUNT = 1024;
+constexpr std::size_t MAX_STRING_LENGTH = 24;
+constexpr std::size_t QUERY_COUNT = 4096;
+
+using PoolType = FixedStringPool<STRING_COUNT, STRING_COUNT * MAX_STRING_LENGTH>;
+using IdType = PoolType::id_type;
+
+struct StringViewHash
+{
+    std::uint64_t operator()(const FixedString<MAX_STRING_LENGTH>& str) const
+    {
+        return wyhash::hash<std::string_view>{}(std::string_view{str});
+    }
+};
+
+using FixedStringKeyedMapType =
+    FixedUnorderedMap<FixedString<MAX_STRING_LENGTH>, IdType, STRING_COUNT, StringViewHash>;
+
+// Symbol-like strings of 4 to MAX_STRING_LENGTH characters.
+const std::vector<std::string>& distinct_strings()
+{
+    static const std::vector<std::string> STRINGS = []()
+    {
+        std::mt19937_64 rng{42};
+        std::vector<std::string> out{};
+        for (std::size_t i = 0; i < STRING_COUNT; i++)
+        {
+            std::string str = std::to_string(i) + ".";
+            const std::size_t length = 4 + (rng() % (MAX_STRING_LENGTH - 3));
+            while (str.size() < length)
+            {
+                str.push_back(static_cast<char>('A' + (rng() % 26)));
+            }
+            out.push_back(str);
+        }
+        return out;
+    }();
+    return STRINGS;
+}
+
+// Independent copies of the strings, so lookups have to compare characters.
+const std::vector<std::string>& queries()
+{
+    static const std::vector<std::string> QUERIES = []()
+    {
+        std::mt19937_64 rng{7};
+        std::vector<std::string> out{};
+        for (std::size_t i = 0; i < QUERY_COUNT; i++)
+        {
+            out.push_back(distinct_strings()[rng() % STRING_COUNT]);
+        }
+        return out;
+    }();
+    return QUERIES;
+}
+
+// Too large for the stack.
+PoolType& pool_instance()
+{
+    static PoolType POOL = []()
+    {
+        PoolType out{};
+        for (const std::string& str : distinct_strings())
+        {
+            out.intern(str);
+        }
+        return out;
+    }();
+    return POOL;
+}
+
+FixedStringKeyedMapType& fixed_string_keyed_map_instance()
+{
+    static FixedStringKeyedMapType MAP = []()
+    {
+        FixedStringKeyedMapType out{};
+        for (const std::string& str : distinct_strings())
+        {
+            out.try_emplace(FixedString<MAX_STRING_LENGTH>{str}, static_cast<IdType>(out.size()));
+        }
+        return out;
+    }();
+    return MAP;
+}
+
+template <typename T>
+void set_memory_counters(benchmark::State& state, const T& container)
+{
+    state.counters["bytes"] = static_cast<double>(sizeof(container));
+    state.counters["bytes_per_string"] = static_cast<double>(sizeof(container)) / STRING_COUNT;
+}
+}  // namespace
+
+static void benchmark_string_to_id_fixed_string_pool(benchmark::State& state)
+{
+    const PoolType& pool = pool_instance();
+    for (auto _ : state)
+    {
+        for (const std::string& query : queries())
+        {
+            benchmark::DoNotOptimize(pool.find(query));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(QUERY_COUNT));
+    set_memory_counters(state, pool);
+}
+BENCHMARK(benchmark_string_to_id_fixed_string_pool);
+
+static void benchmark_string_to_id_fixed_unordered_map(benchmark::State& state)
+{
+    const FixedStringKeyedMapType& map = fixed_string_keyed_map_instance();
+    for (auto _ : state)
+    {
+        for (const std::string& query : queries())
+        {
+            benchmark::DoNotOptimize(map.find(FixedString<MAX_STRING_LENGTH>{query}));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(QUERY_COUNT));
+    set_memory_counters(state, map);
+}
+BENCHMARK(benchmark_string_to_id_fixed_unordered_map);
+
+static void benchmark_string_to_id_std_unordered_map(benchmark::State& state)
+{
+    std::unordered_map<std::string, IdType> map{};
+    for (const std::string& str : distinct_strings())
+    {
+        map.try_emplace(str, static_cast<IdType>(map.size()));
+    }
+    for (auto _ : state)
+    {
+        for (const std::string& query : queries())
+        {
+            benchmark::DoNotOptimize(map.find(query));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(QUERY_COUNT));
+    // The nodes live on the heap, so report a rough per-node cost, excluding the bucket array.
+    state.counters["bytes_per_string"] =
+        static_cast<double>(sizeof(std::pair<const std::string, IdType>) + 2 * sizeof(void*));
+}
+BENCHMARK(benchmark_string_to_id_std_unordered_map);
+
+static void benchmark_id_to_string_fixed_string_pool(benchmark::State& state)
+{
+    const PoolType& pool = pool_instance();
+    for (auto _ : state)
+    {
+        std::size_t total_length = 0;
+        for (std::size_t i = 0; i < QUERY_COUNT; i++)
+        {
+            total_length += pool.at(static_cast<IdType>((i * 7919) % STRING_COUNT)).size();
+        }
+        benchmark::DoNotOptimize(total_length);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(QUERY_COUNT));
+}
+BENCHMARK(benchmark_id_to_string_fixed_string_pool);
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
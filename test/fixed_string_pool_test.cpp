@@ -0,0 +1,179 @@
+#include "fixed_containers/fixed_string_pool.hpp"
+
+#include "fixed_containers/wyhash.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace fixed_containers
+{
+namespace
+{
+static_assert(std::is_same_v<FixedStringPool<256, 16>::id_type, std::uint8_t>);
+static_assert(std::is_same_v<FixedStringPool<257, 16>::id_type, std::uint16_t>);
+static_assert(std::is_same_v<FixedStringPool<65536, 16>::id_type, std::uint16_t>);
+static_assert(std::is_same_v<FixedStringPool<65537, 16>::id_type, std::uint32_t>);
+static_assert(std::is_same_v<FixedStringPool<4, 16, std::uint32_t>::id_type, std::uint32_t>);
+
+constexpr std::string_view HASH_INPUT =
+    "abcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+// Every prefix length, to cover all the tail-reading paths
+constexpr std::array<std::uint64_t, HASH_INPUT.size() + 1> COMPILE_TIME_HASHES = []()
+{
+    std::array<std::uint64_t, HASH_INPUT.size() + 1> out{};
+    for (std::size_t len = 0; len < out.size(); len++)
+    {
+        out[len] = wyhash::hash<std::string_view>{}(HASH_INPUT.substr(0, len));
+    }
+    return out;
+}();
+}  // namespace
+
+TEST(FixedStringPool, ConstexprWyhashMatchesRuntime)
+{
+    for (std::size_t len = 0; len <= HASH_INPUT.size(); len++)
+    {
+        const std::string runtime_copy{HASH_INPUT.substr(0, len)};
+        EXPECT_EQ(COMPILE_TIME_HASHES[len],
+                  wyhash_detail::hash(runtime_copy.data(), static_cast<std::int64_t>(len)))
+            << "len=" << len;
+    }
+
+    constexpr std::uint64_t COMPILE_TIME = wyhash::hash<std::string_view>{}("MSFT");
+    EXPECT_EQ(COMPILE_TIME, wyhash::hash<std::string>{}(std::string{"MSFT"}));
+}
+
+TEST(FixedStringPool, DefaultConstructor)
+{
+    constexpr FixedStringPool<8, 64> POOL{};
+    static_assert(POOL.empty());
+    static_assert(POOL.size() == 0);
+    static_assert(POOL.byte_count() == 0);
+    static_assert(POOL.max_size() == 8);
+    static_assert(POOL.max_byte_count() == 64);
+    static_assert(FixedStringPool<8, 64>::static_max_size() == 8);
+    static_assert(FixedStringPool<8, 64>::static_max_byte_count() == 64);
+    static_assert(!POOL.contains(""));
+}
+
+TEST(FixedStringPool, ConstexprSymbolList)
+{
+    constexpr FixedStringPool<4, 16> SYMBOLS{"AAPL", "MSFT", "NVDA", "AAPL"};
+    static_assert(SYMBOLS.size() == 3);
+    static_assert(SYMBOLS.byte_count() == 12);
+    static_assert(SYMBOLS.find("AAPL") == 0);
+    static_assert(SYMBOLS.find("MSFT") == 1);
+    static_assert(SYMBOLS.find("NVDA") == 2);
+    static_assert(!SYMBOLS.find("GOOG").has_value());
+    static_assert(SYMBOLS.at(1) == "MSFT");
+    static_assert(SYMBOLS[2] == "NVDA");
+
+    EXPECT_EQ(1, SYMBOLS.find(std::string{"MSFT"}));
+    EXPECT_EQ("AAPL", SYMBOLS.at(0));
+}
+
+TEST(FixedStringPool, Intern)
+{
+    FixedStringPool<8, 64> pool{};
+    const auto a = pool.intern("alpha");
+    const auto b = pool.intern("beta");
+    const auto empty = pool.intern("");
+    EXPECT_EQ(0, a);
+    EXPECT_EQ(1, b);
+    EXPECT_EQ(2, empty);
+    EXPECT_EQ(3, pool.size());
+    EXPECT_EQ(9, pool.byte_count());
+
+    // Interning again returns the existing id and doesn't grow the arena
+    const std::string alpha_copy{"alpha"};
+    EXPECT_EQ(a, pool.intern(alpha_copy));
+    EXPECT_EQ(b, pool.intern("beta"));
+    EXPECT_EQ(empty, pool.intern(""));
+    EXPECT_EQ(3, pool.size());
+    EXPECT_EQ(9, pool.byte_count());
+
+    EXPECT_EQ("alpha", pool.at(a));
+    EXPECT_EQ("beta", pool.at(b));
+    EXPECT_EQ("", pool.at(empty));
+    EXPECT_TRUE(pool.contains("beta"));
+    EXPECT_FALSE(pool.contains("bet"));
+    EXPECT_FALSE(pool.contains("betas"));
+}
+
+TEST(FixedStringPool, StringViewsRemainValid)
+{
+    FixedStringPool<64, 1024> pool{};
+    const std::string_view first = pool.at(pool.intern("first"));
+    for (int i = 0; i < 63; i++)
+    {
+        pool.intern(std::to_string(i));
+    }
+    EXPECT_EQ("first", first);
+    EXPECT_EQ(64, pool.size());
+    for (std::uint8_t id = 1; id < 64; id++)
+    {
+        EXPECT_EQ(std::to_string(id - 1), pool.at(id));
+        EXPECT_EQ(id, pool.find(pool.at(id)));
+    }
+}
+
+TEST(FixedStringPool, TryInternWhenFull)
+{
+    {
+        FixedStringPool<2, 64> pool{};
+        EXPECT_EQ(0, pool.try_intern("a"));
+        EXPECT_EQ(1, pool.try_intern("b"));
+        EXPECT_EQ(std::nullopt, pool.try_intern("c"));
+        // Already present strings can still be looked up
+        EXPECT_EQ(1, pool.try_intern("b"));
+        EXPECT_EQ(2, pool.size());
+    }
+    {
+        FixedStringPool<8, 6> pool{};
+        EXPECT_EQ(0, pool.try_intern("abcd"));
+        EXPECT_EQ(std::nullopt, pool.try_intern("efg"));
+        EXPECT_EQ(1, pool.try_intern("ef"));
+        EXPECT_EQ(6, pool.byte_count());
+        EXPECT_EQ(2, pool.try_intern(""));
+        EXPECT_EQ(std::nullopt, pool.try_intern("x"));
+    }
+}
+
+TEST(FixedStringPool, InternAbortsWhenFull)
+{
+    FixedStringPool<1, 8> pool{};
+    pool.intern("a");
+    EXPECT_DEATH(pool.intern("b"), "");
+}
+
+TEST(FixedStringPool, Clear)
+{
+    FixedStringPool<4, 16> pool{"x", "y"};
+    pool.clear();
+    EXPECT_TRUE(pool.empty());
+    EXPECT_EQ(0, pool.byte_count());
+    EXPECT_FALSE(pool.contains("x"));
+    EXPECT_EQ(0, pool.intern("y"));
+    EXPECT_EQ("y", pool.at(0));
+}
+
+TEST(FixedStringPool, CopyIsIndependent)
+{
+    FixedStringPool<4, 16> pool{"x", "y"};
+    FixedStringPool<4, 16> copy = pool;
+    pool.intern("z");
+    EXPECT_EQ(3, pool.size());
+    EXPECT_EQ(2, copy.size());
+    EXPECT_FALSE(copy.contains("z"));
+    EXPECT_EQ("y", copy.at(1));
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,180 @@
+#include "fixed_containers/fixed_string_ref.hpp"
+
+#include "fixed_containers/fixed_string.hpp"
+#include "fixed_containers/source_location.hpp"
+#include "fixed_containers/string_literal.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+
+namespace fixed_containers
+{
+namespace
+{
+// Not templated on the capacity: a single instantiation serves every FixedString<N>
+constexpr void format_order(FixedStringRef<> out,
+                            const std::string_view& symbol,
+                            const std::string_view& side)
+{
+    out.clear();
+    out.append(symbol);
+    out.push_back(':');
+    out += side;
+}
+
+// Reports errors differently from the default checking, so tests can tell which one ran
+struct MessageChecking
+{
+    [[noreturn]] static void out_of_range(const std::size_t /*index*/,
+                                          const std::size_t /*size*/,
+                                          const std_transition::source_location& /*loc*/)
+    {
+        fail("MessageChecking::out_of_range");
+    }
+    [[noreturn]] static void length_error(const std::size_t /*target_capacity*/,
+                                          const std_transition::source_location& /*loc*/)
+    {
+        fail("MessageChecking::length_error");
+    }
+    [[noreturn]] static void empty_container_access(const std_transition::source_location& /*loc*/)
+    {
+        fail("MessageChecking::empty_container_access");
+    }
+    [[noreturn]] static void invalid_argument(const StringLiteral& /*error_message*/,
+                                              const std_transition::source_location& /*loc*/)
+    {
+        fail("MessageChecking::invalid_argument");
+    }
+
+private:
+    [[noreturn]] static void fail(const char* message)
+    {
+        std::fputs(message, stderr);
+        std::abort();
+    }
+};
+}  // namespace
+
+TEST(FixedStringRef, SharedAcrossCapacities)
+{
+    constexpr auto small = []()
+    {
+        FixedString<8> s{"old"};
+        format_order(s, "AB", "BUY");
+        return s;
+    }();
+    static_assert(small == "AB:BUY");
+    static_assert(small.c_str()[6] == '\0');
+
+    constexpr auto large = []()
+    {
+        FixedString<64> s{};
+        format_order(s, "ABCDEFGH", "SELL");
+        return s;
+    }();
+    static_assert(large == "ABCDEFGH:SELL");
+
+    FixedString<8> s{};
+    EXPECT_DEATH(format_order(s, "ABCDEFGH", "SELL"), "");
+}
+
+TEST(FixedStringRef, Accessors)
+{
+    FixedString<16> s{"hello"};
+    const FixedStringRef ref{s};
+
+    EXPECT_EQ(16, ref.max_size());
+    EXPECT_EQ(16, ref.capacity());
+    EXPECT_EQ(5, ref.size());
+    EXPECT_EQ(5, ref.length());
+    EXPECT_FALSE(ref.empty());
+    EXPECT_FALSE(is_full(ref));
+    EXPECT_EQ(s.c_str(), ref.c_str());
+    EXPECT_EQ('h', ref.front());
+    EXPECT_EQ('o', ref.back());
+    EXPECT_EQ('e', ref[1]);
+    EXPECT_EQ('l', ref.at(2));
+    EXPECT_EQ(std::string_view{"hello"}, std::string_view{ref});
+    EXPECT_EQ("ell", ref.substr(1, 3));
+    EXPECT_TRUE(ref.starts_with("he"));
+    EXPECT_TRUE(ref.ends_with('o'));
+    EXPECT_EQ(0, ref.compare("hello"));
+    EXPECT_TRUE(ref == s);
+    EXPECT_TRUE(s == ref);
+    EXPECT_TRUE(ref == ref);
+    EXPECT_TRUE(ref < "world");
+    EXPECT_TRUE(ref < FixedString<8>{"world"});
+
+    EXPECT_DEATH(static_cast<void>(ref.at(5)), "");
+}
+
+TEST(FixedStringRef, MutationsKeepNullTermination)
+{
+    constexpr auto s1 = []()
+    {
+        FixedString<16> s{"hello"};
+        FixedStringRef ref{s};
+        ref.insert(ref.begin(), '>');
+        ref.insert(ref.end(), std::string_view{" world"});
+        ref.erase(std::next(ref.begin(), 6), ref.end());
+        ref.pop_back();
+        ref += {'!', '!'};
+        return s;
+    }();
+    static_assert(s1 == ">hell!!");
+    static_assert(s1.c_str()[7] == '\0');
+
+    constexpr auto s2 = []()
+    {
+        FixedString<16> s{"hello"};
+        FixedStringRef ref{s};
+        ref.resize(7, '.');
+        ref.resize(6);
+        return s;
+    }();
+    static_assert(s2 == "hello.");
+    static_assert(s2.c_str()[6] == '\0');
+
+    constexpr auto s3 = []()
+    {
+        FixedString<16> s{"hello"};
+        FixedStringRef ref{s};
+        ref.assign(3, 'z');
+        return s;
+    }();
+    static_assert(s3 == "zzz");
+
+    FixedString<4> s4{"abcd"};
+    FixedStringRef ref{s4};
+    EXPECT_TRUE(is_full(ref));
+    EXPECT_DEATH(ref.push_back('e'), "");
+    ref.assign("xy");
+    EXPECT_EQ(s4, "xy");
+    EXPECT_EQ('\0', s4.c_str()[2]);
+}
+
+TEST(FixedStringRef, KeepsTheCheckingOfTheString)
+{
+    static_assert(std::is_convertible_v<FixedString<3>&, FixedStringRef<>>);
+    static_assert(!std::is_convertible_v<FixedString<3, MessageChecking>&, FixedStringRef<>>);
+    static_assert(
+        std::is_convertible_v<FixedString<3, MessageChecking>&, FixedStringRef<MessageChecking>>);
+
+    FixedString<3> default_checked{};
+    FixedStringRef default_ref{default_checked};
+    static_assert(std::is_same_v<decltype(default_ref), FixedStringRef<>>);
+
+    FixedString<2, MessageChecking> s{"ab"};
+    FixedStringRef ref{s};
+    static_assert(std::is_same_v<decltype(ref), FixedStringRef<MessageChecking>>);
+    EXPECT_DEATH(ref.push_back('c'), "MessageChecking::length_error");
+    EXPECT_DEATH(static_cast<void>(ref.at(2)), "MessageChecking::out_of_range");
+}
+
+}  // namespace fixed_containers
@@ -1189,6 +1189,51 @@ TEST(FixedString, OperatorPlusEqual)
     static_assert(v1.max_size() == 17);
 }
 
+TEST(FixedString, OperatorPlusEqualChar)
+{
+    constexpr auto v1 = []()
+    {
+        FixedString<5> v{"012"};
+        v += 'a';
+        v += 'b';
+        return v;
+    }();
+
+    static_assert(v1 == "012ab");
+    static_assert(v1.size() == 5);
+}
+
+TEST(FixedString, AppendWritten)
+{
+    {
+        // For off-by-one issues, make the capacity just fit
+        constexpr auto v1 = []()
+        {
+            FixedString<5> v{"01"};
+            v.append_written(
+                3, [](char* destination) { std::string_view{"abc"}.copy(destination, 3); });
+            return v;
+        }();
+
+        static_assert(v1 == "01abc");
+        static_assert(v1.size() == 5);
+    }
+
+    {
+        FixedString<7> v{"0123"};
+        auto& self = v.append_written(0, [](char*) {});
+        EXPECT_EQ(v, "0123");
+        EXPECT_EQ(self, v);
+        EXPECT_EQ('\0', *std::next(v.data(), 4));
+    }
+}
+
+TEST(FixedString, AppendWritten_ExceedsCapacity)
+{
+    FixedString<3> v{"01"};
+    EXPECT_DEATH(v.append_written(2, [](char*) {}), "");
+}
+
 TEST(FixedString, Equality)
 {
     constexpr auto v1 = FixedString<12>{"012"};
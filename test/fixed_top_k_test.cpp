@@ -0,0 +1,111 @@
+#include "fixed_containers/fixed_top_k.hpp"
+
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace fixed_containers
+{
+namespace
+{
+using TopClients = FixedTopK<std::uint64_t, 5>;
+static_assert(TriviallyCopyable<TopClients>);
+static_assert(IsStructuralType<TopClients>);
+
+std::uint64_t next_random(std::uint64_t& state)
+{
+    state ^= state << 13U;
+    state ^= state >> 7U;
+    state ^= state << 17U;
+    return state;
+}
+
+// Background noise from many clients, plus clients 1 to 5 sending 5000, 4000, ... 1000 messages
+template <typename TopK>
+void add_messages(TopK& top, std::uint64_t seed)
+{
+    for (std::uint64_t i = 0; i < 15'000; i++)
+    {
+        top.add(1000 + (next_random(seed) % 50'000));
+        for (std::uint64_t client = 1; client <= 5; client++)
+        {
+            if (i % 3 == 0 && i < 3000 * (6 - client))
+            {
+                top.add(client);
+            }
+        }
+    }
+}
+}  // namespace
+
+TEST(FixedTopK, Add)
+{
+    constexpr auto t1 = []()
+    {
+        FixedTopK<std::string_view, 2, 64> t{};
+        t.add("a");
+        t.add("b", 3);
+        t.add("c", 2);
+        t.add("a", 5);
+        return t;
+    }();
+
+    static_assert(t1.size() == 2);
+    static_assert(t1.sketch().total_count() == 11);
+    static_assert(t1.top().size() == 2);
+    static_assert(t1.top()[0] == FixedTopKEntry<std::string_view>{"a", 6});
+    static_assert(t1.top()[1] == FixedTopKEntry<std::string_view>{"b", 3});
+    static_assert(t1.estimate("c") == 2);
+}
+
+TEST(FixedTopK, HeavyHitters)
+{
+    static TopClients top{};
+    add_messages(top, 88172645463325252ULL);
+
+    const auto result = top.top();
+    ASSERT_EQ(5, result.size());
+    for (std::size_t i = 0; i < 5; i++)
+    {
+        EXPECT_EQ(i + 1, result[i].key);
+        // Never below the true count, and close to it
+        EXPECT_GE(result[i].count, 1000 * (5 - i));
+        EXPECT_LE(result[i].count, (1000 * (5 - i)) + 100);
+    }
+}
+
+TEST(FixedTopK, Merge)
+{
+    static TopClients a{};
+    static TopClients b{};
+    add_messages(a, 1);
+    add_messages(b, 2);
+    b.add(6, 9000);
+    a.merge(b);
+
+    const auto result = a.top();
+    ASSERT_EQ(5, result.size());
+    EXPECT_EQ(1, result[0].key);
+    EXPECT_GE(result[0].count, 10'000);
+    EXPECT_EQ(6, result[1].key);
+    EXPECT_EQ(2, result[2].key);
+    EXPECT_EQ(3, result[3].key);
+    EXPECT_EQ(4, result[4].key);
+    EXPECT_EQ((2 * 30'000) + 9000, a.sketch().total_count());
+}
+
+TEST(FixedTopK, Clear)
+{
+    TopClients t{};
+    t.add(1);
+    t.clear();
+    EXPECT_TRUE(t.empty());
+    EXPECT_EQ(0, t.estimate(1));
+    EXPECT_EQ(TopClients{}, t);
+}
+
+}  // namespace fixed_containers
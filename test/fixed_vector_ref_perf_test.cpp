@@ -0,0 +1,80 @@
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/fixed_vector_ref.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <tuple>
+#include <utility>
+
+namespace fixed_containers
+{
+namespace
+{
+// Many capacities of the same element type, as in a large program. Code templated on the
+// capacity gets one copy of insert()/erase() per capacity; FixedVectorRef code gets one in total.
+constexpr std::size_t CAPACITY_COUNT = 32;
+constexpr std::size_t BASE_CAPACITY = 64;
+
+template <std::size_t... INDICES>
+auto make_vectors(std::index_sequence<INDICES...> /*unused*/)
+{
+    return std::tuple<FixedVector<std::int64_t, BASE_CAPACITY + INDICES>...>{};
+}
+using Vectors = decltype(make_vectors(std::make_index_sequence<CAPACITY_COUNT>{}));
+
+// Order-book style churn: insert in the middle, then erase from the front
+template <typename VectorType>
+[[gnu::noinline]] std::int64_t churn(VectorType& v, const std::int64_t seed)
+{
+    for (std::int64_t i = 0; i < 8; i++)
+    {
+        const auto middle = std::next(v.begin(), static_cast<std::ptrdiff_t>(v.size() / 2));
+        v.insert(middle, seed + i);
+    }
+    std::int64_t sum = 0;
+    while (v.size() > BASE_CAPACITY / 2)
+    {
+        sum += v.front();
+        v.erase(v.begin());
+    }
+    return sum;
+}
+
+[[gnu::noinline]] std::int64_t churn_ref(FixedVectorRef<std::int64_t> v, const std::int64_t seed)
+{
+    return churn(v, seed);
+}
+
+template <typename Churn>
+void benchmark_churn(benchmark::State& state, const Churn& churn_one)
+{
+    Vectors vectors{};
+    std::apply([](auto&... v) { (v.resize(BASE_CAPACITY / 2, 1), ...); }, vectors);
+    for (auto _ : state)
+    {
+        std::int64_t sum = 0;
+        std::apply([&](auto&... v) { ((sum += churn_one(v, sum)), ...); }, vectors);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(CAPACITY_COUNT));
+}
+}  // namespace
+
+static void benchmark_churn_per_capacity_instantiations(benchmark::State& state)
+{
+    benchmark_churn(state, [](auto& v, const std::int64_t seed) { return churn(v, seed); });
+}
+BENCHMARK(benchmark_churn_per_capacity_instantiations);
+
+static void benchmark_churn_fixed_vector_ref(benchmark::State& state)
+{
+    benchmark_churn(state, [](auto& v, const std::int64_t seed) { return churn_ref(v, seed); });
+}
+BENCHMARK(benchmark_churn_fixed_vector_ref);
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
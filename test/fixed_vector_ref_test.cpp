@@ -0,0 +1,257 @@
+#include "fixed_containers/fixed_vector_ref.hpp"
+
+#include "instance_counter.hpp"
+#include "mock_testing_types.hpp"
+
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/source_location.hpp"
+#include "fixed_containers/string_literal.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+namespace fixed_containers
+{
+namespace
+{
+// Not templated on the capacity: a single instantiation serves every FixedVector<int, N>
+constexpr void append_squares(FixedVectorRef<int> out, const int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        out.push_back(i * i);
+    }
+}
+
+constexpr void erase_odd(FixedVectorRef<int> out)
+{
+    out.erase(std::remove_if(out.begin(), out.end(), [](const int v) { return v % 2 != 0; }),
+              out.end());
+}
+
+// Reports errors differently from the default checking, so tests can tell which one ran
+struct MessageChecking
+{
+    [[noreturn]] static void out_of_range(const std::size_t /*index*/,
+                                          const std::size_t /*size*/,
+                                          const std_transition::source_location& /*loc*/)
+    {
+        fail("MessageChecking::out_of_range");
+    }
+    [[noreturn]] static void length_error(const std::size_t /*target_capacity*/,
+                                          const std_transition::source_location& /*loc*/)
+    {
+        fail("MessageChecking::length_error");
+    }
+    [[noreturn]] static void empty_container_access(const std_transition::source_location& /*loc*/)
+    {
+        fail("MessageChecking::empty_container_access");
+    }
+    [[noreturn]] static void invalid_argument(const StringLiteral& /*error_message*/,
+                                              const std_transition::source_location& /*loc*/)
+    {
+        fail("MessageChecking::invalid_argument");
+    }
+
+private:
+    [[noreturn]] static void fail(const char* message)
+    {
+        std::fputs(message, stderr);
+        std::abort();
+    }
+};
+}  // namespace
+
+TEST(FixedVectorRef, SharedAcrossCapacities)
+{
+    constexpr auto small = []()
+    {
+        FixedVector<int, 4> v{};
+        append_squares(v, 4);
+        erase_odd(v);
+        return v;
+    }();
+    static_assert(small == FixedVector<int, 4>{0, 4});
+
+    constexpr auto large = []()
+    {
+        FixedVector<int, 100> v{};
+        append_squares(v, 10);
+        erase_odd(v);
+        return v;
+    }();
+    static_assert(large == FixedVector<int, 100>{0, 4, 16, 36, 64});
+
+    FixedVector<int, 7> v{};
+    append_squares(v, 3);
+    EXPECT_EQ(v, (FixedVector<int, 7>{0, 1, 4}));
+}
+
+TEST(FixedVectorRef, Accessors)
+{
+    FixedVector<int, 8> v{1, 2, 3};
+    const FixedVectorRef ref{v};
+
+    EXPECT_EQ(8, ref.max_size());
+    EXPECT_EQ(8, ref.capacity());
+    EXPECT_EQ(3, ref.size());
+    EXPECT_FALSE(ref.empty());
+    EXPECT_FALSE(is_full(ref));
+    EXPECT_EQ(v.data(), ref.data());
+    EXPECT_EQ(1, ref.front());
+    EXPECT_EQ(3, ref.back());
+    EXPECT_EQ(2, ref[1]);
+    EXPECT_EQ(2, ref.at(1));
+    EXPECT_TRUE(std::ranges::equal(ref, std::array{1, 2, 3}));
+    EXPECT_TRUE(std::equal(ref.rbegin(), ref.rend(), std::array{3, 2, 1}.begin()));
+
+    EXPECT_DEATH(static_cast<void>(ref.at(3)), "");
+}
+
+TEST(FixedVectorRef, MutationsAreVisibleInTheVector)
+{
+    constexpr auto v1 = []()
+    {
+        FixedVector<int, 10> v{1, 2, 3};
+        FixedVectorRef<int> ref{v};
+        ref.insert(std::next(ref.begin()), 10);
+        ref.insert(ref.end(), {20, 21});
+        ref.emplace(ref.begin(), 0);
+        ref.emplace_back(30);
+        ref.erase(std::next(ref.begin(), 2));
+        ref.pop_back();
+        ref[0] = -1;
+        return v;
+    }();
+    static_assert(v1 == FixedVector<int, 10>{-1, 1, 2, 3, 20, 21});
+
+    constexpr auto v2 = []()
+    {
+        FixedVector<int, 10> v{1, 2, 3};
+        FixedVectorRef<int> ref{v};
+        ref.resize(5, 9);
+        ref.resize(4);
+        return v;
+    }();
+    static_assert(v2 == FixedVector<int, 10>{1, 2, 3, 9});
+
+    constexpr auto v3 = []()
+    {
+        FixedVector<int, 10> v{1, 2, 3};
+        FixedVectorRef<int> ref{v};
+        ref.assign(2, 7);
+        return v;
+    }();
+    static_assert(v3 == FixedVector<int, 10>{7, 7});
+
+    FixedVector<int, 10> v4{1, 2, 3};
+    FixedVectorRef<int> ref{v4};
+    std::istringstream stream{"4 5 6"};
+    ref.insert(std::next(ref.cbegin()),
+               std::istream_iterator<int>{stream},
+               std::istream_iterator<int>{});
+    EXPECT_EQ(v4, (FixedVector<int, 10>{1, 4, 5, 6, 2, 3}));
+    ref.clear();
+    EXPECT_TRUE(v4.empty());
+}
+
+TEST(FixedVectorRef, CapacityIsChecked)
+{
+    FixedVector<int, 3> v{1, 2, 3};
+    FixedVectorRef<int> ref{v};
+    EXPECT_TRUE(is_full(ref));
+    EXPECT_DEATH(ref.push_back(4), "");
+    EXPECT_DEATH(ref.insert(ref.begin(), {4, 5}), "");
+    EXPECT_DEATH(ref.resize(4), "");
+
+    ref.clear();
+    EXPECT_DEATH(ref.pop_back(), "");
+}
+
+TEST(FixedVectorRef, NonTrivialElements)
+{
+    struct InstanceCounterUniquenessToken
+    {
+    };
+    using InstanceCounter =
+        instance_counter::InstanceCounterNonTrivialAssignment<InstanceCounterUniquenessToken>;
+
+    {
+        FixedVector<InstanceCounter, 8> v{};
+        FixedVectorRef<InstanceCounter> ref{v};
+        ref.emplace_back(1);
+        ref.push_back(InstanceCounter{2});
+        ref.insert(ref.begin(), InstanceCounter{0});
+        EXPECT_EQ(3, InstanceCounter::counter);
+        ref.erase(ref.begin());
+        EXPECT_EQ(2, InstanceCounter::counter);
+        ref.resize(5);
+        EXPECT_EQ(5, InstanceCounter::counter);
+        ref.resize(1);
+        EXPECT_EQ(1, InstanceCounter::counter);
+    }
+    EXPECT_EQ(0, InstanceCounter::counter);
+
+    FixedVector<std::string, 4> strings{"a", "b"};
+    FixedVectorRef<std::string> ref{strings};
+    ref.insert(std::next(ref.begin()), std::string(64, 'x'));
+    EXPECT_EQ(strings, (FixedVector<std::string, 4>{"a", std::string(64, 'x'), "b"}));
+}
+
+TEST(FixedVectorRef, Comparison)
+{
+    FixedVector<int, 4> v1{1, 2, 3};
+    FixedVector<int, 8> v2{1, 2, 3};
+    FixedVector<int, 8> v3{1, 2, 4};
+    const FixedVectorRef<int> ref1{v1};
+    const FixedVectorRef<int> ref2{v2};
+    const FixedVectorRef<int> ref3{v3};
+
+    EXPECT_EQ(ref1, ref2);
+    EXPECT_NE(ref1, ref3);
+    EXPECT_LT(ref1, ref3);
+    EXPECT_GT(ref3, ref2);
+}
+
+TEST(FixedVectorRef, NonTrivialIntElements)
+{
+    FixedVector<MockNonTrivialInt, 4> v{};
+    FixedVectorRef<MockNonTrivialInt> ref{v};
+    ref.push_back(MockNonTrivialInt{3});
+    ref.insert(ref.begin(), MockNonTrivialInt{1});
+    EXPECT_EQ(2, v.size());
+    EXPECT_EQ(1, v[0].value);
+    EXPECT_EQ(3, v[1].value);
+}
+
+TEST(FixedVectorRef, KeepsTheCheckingOfTheVector)
+{
+    static_assert(std::is_convertible_v<FixedVector<int, 3>&, FixedVectorRef<int>>);
+    static_assert(
+        !std::is_convertible_v<FixedVector<int, 3, MessageChecking>&, FixedVectorRef<int>>);
+    static_assert(std::is_convertible_v<FixedVector<int, 3, MessageChecking>&,
+                                        FixedVectorRef<int, MessageChecking>>);
+
+    FixedVector<int, 3> default_checked{};
+    FixedVectorRef default_ref{default_checked};
+    static_assert(std::is_same_v<decltype(default_ref), FixedVectorRef<int>>);
+
+    FixedVector<int, 2, MessageChecking> v{1, 2};
+    FixedVectorRef ref{v};
+    static_assert(std::is_same_v<decltype(ref), FixedVectorRef<int, MessageChecking>>);
+    EXPECT_DEATH(ref.push_back(3), "MessageChecking::length_error");
+    EXPECT_DEATH((void)ref.at(2), "MessageChecking::out_of_range");
+    ref.clear();
+    EXPECT_DEATH(ref.pop_back(), "MessageChecking::empty_container_access");
+}
+
+}  // namespace fixed_containers
@@ -16,7 +16,9 @@
 
 #include <algorithm>
 #include <array>
+#include <compare>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
 #include <memory>
 #include <ranges>
@@ -876,6 +878,78 @@ TEST(FixedVector, Comparison)
     }
 }
 
+TEST(FixedVector, ComparisonMatchesElementWise)
+{
+    // Evaluated at compile-time this runs the scalar path, at run-time the memcmp()-based one.
+    // 64-bit elements make the comparison blocks 8 elements long, so the sizes below cover empty,
+    // partial, exact and multiple blocks with a tail.
+    constexpr auto matches_element_wise = []()
+    {
+        using VecType = FixedVector<std::int64_t, 24>;
+        const auto matches = [](const VecType& left, const VecType& right)
+        {
+            return (left == right) == std::ranges::equal(left, right) &&
+                   (left <=> right) ==
+                       std::lexicographical_compare_three_way(
+                           left.cbegin(), left.cend(), right.cbegin(), right.cend());
+        };
+
+        bool out = true;
+        for (const std::size_t size : {0, 1, 7, 8, 9, 20})
+        {
+            VecType base{};
+            for (std::size_t i = 0; i < size; i++)
+            {
+                // Negative values, so that the byte order differs from the numeric order
+                base.push_back((static_cast<std::int64_t>(i) * 1000) - 5000);
+            }
+            out = out && matches(base, base);
+            for (std::size_t i = 0; i < size; i++)
+            {
+                for (const std::int64_t delta : {-1, 256})
+                {
+                    VecType changed = base;
+                    changed[i] += delta;
+                    out = out && matches(base, changed) && matches(changed, base);
+                }
+                const VecType prefix{base.begin(),
+                                     std::next(base.begin(), static_cast<std::ptrdiff_t>(i))};
+                out = out && matches(base, prefix) && matches(prefix, base);
+            }
+        }
+        return out;
+    };
+
+    static_assert(matches_element_wise());
+    EXPECT_TRUE(matches_element_wise());
+}
+
+TEST(FixedVector, ComparisonOfNonTrivialElementsInConstantEvaluation)
+{
+    // Not trivially default constructible, so stored in OptionalStorage
+    struct Element
+    {
+        int value = 0;
+        constexpr bool operator==(const Element&) const = default;
+        constexpr auto operator<=>(const Element&) const = default;
+    };
+    static_assert(!std::is_trivially_default_constructible_v<Element>);
+
+    static_assert(FixedVector<Element, 5>{Element{1}, Element{2}} ==
+                  FixedVector<Element, 5>{Element{1}, Element{2}});
+    static_assert(FixedVector<Element, 5>{Element{1}, Element{2}} !=
+                  FixedVector<Element, 3>{Element{1}, Element{3}});
+    static_assert((FixedVector<Element, 5>{Element{1}, Element{2}} <=>
+                   FixedVector<Element, 5>{Element{1}, Element{3}}) < 0);
+    static_assert((FixedVector<Element, 5>{Element{1}, Element{2}} <=>
+                   FixedVector<Element, 5>{Element{1}}) > 0);
+
+    const FixedVector<Element, 5> v1{Element{1}, Element{2}};
+    const FixedVector<Element, 5> v2{Element{1}, Element{3}};
+    EXPECT_NE(v1, v2);
+    EXPECT_LT(v1, v2);
+}
+
 TEST(FixedVector, IteratorAssignment)
 {
     FixedVector<int, 8>::iterator it;              // Default construction
@@ -0,0 +1,122 @@
+#include "fixed_containers/fixed_deque.hpp"
+#include "fixed_containers/fixed_work_stealing_deque.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+
+namespace fixed_containers
+{
+namespace
+{
+// Baseline with the same interface as FixedWorkStealingDeque.
+template <typename T, std::size_t MAXIMUM_SIZE>
+class MutexFixedDeque
+{
+    std::mutex mutex_{};
+    FixedDeque<T, MAXIMUM_SIZE> deque_{};
+
+public:
+    bool push(const T& value)
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+        if (is_full(deque_))
+        {
+            return false;
+        }
+        deque_.push_back(value);
+        return true;
+    }
+
+    std::optional<T> pop()
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+        if (deque_.empty())
+        {
+            return std::nullopt;
+        }
+        std::optional<T> out{deque_.back()};
+        deque_.pop_back();
+        return out;
+    }
+
+    std::optional<T> steal()
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+        if (deque_.empty())
+        {
+            return std::nullopt;
+        }
+        std::optional<T> out{deque_.front()};
+        deque_.pop_front();
+        return out;
+    }
+};
+
+constexpr std::size_t CAP = 1024;
+}  // namespace
+
+template <typename DequeType>
+static void benchmark_owner_push_pop(benchmark::State& state)
+{
+    DequeType instance{};
+    std::int64_t i = 0;
+    for (auto _ : state)
+    {
+        instance.push(i++);
+        instance.push(i++);
+        benchmark::DoNotOptimize(instance.pop());
+        benchmark::DoNotOptimize(instance.pop());
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+
+// Thread 0 is the owner, pushing and occasionally popping. All other threads steal.
+template <typename DequeType>
+static void benchmark_push_and_steal(benchmark::State& state)
+{
+    static DequeType instance{};
+    std::int64_t i = 0;
+    if (state.thread_index() == 0)
+    {
+        for (auto _ : state)
+        {
+            if (!instance.push(i++) || i % 4 == 0)
+            {
+                benchmark::DoNotOptimize(instance.pop());
+            }
+        }
+        while (instance.pop().has_value())
+        {
+        }
+    }
+    else
+    {
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(instance.steal());
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(benchmark_owner_push_pop<MutexFixedDeque<std::int64_t, CAP>>);
+BENCHMARK(benchmark_owner_push_pop<FixedWorkStealingDeque<std::int64_t, CAP>>);
+
+BENCHMARK(benchmark_push_and_steal<MutexFixedDeque<std::int64_t, CAP>>)
+    ->Threads(2)
+    ->Threads(4)
+    ->Threads(8)
+    ->UseRealTime();
+BENCHMARK(benchmark_push_and_steal<FixedWorkStealingDeque<std::int64_t, CAP>>)
+    ->Threads(2)
+    ->Threads(4)
+    ->Threads(8)
+    ->UseRealTime();
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -0,0 +1,186 @@
+#include "fixed_containers/fixed_work_stealing_deque.hpp"
+
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using DequeType = FixedWorkStealingDeque<int, 8>;
+static_assert(NotCopyConstructible<DequeType>);
+static_assert(NotMoveConstructible<DequeType>);
+static_assert(DequeType::static_max_size() == 8);
+}  // namespace
+
+TEST(FixedWorkStealingDeque, DefaultConstructor)
+{
+    const DequeType v1{};
+    EXPECT_TRUE(v1.empty_approx());
+    EXPECT_EQ(0, v1.size_approx());
+    EXPECT_EQ(8, v1.max_size());
+}
+
+TEST(FixedWorkStealingDeque, PushAndPopIsLifo)
+{
+    DequeType v1{};
+    EXPECT_TRUE(v1.push(1));
+    EXPECT_TRUE(v1.push(2));
+    EXPECT_TRUE(v1.push(3));
+    EXPECT_EQ(3, v1.size_approx());
+
+    EXPECT_EQ(3, v1.pop());
+    EXPECT_EQ(2, v1.pop());
+    EXPECT_EQ(1, v1.pop());
+    EXPECT_EQ(std::nullopt, v1.pop());
+    EXPECT_TRUE(v1.empty_approx());
+}
+
+TEST(FixedWorkStealingDeque, PushAndStealIsFifo)
+{
+    DequeType v1{};
+    v1.push(1);
+    v1.push(2);
+    v1.push(3);
+
+    EXPECT_EQ(1, v1.steal());
+    EXPECT_EQ(2, v1.steal());
+    EXPECT_EQ(3, v1.steal());
+    EXPECT_EQ(std::nullopt, v1.steal());
+    EXPECT_TRUE(v1.empty_approx());
+}
+
+TEST(FixedWorkStealingDeque, PopAndStealFromBothEnds)
+{
+    DequeType v1{};
+    v1.push(1);
+    v1.push(2);
+    v1.push(3);
+    v1.push(4);
+
+    EXPECT_EQ(1, v1.steal());
+    EXPECT_EQ(4, v1.pop());
+    EXPECT_EQ(2, v1.steal());
+    EXPECT_EQ(3, v1.pop());
+    EXPECT_EQ(std::nullopt, v1.pop());
+    EXPECT_EQ(std::nullopt, v1.steal());
+}
+
+TEST(FixedWorkStealingDeque, Full)
+{
+    DequeType v1{};
+    for (int i = 0; i < 8; i++)
+    {
+        EXPECT_TRUE(v1.push(i));
+    }
+    EXPECT_FALSE(v1.push(99));
+    EXPECT_EQ(8, v1.size_approx());
+
+    EXPECT_EQ(0, v1.steal());
+    EXPECT_TRUE(v1.push(99));
+    EXPECT_EQ(99, v1.pop());
+    EXPECT_EQ(7, v1.pop());
+}
+
+TEST(FixedWorkStealingDeque, Wraparound)
+{
+    DequeType v1{};
+    for (int round = 0; round < 10; round++)
+    {
+        for (int i = 0; i < 6; i++)
+        {
+            EXPECT_TRUE(v1.push((round * 10) + i));
+        }
+        for (int i = 0; i < 3; i++)
+        {
+            EXPECT_EQ((round * 10) + i, v1.steal());
+        }
+        for (int i = 5; i >= 3; i--)
+        {
+            EXPECT_EQ((round * 10) + i, v1.pop());
+        }
+        EXPECT_TRUE(v1.empty_approx());
+    }
+}
+
+// Intended to also be run under ThreadSanitizer.
+TEST(FixedWorkStealingDeque, StressOwnerAndThieves)
+{
+    static constexpr std::size_t THIEF_COUNT = 3;
+    static constexpr std::int64_t ITEM_COUNT = 200'000;
+
+    FixedWorkStealingDeque<std::int64_t, 64> deque{};
+    std::vector<std::atomic<int>> seen(static_cast<std::size_t>(ITEM_COUNT));
+    std::atomic<bool> done{false};
+    std::atomic<std::int64_t> consumed{0};
+
+    auto consume = [&](const std::int64_t item)
+    {
+        seen[static_cast<std::size_t>(item)].fetch_add(1, std::memory_order_relaxed);
+        consumed.fetch_add(1, std::memory_order_relaxed);
+    };
+
+    std::array<std::thread, THIEF_COUNT> thieves{};
+    for (std::thread& thief : thieves)
+    {
+        thief = std::thread(
+            [&]()
+            {
+                while (!done.load(std::memory_order_acquire))
+                {
+                    if (const auto item = deque.steal(); item.has_value())
+                    {
+                        consume(*item);
+                    }
+                }
+            });
+    }
+
+    for (std::int64_t i = 0; i < ITEM_COUNT; i++)
+    {
+        while (!deque.push(i))
+        {
+            if (const auto item = deque.pop(); item.has_value())
+            {
+                consume(*item);
+            }
+        }
+        if (i % 3 == 0)
+        {
+            if (const auto item = deque.pop(); item.has_value())
+            {
+                consume(*item);
+            }
+        }
+    }
+    while (const auto item = deque.pop())
+    {
+        consume(*item);
+    }
+    while (consumed.load(std::memory_order_acquire) != ITEM_COUNT)
+    {
+        std::this_thread::yield();
+    }
+
+    done.store(true, std::memory_order_release);
+    for (std::thread& thief : thieves)
+    {
+        thief.join();
+    }
+
+    EXPECT_TRUE(deque.empty_approx());
+    for (const std::atomic<int>& count : seen)
+    {
+        ASSERT_EQ(1, count.load());
+    }
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,135 @@
+#include "fixed_containers/hashed_fixed_string.hpp"
+
+#include "fixed_containers/fixed_string.hpp"
+#include "fixed_containers/fixed_unordered_map.hpp"
+#include "fixed_containers/wyhash.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t KEY_COUNT = 1024;
+constexpr std::size_t MAX_KEY_LENGTH = 32;
+constexpr std::size_t QUERY_COUNT = 4096;
+// Each query is looked up in this many maps, e.g. price, position and risk limit per symbol.
+constexpr std::size_t MAP_COUNT = 4;
+
+struct FixedStringHash
+{
+    std::uint64_t operator()(const FixedString<MAX_KEY_LENGTH>& str) const
+    {
+        return wyhash::hash<std::string_view>{}(std::string_view{str});
+    }
+};
+
+using FixedStringMapType =
+    FixedUnorderedMap<FixedString<MAX_KEY_LENGTH>, std::int64_t, KEY_COUNT, FixedStringHash>;
+using HashedFixedStringMapType =
+    FixedUnorderedMap<HashedFixedString<MAX_KEY_LENGTH>, std::int64_t, KEY_COUNT>;
+
+// Keys of 8 to MAX_KEY_LENGTH characters.
+const std::vector<std::string>& keys()
+{
+    static const std::vector<std::string> KEYS = []()
+    {
+        std::mt19937_64 rng{42};
+        std::vector<std::string> out{};
+        for (std::size_t i = 0; i < KEY_COUNT; i++)
+        {
+            std::string key = std::to_string(i) + ".";
+            const std::size_t length = 8 + (rng() % (MAX_KEY_LENGTH - 7));
+            while (key.size() < length)
+            {
+                key.push_back(static_cast<char>('A' + (rng() % 26)));
+            }
+            out.push_back(key);
+        }
+        return out;
+    }();
+    return KEYS;
+}
+
+const std::vector<std::string>& queries()
+{
+    static const std::vector<std::string> QUERIES = []()
+    {
+        std::mt19937_64 rng{7};
+        std::vector<std::string> out{};
+        for (std::size_t i = 0; i < QUERY_COUNT; i++)
+        {
+            out.push_back(keys()[rng() % KEY_COUNT]);
+        }
+        return out;
+    }();
+    return QUERIES;
+}
+
+// Static, as the maps are too large for the stack.
+template <typename MapType>
+const std::array<MapType, MAP_COUNT>& filled_maps()
+{
+    static const std::array<MapType, MAP_COUNT> MAPS = []()
+    {
+        std::array<MapType, MAP_COUNT> out{};
+        for (std::size_t m = 0; m < MAP_COUNT; m++)
+        {
+            std::int64_t i = 0;
+            for (const std::string& key : keys())
+            {
+                out.at(m).try_emplace(std::string_view{key}, i * static_cast<std::int64_t>(m));
+                i++;
+            }
+        }
+        return out;
+    }();
+    return MAPS;
+}
+
+template <typename MapType>
+void benchmark_lookup_chain(benchmark::State& state)
+{
+    using KeyType = typename MapType::key_type;
+    const std::array<MapType, MAP_COUNT>& maps = filled_maps<MapType>();
+    for (auto _ : state)
+    {
+        std::int64_t sum = 0;
+        for (const std::string& query : queries())
+        {
+            // The key is built once per query; only HashedFixedString hashes it here.
+            const KeyType key{std::string_view{query}};
+            for (const MapType& map : maps)
+            {
+                sum += map.at(key);
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(QUERY_COUNT));
+}
+}  // namespace
+
+static void benchmark_lookup_chain_fixed_string(benchmark::State& state)
+{
+    benchmark_lookup_chain<FixedStringMapType>(state);
+}
+BENCHMARK(benchmark_lookup_chain_fixed_string);
+
+static void benchmark_lookup_chain_hashed_fixed_string(benchmark::State& state)
+{
+    benchmark_lookup_chain<HashedFixedStringMapType>(state);
+}
+BENCHMARK(benchmark_lookup_chain_hashed_fixed_string);
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
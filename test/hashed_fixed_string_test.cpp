@@ -0,0 +1,123 @@
+#include "fixed_containers/hashed_fixed_string.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_string.hpp"
+#include "fixed_containers/fixed_unordered_map.hpp"
+#include "fixed_containers/fixed_unordered_set.hpp"
+#include "fixed_containers/wyhash.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+namespace fixed_containers
+{
+namespace
+{
+using HashedFixedStringType = HashedFixedString<16>;
+static_assert(TriviallyCopyable<HashedFixedStringType>);
+static_assert(StandardLayout<HashedFixedStringType>);
+static_assert(IsStructuralType<HashedFixedStringType>);
+static_assert(std::contiguous_iterator<HashedFixedStringType::const_iterator>);
+
+constexpr std::uint64_t hash_of(std::string_view view)
+{
+    return wyhash::hash<std::string_view>{}(view);
+}
+}  // namespace
+
+TEST(HashedFixedString, DefaultConstructor)
+{
+    constexpr HashedFixedStringType S{};
+    static_assert(S.empty());
+    static_assert(S.max_size() == 16);
+    static_assert(S.hash() == hash_of(""));
+}
+
+TEST(HashedFixedString, HashMatchesStringViewHash)
+{
+    constexpr HashedFixedStringType S{"hello"};
+    static_assert(S == "hello");
+    static_assert(S.size() == 5);
+    static_assert(S.hash() == hash_of("hello"));
+    static_assert(wyhash::hash<HashedFixedStringType>{}(S) == hash_of("hello"));
+
+    const HashedFixedStringType from_fixed_string{FixedString<16>{"hello"}};
+    EXPECT_EQ(S, from_fixed_string);
+    EXPECT_EQ(S.hash(), from_fixed_string.hash());
+}
+
+TEST(HashedFixedString, MutationRecomputesHash)
+{
+    constexpr auto AFTER_MUTATIONS = []()
+    {
+        HashedFixedStringType s{"ab"};
+        s.push_back('c');
+        s += "de";
+        s += 'f';
+        s.append({'g', 'h'});
+        s.pop_back();
+        s.resize(8, 'x');
+        return s;
+    }();
+    static_assert(AFTER_MUTATIONS == "abcdefgx");
+    static_assert(AFTER_MUTATIONS.hash() == hash_of("abcdefgx"));
+
+    HashedFixedStringType s{"abc"};
+    s.assign("xyz");
+    EXPECT_EQ(hash_of("xyz"), s.hash());
+    s.assign(3, 'q');
+    EXPECT_EQ(hash_of("qqq"), s.hash());
+    s.clear();
+    EXPECT_EQ(hash_of(""), s.hash());
+}
+
+TEST(HashedFixedString, Comparison)
+{
+    static_assert(HashedFixedStringType{"abc"} == HashedFixedStringType{"abc"});
+    static_assert(HashedFixedStringType{"abc"} != HashedFixedStringType{"abd"});
+    static_assert(HashedFixedStringType{"abc"} == HashedFixedString<3>{"abc"});
+    static_assert(HashedFixedStringType{"abc"} < HashedFixedStringType{"abd"});
+    static_assert(HashedFixedStringType{"abc"} == std::string_view{"abc"});
+    static_assert(HashedFixedStringType{"b"} > "a");
+}
+
+TEST(HashedFixedString, ConstAccess)
+{
+    constexpr HashedFixedStringType S{"hello"};
+    static_assert(S[1] == 'e');
+    static_assert(S.at(4) == 'o');
+    static_assert(S.front() == 'h');
+    static_assert(S.back() == 'o');
+    static_assert(S.starts_with("he"));
+    static_assert(S.ends_with("lo"));
+    static_assert(S.substr(1, 3) == "ell");
+    static_assert(*S.crbegin() == 'o');
+    static_assert(S.str() == FixedString<16>{"hello"});
+
+    EXPECT_EQ(std::string{"hello"}, std::string{S.c_str()});
+    std::stringstream ss{};
+    ss << S;
+    EXPECT_EQ("hello", ss.str());
+}
+
+TEST(HashedFixedString, AsUnorderedMapKey)
+{
+    FixedUnorderedMap<HashedFixedStringType, int, 8> prices{};
+    FixedUnorderedSet<HashedFixedStringType, 8> halted{};
+    prices["AAPL"] = 1;
+    prices["MSFT"] = 2;
+    halted.insert("MSFT");
+
+    // One hash, several lookups
+    const HashedFixedStringType key{"MSFT"};
+    EXPECT_EQ(2, prices.at(key));
+    EXPECT_TRUE(halted.contains(key));
+    EXPECT_FALSE(halted.contains("AAPL"));
+    EXPECT_EQ(0, prices.count("GOOG"));
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,110 @@
+#include "fixed_containers/padded_enum_array.hpp"
+
+#include "enums_test_common.hpp"
+
+#include "fixed_containers/cache_line_padded.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/consteval_compare.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace fixed_containers
+{
+namespace
+{
+using TestEnum1 = rich_enums::TestEnum1;
+
+static_assert(TriviallyCopyable<PaddedEnumArray<TestEnum1, int>>);
+static_assert(IsStructuralType<PaddedEnumArray<TestEnum1, int>>);
+
+static_assert(consteval_compare::equal<CACHE_LINE_SIZE * 4,
+                                       sizeof(PaddedEnumArray<TestEnum1, std::uint64_t>)>);
+static_assert(consteval_compare::equal<CACHE_LINE_SIZE,
+                                       alignof(PaddedEnumArray<TestEnum1, std::uint64_t>)>);
+static_assert(consteval_compare::equal<16 * 4, sizeof(PaddedEnumArray<TestEnum1, char, 16>)>);
+}  // namespace
+
+TEST(PaddedEnumArray, DefaultConstructor)
+{
+    constexpr PaddedEnumArray<TestEnum1, int> s1{};
+    static_assert(consteval_compare::equal<4, s1.size()>);
+    static_assert(consteval_compare::equal<4, s1.max_size()>);
+    static_assert(!s1.empty());
+    static_assert(consteval_compare::equal<0, s1.at(TestEnum1::ONE)>);
+    static_assert(consteval_compare::equal<0, s1.at(TestEnum1::FOUR)>);
+}
+
+TEST(PaddedEnumArray, InitializerConstructor)
+{
+    constexpr PaddedEnumArray<TestEnum1, int> s1{{TestEnum1::TWO, 20}, {TestEnum1::FOUR, 40}};
+    static_assert(consteval_compare::equal<0, s1.at(TestEnum1::ONE)>);
+    static_assert(consteval_compare::equal<20, s1.at(TestEnum1::TWO)>);
+    static_assert(consteval_compare::equal<0, s1[TestEnum1::THREE]>);
+    static_assert(consteval_compare::equal<40, s1[TestEnum1::FOUR]>);
+}
+
+TEST(PaddedEnumArray, MutableAccess)
+{
+    constexpr PaddedEnumArray<TestEnum1, int> s1 = []()
+    {
+        PaddedEnumArray<TestEnum1, int> out{};
+        out[TestEnum1::ONE] = 1;
+        out.at(TestEnum1::THREE) = 3;
+        return out;
+    }();
+
+    static_assert(consteval_compare::equal<1, s1.at(TestEnum1::ONE)>);
+    static_assert(consteval_compare::equal<0, s1.at(TestEnum1::TWO)>);
+    static_assert(consteval_compare::equal<3, s1.at(TestEnum1::THREE)>);
+}
+
+TEST(PaddedEnumArray, Fill)
+{
+    constexpr PaddedEnumArray<TestEnum1, int> s1 = []()
+    {
+        PaddedEnumArray<TestEnum1, int> out{};
+        out.fill(7);
+        return out;
+    }();
+
+    static_assert(consteval_compare::equal<7, s1.at(TestEnum1::ONE)>);
+    static_assert(consteval_compare::equal<7, s1.at(TestEnum1::FOUR)>);
+}
+
+TEST(PaddedEnumArray, Equality)
+{
+    constexpr PaddedEnumArray<TestEnum1, int> s1{{TestEnum1::TWO, 20}};
+    constexpr PaddedEnumArray<TestEnum1, int> s2{{TestEnum1::TWO, 20}};
+    constexpr PaddedEnumArray<TestEnum1, int> s3{{TestEnum1::TWO, 21}};
+
+    static_assert(s1 == s2);
+    static_assert(s1 != s3);
+}
+
+TEST(PaddedEnumArray, Labels)
+{
+    constexpr PaddedEnumArray<TestEnum1, int> s1{};
+    static_assert(consteval_compare::equal<4, s1.labels().size()>);
+    static_assert(s1.labels()[0] == TestEnum1::ONE);
+    static_assert(s1.labels()[3] == TestEnum1::FOUR);
+}
+
+TEST(PaddedEnumArray, Atomics)
+{
+    PaddedEnumArray<TestEnum1, std::atomic<std::uint64_t>> s1{};
+    s1.at(TestEnum1::TWO).fetch_add(5);
+    s1[TestEnum1::TWO].fetch_add(2);
+    EXPECT_EQ(0, s1.at(TestEnum1::ONE).load());
+    EXPECT_EQ(7, s1.at(TestEnum1::TWO).load());
+
+    // Each element is on its own cache line
+    const auto* one = reinterpret_cast<const char*>(&s1.at(TestEnum1::ONE));
+    const auto* two = reinterpret_cast<const char*>(&s1.at(TestEnum1::TWO));
+    EXPECT_EQ(CACHE_LINE_SIZE, static_cast<std::size_t>(two - one));
+}
+
+}  // namespace fixed_containers
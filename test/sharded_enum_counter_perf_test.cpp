@@ -0,0 +1,97 @@
+#include "fixed_containers/enum_array.hpp"
+#include "fixed_containers/padded_enum_array.hpp"
+#include "fixed_containers/sharded_enum_counter.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace fixed_containers
+{
+namespace
+{
+enum class Venue
+{
+    VENUE_A,
+    VENUE_B,
+    VENUE_C,
+    VENUE_D,
+    VENUE_E,
+    VENUE_F,
+    VENUE_G,
+    VENUE_H,
+};
+
+// Each thread bumps a different venue, so all contention is false sharing.
+Venue venue_for_thread(const std::size_t thread_index)
+{
+    return static_cast<Venue>(thread_index % 8);
+}
+
+constexpr std::size_t SHARD_COUNT = 32;
+}  // namespace
+
+static void benchmark_enum_array_of_atomics(benchmark::State& state)
+{
+    static EnumArray<Venue, std::atomic<std::uint64_t>> counters{};
+    const Venue venue = venue_for_thread(static_cast<std::size_t>(state.thread_index()));
+    for (auto _ : state)
+    {
+        counters.at(venue).fetch_add(1, std::memory_order_relaxed);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void benchmark_padded_enum_array_of_atomics(benchmark::State& state)
+{
+    static PaddedEnumArray<Venue, std::atomic<std::uint64_t>> counters{};
+    const Venue venue = venue_for_thread(static_cast<std::size_t>(state.thread_index()));
+    for (auto _ : state)
+    {
+        counters.at(venue).fetch_add(1, std::memory_order_relaxed);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// All threads bump the same venue: true sharing, unless sharded.
+static void benchmark_enum_array_of_atomics_same_label(benchmark::State& state)
+{
+    static EnumArray<Venue, std::atomic<std::uint64_t>> counters{};
+    for (auto _ : state)
+    {
+        counters.at(Venue::VENUE_A).fetch_add(1, std::memory_order_relaxed);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void benchmark_sharded_enum_counter_same_label(benchmark::State& state)
+{
+    static ShardedEnumCounter<Venue, SHARD_COUNT> counters{};
+    for (auto _ : state)
+    {
+        counters.increment(Venue::VENUE_A);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void benchmark_sharded_enum_counter_load_all(benchmark::State& state)
+{
+    static ShardedEnumCounter<Venue, SHARD_COUNT> counters{};
+    counters.increment(Venue::VENUE_A);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(counters.load_all());
+    }
+}
+
+BENCHMARK(benchmark_enum_array_of_atomics)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(benchmark_padded_enum_array_of_atomics)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(benchmark_enum_array_of_atomics_same_label)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(benchmark_sharded_enum_counter_same_label)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(benchmark_sharded_enum_counter_load_all);
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
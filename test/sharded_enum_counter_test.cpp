@@ -0,0 +1,108 @@
+#include "fixed_containers/sharded_enum_counter.hpp"
+
+#include "enums_test_common.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/enum_array.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using TestEnum1 = rich_enums::TestEnum1;
+using CounterType = ShardedEnumCounter<TestEnum1, 4>;
+
+static_assert(NotCopyConstructible<CounterType>);
+static_assert(CounterType::shard_count() == 4);
+}  // namespace
+
+TEST(ShardedEnumCounter, DefaultConstructor)
+{
+    const CounterType s1{};
+    EXPECT_EQ(0, s1.load(TestEnum1::ONE));
+    EXPECT_EQ(0, s1.load(TestEnum1::FOUR));
+}
+
+TEST(ShardedEnumCounter, Increment)
+{
+    CounterType s1{};
+    s1.increment(TestEnum1::ONE);
+    s1.increment(TestEnum1::ONE);
+    s1.increment(TestEnum1::THREE, 10);
+
+    EXPECT_EQ(2, s1.load(TestEnum1::ONE));
+    EXPECT_EQ(0, s1.load(TestEnum1::TWO));
+    EXPECT_EQ(10, s1.load(TestEnum1::THREE));
+}
+
+TEST(ShardedEnumCounter, IncrementShardAggregates)
+{
+    CounterType s1{};
+    s1.increment_shard(0, TestEnum1::TWO, 1);
+    s1.increment_shard(1, TestEnum1::TWO, 2);
+    s1.increment_shard(3, TestEnum1::TWO, 4);
+    s1.increment_shard(3, TestEnum1::FOUR, 8);
+
+    EXPECT_EQ(7, s1.load(TestEnum1::TWO));
+
+    const EnumArray<TestEnum1, std::uint64_t> all = s1.load_all();
+    const EnumArray<TestEnum1, std::uint64_t> expected{{TestEnum1::TWO, 7}, {TestEnum1::FOUR, 8}};
+    EXPECT_EQ(expected, all);
+}
+
+TEST(ShardedEnumCounter, Reset)
+{
+    CounterType s1{};
+    s1.increment_shard(2, TestEnum1::TWO, 3);
+    s1.increment(TestEnum1::ONE);
+    s1.reset();
+    EXPECT_EQ(0, s1.load(TestEnum1::ONE));
+    EXPECT_EQ(0, s1.load(TestEnum1::TWO));
+}
+
+TEST(ShardedEnumCounter, ShardIndexIsStablePerThread)
+{
+    const std::size_t index = CounterType::this_thread_shard_index();
+    EXPECT_LT(index, CounterType::shard_count());
+    EXPECT_EQ(index, CounterType::this_thread_shard_index());
+}
+
+// Intended to also be run under ThreadSanitizer.
+TEST(ShardedEnumCounter, ConcurrentIncrements)
+{
+    static constexpr std::size_t THREAD_COUNT = 6;  // More threads than shards
+    static constexpr std::uint64_t INCREMENTS_PER_THREAD = 20'000;
+
+    CounterType s1{};
+    std::vector<std::thread> threads{};
+    for (std::size_t t = 0; t < THREAD_COUNT; t++)
+    {
+        threads.emplace_back(
+            [&s1]()
+            {
+                for (std::uint64_t i = 0; i < INCREMENTS_PER_THREAD; i++)
+                {
+                    s1.increment(TestEnum1::ONE);
+                    s1.increment(i % 2 == 0 ? TestEnum1::TWO : TestEnum1::THREE);
+                }
+            });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(THREAD_COUNT * INCREMENTS_PER_THREAD, s1.load(TestEnum1::ONE));
+    EXPECT_EQ(THREAD_COUNT * INCREMENTS_PER_THREAD / 2, s1.load(TestEnum1::TWO));
+    EXPECT_EQ(THREAD_COUNT * INCREMENTS_PER_THREAD / 2, s1.load(TestEnum1::THREE));
+    EXPECT_EQ(0, s1.load(TestEnum1::FOUR));
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,186 @@
+#include "fixed_containers/sort.hpp"
+
+#include "fixed_containers/fixed_vector.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+struct Fill
+{
+    std::int64_t price;
+    std::uint32_t quantity;
+    std::uint32_t venue;
+};
+
+// Branchy sorts look unrealistically fast when the branch predictor can learn a single input, so
+// iterations cycle through several random inputs (fewer for larger sizes, to bound memory).
+template <typename T, std::size_t N>
+const std::vector<FixedVector<T, N>>& random_inputs()
+{
+    static const std::vector<FixedVector<T, N>> INPUTS = []()
+    {
+        const std::size_t input_count = std::clamp<std::size_t>(65536 / N, 1, 64);
+        std::vector<FixedVector<T, N>> out(input_count);
+        std::mt19937_64 rng{N};
+        for (FixedVector<T, N>& input : out)
+        {
+            for (std::size_t i = 0; i < N; i++)
+            {
+                if constexpr (std::is_same_v<T, Fill>)
+                {
+                    input.push_back(
+                        Fill{.price = static_cast<std::int64_t>(rng() % 100'000) - 50'000,
+                             .quantity = static_cast<std::uint32_t>(rng()),
+                             .venue = static_cast<std::uint32_t>(i)});
+                }
+                else
+                {
+                    input.push_back(static_cast<T>(rng()));
+                }
+            }
+        }
+        return out;
+    }();
+    return INPUTS;
+}
+
+// Static, as the larger ones do not fit on the stack.
+template <typename T, std::size_t N>
+FixedVector<T, N>& working_copy()
+{
+    static FixedVector<T, N> instance{};
+    return instance;
+}
+
+// Every iteration sorts a fresh copy of one of the inputs. The copy is included in the timing of
+// all variants alike.
+template <typename T, std::size_t N, typename SortFunc>
+void run_sort_benchmark(benchmark::State& state, SortFunc&& sort_func)
+{
+    const std::vector<FixedVector<T, N>>& inputs = random_inputs<T, N>();
+    FixedVector<T, N>& v = working_copy<T, N>();
+    std::size_t next_input = 0;
+    for (auto _ : state)
+    {
+        v = inputs[next_input];
+        next_input = (next_input + 1) % inputs.size();
+        sort_func(v);
+        benchmark::DoNotOptimize(v.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(N));
+}
+}  // namespace
+
+template <typename T, std::size_t N>
+static void benchmark_std_sort(benchmark::State& state)
+{
+    run_sort_benchmark<T, N>(state, [](auto& v) { std::sort(v.begin(), v.end()); });
+}
+
+template <typename T, std::size_t N>
+static void benchmark_fixed_sort(benchmark::State& state)
+{
+    run_sort_benchmark<T, N>(state, [](auto& v) { sort(v); });
+}
+
+// Forces pdqsort (or the networks for small sizes), bypassing the radix sort
+template <typename T, std::size_t N>
+static void benchmark_fixed_sort_comparison_only(benchmark::State& state)
+{
+    run_sort_benchmark<T, N>(state, [](auto& v) { sort(v, [](T a, T b) { return a < b; }); });
+}
+
+template <typename T, std::size_t N>
+static void benchmark_fixed_radix_sort(benchmark::State& state)
+{
+    static FixedVector<T, N> scratch{};
+    run_sort_benchmark<T, N>(state, [](auto& v) { radix_sort(v, scratch); });
+}
+
+template <std::size_t N>
+static void benchmark_std_sort_by_key(benchmark::State& state)
+{
+    run_sort_benchmark<Fill, N>(state,
+                                [](auto& v)
+                                {
+                                    std::sort(v.begin(),
+                                              v.end(),
+                                              [](const Fill& a, const Fill& b)
+                                              { return a.price < b.price; });
+                                });
+}
+
+template <std::size_t N>
+static void benchmark_fixed_radix_sort_by_key(benchmark::State& state)
+{
+    static FixedVector<Fill, N> scratch{};
+    run_sort_benchmark<Fill, N>(state, [](auto& v) { radix_sort(v, scratch, &Fill::price); });
+}
+
+BENCHMARK(benchmark_std_sort<std::uint32_t, 8>);
+BENCHMARK(benchmark_std_sort<std::uint32_t, 16>);
+BENCHMARK(benchmark_std_sort<std::uint32_t, 32>);
+BENCHMARK(benchmark_std_sort<std::uint32_t, 256>);
+BENCHMARK(benchmark_std_sort<std::uint32_t, 4096>);
+BENCHMARK(benchmark_std_sort<std::uint32_t, 65536>);
+BENCHMARK(benchmark_std_sort<std::uint32_t, 1048576>);
+
+BENCHMARK(benchmark_fixed_sort<std::uint32_t, 8>);
+BENCHMARK(benchmark_fixed_sort<std::uint32_t, 16>);
+BENCHMARK(benchmark_fixed_sort<std::uint32_t, 32>);
+BENCHMARK(benchmark_fixed_sort<std::uint32_t, 256>);
+BENCHMARK(benchmark_fixed_sort<std::uint32_t, 4096>);
+BENCHMARK(benchmark_fixed_sort<std::uint32_t, 65536>);
+BENCHMARK(benchmark_fixed_sort<std::uint32_t, 1048576>);
+
+BENCHMARK(benchmark_fixed_sort_comparison_only<std::uint32_t, 8>);
+BENCHMARK(benchmark_fixed_sort_comparison_only<std::uint32_t, 16>);
+BENCHMARK(benchmark_fixed_sort_comparison_only<std::uint32_t, 32>);
+BENCHMARK(benchmark_fixed_sort_comparison_only<std::uint32_t, 256>);
+BENCHMARK(benchmark_fixed_sort_comparison_only<std::uint32_t, 4096>);
+BENCHMARK(benchmark_fixed_sort_comparison_only<std::uint32_t, 65536>);
+BENCHMARK(benchmark_fixed_sort_comparison_only<std::uint32_t, 1048576>);
+
+BENCHMARK(benchmark_fixed_radix_sort<std::uint32_t, 8>);
+BENCHMARK(benchmark_fixed_radix_sort<std::uint32_t, 16>);
+BENCHMARK(benchmark_fixed_radix_sort<std::uint32_t, 32>);
+BENCHMARK(benchmark_fixed_radix_sort<std::uint32_t, 256>);
+BENCHMARK(benchmark_fixed_radix_sort<std::uint32_t, 4096>);
+BENCHMARK(benchmark_fixed_radix_sort<std::uint32_t, 65536>);
+BENCHMARK(benchmark_fixed_radix_sort<std::uint32_t, 1048576>);
+
+BENCHMARK(benchmark_std_sort_by_key<8>);
+BENCHMARK(benchmark_std_sort_by_key<16>);
+BENCHMARK(benchmark_std_sort_by_key<32>);
+BENCHMARK(benchmark_std_sort_by_key<256>);
+BENCHMARK(benchmark_std_sort_by_key<4096>);
+BENCHMARK(benchmark_std_sort_by_key<65536>);
+BENCHMARK(benchmark_std_sort_by_key<1048576>);
+
+BENCHMARK(benchmark_fixed_radix_sort_by_key<8>);
+BENCHMARK(benchmark_fixed_radix_sort_by_key<16>);
+BENCHMARK(benchmark_fixed_radix_sort_by_key<32>);
+BENCHMARK(benchmark_fixed_radix_sort_by_key<256>);
+BENCHMARK(benchmark_fixed_radix_sort_by_key<4096>);
+BENCHMARK(benchmark_fixed_radix_sort_by_key<65536>);
+BENCHMARK(benchmark_fixed_radix_sort_by_key<1048576>);
+
+BENCHMARK(benchmark_std_sort<double, 4096>);
+BENCHMARK(benchmark_fixed_sort<double, 4096>);
+BENCHMARK(benchmark_fixed_radix_sort<double, 4096>);
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
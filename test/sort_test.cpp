@@ -0,0 +1,325 @@
+#include "fixed_containers/sort.hpp"
+
+#include "enums_test_common.hpp"
+
+#include "fixed_containers/enum_array.hpp"
+#include "fixed_containers/fixed_deque.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using TestEnum1 = rich_enums::TestEnum1;
+
+struct Order
+{
+    std::int64_t price;
+    int sequence;
+
+    constexpr bool operator==(const Order&) const = default;
+};
+
+static_assert(sort_detail::batcher_network_size(0) == 0);
+static_assert(sort_detail::batcher_network_size(2) == 1);
+static_assert(sort_detail::batcher_network_size(4) == 5);
+static_assert(sort_detail::batcher_network_size(8) == 19);
+static_assert(sort_detail::batcher_network_size(16) == 63);
+static_assert(sort_detail::batcher_network_size(32) == 191);
+
+template <typename T, std::size_t N>
+std::vector<T> to_std_vector(const FixedVector<T, N>& v)
+{
+    return {v.begin(), v.end()};
+}
+
+template <typename T, std::size_t N>
+void expect_sorts_like_std_sort(FixedVector<T, N> v)
+{
+    std::vector<T> expected = to_std_vector(v);
+    std::sort(expected.begin(), expected.end());
+    sort(v);
+    EXPECT_EQ(expected, to_std_vector(v));
+}
+}  // namespace
+
+TEST(Sort, Constexpr)
+{
+    constexpr FixedVector<int, 8> SMALL = []()
+    {
+        FixedVector<int, 8> v{5, 3, 8, 1, 7, 2};
+        sort(v);
+        return v;
+    }();
+    static_assert(SMALL == FixedVector<int, 8>{1, 2, 3, 5, 7, 8});
+
+    constexpr FixedVector<int, 64> LARGE = []()
+    {
+        FixedVector<int, 64> v{};
+        for (int i = 0; i < 50; i++)
+        {
+            v.push_back((i * 37) % 50);
+        }
+        sort(v, std::greater<>{});
+        return v;
+    }();
+    static_assert(LARGE.front() == 49);
+    static_assert(LARGE.back() == 0);
+    static_assert(std::is_sorted(LARGE.begin(), LARGE.end(), std::greater<>{}));
+
+    constexpr FixedVector<std::uint32_t, 300> RADIX = []()
+    {
+        FixedVector<std::uint32_t, 300> v{};
+        for (std::uint32_t i = 0; i < 300; i++)
+        {
+            v.push_back((i * 7919U) % 300U);
+        }
+        radix_sort(v);
+        return v;
+    }();
+    static_assert(std::is_sorted(RADIX.begin(), RADIX.end()));
+}
+
+// 0-1 principle: a comparator network sorts every input iff it sorts every 0/1 input.
+TEST(Sort, SortingNetworksSortAllZeroOneInputs)
+{
+    const auto check_size = [](auto size_constant)
+    {
+        constexpr std::size_t N = decltype(size_constant)::value;
+        for (std::uint32_t bits = 0; bits < (1U << N); bits++)
+        {
+            std::array<int, N> v{};
+            for (std::size_t i = 0; i < N; i++)
+            {
+                v[i] = static_cast<int>((bits >> i) & 1U);
+            }
+            std::less<> comp{};
+            sort_detail::network_sort<N>(v.begin(), comp);
+            ASSERT_TRUE(std::is_sorted(v.begin(), v.end())) << "N=" << N << " bits=" << bits;
+        }
+    };
+    [&]<std::size_t... NS>(std::index_sequence<NS...>)
+    {
+        (check_size(std::integral_constant<std::size_t, NS>{}), ...);
+    }(std::make_index_sequence<19>{});
+}
+
+TEST(Sort, AllSizesUpToCapacity)
+{
+    std::mt19937 rng{42};
+    std::uniform_int_distribution<int> dist{-1000, 1000};
+    for (std::size_t n = 0; n <= 100; n++)
+    {
+        FixedVector<int, 100> v{};
+        for (std::size_t i = 0; i < n; i++)
+        {
+            v.push_back(dist(rng));
+        }
+        expect_sorts_like_std_sort(v);
+    }
+}
+
+TEST(Sort, SmallCapacityUsesOnlyNetworksUpToCapacity)
+{
+    FixedVector<int, 5> v{4, 1, 3};
+    sort(v);
+    EXPECT_EQ((FixedVector<int, 5>{1, 3, 4}), v);
+}
+
+TEST(Sort, SmallFloatingPointWithInfinities)
+{
+    FixedVector<double, 16> v{3.0,
+                              std::numeric_limits<double>::infinity(),
+                              -1.5,
+                              std::numeric_limits<double>::max(),
+                              -std::numeric_limits<double>::infinity()};
+    sort(v);
+    EXPECT_EQ((FixedVector<double, 16>{-std::numeric_limits<double>::infinity(),
+                                       -1.5,
+                                       3.0,
+                                       std::numeric_limits<double>::max(),
+                                       std::numeric_limits<double>::infinity()}),
+              v);
+}
+
+TEST(Sort, PdqsortPatterns)
+{
+    constexpr std::size_t N = 5000;
+    const auto check = [](const auto& generate)
+    {
+        FixedVector<int, N> v{};
+        for (std::size_t i = 0; i < N; i++)
+        {
+            v.push_back(generate(static_cast<int>(i)));
+        }
+        std::vector<int> expected(v.begin(), v.end());
+        std::sort(expected.begin(), expected.end());
+        // Custom comparator, to bypass the radix sort
+        sort(v, [](int a, int b) { return a < b; });
+        EXPECT_EQ(expected, std::vector<int>(v.begin(), v.end()));
+    };
+    const int n = static_cast<int>(N);
+    check([](int i) { return i; });
+    check([n](int i) { return n - i; });
+    check([](int /*i*/) { return 7; });
+    check([](int i) { return i % 2; });
+    check([n](int i) { return i < n / 2 ? i : n - i; });
+    check([](int i) { return (i * 7919) % 1013; });
+    check([n](int i) { return i == n - 1 ? 0 : i + 1; });
+}
+
+TEST(Sort, CustomComparatorAndNonTrivialType)
+{
+    FixedVector<std::string, 40> v{};
+    for (int i = 0; i < 40; i++)
+    {
+        v.push_back(std::to_string((i * 13) % 40));
+    }
+    std::vector<std::string> expected(v.begin(), v.end());
+    std::sort(expected.begin(), expected.end(), std::greater<>{});
+    sort(v, std::greater<>{});
+    EXPECT_EQ(expected, std::vector<std::string>(v.begin(), v.end()));
+}
+
+TEST(Sort, RadixSortSignedAndFloatingPointKeys)
+{
+    std::mt19937 rng{7};
+    {
+        std::uniform_int_distribution<std::int64_t> dist{std::numeric_limits<std::int64_t>::min(),
+                                                         std::numeric_limits<std::int64_t>::max()};
+        FixedVector<std::int64_t, 2000> v{};
+        for (std::size_t i = 0; i < 2000; i++)
+        {
+            v.push_back(dist(rng));
+        }
+        expect_sorts_like_std_sort(v);
+    }
+    {
+        std::uniform_real_distribution<double> dist{-1e6, 1e6};
+        FixedVector<double, 2048> v{};
+        for (std::size_t i = 0; i < 2000; i++)
+        {
+            v.push_back(dist(rng));
+        }
+        v.push_back(std::numeric_limits<double>::infinity());
+        v.push_back(-std::numeric_limits<double>::infinity());
+        expect_sorts_like_std_sort(v);
+    }
+    {
+        std::uniform_real_distribution<float> dist{-10.0F, 10.0F};
+        FixedVector<float, 512> v{};
+        for (std::size_t i = 0; i < 512; i++)
+        {
+            v.push_back(dist(rng));
+        }
+        radix_sort(v);
+        EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+    }
+    {
+        FixedVector<std::int8_t, 300> v{};
+        for (int i = 0; i < 300; i++)
+        {
+            v.push_back(static_cast<std::int8_t>((i * 31) % 256 - 128));
+        }
+        expect_sorts_like_std_sort(v);
+    }
+}
+
+TEST(Sort, RadixSortWithKeyExtractorIsStable)
+{
+    FixedVector<Order, 64> v{};
+    for (int i = 0; i < 64; i++)
+    {
+        v.push_back({.price = (i * 5) % 4 - 2, .sequence = i});
+    }
+    radix_sort(v, &Order::price);
+
+    for (std::size_t i = 1; i < v.size(); i++)
+    {
+        EXPECT_LE(v[i - 1].price, v[i].price);
+        if (v[i - 1].price == v[i].price)
+        {
+            EXPECT_LT(v[i - 1].sequence, v[i].sequence);
+        }
+    }
+}
+
+TEST(Sort, RadixSortWithExternalScratch)
+{
+    static FixedVector<std::uint64_t, 100'000> v{};
+    static FixedVector<std::uint64_t, 100'000> scratch{};
+    std::mt19937_64 rng{3};
+    v.clear();
+    for (std::size_t i = 0; i < 100'000; i++)
+    {
+        v.push_back(rng());
+    }
+    radix_sort(v, scratch);
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+    EXPECT_EQ(100'000, v.size());
+}
+
+TEST(Sort, FixedDeque)
+{
+    FixedDeque<int, 100> v{};
+    for (int i = 0; i < 70; i++)
+    {
+        if (i % 2 == 0)
+        {
+            v.push_front((i * 17) % 70);
+        }
+        else
+        {
+            v.push_back((i * 17) % 70);
+        }
+    }
+    sort(v);
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+    EXPECT_EQ(0, v.front());
+    EXPECT_EQ(69, v.back());
+
+    FixedDeque<int, 8> small{3, 1, 2};
+    sort(small);
+    EXPECT_EQ((FixedDeque<int, 8>{1, 2, 3}), small);
+}
+
+TEST(Sort, EnumArray)
+{
+    static_assert(EnumArray<TestEnum1, int>::static_max_size() == 4);
+    EnumArray<TestEnum1, int> v{{TestEnum1::ONE, 40},
+                                {TestEnum1::TWO, 10},
+                                {TestEnum1::THREE, 30},
+                                {TestEnum1::FOUR, 20}};
+    sort(v);
+    EXPECT_EQ(10, v.at(TestEnum1::ONE));
+    EXPECT_EQ(20, v.at(TestEnum1::TWO));
+    EXPECT_EQ(30, v.at(TestEnum1::THREE));
+    EXPECT_EQ(40, v.at(TestEnum1::FOUR));
+}
+
+TEST(Sort, IteratorRange)
+{
+    std::array<int, 50> v{};
+    for (std::size_t i = 0; i < v.size(); i++)
+    {
+        v[i] = static_cast<int>((i * 23) % 50);
+    }
+    sort(v.begin() + 10, v.end());
+    EXPECT_TRUE(std::is_sorted(v.begin() + 10, v.end()));
+}
+
+}  // namespace fixed_containers
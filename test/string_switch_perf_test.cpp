@@ -0,0 +1,111 @@
+#include "fixed_containers/string_switch.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+// FIX-like message type names, with shared prefixes as in real protocols
+constexpr StringSwitch COMMANDS{
+    "Heartbeat",          "TestRequest",          "ResendRequest",       "Reject",
+    "SequenceReset",      "Logout",               "IOI",                 "Advertisement",
+    "ExecutionReport",    "OrderCancelReject",    "Logon",               "News",
+    "Email",              "NewOrderSingle",       "NewOrderList",        "OrderCancelRequest",
+    "OrderCancelReplace", "OrderStatusRequest",   "AllocationInstruction", "ListCancelRequest",
+    "ListExecute",        "ListStatusRequest",    "ListStatus",          "AllocationAck",
+    "DontKnowTrade",      "QuoteRequest",         "Quote",               "SettlementInstructions",
+    "MarketDataRequest",  "MarketDataSnapshot",   "MarketDataIncremental", "MarketDataReject",
+};
+constexpr std::size_t QUERY_COUNT = 4096;
+
+const std::vector<std::string>& queries()
+{
+    static const std::vector<std::string> QUERIES = []()
+    {
+        std::mt19937_64 rng{7};
+        std::vector<std::string> out{};
+        for (std::size_t i = 0; i < QUERY_COUNT; i++)
+        {
+            // One in eight tokens is unknown
+            const std::size_t index = rng() % (COMMANDS.size() + COMMANDS.size() / 8);
+            out.emplace_back(index < COMMANDS.size() ? COMMANDS[index].as_view()
+                                                     : std::string_view{"Unknown"});
+        }
+        return out;
+    }();
+    return QUERIES;
+}
+
+std::size_t find_with_if_else_chain(const std::string_view& token)
+{
+    for (std::size_t i = 0; i < COMMANDS.size(); i++)
+    {
+        if (token == COMMANDS[i].as_view())
+        {
+            return i;
+        }
+    }
+    return COMMANDS.NOT_FOUND;
+}
+
+template <typename Find>
+void benchmark_find(benchmark::State& state, const Find& find)
+{
+    for (auto _ : state)
+    {
+        std::size_t sum = 0;
+        for (const std::string& query : queries())
+        {
+            sum += find(std::string_view{query});
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(QUERY_COUNT));
+}
+}  // namespace
+
+static void benchmark_dispatch_if_else_chain(benchmark::State& state)
+{
+    benchmark_find(state, find_with_if_else_chain);
+}
+BENCHMARK(benchmark_dispatch_if_else_chain);
+
+static void benchmark_dispatch_std_unordered_map(benchmark::State& state)
+{
+    const std::unordered_map<std::string_view, std::size_t> map = []()
+    {
+        std::unordered_map<std::string_view, std::size_t> out{};
+        for (std::size_t i = 0; i < COMMANDS.size(); i++)
+        {
+            out.emplace(COMMANDS[i].as_view(), i);
+        }
+        return out;
+    }();
+    benchmark_find(state,
+                   [&map](const std::string_view& token)
+                   {
+                       const auto it = map.find(token);
+                       return it != map.end() ? it->second : COMMANDS.NOT_FOUND;
+                   });
+}
+BENCHMARK(benchmark_dispatch_std_unordered_map);
+
+static void benchmark_dispatch_string_switch(benchmark::State& state)
+{
+    benchmark_find(state, [](const std::string_view& token) { return COMMANDS.find(token); });
+}
+BENCHMARK(benchmark_dispatch_string_switch);
+
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -0,0 +1,106 @@
+#include "fixed_containers/string_switch.hpp"
+
+#include "fixed_containers/fixed_string.hpp"
+#include "fixed_containers/string_literal.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr StringSwitch MESSAGE_TYPES{"NEW", "CANCEL", "REPLACE", "STATUS", ""};
+static_assert(MESSAGE_TYPES.size() == 5);
+
+enum class Action
+{
+    SUBMIT,
+    CANCEL,
+    AMEND,
+    IGNORE,
+};
+
+constexpr Action action_of(const std::string_view& token)
+{
+    switch (MESSAGE_TYPES.find(token))
+    {
+    case MESSAGE_TYPES.case_index("NEW"):
+        return Action::SUBMIT;
+    case MESSAGE_TYPES.case_index("CANCEL"):
+        return Action::CANCEL;
+    case MESSAGE_TYPES.case_index("REPLACE"):
+        return Action::AMEND;
+    default:
+        return Action::IGNORE;
+    }
+}
+}  // namespace
+
+TEST(StringSwitch, Find)
+{
+    static_assert(MESSAGE_TYPES.find("NEW") == 0);
+    static_assert(MESSAGE_TYPES.find("CANCEL") == 1);
+    static_assert(MESSAGE_TYPES.find("REPLACE") == 2);
+    static_assert(MESSAGE_TYPES.find("STATUS") == 3);
+    static_assert(MESSAGE_TYPES.find("") == 4);
+    static_assert(MESSAGE_TYPES.find("NEWS") == MESSAGE_TYPES.NOT_FOUND);
+    static_assert(MESSAGE_TYPES.find("new") == MESSAGE_TYPES.NOT_FOUND);
+    static_assert(MESSAGE_TYPES[2].as_view() == "REPLACE");
+
+    EXPECT_EQ(1, MESSAGE_TYPES.find(std::string{"CANCEL"}));
+    EXPECT_EQ(3, MESSAGE_TYPES.find(FixedString<8>{"STATUS"}));
+    EXPECT_TRUE(MESSAGE_TYPES.contains(std::string_view{"NEW"}));
+    EXPECT_FALSE(MESSAGE_TYPES.contains(std::string_view{"CANCELLED"}));
+}
+
+TEST(StringSwitch, SwitchStatement)
+{
+    static_assert(action_of("NEW") == Action::SUBMIT);
+    static_assert(action_of("REPLACE") == Action::AMEND);
+    static_assert(action_of("STATUS") == Action::IGNORE);
+    static_assert(action_of("bogus") == Action::IGNORE);
+
+    EXPECT_EQ(Action::CANCEL, action_of(std::string{"CANCEL"}));
+}
+
+TEST(StringSwitch, StringLiteralCases)
+{
+    static constexpr StringLiteral BUY = "BUY";
+    static constexpr StringLiteral SELL = "SELL";
+    constexpr StringSwitch SIDES{BUY, SELL};
+    static_assert(SIDES.find("SELL") == 1);
+    static_assert(SIDES.find("BUY") == 0);
+    static_assert(SIDES.find("SHORT") == SIDES.NOT_FOUND);
+}
+
+TEST(StringSwitch, SingleCase)
+{
+    constexpr StringSwitch ONE{"only"};
+    static_assert(ONE.find("only") == 0);
+    static_assert(ONE.find("other") == ONE.NOT_FOUND);
+}
+
+TEST(StringSwitch, ManyCases)
+{
+    // Similar tokens, to exercise collisions in the first-level buckets
+    constexpr StringSwitch MANY{
+        "a0",  "a1",  "a2",  "a3",  "a4",  "a5",  "a6",  "a7",  "a8",  "a9",  "b0",  "b1",
+        "b2",  "b3",  "b4",  "b5",  "b6",  "b7",  "b8",  "b9",  "c0",  "c1",  "c2",  "c3",
+        "c4",  "c5",  "c6",  "c7",  "c8",  "c9",  "d0",  "d1",  "d2",  "d3",  "d4",  "d5",
+        "d6",  "d7",  "d8",  "d9",  "aa0", "aa1", "aa2", "aa3", "aa4", "aa5", "aa6", "aa7",
+        "aa8", "aa9", "bb0", "bb1", "bb2", "bb3", "bb4", "bb5", "bb6", "bb7", "bb8", "bb9",
+    };
+    static_assert(MANY.size() == 60);
+    for (std::size_t i = 0; i < MANY.size(); i++)
+    {
+        EXPECT_EQ(i, MANY.find(MANY[i]));
+    }
+    EXPECT_EQ(MANY.NOT_FOUND, MANY.find("e0"));
+    EXPECT_EQ(MANY.NOT_FOUND, MANY.find("aa"));
+}
+
+}  // namespace fixed_containers